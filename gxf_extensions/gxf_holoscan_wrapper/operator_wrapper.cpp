@@ -304,6 +304,10 @@ gxf_result_t OperatorWrapper::start() {
     return GXF_FAILURE;
   }
   op_->start();
+
+  exec_context_ = std::make_unique<GXFExecutionContext>(context(), op_.get());
+  exec_context_->gxf_input()->cache_connectors();
+  exec_context_->gxf_output()->cache_connectors();
   return GXF_SUCCESS;
 }
 
@@ -316,10 +320,12 @@ gxf_result_t OperatorWrapper::tick() {
 
   HOLOSCAN_LOG_TRACE("Calling operator: {}", op_->name());
 
-  GXFExecutionContext exec_context(context(), op_.get());
-  InputContext* op_input = exec_context.input();
-  OutputContext* op_output = exec_context.output();
-  op_->compute(*op_input, *op_output, exec_context);
+  if (!exec_context_) {
+    exec_context_ = std::make_unique<GXFExecutionContext>(context(), op_.get());
+  }
+  InputContext* op_input = exec_context_->input();
+  OutputContext* op_output = exec_context_->output();
+  op_->compute(*op_input, *op_output, *exec_context_);
 
   return GXF_SUCCESS;
 }
@@ -331,6 +337,7 @@ gxf_result_t OperatorWrapper::stop() {
     return GXF_FAILURE;
   }
   op_->stop();
+  exec_context_.reset();
   return GXF_SUCCESS;
 }
 
@@ -21,6 +21,7 @@
 #include <list>
 #include <memory>
 
+#include "holoscan/core/gxf/gxf_execution_context.hpp"
 #include "holoscan/core/operator.hpp"
 #include "holoscan/core/parameter.hpp"
 #include "operator_wrapper_fragment.hpp"
@@ -66,6 +67,8 @@ class OperatorWrapper : public nvidia::gxf::Codelet {
   std::shared_ptr<Operator> op_;        ///< The Operator to wrap.
   OperatorWrapperFragment fragment_;    ///< The fragment to use for the Operator.
   std::list<GXFParameter> parameters_;  ///< The parameters to use for the GXF Codelet.
+  /// The execution context created at start and reused on each tick.
+  std::unique_ptr<GXFExecutionContext> exec_context_;
 };
 
 }  // namespace holoscan::gxf
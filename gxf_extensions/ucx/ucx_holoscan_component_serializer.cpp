@@ -18,6 +18,7 @@
 #include "ucx_holoscan_component_serializer.hpp"
 
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <string>
 #include <thread>
@@ -50,6 +51,9 @@ Expected<void> UcxHoloscanComponentSerializer::configureSerializers() {
   result &= setSerializer<holoscan::Message>([this](void* component, Endpoint* endpoint) {
     return serializeHoloscanMessage(*static_cast<holoscan::Message*>(component), endpoint);
   });
+  result &= setSerializer<holoscan::MessageLabel>([](void* component, Endpoint* endpoint) {
+    return serializeMessageLabel(*static_cast<holoscan::MessageLabel*>(component), endpoint);
+  });
   return result;
 }
 
@@ -59,6 +63,10 @@ Expected<void> UcxHoloscanComponentSerializer::configureDeserializers() {
     return deserializeHoloscanMessage(endpoint).assign_to(
         *static_cast<holoscan::Message*>(component));
   });
+  result &= setDeserializer<holoscan::MessageLabel>([](void* component, Endpoint* endpoint) {
+    return deserializeMessageLabel(endpoint).assign_to(
+        *static_cast<holoscan::MessageLabel*>(component));
+  });
   return result;
 }
 
@@ -66,9 +74,40 @@ Expected<size_t> UcxHoloscanComponentSerializer::serializeHoloscanMessage(
     const holoscan::Message& message, Endpoint* endpoint) {
   GXF_LOG_DEBUG("UcxHoloscanComponentSerializer::serializeHoloscanMessage");
 
-  // retrieve the name of the codec corresponding to the data in the Message
   auto index = std::type_index(message.value().type());
   auto& registry = holoscan::CodecRegistry::get_instance();
+
+  // fast path: the codec has an ID in the table negotiated between the fragments
+  uint32_t wire_id = registry.wire_codec_id(index);
+  if (wire_id != holoscan::CodecRegistry::kInvalidWireCodecId) {
+    const auto* codec = registry.get_codec(wire_id);
+    if (codec != nullptr) {
+      // write the tag and the ID in a single call (the ID is narrowed to 16 bits when possible)
+      uint8_t buffer[sizeof(uint8_t) + sizeof(uint32_t)];
+      size_t buffer_size = sizeof(uint8_t);
+      if (wire_id <= std::numeric_limits<uint16_t>::max()) {
+        buffer[0] = static_cast<uint8_t>(HoloscanMessageCodecTag::kId16);
+        uint16_t wire_id16 = static_cast<uint16_t>(wire_id);
+        std::memcpy(buffer + buffer_size, &wire_id16, sizeof(wire_id16));
+        buffer_size += sizeof(wire_id16);
+      } else {
+        buffer[0] = static_cast<uint8_t>(HoloscanMessageCodecTag::kId32);
+        std::memcpy(buffer + buffer_size, &wire_id, sizeof(wire_id));
+        buffer_size += sizeof(wire_id);
+      }
+      size_t total_size = 0;
+      auto maybe_size = endpoint->write(buffer, buffer_size);
+      if (!maybe_size) { return ForwardError(maybe_size); }
+      total_size += maybe_size.value();
+
+      maybe_size = codec->first(message, endpoint);
+      if (!maybe_size) { return ForwardError(maybe_size); }
+      total_size += maybe_size.value();
+      return total_size;
+    }
+  }
+
+  // fallback: retrieve the name of the codec corresponding to the data in the Message
   auto maybe_name = registry.index_to_name(index);
   if (!maybe_name) {
     GXF_LOG_ERROR("No codec found for type_index with name: %s", index.name());
@@ -77,11 +116,15 @@ Expected<size_t> UcxHoloscanComponentSerializer::serializeHoloscanMessage(
   std::string codec_name = maybe_name.value();
 
   // serialize the codec_name of the holoscan::Message codec to retrieve
+  size_t total_size = 0;
+  auto tag = HoloscanMessageCodecTag::kName;
+  auto maybe_size = endpoint->writeTrivialType<HoloscanMessageCodecTag>(&tag);
+  if (!maybe_size) { return ForwardError(maybe_size); }
+  total_size += maybe_size.value();
   holoscan::ContiguousDataHeader header;
   header.size = codec_name.size();
   header.bytes_per_element = header.size > 0 ? sizeof(codec_name[0]) : 1;
-  size_t total_size = 0;
-  auto maybe_size = endpoint->writeTrivialType<holoscan::ContiguousDataHeader>(&header);
+  maybe_size = endpoint->writeTrivialType<holoscan::ContiguousDataHeader>(&header);
   if (!maybe_size) { return ForwardError(maybe_size); }
   total_size += maybe_size.value();
   maybe_size = endpoint->write(codec_name.data(), header.size * header.bytes_per_element);
@@ -100,6 +143,39 @@ Expected<holoscan::Message> UcxHoloscanComponentSerializer::deserializeHoloscanM
     Endpoint* endpoint) {
   GXF_LOG_DEBUG("UcxHoloscanComponentSerializer::deserializeHoloscanMessage");
 
+  auto& registry = holoscan::CodecRegistry::get_instance();
+
+  HoloscanMessageCodecTag tag;
+  auto tag_size = endpoint->readTrivialType<HoloscanMessageCodecTag>(&tag);
+  if (!tag_size) { return ForwardError(tag_size); }
+
+  switch (tag) {
+    case HoloscanMessageCodecTag::kId16:
+    case HoloscanMessageCodecTag::kId32: {
+      uint32_t wire_id = 0;
+      if (tag == HoloscanMessageCodecTag::kId16) {
+        uint16_t wire_id16 = 0;
+        auto result = endpoint->readTrivialType<uint16_t>(&wire_id16);
+        if (!result) { return ForwardError(result); }
+        wire_id = wire_id16;
+      } else {
+        auto result = endpoint->readTrivialType<uint32_t>(&wire_id);
+        if (!result) { return ForwardError(result); }
+      }
+      const auto* codec = registry.get_codec(wire_id);
+      if (codec == nullptr) {
+        GXF_LOG_ERROR("No codec found for wire codec ID: %u", wire_id);
+        return Unexpected{GXF_FAILURE};
+      }
+      return codec->second(endpoint);
+    }
+    case HoloscanMessageCodecTag::kName:
+      break;
+    default:
+      GXF_LOG_ERROR("Invalid holoscan::Message codec tag: %u", static_cast<unsigned int>(tag));
+      return Unexpected{GXF_FAILURE};
+  }
+
   // deserialize the type_name of the holoscan::Message codec to retrieve
   holoscan::ContiguousDataHeader header;
   auto header_size = endpoint->readTrivialType<holoscan::ContiguousDataHeader>(&header);
@@ -110,10 +186,33 @@ Expected<holoscan::Message> UcxHoloscanComponentSerializer::deserializeHoloscanM
   if (!result) { return ForwardError(result); }
 
   // deserialize the message contents
-  auto& registry = holoscan::CodecRegistry::get_instance();
   auto deserialize_func = registry.get_deserializer(codec_name);
   return deserialize_func(endpoint);
 }
 
+Expected<size_t> UcxHoloscanComponentSerializer::serializeMessageLabel(
+    const holoscan::MessageLabel& label, Endpoint* endpoint) {
+  GXF_LOG_DEBUG("UcxHoloscanComponentSerializer::serializeMessageLabel");
+  holoscan::Endpoint holoscan_endpoint(endpoint);
+  auto maybe_size = holoscan::codec<holoscan::MessageLabel>::serialize(label, &holoscan_endpoint);
+  if (!maybe_size) {
+    GXF_LOG_ERROR("Failed to serialize MessageLabel: %s", maybe_size.error().what());
+    return Unexpected{GXF_FAILURE};
+  }
+  return maybe_size.value();
+}
+
+Expected<holoscan::MessageLabel> UcxHoloscanComponentSerializer::deserializeMessageLabel(
+    Endpoint* endpoint) {
+  GXF_LOG_DEBUG("UcxHoloscanComponentSerializer::deserializeMessageLabel");
+  holoscan::Endpoint holoscan_endpoint(endpoint);
+  auto maybe_label = holoscan::codec<holoscan::MessageLabel>::deserialize(&holoscan_endpoint);
+  if (!maybe_label) {
+    GXF_LOG_ERROR("Failed to deserialize MessageLabel: %s", maybe_label.error().what());
+    return Unexpected{GXF_FAILURE};
+  }
+  return std::move(maybe_label.value());
+}
+
 }  // namespace gxf
 }  // namespace nvidia
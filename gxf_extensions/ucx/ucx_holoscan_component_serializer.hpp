@@ -18,6 +18,7 @@
 #ifndef NVIDIA_GXF_SERIALIZATION_UCX_HOLOSCAN_COMPONENT_SERIALIZER_HPP_
 #define NVIDIA_GXF_SERIALIZATION_UCX_HOLOSCAN_COMPONENT_SERIALIZER_HPP_
 
+#include <cstdint>
 #include <string>
 
 // #include "common/endian.hpp"
@@ -26,10 +27,21 @@
 #include "gxf/std/tensor.hpp"
 #include "holoscan/core/codec_registry.hpp"
 #include "holoscan/core/message.hpp"
+#include "holoscan/core/messagelabel.hpp"
 
 namespace nvidia {
 namespace gxf {
 
+// Tag written in front of every serialized holoscan::Message to indicate how the codec is
+// identified. Numeric IDs refer to the codec table negotiated by the app driver (see
+// holoscan::CodecRegistry::set_wire_codec_table). The codec name is used as a fallback whenever
+// the type has no entry in the negotiated table.
+enum class HoloscanMessageCodecTag : uint8_t {
+  kName = 0,   // ContiguousDataHeader followed by the codec name
+  kId16 = 1,   // 16-bit wire codec ID
+  kId32 = 2,   // 32-bit wire codec ID
+};
+
 // Serializer that supports serializaing Timestamps, Tensors, Video Buffer,
 // Audio Buffer and integer components
 // Valid for sharing data between devices with the same endianness
@@ -48,6 +60,11 @@ class UcxHoloscanComponentSerializer : public ComponentSerializer {
   Expected<size_t> serializeHoloscanMessage(const holoscan::Message& message, Endpoint* endpoint);
   // Deserializes a holoscan::Message
   Expected<holoscan::Message> deserializeHoloscanMessage(Endpoint* endpoint);
+  // Serializes a holoscan::MessageLabel (Data Flow Tracking)
+  static Expected<size_t> serializeMessageLabel(const holoscan::MessageLabel& label,
+                                                Endpoint* endpoint);
+  // Deserializes a holoscan::MessageLabel (Data Flow Tracking)
+  static Expected<holoscan::MessageLabel> deserializeMessageLabel(Endpoint* endpoint);
 
   Parameter<Handle<Allocator>> allocator_;
 };
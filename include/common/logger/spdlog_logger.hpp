@@ -18,6 +18,8 @@
 #ifndef COMMON_LOGGER_SPDLOG_LOGGER_HPP
 #define COMMON_LOGGER_SPDLOG_LOGGER_HPP
 
+#include <chrono>
+#include <cstddef>
 #include <cstdio>
 #include <memory>
 #include <string>
@@ -30,6 +32,16 @@ namespace nvidia {
 /// Namespace for the NVIDIA logger functionality.
 namespace logger {
 
+/// Origin of a message logged on behalf of another thread (e.g., by an asynchronous logging
+/// thread).
+///
+/// A pointer to this structure can be passed as the `arg` argument of `Logger::log()` so that the
+/// time and thread id printed for the message are the ones of the original log call.
+struct LogMessageOrigin {
+  std::chrono::system_clock::time_point time;  ///< time of the log call
+  size_t thread_id = 0;                        ///< OS thread id of the thread that logged it
+};
+
 class SpdlogLogger : public Logger {
  public:
   /// Create a logger with the given name.
@@ -20,6 +20,8 @@
 
 #include <future>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <queue>
 #include <string>
 #include <unordered_map>
@@ -173,6 +175,23 @@ class AppDriver {
 
   void submit_message(DriverMessage&& message);
 
+  /**
+   * @brief Add the codec names reported by a worker to the wire codec table negotiation.
+   *
+   * The wire codec table is the sorted intersection of the codec names of all workers. Codecs in
+   * the table are identified by their (numeric) index when messages are sent between fragments.
+   *
+   * @param codec_names The sorted codec names registered in the worker's CodecRegistry.
+   */
+  void add_worker_codec_names(const std::vector<std::string>& codec_names);
+
+  /**
+   * @brief Get the wire codec table negotiated with all workers.
+   *
+   * @return The sorted codec names shared by all workers (empty if no worker reported any).
+   */
+  std::vector<std::string> wire_codec_table();
+
   void process_message_queue();
 
  private:
@@ -198,6 +217,9 @@ class AppDriver {
   /// `connection_map_` is initialized with the default IP (0.0.0.0) and port (zero-based index).
   /// This function corrects the connection map by replacing the default IP and port with the
   /// real IP and port (using index_to_ip_map_ and index_to_port_map_).
+  /// If the `HOLOSCAN_SHM_TRANSPORT` environment variable is set to true, connections whose source
+  /// and target fragments have the same IP (index_to_source_ip_map_) use a shared memory
+  /// connector (IOSpec::ConnectorType::kSharedMemory) instead of UCX.
   void correct_connection_map();
 
   /// Connect target fragments with UCX connector.
@@ -267,6 +289,10 @@ class AppDriver {
   /// Maps port indices to their IP addresses (initially set to the fragment name).
   std::unordered_map<int32_t, std::string> index_to_ip_map_;
 
+  /// Maps port indices to the IP addresses of the source fragments (initially set to the source
+  /// fragment name).
+  std::unordered_map<int32_t, std::string> index_to_source_ip_map_;
+
   /// Maps port indices to real port numbers (initially set to 0).
   std::unordered_map<int32_t, uint32_t> index_to_port_map_;
 
@@ -280,6 +306,10 @@ class AppDriver {
   /// application. Unused when running an application locally.
   std::unique_ptr<MultipleFragmentsPortMap> all_fragment_port_map_ =
       std::make_unique<MultipleFragmentsPortMap>();
+
+  std::mutex codec_table_mutex_;  ///< Mutex for the wire codec table.
+  /// Codec names shared by all workers (std::nullopt until the first worker reports its codecs).
+  std::optional<std::vector<std::string>> wire_codec_names_;
 };
 
 }  // namespace holoscan
@@ -284,6 +284,8 @@ class Application : public Fragment {
 
   std::future<void> run_async() override;
 
+  std::vector<OperatorStatsSnapshot> operator_stats() override;
+
  protected:
   friend class AppDriver;
   friend class AppWorker;
@@ -338,6 +340,27 @@ class Application : public Fragment {
    */
   static void set_scheduler_for_fragments(std::vector<FragmentNodeType>& target_fragments);
 
+  /**
+   * @brief Make the work-stealing schedulers of the fragments share their worker threads.
+   *
+   * When several fragments running in the same process use a `holoscan::WorkStealingScheduler`
+   * (without an explicit `shared_pool`), their schedulers are attached to a shared worker pool
+   * sized for the CPUs of the host instead of each creating its own worker threads. The priority
+   * and quota of each fragment in the pool can be set with the `pool_priority` and
+   * `pool_max_workers` arguments of its scheduler.
+   *
+   * If the environment variable `HOLOSCAN_FRAGMENT_NUMA_PLACEMENT` is true and the host has
+   * several NUMA nodes, the fragments are assigned to NUMA nodes (see
+   * `GreedyFragmentAllocationStrategy::assign_numa_nodes()`) and the fragments of a node share
+   * a pool whose workers are pinned to that node.
+   *
+   * Setting the environment variable `HOLOSCAN_SHARED_WORKER_POOL` to false disables the
+   * sharing.
+   *
+   * @param target_fragments The fragments running in the process.
+   */
+  static void set_shared_worker_pools(std::vector<FragmentNodeType>& target_fragments);
+
   std::string app_description_{};     ///< The description of the application.
   std::string app_version_{"0.0.0"};  ///< The version of the application.
 
@@ -0,0 +1,396 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_CODEC_FIELDS_HPP
+#define HOLOSCAN_CORE_CODEC_FIELDS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "./codecs.hpp"
+#include "./endpoint.hpp"
+#include "./errors.hpp"
+#include "./expected.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Field list of an aggregate type used to generate its codec.
+ *
+ * This template is specialized by the HOLOSCAN_CODEC_FIELDS macro. A specialization provides:
+ *
+ * - `static constexpr const char* name`: the codec name of the type.
+ * - `static constexpr auto members()`: a tuple of pointers to the data members to serialize.
+ */
+template <typename typeT>
+struct codec_fields;
+
+/// True if HOLOSCAN_CODEC_FIELDS was used for typeT.
+template <typename typeT, typename = void>
+struct has_codec_fields : std::false_type {};
+
+template <typename typeT>
+struct has_codec_fields<typeT, std::void_t<decltype(codec_fields<typeT>::members())>>
+    : std::true_type {};
+
+template <typename typeT>
+inline constexpr bool has_codec_fields_v = has_codec_fields<typeT>::value;
+
+namespace detail {
+
+template <typename memberT>
+struct member_pointer_traits;
+
+template <typename classT, typename fieldT>
+struct member_pointer_traits<fieldT classT::*> {
+  using field_type = std::remove_cv_t<fieldT>;
+};
+
+template <typename memberT>
+using member_field_t = typename member_pointer_traits<memberT>::field_type;
+
+// Pointers are trivially copyable, but the address they hold is meaningless once sent to another
+// process, so pointer fields (including arrays of pointers) are rejected.
+template <typename fieldT>
+struct is_value_field
+    : std::bool_constant<!std::is_pointer_v<fieldT> && !std::is_member_pointer_v<fieldT> &&
+                         !std::is_null_pointer_v<fieldT>> {};
+
+template <typename elementT, size_t N>
+struct is_value_field<elementT[N]> : is_value_field<std::remove_cv_t<elementT>> {};
+
+template <typename elementT, size_t N>
+struct is_value_field<std::array<elementT, N>> : is_value_field<std::remove_cv_t<elementT>> {};
+
+template <typename fieldT>
+inline constexpr bool is_value_field_v = is_value_field<fieldT>::value;
+
+// Fields of trivially copyable value types are merged into runs that are written/read with a
+// single endpoint call. Other fields (strings, vectors, nested types with their own codec) are
+// serialized with codec<fieldT>.
+template <typename fieldT>
+inline constexpr bool is_bulk_field_v =
+    std::is_trivially_copyable_v<fieldT> && is_value_field_v<fieldT>;
+
+template <typename tupleT>
+struct all_value_fields;
+
+template <typename... memberT>
+struct all_value_fields<std::tuple<memberT...>>
+    : std::bool_constant<(is_value_field_v<member_field_t<memberT>> && ...)> {};
+
+// Upper bound of the size of a run of trivially copyable fields (at least 1 byte).
+template <typename tupleT>
+struct bulk_capacity;
+
+template <typename... memberT>
+struct bulk_capacity<std::tuple<memberT...>> {
+  static constexpr size_t value = std::max<size_t>(
+      1,
+      (size_t{0} + ... +
+       (is_bulk_field_v<member_field_t<memberT>> ? sizeof(member_field_t<memberT>) : size_t{0})));
+};
+
+}  // namespace detail
+
+/**
+ * @brief Codec generated from the field list of an aggregate type.
+ *
+ * Consecutive fields of trivially copyable types are copied into a staging buffer and written
+ * with a single call to Endpoint::write (and read back with a single Endpoint::read). Other
+ * fields are serialized in order with their own codec, so nested std::string, std::vector or
+ * other types declared with HOLOSCAN_CODEC_FIELDS are handled recursively.
+ *
+ * The type must be default constructible and its fields must hold values: pointer fields are
+ * rejected at compile time, and a trivially copyable nested type is copied bytewise, so it must
+ * not hold pointers either.
+ */
+template <typename typeT>
+struct fields_codec {
+  using members_type = decltype(codec_fields<typeT>::members());
+  static_assert(detail::all_value_fields<members_type>::value,
+                "fields_codec: pointer fields cannot be serialized");
+  static constexpr size_t kBulkCapacity = detail::bulk_capacity<members_type>::value;
+
+  static expected<size_t, RuntimeError> serialize(const typeT& value, Endpoint* endpoint) {
+    std::array<uint8_t, kBulkCapacity> run;
+    size_t run_size = 0;
+    size_t total_size = 0;
+    std::optional<RuntimeError> error;
+
+    auto flush = [&]() {
+      if (run_size == 0) { return true; }
+      auto maybe_size = endpoint->write(run.data(), run_size);
+      if (!maybe_size) {
+        error = maybe_size.error();
+        return false;
+      }
+      total_size += maybe_size.value();
+      run_size = 0;
+      return true;
+    };
+
+    auto process = [&](auto member) {
+      using fieldT = detail::member_field_t<decltype(member)>;
+      const auto& field = value.*member;
+      if constexpr (detail::is_bulk_field_v<fieldT>) {
+        std::memcpy(run.data() + run_size, &field, sizeof(fieldT));
+        run_size += sizeof(fieldT);
+        return true;
+      } else {
+        if (!flush()) { return false; }
+        auto maybe_size = codec<fieldT>::serialize(field, endpoint);
+        if (!maybe_size) {
+          error = maybe_size.error();
+          return false;
+        }
+        total_size += maybe_size.value();
+        return true;
+      }
+    };
+
+    bool success = std::apply([&](auto... member) { return (process(member) && ...); },
+                              codec_fields<typeT>::members());
+    if (success) { success = flush(); }
+    if (!success) { return make_unexpected<RuntimeError>(std::move(error.value())); }
+    return total_size;
+  }
+
+  static expected<typeT, RuntimeError> deserialize(Endpoint* endpoint) {
+    typeT value{};
+    std::array<uint8_t, kBulkCapacity> run;
+    // destinations of the trivially copyable fields of the current run
+    std::array<std::pair<void*, size_t>, std::tuple_size_v<members_type>> pending;
+    size_t num_pending = 0;
+    size_t run_size = 0;
+    std::optional<RuntimeError> error;
+
+    auto flush = [&]() {
+      if (run_size == 0) { return true; }
+      auto maybe_size = endpoint->read(run.data(), run_size);
+      if (!maybe_size) {
+        error = maybe_size.error();
+        return false;
+      }
+      size_t offset = 0;
+      for (size_t i = 0; i < num_pending; ++i) {
+        std::memcpy(pending[i].first, run.data() + offset, pending[i].second);
+        offset += pending[i].second;
+      }
+      num_pending = 0;
+      run_size = 0;
+      return true;
+    };
+
+    auto process = [&](auto member) {
+      using fieldT = detail::member_field_t<decltype(member)>;
+      auto& field = value.*member;
+      if constexpr (detail::is_bulk_field_v<fieldT>) {
+        pending[num_pending++] = {static_cast<void*>(&field), sizeof(fieldT)};
+        run_size += sizeof(fieldT);
+        return true;
+      } else {
+        if (!flush()) { return false; }
+        auto maybe_field = codec<fieldT>::deserialize(endpoint);
+        if (!maybe_field) {
+          error = maybe_field.error();
+          return false;
+        }
+        field = std::move(maybe_field.value());
+        return true;
+      }
+    };
+
+    bool success = std::apply([&](auto... member) { return (process(member) && ...); },
+                              codec_fields<typeT>::members());
+    if (success) { success = flush(); }
+    if (!success) { return make_unexpected<RuntimeError>(std::move(error.value())); }
+    return value;
+  }
+};
+
+/**
+ * @brief Codec for a vector of a type declared with HOLOSCAN_CODEC_FIELDS.
+ *
+ * Vectors of trivially copyable types are sent as a single binary blob. Otherwise, each element
+ * is serialized with fields_codec.
+ */
+template <typename typeT>
+struct fields_vector_codec {
+  static expected<size_t, RuntimeError> serialize(const std::vector<typeT>& value,
+                                                  Endpoint* endpoint) {
+    if constexpr (std::is_trivially_copyable_v<typeT>) {
+      return serialize_binary_blob<std::vector<typeT>>(value, endpoint);
+    } else {
+      return serialize_vector_of_vectors<std::vector<typeT>>(value, endpoint);
+    }
+  }
+  static expected<std::vector<typeT>, RuntimeError> deserialize(Endpoint* endpoint) {
+    if constexpr (std::is_trivially_copyable_v<typeT>) {
+      return deserialize_binary_blob<std::vector<typeT>>(endpoint);
+    } else {
+      return deserialize_vector_of_vectors<std::vector<typeT>>(endpoint);
+    }
+  }
+};
+
+}  // namespace holoscan
+
+// Helper macros applying a macro to each of up to 32 arguments
+#define HOLOSCAN_CODEC_EXPAND(x) x
+#define HOLOSCAN_CODEC_FE_1(m, t, x) m(t, x)
+#define HOLOSCAN_CODEC_FE_2(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_1(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_3(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_2(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_4(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_3(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_5(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_4(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_6(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_5(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_7(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_6(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_8(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_7(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_9(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_8(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_10(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_9(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_11(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_10(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_12(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_11(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_13(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_12(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_14(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_13(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_15(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_14(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_16(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_15(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_17(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_16(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_18(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_17(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_19(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_18(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_20(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_19(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_21(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_20(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_22(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_21(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_23(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_22(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_24(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_23(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_25(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_24(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_26(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_25(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_27(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_26(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_28(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_27(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_29(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_28(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_30(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_29(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_31(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_30(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_32(m, t, x, ...) \
+  m(t, x), HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_31(m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_FE_SELECT( \
+    _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, \
+    _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, NAME, ...) \
+  NAME
+#define HOLOSCAN_CODEC_FOR_EACH(m, t, ...) \
+  HOLOSCAN_CODEC_EXPAND(HOLOSCAN_CODEC_FE_SELECT(__VA_ARGS__, \
+      HOLOSCAN_CODEC_FE_32, HOLOSCAN_CODEC_FE_31, HOLOSCAN_CODEC_FE_30, HOLOSCAN_CODEC_FE_29, \
+      HOLOSCAN_CODEC_FE_28, HOLOSCAN_CODEC_FE_27, HOLOSCAN_CODEC_FE_26, HOLOSCAN_CODEC_FE_25, \
+      HOLOSCAN_CODEC_FE_24, HOLOSCAN_CODEC_FE_23, HOLOSCAN_CODEC_FE_22, HOLOSCAN_CODEC_FE_21, \
+      HOLOSCAN_CODEC_FE_20, HOLOSCAN_CODEC_FE_19, HOLOSCAN_CODEC_FE_18, HOLOSCAN_CODEC_FE_17, \
+      HOLOSCAN_CODEC_FE_16, HOLOSCAN_CODEC_FE_15, HOLOSCAN_CODEC_FE_14, HOLOSCAN_CODEC_FE_13, \
+      HOLOSCAN_CODEC_FE_12, HOLOSCAN_CODEC_FE_11, HOLOSCAN_CODEC_FE_10, HOLOSCAN_CODEC_FE_9, \
+      HOLOSCAN_CODEC_FE_8, HOLOSCAN_CODEC_FE_7, HOLOSCAN_CODEC_FE_6, HOLOSCAN_CODEC_FE_5, \
+      HOLOSCAN_CODEC_FE_4, HOLOSCAN_CODEC_FE_3, HOLOSCAN_CODEC_FE_2, HOLOSCAN_CODEC_FE_1)( \
+      m, t, __VA_ARGS__))
+#define HOLOSCAN_CODEC_MEMBER_POINTER(type, field) &type::field
+#define HOLOSCAN_CODEC_CHECK_FIELD(type, field)                                                \
+  [] {                                                                                         \
+    static_assert(holoscan::detail::is_value_field_v<                                          \
+                      holoscan::detail::member_field_t<decltype(&type::field)>>,               \
+                  "HOLOSCAN_CODEC_FIELDS: " #type "::" #field " is a pointer and cannot be "   \
+                  "serialized");                                                               \
+  }
+
+/**
+ * @brief Generate a codec for an aggregate type from a list of its data members.
+ *
+ * This macro defines `holoscan::codec<Type>` and `holoscan::codec<std::vector<Type>>` based on
+ * `holoscan::fields_codec`, so that the type can be sent between fragments without a hand-written
+ * codec. It must be used at global namespace scope with the fully qualified type name, and all
+ * fragments exchanging the type must declare the same fields in the same order.
+ *
+ * The fields must hold values. Pointer fields (raw pointers, pointers to members, `std::nullptr_t`
+ * or arrays of them) fail to compile with a static_assert naming the field, and trivially copyable
+ * nested types are copied bytewise, so they must not hold pointers either.
+ *
+ * The codec is registered by calling `register_codec<Type>()` (or
+ * `CodecRegistry::get_instance().add_codec<Type>()`), which uses the stringified type name as
+ * the codec name.
+ *
+ * ```cpp
+ * struct Detection {
+ *   std::string label;
+ *   float score;
+ *   std::array<float, 4> box;
+ * };
+ *
+ * HOLOSCAN_CODEC_FIELDS(Detection, label, score, box)
+ * ```
+ *
+ * Up to 32 fields are supported.
+ */
+#define HOLOSCAN_CODEC_FIELDS(Type, ...)                                                  \
+  template <>                                                                             \
+  struct holoscan::codec_fields<Type> {                                                   \
+    static constexpr const char* name = #Type;                                            \
+    static constexpr auto members() {                                                     \
+      return std::make_tuple(                                                             \
+          HOLOSCAN_CODEC_FOR_EACH(HOLOSCAN_CODEC_MEMBER_POINTER, Type, __VA_ARGS__));     \
+    }                                                                                     \
+    /* never called: reports the pointer fields by name at compile time */                \
+    static void check_fields() {                                                          \
+      (void)std::make_tuple(                                                              \
+          HOLOSCAN_CODEC_FOR_EACH(HOLOSCAN_CODEC_CHECK_FIELD, Type, __VA_ARGS__));        \
+    }                                                                                     \
+  };                                                                                      \
+  template <>                                                                             \
+  struct holoscan::codec<Type> : holoscan::fields_codec<Type> {};                         \
+  template <>                                                                             \
+  struct holoscan::codec<std::vector<Type>> : holoscan::fields_vector_codec<Type> {};
+
+#endif /* HOLOSCAN_CORE_CODEC_FIELDS_HPP */
@@ -18,9 +18,13 @@
 #ifndef HOLOSCAN_CORE_CODEC_REGISTRY_HPP
 #define HOLOSCAN_CORE_CODEC_REGISTRY_HPP
 
+#include <algorithm>
 #include <complex>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <typeindex>
@@ -29,6 +33,7 @@
 #include <utility>
 #include <vector>
 
+#include "./codec_fields.hpp"
 #include "./codecs.hpp"
 #include "./common.hpp"
 #include "./errors.hpp"
@@ -85,6 +90,11 @@ class CodecRegistry {
    */
   inline static Codec none_codec = std::make_pair(none_serialize, none_deserialize);
 
+  /**
+   * @brief Sentinel value returned when no wire codec ID is assigned to a type.
+   */
+  static constexpr uint32_t kInvalidWireCodecId = std::numeric_limits<uint32_t>::max();
+
   /**
    * @brief Get the instance object.
    *
@@ -288,18 +298,20 @@ class CodecRegistry {
     name_to_index_map_.try_emplace(codec_name, index);
     index_to_name_map_.try_emplace(index, codec_name);
     codec_map_.try_emplace(codec_name, codec);
+    if (!wire_codec_names_.empty()) { rebuild_wire_codec_table(); }
   }
 
   /**
    * @brief Add a codec for the type.
    *
    * @tparam typeT the type for which a codec is being added
-   * @param index the type index of the parameter.
-   * @param codec a pair containing a serialization function and deserialization function.
+   * @tparam codecT the codec class providing static serialize/deserialize functions for typeT
+   * (e.g. `zero_copy_codec<std::vector<float, default_init_allocator<float>>>`). Defaults to
+   * `codec<typeT>`.
    * @param codec_name The name of the codec to add.
    * @param overwrite if true, any existing codec with matching codec_name will be overwritten.
    */
-  template <typename typeT>
+  template <typename typeT, typename codecT = codec<typeT>>
   void add_codec(const std::string& codec_name, bool overwrite = true) {
     auto name_search = name_to_index_map_.find(codec_name);
     auto index = std::type_index(typeid(typeT));
@@ -320,39 +332,135 @@ class CodecRegistry {
         codec_name,
         std::make_pair(
             [](const Message& data, GXFEndpoint* gxf_endpoint) -> nvidia::gxf::Expected<size_t> {
-              try {
-                const typeT& value = std::any_cast<typeT>(data.value());
-                Endpoint endpoint(gxf_endpoint);
-
-                auto result = codec<typeT>::serialize(value, &endpoint);
-                if (result) {
-                  return result.value();
-                } else {
-                  HOLOSCAN_LOG_ERROR("Error happens in serializing data of type '{}'",
-                                     typeid(typeT).name());
-                  return nvidia::gxf::Unexpected(GXF_FAILURE);
-                }
-              } catch (const std::bad_any_cast& e) {
-                HOLOSCAN_LOG_ERROR("Unable to cast the data (std::any) to '{}' : {}",
-                                   typeid(typeT).name(),
-                                   e.what());
+              // Serialize the value stored in the message (not a copy): zero-copy codecs register
+              // its memory with the endpoint, which must stay valid until the data is sent.
+              const typeT* value = data.get_if<typeT>();
+              if (value == nullptr) {
+                HOLOSCAN_LOG_ERROR("Unable to cast the data (std::any) to '{}'",
+                                   typeid(typeT).name());
+                return nvidia::gxf::Unexpected(GXF_FAILURE);
+              }
+              Endpoint endpoint(gxf_endpoint);
+
+              auto result = codecT::serialize(*value, &endpoint);
+              if (result) {
+                return result.value();
+              } else {
+                HOLOSCAN_LOG_ERROR("Error happens in serializing data of type '{}'",
+                                   typeid(typeT).name());
                 return nvidia::gxf::Unexpected(GXF_FAILURE);
               }
             },
             [](GXFEndpoint* gxf_endpoint) -> nvidia::gxf::Expected<Message> {
               Endpoint endpoint(gxf_endpoint);
-              auto maybe_value = codec<typeT>::deserialize(&endpoint);
+              auto maybe_value = codecT::deserialize(&endpoint);
               if (maybe_value) {
-                return Message{maybe_value.value()};
+                // move the value so that memory registered with the endpoint stays valid
+                return Message{std::move(maybe_value.value())};
               } else {
                 HOLOSCAN_LOG_ERROR("Error happens in deserializing data of type '{}'",
                                    typeid(typeT).name());
                 return nvidia::gxf::Unexpected(GXF_FAILURE);
               }
             }));
+    if (!wire_codec_names_.empty()) { rebuild_wire_codec_table(); }
+  }
+
+  /**
+   * @brief Add the codec generated for a type declared with HOLOSCAN_CODEC_FIELDS.
+   *
+   * The stringified type name given to HOLOSCAN_CODEC_FIELDS is used as the codec name. Codecs
+   * for `std::vector<typeT>` and `std::shared_ptr<typeT>` are added as well.
+   *
+   * @tparam typeT the type declared with HOLOSCAN_CODEC_FIELDS.
+   */
+  template <typename typeT, typename = std::enable_if_t<has_codec_fields_v<typeT>>>
+  void add_codec() {
+    const std::string name{codec_fields<typeT>::name};
+    add_codec<typeT>(name);
+    add_codec<std::vector<typeT>>(fmt::format("std::vector<{}>", name));
+    add_codec<std::shared_ptr<typeT>>(fmt::format("std::shared_ptr<{}>", name));
+  }
+
+  /**
+   * @brief Get the names of all registered codecs.
+   *
+   * The names are returned in sorted order so that the list can be compared across processes.
+   *
+   * @return The sorted vector of codec names.
+   */
+  std::vector<std::string> codec_names() const {
+    std::vector<std::string> names;
+    names.reserve(codec_map_.size());
+    for (const auto& [name, _] : codec_map_) { names.push_back(name); }
+    std::sort(names.begin(), names.end());
+    return names;
+  }
+
+  /**
+   * @brief Set the table of codecs that can be referred to by a numeric ID on the wire.
+   *
+   * The position of a codec name in `codec_names` is used as its wire ID. All fragments that
+   * exchange messages must install the same table (the app driver distributes it during the
+   * fragment execution handshake). Names that are not registered locally are kept in the table so
+   * that IDs stay aligned, but they cannot be used for serialization or deserialization.
+   * Passing an empty vector disables the wire ID table so that all messages use codec names.
+   *
+   * @param codec_names The ordered list of codec names shared by all fragments.
+   */
+  void set_wire_codec_table(const std::vector<std::string>& codec_names) {
+    wire_codec_names_ = codec_names;
+    rebuild_wire_codec_table();
+  }
+
+  /**
+   * @brief Get the table of codec names that are addressable by a wire ID.
+   *
+   * @return The ordered list of codec names (the index is the wire ID).
+   */
+  const std::vector<std::string>& wire_codec_table() const { return wire_codec_names_; }
+
+  /**
+   * @brief Get the wire ID of the codec registered for the given type.
+   *
+   * @param index The type index of the data type.
+   * @return The wire ID, or `kInvalidWireCodecId` if the type has no entry in the wire table.
+   */
+  uint32_t wire_codec_id(const std::type_index& index) const {
+    auto loc = index_to_wire_id_map_.find(index);
+    if (loc == index_to_wire_id_map_.end()) { return kInvalidWireCodecId; }
+    return loc->second;
+  }
+
+  /**
+   * @brief Get the codec corresponding to a wire ID.
+   *
+   * @param wire_id The wire ID of the codec.
+   * @return The pointer to the Codec object, or nullptr if the ID is unknown.
+   */
+  const Codec* get_codec(uint32_t wire_id) const {
+    if (wire_id >= wire_codecs_.size() || !wire_codecs_[wire_id]) { return nullptr; }
+    return &wire_codecs_[wire_id].value();
   }
 
  private:
+  /// Resolve the codec pointers of the wire table (called whenever the codec map changes).
+  void rebuild_wire_codec_table() {
+    wire_codecs_.assign(wire_codec_names_.size(), std::nullopt);
+    index_to_wire_id_map_.clear();
+    for (size_t wire_id = 0; wire_id < wire_codec_names_.size(); ++wire_id) {
+      const auto& name = wire_codec_names_[wire_id];
+      auto codec_loc = codec_map_.find(name);
+      auto index_loc = name_to_index_map_.find(name);
+      if (codec_loc == codec_map_.end() || index_loc == name_to_index_map_.end()) {
+        HOLOSCAN_LOG_DEBUG("Codec '{}' in the wire codec table is not registered locally", name);
+        continue;
+      }
+      wire_codecs_[wire_id] = codec_loc->second;
+      index_to_wire_id_map_.try_emplace(index_loc->second, static_cast<uint32_t>(wire_id));
+    }
+  }
+
   CodecRegistry() {
     // Note: All codecs are for a holoscan::Message.
     //       The names used here could be holoscan::Message(bool), etc.
@@ -475,6 +583,11 @@ class CodecRegistry {
 
   std::unordered_map<std::string, std::pair<SerializeFunc, DeserializeFunc>>
       codec_map_;  ///< Map of codec name to codec function pair
+
+  std::vector<std::string> wire_codec_names_;  ///< Negotiated codec names (index is the wire ID)
+  std::vector<std::optional<Codec>> wire_codecs_;  ///< Codecs indexed by wire ID
+  std::unordered_map<std::type_index, uint32_t>
+      index_to_wire_id_map_;  ///< Mapping from type_index to wire ID
 };
 
 }  // namespace holoscan
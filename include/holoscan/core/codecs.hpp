@@ -34,6 +34,7 @@
 #include "./endpoint.hpp"
 #include "./errors.hpp"
 #include "./expected.hpp"
+#include "./messagelabel.hpp"
 #include "./type_traits.hpp"
 
 #include "gxf/core/expected.hpp"
@@ -122,14 +123,158 @@ static inline expected<vectorT, RuntimeError> deserialize_binary_blob(Endpoint*
 }
 
 // codec for vector of trivially serializable typeT
-template <typename typeT>
-struct codec<std::vector<typeT>> {
-  static expected<size_t, RuntimeError> serialize(const std::vector<typeT>& value,
+template <typename typeT, typename allocatorT>
+struct codec<std::vector<typeT, allocatorT>> {
+  static expected<size_t, RuntimeError> serialize(const std::vector<typeT, allocatorT>& value,
+                                                  Endpoint* endpoint) {
+    return serialize_binary_blob<std::vector<typeT, allocatorT>>(value, endpoint);
+  }
+  static expected<std::vector<typeT, allocatorT>, RuntimeError> deserialize(Endpoint* endpoint) {
+    return deserialize_binary_blob<std::vector<typeT, allocatorT>>(endpoint);
+  }
+};
+
+// Allocator adaptor that default-initializes (i.e. leaves uninitialized) trivial elements when
+// a container is resized, instead of value-initializing (zeroing) them.
+// std::vector<T, default_init_allocator<T>> can be used for large buffers that are always
+// overwritten after being resized (e.g. on deserialization).
+template <typename T, typename allocatorT = std::allocator<T>>
+class default_init_allocator : public allocatorT {
+  using traits = std::allocator_traits<allocatorT>;
+
+ public:
+  template <typename U>
+  struct rebind {
+    using other = default_init_allocator<U, typename traits::template rebind_alloc<U>>;
+  };
+
+  using allocatorT::allocatorT;
+
+  template <typename U>
+  void construct(U* ptr) noexcept(std::is_nothrow_default_constructible_v<U>) {
+    ::new (static_cast<void*>(ptr)) U;
+  }
+  template <typename U, typename... ArgsT>
+  void construct(U* ptr, ArgsT&&... args) {
+    traits::construct(static_cast<allocatorT&>(*this), ptr, std::forward<ArgsT>(args)...);
+  }
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Codec type 3b: zero-copy contiguous containers
+//
+// For large vectorT types of trivially copyable elements. Instead of copying the data into the
+// serialization buffer, the container's memory is registered with the endpoint as a separate
+// (iovec) segment via Endpoint::write_ptr and sent directly by the transport. On the receiving
+// side, the container is allocated and its memory is registered via Endpoint::write_ptr as the
+// destination of that segment, so the data is received in place without an extra copy.
+//
+// Because the transport fills the registered memory after deserialize() returns, the deserialized
+// container must be moved (not copied) into the received message. CodecRegistry::add_codec does
+// so. Containers smaller than kZeroCopyMinBytes are copied inline, as the per-segment overhead
+// outweighs the copy for small payloads.
+//
+// The codec is only provided for vectors using default_init_allocator: the received container is
+// resized before its memory is filled by the transport, and resizing a std::vector with the
+// default allocator would zero its whole payload first.
+//
+// This codec is opt-in. Register it for a type with
+//   using FloatVector = std::vector<float, default_init_allocator<float>>;
+//   register_codec<FloatVector, zero_copy_codec<FloatVector>>("...")
+// on all fragments exchanging that type.
+
+/// Minimum payload size in bytes for which zero_copy_codec sends data as a separate segment.
+constexpr size_t kZeroCopyMinBytes = 64 * 1024;
+
+#pragma pack(push, 1)
+struct ZeroCopyDataHeader {
+  size_t size;
+  uint8_t bytes_per_element;
+  uint8_t is_segment;  // 1 if the data follows as a separate segment, 0 if it is inline
+};
+#pragma pack(pop)
+
+template <typename vectorT>
+static inline expected<size_t, RuntimeError> serialize_binary_blob_zero_copy(const vectorT& data,
+                                                                             Endpoint* endpoint) {
+  using valueT = typename vectorT::value_type;
+  static_assert(std::is_trivially_copyable_v<valueT>,
+                "zero-copy serialization requires trivially copyable elements");
+  ZeroCopyDataHeader header;
+  header.size = data.size();
+  header.bytes_per_element = sizeof(valueT);
+  size_t num_bytes = header.size * header.bytes_per_element;
+  header.is_segment = num_bytes >= kZeroCopyMinBytes ? 1 : 0;
+  auto size = endpoint->write_trivial_type<ZeroCopyDataHeader>(&header);
+  if (!size) { return forward_error(size); }
+  if (header.is_segment) {
+    auto result = endpoint->write_ptr(data.data(), num_bytes, Endpoint::MemoryStorageType::kSystem);
+    if (!result) { return forward_error(result); }
+    return size.value() + num_bytes;
+  }
+  auto size2 = endpoint->write(data.data(), num_bytes);
+  if (!size2) { return forward_error(size2); }
+  return size.value() + size2.value();
+}
+
+template <typename vectorT>
+static inline expected<vectorT, RuntimeError> deserialize_binary_blob_zero_copy(
+    Endpoint* endpoint) {
+  using valueT = typename vectorT::value_type;
+  ZeroCopyDataHeader header;
+  auto header_size = endpoint->read_trivial_type<ZeroCopyDataHeader>(&header);
+  if (!header_size) { return forward_error(header_size); }
+  if (header.bytes_per_element != sizeof(valueT)) {
+    return make_unexpected<RuntimeError>(
+        RuntimeError(ErrorCode::kCodecError, "element size mismatch in zero-copy deserialization"));
+  }
+  // the elements are left uninitialized (see default_init_allocator) as they are overwritten below
+  vectorT data;
+  data.resize(header.size);
+  size_t num_bytes = header.size * header.bytes_per_element;
+  if (header.is_segment) {
+    // register the container's memory as the destination of the received segment
+    auto result = endpoint->write_ptr(data.data(), num_bytes, Endpoint::MemoryStorageType::kSystem);
+    if (!result) { return forward_error(result); }
+  } else {
+    auto result = endpoint->read(data.data(), num_bytes);
+    if (!result) { return forward_error(result); }
+  }
+  return data;
+}
+
+template <typename vectorT>
+struct zero_copy_codec {
+  static_assert(!std::is_same_v<vectorT, vectorT>,
+                "zero_copy_codec is only provided for std::vector<T, default_init_allocator<T>> "
+                "(or a shared_ptr to it)");
+};
+
+// zero-copy codec for vector of trivially copyable typeT
+template <typename typeT, typename allocatorT>
+struct zero_copy_codec<std::vector<typeT, default_init_allocator<typeT, allocatorT>>> {
+  using vectorT = std::vector<typeT, default_init_allocator<typeT, allocatorT>>;
+  static expected<size_t, RuntimeError> serialize(const vectorT& value, Endpoint* endpoint) {
+    return serialize_binary_blob_zero_copy<vectorT>(value, endpoint);
+  }
+  static expected<vectorT, RuntimeError> deserialize(Endpoint* endpoint) {
+    return deserialize_binary_blob_zero_copy<vectorT>(endpoint);
+  }
+};
+
+// zero-copy codec for shared_ptr to a vector of trivially copyable typeT
+template <typename typeT, typename allocatorT>
+struct zero_copy_codec<
+    std::shared_ptr<std::vector<typeT, default_init_allocator<typeT, allocatorT>>>> {
+  using vectorT = std::vector<typeT, default_init_allocator<typeT, allocatorT>>;
+  static expected<size_t, RuntimeError> serialize(std::shared_ptr<vectorT> value,
                                                   Endpoint* endpoint) {
-    return serialize_binary_blob<std::vector<typeT>>(value, endpoint);
+    return serialize_binary_blob_zero_copy<vectorT>(*value, endpoint);
   }
-  static expected<std::vector<typeT>, RuntimeError> deserialize(Endpoint* endpoint) {
-    return deserialize_binary_blob<std::vector<typeT>>(endpoint);
+  static expected<std::shared_ptr<vectorT>, RuntimeError> deserialize(Endpoint* endpoint) {
+    auto value = deserialize_binary_blob_zero_copy<vectorT>(endpoint);
+    if (!value) { return forward_error(value); }
+    return std::make_shared<vectorT>(std::move(value.value()));
   }
 };
 
@@ -255,7 +400,7 @@ static inline expected<typeT, RuntimeError> deserialize_vector_of_vectors(Endpoi
   for (size_t i = 0; i < num_vectors; i++) {
     auto vec = codec<vectorT>::deserialize(endpoint);
     if (!vec) { return forward_error(vec); }
-    data.push_back(vec.value());
+    data.push_back(std::move(vec.value()));
   }
   return data;
 }
@@ -282,6 +427,23 @@ struct codec<std::vector<std::string>> {
   }
 };
 
+// codec for MessageLabel
+// The label is written as a binary blob in the compact representation of
+// MessageLabel::serialize(), so that Data Flow Tracking labels can cross fragments cheaply.
+template <>
+struct codec<MessageLabel> {
+  static expected<size_t, RuntimeError> serialize(const MessageLabel& value, Endpoint* endpoint) {
+    std::vector<uint8_t> buffer;
+    value.serialize(buffer);
+    return serialize_binary_blob<std::vector<uint8_t>>(buffer, endpoint);
+  }
+  static expected<MessageLabel, RuntimeError> deserialize(Endpoint* endpoint) {
+    auto buffer = deserialize_binary_blob<std::vector<uint8_t>>(endpoint);
+    if (!buffer) { return forward_error(buffer); }
+    return MessageLabel::deserialize(buffer.value().data(), buffer.value().size());
+  }
+};
+
 // codec for shared_ptr types
 // Serializes the contents of the shared_ptr. On deserialize, a new shared_ptr to the deserialized
 // value is returned.
@@ -294,7 +456,7 @@ struct codec<std::shared_ptr<typeT>> {
   static expected<std::shared_ptr<typeT>, RuntimeError> deserialize(Endpoint* endpoint) {
     auto value = codec<typeT>::deserialize(endpoint);
     if (!value) { return forward_error(value); }
-    return std::make_shared<typeT>(value.value());
+    return std::make_shared<typeT>(std::move(value.value()));
   }
 };
 }  // namespace holoscan
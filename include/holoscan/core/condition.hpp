@@ -107,6 +107,7 @@ enum class ConditionType {
   kBoolean,                      ///< nvidia::gxf::BooleanSchedulingTerm
   kPeriodic,                     ///< nvidia::gxf::PeriodicSchedulingTerm
   kAsynchronous,                 ///< nvidia::gxf::AsynchronousSchedulingTerm
+  kBatchMessageAvailable,        ///< holoscan::gxf::BatchMessageAvailableSchedulingTerm
 };
 
 /**
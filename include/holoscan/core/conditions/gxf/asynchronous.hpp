@@ -18,6 +18,8 @@
 #ifndef HOLOSCAN_CORE_CONDITIONS_GXF_ASYNCHRONOUS_HPP
 #define HOLOSCAN_CORE_CONDITIONS_GXF_ASYNCHRONOUS_HPP
 
+#include <atomic>
+#include <mutex>
 #include <string>
 
 #include <gxf/std/scheduling_terms.hpp>
@@ -71,10 +73,27 @@ class AsynchronousCondition : public gxf::GXFCondition {
    */
   AsynchronousEventState event_state() const;
 
+  /**
+   * @brief Set the asynchronous event state only if it currently has the expected value.
+   *
+   * The comparison and the update are atomic with respect to the other state changes, so a
+   * notifier (e.g., setting `EVENT_WAITING` to `EVENT_DONE`) cannot overwrite a state set
+   * concurrently by the operator.
+   *
+   * @param expected The state the condition must be in.
+   * @param desired The state to which the condition should be set.
+   * @return true if the state was changed.
+   */
+  bool compare_exchange_event_state(AsynchronousEventState expected,
+                                    AsynchronousEventState desired);
+
   nvidia::gxf::AsynchronousSchedulingTerm* get() const;
 
  private:
-  AsynchronousEventState event_state_{AsynchronousEventState::READY};
+  // set from the asynchronous thread (or EventReactor) and read by the operator
+  std::atomic<AsynchronousEventState> event_state_{AsynchronousEventState::READY};
+  // keeps the state of the GXF scheduling term in sync with event_state_
+  std::mutex event_state_mutex_;
 };
 
 }  // namespace holoscan
@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_CONDITIONS_GXF_BATCH_FLUSH_HPP
+#define HOLOSCAN_CORE_CONDITIONS_GXF_BATCH_FLUSH_HPP
+
+#include <chrono>
+
+#include "../../gxf/batch_flush_scheduling_term.hpp"
+#include "../../gxf/gxf_condition.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Condition class to execute an operator batching the messages of several input ports.
+ *
+ * The operator is executed when any of its input ports has a message, or when the flush it
+ * requested with `request_flush()` is due. This lets an operator keep a partial batch across
+ * executions and flush it on time even if no other message arrives. The input ports must have
+ * no other condition (`ConditionType::kNone`), since a port without a message would otherwise
+ * prevent the execution.
+ *
+ * ```cpp
+ * void compute(InputContext& op_input, OutputContext& op_output, ExecutionContext&) override {
+ *   // add the received messages to the batch, emit the batch if it is full or due
+ *   ...
+ *   if (!batch.empty()) { flush_condition_->request_flush(batch.time_left()); }
+ * }
+ * ```
+ *
+ * This class wraps holoscan::gxf::BatchFlushSchedulingTerm.
+ */
+class BatchFlushCondition : public gxf::GXFCondition {
+ public:
+  HOLOSCAN_CONDITION_FORWARD_ARGS_SUPER(BatchFlushCondition, GXFCondition)
+
+  BatchFlushCondition() = default;
+
+  const char* gxf_typename() const override { return "holoscan::gxf::BatchFlushSchedulingTerm"; }
+
+  void setup(ComponentSpec& spec) override;
+
+  /**
+   * @brief Request an execution once the given delay has passed, even without a new message.
+   *
+   * A request is valid for the next execution only: it is typically renewed at the end of each
+   * `compute()` call as long as a batch is pending.
+   *
+   * @param delay The delay from now.
+   */
+  void request_flush(std::chrono::nanoseconds delay);
+
+  gxf::BatchFlushSchedulingTerm* get() const;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_CONDITIONS_GXF_BATCH_FLUSH_HPP */
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_CONDITIONS_GXF_BATCH_MESSAGE_AVAILABLE_HPP
+#define HOLOSCAN_CORE_CONDITIONS_GXF_BATCH_MESSAGE_AVAILABLE_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "../../gxf/batch_message_available_scheduling_term.hpp"
+#include "../../gxf/gxf_condition.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Condition class to execute an operator with batches of messages.
+ *
+ * The operator is executed when the receiver of its input port has at least `max_batch_size`
+ * messages, or when it has at least one message and `max_delay_ns` nanoseconds have passed since
+ * the first message of the batch arrived (whichever comes first). The messages of the batch can
+ * then be received at once with `InputContext::receive_batch()`.
+ *
+ * The queue of the input port must be able to hold a full batch, e.g.:
+ *
+ * ```cpp
+ * spec.input<std::shared_ptr<Frame>>("in")
+ *     .connector(IOSpec::ConnectorType::kDoubleBuffer, Arg("capacity", 8UL))
+ *     .condition(ConditionType::kBatchMessageAvailable,
+ *                Arg("max_batch_size", static_cast<int64_t>(8)),
+ *                Arg("max_delay_ns", static_cast<int64_t>(2'000'000)));
+ * ```
+ *
+ * This class wraps holoscan::gxf::BatchMessageAvailableSchedulingTerm.
+ */
+class BatchMessageAvailableCondition : public gxf::GXFCondition {
+ public:
+  HOLOSCAN_CONDITION_FORWARD_ARGS_SUPER(BatchMessageAvailableCondition, GXFCondition)
+
+  BatchMessageAvailableCondition() = default;
+  BatchMessageAvailableCondition(int64_t max_batch_size, int64_t max_delay_ns)
+      : max_batch_size_(max_batch_size), max_delay_ns_(max_delay_ns) {}
+  template <typename Rep, typename Period>
+  BatchMessageAvailableCondition(int64_t max_batch_size,
+                                 std::chrono::duration<Rep, Period> max_delay)
+      : max_batch_size_(max_batch_size),
+        max_delay_ns_(std::chrono::duration_cast<std::chrono::nanoseconds>(max_delay).count()) {}
+
+  const char* gxf_typename() const override {
+    return "holoscan::gxf::BatchMessageAvailableSchedulingTerm";
+  }
+
+  void receiver(std::shared_ptr<gxf::GXFResource> receiver) { receiver_ = receiver; }
+  std::shared_ptr<gxf::GXFResource> receiver() { return receiver_.get(); }
+
+  int64_t max_batch_size() { return max_batch_size_; }
+  int64_t max_delay_ns() { return max_delay_ns_; }
+
+  void setup(ComponentSpec& spec) override;
+
+  gxf::BatchMessageAvailableSchedulingTerm* get() const;
+
+ private:
+  Parameter<std::shared_ptr<gxf::GXFResource>> receiver_;
+  Parameter<int64_t> max_batch_size_;
+  Parameter<int64_t> max_delay_ns_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_CONDITIONS_GXF_BATCH_MESSAGE_AVAILABLE_HPP */
@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_DATAFLOW_TRACE_HPP
+#define HOLOSCAN_CORE_DATAFLOW_TRACE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace holoscan {
+
+/**
+ * @brief Format of the log file written by DataFlowTracker::enable_logging().
+ */
+enum class DataFlowLogFormat {
+  kText,    ///< Human-readable text: the paths of a message as (operator, receive, publish) tuples
+  kBinary,  ///< Compact binary trace (see DataFlowTraceHeader)
+};
+
+/// The magic bytes at the start of a binary data flow trace file.
+constexpr char kDataFlowTraceMagic[8] = {'H', 'S', 'D', 'F', 'T', 'R', 'C', '\0'};
+/// The version of the binary data flow trace format.
+constexpr uint32_t kDataFlowTraceVersion = 1;
+
+/**
+ * @brief Header of a binary data flow trace file.
+ *
+ * A binary trace file is made of this header, followed by `num_records` DataFlowTraceRecord
+ * records and by the string table (at `string_table_offset`). All the integers are
+ * little-endian. The string table is:
+ *
+ * ```
+ * uint32_t num_operators
+ * num_operators x { uint32_t name_size; char name[name_size]; }      // operator ID = index
+ * uint32_t num_paths
+ * num_paths x { uint32_t path_id; uint32_t num_operators; uint32_t operator_ids[num_operators]; }
+ * ```
+ *
+ * The header is rewritten when the trace is closed. If the process stopped before (e.g., during a
+ * long run), `string_table_offset` is 0 and the records (up to the end of the file) can still be
+ * read, without the operator names.
+ */
+struct DataFlowTraceHeader {
+  char magic[8];                  ///< kDataFlowTraceMagic
+  uint32_t version;               ///< kDataFlowTraceVersion
+  uint32_t record_size;           ///< sizeof(DataFlowTraceRecord)
+  uint64_t records_offset;        ///< offset of the first record in the file
+  uint64_t num_records;           ///< number of records
+  uint64_t num_messages;          ///< number of logged messages
+  uint64_t num_dropped_messages;  ///< messages that could not be logged (e.g., untracked paths)
+  uint64_t string_table_offset;   ///< offset of the string table (0 if the trace is not closed)
+  uint64_t string_table_size;     ///< size of the string table in bytes
+};
+static_assert(sizeof(DataFlowTraceHeader) == 64, "Unexpected DataFlowTraceHeader size");
+
+/**
+ * @brief Record of a binary data flow trace: the timestamps of one operator of a logged path.
+ *
+ * A message whose label has several paths is logged as one record per operator of each path,
+ * with the same `message_index`.
+ */
+struct DataFlowTraceRecord {
+  uint64_t message_index;     ///< 1-based index of the logged message
+  uint32_t path_id;           ///< ID of the path (see the string table)
+  uint32_t operator_id;       ///< ID of the operator (index of its name in the string table)
+  uint16_t path_index;        ///< index of the path in the message label
+  uint16_t operator_index;    ///< index of the operator in the path (0 for the root operator)
+  uint32_t reserved;          ///< reserved (0)
+  int64_t receive_timestamp;  ///< time the operator received the message (us since epoch)
+  int64_t publish_timestamp;  ///< time the operator published the message (us since epoch)
+};
+static_assert(sizeof(DataFlowTraceRecord) == 40, "Unexpected DataFlowTraceRecord size");
+
+/**
+ * @brief Writer of binary data flow trace files.
+ *
+ * Records are written through a user-space buffer, or directly to the page cache through a
+ * memory-mapped window of the file that is moved forward as the file grows. Operator names and
+ * paths are interned and written in the string table when the trace is closed.
+ *
+ * This class is not thread-safe: it is used by the log writer thread of DataFlowTracker.
+ */
+class DataFlowTraceWriter {
+ public:
+  DataFlowTraceWriter() = default;
+  ~DataFlowTraceWriter();
+
+  DataFlowTraceWriter(const DataFlowTraceWriter&) = delete;
+  DataFlowTraceWriter& operator=(const DataFlowTraceWriter&) = delete;
+
+  /**
+   * @brief Create (or truncate) a trace file and write its header.
+   *
+   * @param filename The name of the trace file.
+   * @param use_mmap Whether to write the records through a memory-mapped window of the file.
+   * @return True if the file was opened.
+   */
+  bool open(const std::string& filename, bool use_mmap = false);
+
+  /// Whether a trace file is open.
+  bool is_open() const { return fd_ >= 0; }
+
+  /**
+   * @brief Get the operator IDs of a path, interning the path and its operators on first use.
+   *
+   * @param path_id The ID of the path.
+   * @param operator_names The names of the operators of the path.
+   * @return The IDs of the operators of the path.
+   */
+  const std::vector<uint32_t>& path_operator_ids(uint32_t path_id,
+                                                 const std::vector<std::string>& operator_names);
+
+  /// Write a record.
+  void write(const DataFlowTraceRecord& record);
+
+  /// Write the buffered records to the file.
+  void flush();
+
+  /**
+   * @brief Write the string table and the final header, and close the file.
+   *
+   * @param num_messages The number of logged messages.
+   * @param num_dropped_messages The number of messages that could not be logged.
+   */
+  void close(uint64_t num_messages, uint64_t num_dropped_messages);
+
+  /// The number of records written since the file was opened.
+  uint64_t num_records() const { return num_records_; }
+
+ private:
+  bool write_at(uint64_t offset, const void* data, size_t size);
+  bool map_window(uint64_t offset);
+  void unmap_window();
+
+  int fd_ = -1;
+  std::string filename_;
+  bool use_mmap_ = false;
+  uint64_t file_size_ = 0;  ///< The number of bytes written (or mapped and filled) so far
+  uint64_t num_records_ = 0;
+
+  std::vector<char> buffer_;  ///< The user-space buffer (if not memory-mapped)
+  size_t buffer_size_ = 0;
+
+  char* window_ = nullptr;      ///< The memory-mapped window (if memory-mapped)
+  uint64_t window_offset_ = 0;  ///< The offset of the window in the file
+  size_t window_size_ = 0;
+
+  std::unordered_map<std::string, uint32_t> operator_ids_;
+  std::vector<std::string> operator_names_;
+  std::vector<std::vector<uint32_t>> path_operator_ids_;  ///< indexed by path ID
+  std::vector<uint32_t> path_ids_;                        ///< interned path IDs, in order
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_DATAFLOW_TRACE_HPP */
@@ -20,17 +20,26 @@
 
 #include <limits.h>
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
+#include "./dataflow_trace.hpp"
 #include "./forward_def.hpp"
+#include "./graph.hpp"
+#include "./hdr_histogram.hpp"
+#include "./messagelabel.hpp"
 
 namespace holoscan {
 
@@ -39,6 +48,9 @@ constexpr uint64_t kDefaultNumLastMessagesToDiscard = 10;
 constexpr int kDefaultLatencyThreshold = 0;
 constexpr uint64_t kDefaultNumBufferedMessages = 100;
 constexpr const char* kDefaultLogfileName = "logger.log";
+/// The default capacity of the path table (see `HOLOSCAN_FLOW_TRACKING_MAX_PATHS`).
+constexpr size_t kDefaultMaxNumTrackedPaths = 1024;
+constexpr uint32_t kInvalidPathId = UINT32_MAX;
 
 enum class DataFlowMetric {
   kMaxMessageID,
@@ -48,6 +60,9 @@ enum class DataFlowMetric {
   kMinE2ELatency,
   kNumSrcMessages,
   kNumDstMessages,
+  kP50E2ELatency,
+  kP99E2ELatency,
+  kP999E2ELatency,
 };
 
 static const std::unordered_map<DataFlowMetric, std::string> metricToString = {
@@ -56,27 +71,90 @@ static const std::unordered_map<DataFlowMetric, std::string> metricToString = {
     {DataFlowMetric::kAvgE2ELatency, "Avg end-to-end Latency (ms)"},
     {DataFlowMetric::kMinE2ELatency, "Min end-to-end Latency (ms)"},
     {DataFlowMetric::kMinMessageID, "Min Latency Message No"},
+    {DataFlowMetric::kP50E2ELatency, "50th percentile end-to-end Latency (ms)"},
+    {DataFlowMetric::kP99E2ELatency, "99th percentile end-to-end Latency (ms)"},
+    {DataFlowMetric::kP999E2ELatency, "99.9th percentile end-to-end Latency (ms)"},
     {DataFlowMetric::kNumDstMessages, "Number of messages"}};
 
+/**
+ * @brief The end-to-end latency metrics of a path.
+ *
+ * All the members are updated with atomic operations so that the latencies of a path can be
+ * recorded by multiple threads without locking. Latency sums and histograms are sharded per
+ * thread (a thread always uses the same shard) to avoid contention on the same cache lines.
+ */
 class PathMetrics {
  public:
-  PathMetrics() {
-    path = "";
-    metrics[DataFlowMetric::kMaxE2ELatency] = INT_MIN;
-    metrics[DataFlowMetric::kMaxMessageID] = -1;
-    metrics[DataFlowMetric::kAvgE2ELatency] = 0;
-    metrics[DataFlowMetric::kMinE2ELatency] = INT_MAX;
-    metrics[DataFlowMetric::kMinMessageID] = -1;
-    metrics[DataFlowMetric::kNumDstMessages] = 0;
-    num_skipped_messages = 0;
-  }
+  /// The number of shards of the latency sums and histograms.
+  static constexpr size_t kNumShards = 8;
 
+  /**
+   * @brief Construct a new PathMetrics object.
+   *
+   * @param path The path name (comma-separated operator names).
+   * @param operator_names The names of the operators of the path.
+   * @param num_last_messages_to_discard The number of latencies held back before being recorded.
+   */
+  PathMetrics(std::string path, std::vector<std::string> operator_names,
+              uint64_t num_last_messages_to_discard);
+  ~PathMetrics();
+
+  PathMetrics(const PathMetrics&) = delete;
+  PathMetrics& operator=(const PathMetrics&) = delete;
+
+  /// The number of latencies held back in the buffer of the last messages to discard.
   uint64_t get_buffer_size();
 
-  std::string path;
-  std::unordered_map<DataFlowMetric, double> metrics;
-  std::queue<double> latency_buffer;
-  uint64_t num_skipped_messages;
+  /**
+   * @brief Push a latency to the buffer of the last messages to discard.
+   *
+   * @param latency The latency in milliseconds.
+   * @param oldest_latency The latency that was pushed `num_last_messages_to_discard` calls ago.
+   * @return True if `oldest_latency` was set (i.e., the buffer was full), false otherwise.
+   */
+  bool push_latency(double latency, double& oldest_latency);
+
+  /**
+   * @brief Record a latency in the metrics of the path.
+   *
+   * @param latency The latency in milliseconds.
+   */
+  void record(double latency);
+
+  /**
+   * @brief Get the current value of a metric.
+   *
+   * @param metric The metric (must not be DataFlowMetric::kNumSrcMessages).
+   * @return The value of the metric.
+   */
+  double get_metric(DataFlowMetric metric) const;
+
+  std::string path;                         ///< The path name.
+  std::vector<std::string> operator_names;  ///< The names of the operators of the path.
+  uint64_t hash = 0;                        ///< The hash of the path name.
+  std::atomic<bool> is_updated{false};      ///< Whether a latency was reported for the path.
+  std::atomic<uint64_t> num_skipped_messages{0};
+
+ private:
+  struct alignas(64) Shard {
+    std::atomic<double> latency_sum{0};
+    HdrHistogram histogram;  ///< Histogram of the latencies in microseconds.
+  };
+
+  /// Get the shard of the calling thread (allocated on first use).
+  Shard& shard();
+
+  std::array<std::atomic<Shard*>, kNumShards> shards_{};
+
+  uint64_t latency_buffer_size_ = 0;
+  std::unique_ptr<std::atomic<double>[]> latency_buffer_;
+  std::atomic<uint64_t> num_pushed_latencies_{0};
+
+  std::atomic<uint64_t> num_dst_messages_{0};
+  std::atomic<double> max_latency_{static_cast<double>(INT_MIN)};
+  std::atomic<double> min_latency_{static_cast<double>(INT_MAX)};
+  std::atomic<int64_t> max_message_id_{-1};
+  std::atomic<int64_t> min_message_id_{-1};
 };
 
 /**
@@ -84,13 +162,15 @@ class PathMetrics {
  * between the root operators and leaf operators. This class is used by the developers to get the
  * metrics data for flow during the execution of the application and at the end of it.
  *
- * This class uses mutex locks on metric properties so that multiple threads on multiple operators
- * can update the metrics without conflicts.
+ * Paths are interned to integer IDs (when the graph is initialized, or when a path is first seen)
+ * in a lock-free table, and the metrics of a path are updated with atomic operations, so that
+ * multiple threads on multiple operators can update the metrics without locking. Log entries are
+ * pushed to a lock-free ring buffer which is written to the log file by a background thread.
  *
  */
 class DataFlowTracker {
  public:
-  DataFlowTracker() {}
+  DataFlowTracker();
 
   ~DataFlowTracker();
 
@@ -130,15 +210,25 @@ class DataFlowTracker {
    * receive timestamp, message publish timestamp) is logged in a file. The logging does not take
    * into account the number of message to skip or discard or the threshold latency.
    *
-   * This function buffers a number of lines set by the @num_buffered_messages parameter before
-   * flushing the buffer to the log file.
+   * Log entries are buffered in a ring buffer of (at least) @num_buffered_messages entries and
+   * written to the log file by a background thread, so that logging does not block the operators.
+   *
+   * With DataFlowLogFormat::kBinary, the log file is a compact binary trace (see
+   * DataFlowTraceHeader) made of fixed-size records and of a table of the operator names, which
+   * can be converted to the Chrome trace (Perfetto) JSON format with the
+   * `convert_flow_tracking_trace.py` script.
    *
    * @param filename The name of the log file.
-   * @param num_buffered_messages The number of messages to be buffered before flushing the buffer
+   * @param num_buffered_messages The number of messages that can be buffered before being written
    * to the log file.
+   * @param log_format The format of the log file.
+   * @param use_mmap Whether to write a binary log file through a memory-mapped window of the file
+   * instead of a user-space buffer (ignored for the text format).
    */
   void enable_logging(std::string filename = kDefaultLogfileName,
-                      uint64_t num_buffered_messages = kDefaultNumBufferedMessages);
+                      uint64_t num_buffered_messages = kDefaultNumBufferedMessages,
+                      DataFlowLogFormat log_format = DataFlowLogFormat::kText,
+                      bool use_mmap = false);
 
   /**
    * @brief Print the result of the data flow tracking in pretty-printed format to the standard
@@ -147,13 +237,40 @@ class DataFlowTracker {
    */
   void print() const;
 
+  /**
+   * @brief Intern the paths from the root operators to the leaf operators of a graph.
+   *
+   * This is called by the executor when the graph is initialized so that path IDs do not need to
+   * be created while the application is running. Paths that are not found in the graph (e.g.,
+   * paths spanning multiple fragments) are interned when they are first seen.
+   *
+   * If no path has been interned yet, the path table is enlarged to twice the number of paths of
+   * the graph when it is smaller, so that all the paths of the graph can be tracked.
+   *
+   * @param graph The operator graph.
+   */
+  void add_graph_paths(OperatorGraph& graph);
+
   /**
    * @brief Return the number of tracked paths.
    *
+   * Paths that could not be tracked because the path table is full are not included (see
+   * get_num_dropped_paths()).
+   *
    * @return The number of tracked paths.
    */
   int get_num_paths();
 
+  /**
+   * @brief Return the number of paths that are not tracked because the path table is full.
+   *
+   * The capacity of the table can be increased with the `HOLOSCAN_FLOW_TRACKING_MAX_PATHS`
+   * environment variable.
+   *
+   * @return The number of untracked paths.
+   */
+  uint64_t get_num_dropped_paths() const;
+
   /**
    * @brief Return an array of strings which are path names. Each path name is a
    * comma-separated list of Operator names in a path. The paths are agnostic to the edges between
@@ -200,6 +317,24 @@ class DataFlowTracker {
   // because the cyclic paths are updated from there, instead of DFFTCollector
   friend class AnnotatedDoubleBufferReceiver;
 
+  /**
+   * @brief Get the ID of a path, interning it if it is not tracked yet.
+   *
+   * The lookup is lock-free and does not allocate memory once the path is interned.
+   *
+   * @param path The timestamped path of a message label.
+   * @return The ID of the path, or kInvalidPathId if the path cannot be tracked.
+   */
+  uint32_t path_id(const MessageLabel::TimestampedPath& path);
+
+  /**
+   * @brief Get the ID of a path, interning it if it is not tracked yet.
+   *
+   * @param pathstring The path name string.
+   * @return The ID of the path, or kInvalidPathId if the path cannot be tracked.
+   */
+  uint32_t path_id(const std::string& pathstring);
+
   /**
    * @brief Update the tracker with the current latency for a given path.
    *
@@ -213,6 +348,17 @@ class DataFlowTracker {
    */
   void update_latency(std::string pathstring, double current_latency);
 
+  /**
+   * @brief Update the tracker with the current latency for the path with the given ID.
+   *
+   * This is the lock-free and allocation-free version of `update_latency` used while the
+   * application is running.
+   *
+   * @param path_id The ID of the path (see `path_id()`).
+   * @param current_latency The current latency value.
+   */
+  void update_latency(uint32_t path_id, double current_latency);
+
   /**
    * @brief Update the tracker with the number of published messages for a given source
    * Operator.
@@ -227,21 +373,41 @@ class DataFlowTracker {
 
   /**
    * @brief Writes to a log file only if file logging is enabled. Otherwise, the
-   * function does nothing. It also takes care of buffering the messages and flushing them to the
-   * log file periodically.
+   * function does nothing. The text is written by the background log writer.
    *
    * @param text The new text to be written to the log file.
    */
   void write_to_logfile(std::string text);
 
+  /**
+   * @brief Log all the paths of a message label if file logging is enabled.
+   *
+   * The timestamps are copied to the log ring buffer and formatted by the background log writer,
+   * so that no string is built by the calling thread.
+   *
+   * @param label The message label to log.
+   */
+  void write_to_logfile(const MessageLabel& label);
+
+  /**
+   * @brief Log a timestamped path if file logging is enabled.
+   *
+   * @param path The path to log.
+   */
+  void write_to_logfile(const MessageLabel::TimestampedPath& path);
+
  private:
   std::map<std::string, uint64_t>
       source_messages_;  ///< The map of source names to the number of published messages.
   std::mutex source_messages_mutex_;  ///< The mutex for the source_messages_.
 
-  std::map<std::string, std::shared_ptr<holoscan::PathMetrics>>
-      all_path_metrics_;               ///< The map of path names to the path metrics.
-  std::mutex all_path_metrics_mutex_;  ///< The mutex for the all_path_metrics_.
+  /// The open-addressing table of the interned paths. The index of a path is its ID.
+  std::unique_ptr<std::atomic<PathMetrics*>[]> all_path_metrics_;
+  size_t max_num_paths_ = 0;  ///< The capacity of the path table (a power of two).
+  std::atomic<size_t> num_interned_paths_{0};  ///< The number of paths in the path table.
+  /// The names of the paths that could not be interned because the path table is full.
+  std::unordered_set<std::string> dropped_paths_;
+  mutable std::mutex dropped_paths_mutex_;  ///< The mutex for dropped_paths_.
 
   /// The number of messages to skip at the beginning of the execution of an application graph.
   /// This is also known as the warm-up period.
@@ -254,15 +420,57 @@ class DataFlowTracker {
       kDefaultNumLastMessagesToDiscard;  ///< The number of messages to discard at the end of the
                                          ///< execution of an application graph.
 
-  bool is_file_logging_enabled_ = false;  ///< The variable to indicate if file logging is enabled.
-  std::string logger_filename_;           ///< The name of the log file.
+  struct LogRecord;
+
+  /// Find the interned path with the given hash and name (kInvalidPathId if not found).
+  template <typename MatchT>
+  uint32_t find_path(uint64_t hash, MatchT&& matches) const;
+  /// Intern a new path (or get the ID of the path if it was interned concurrently).
+  uint32_t intern_path(uint64_t hash, std::string pathstring,
+                       std::vector<std::string> operator_names);
+  /// Replace the (empty) path table with a table of the given capacity (a power of two).
+  void reset_path_table(size_t max_num_paths);
+
+  /// Push a message label (or a single path) to the log ring buffer.
+  void enqueue_log_record(const MessageLabel::TimestampedPath* const* paths, size_t num_paths);
+  /// Write the buffered log entries to the log file and return the number of written entries.
+  size_t drain_log_records();
+  /// The loop of the background log writer.
+  void run_log_writer();
+  /// Write a log entry to the binary trace (called by the log writer).
+  void write_trace_entry(uint32_t num_paths, const uint32_t* path_ids, const int64_t* timestamps);
+  /// Drain the log records and flush the log file if any entry was written.
+  void flush_logfile();
+
+  /// The variable to indicate if file logging is enabled.
+  std::atomic<bool> is_file_logging_enabled_{false};
+  std::string logger_filename_;  ///< The name of the log file.
   uint64_t num_buffered_messages_ =
-      100;  ///< The number of messages to be buffered before flushing the buffer to the log file.
+      100;  ///< The number of messages that can be buffered before being written to the log file.
   std::ofstream logger_ofstream_;  ///< The output file stream for the log file.
-
-  std::vector<std::string> buffered_messages_;  ///< The buffer for the log file.
+  /// The format of the log file.
+  DataFlowLogFormat log_format_ = DataFlowLogFormat::kText;
+  bool use_mmap_ = false;             ///< Whether to memory-map the binary log file.
+  DataFlowTraceWriter trace_writer_;  ///< The writer of the binary log file.
+  /// The number of log entries that could not be written to the binary log file.
+  std::atomic<uint64_t> num_dropped_log_entries_{0};
+
+  std::unique_ptr<LogRecord[]> log_records_;  ///< The lock-free (MPSC) ring buffer of log entries.
+  uint64_t log_records_mask_ = 0;             ///< The capacity of the ring buffer minus one.
+  std::atomic<uint64_t> log_enqueue_pos_{0};  ///< The next position to write in the ring buffer.
+  uint64_t log_dequeue_pos_ = 0;  ///< The next position to read (used by the log writer only).
+
+  std::vector<std::string> buffered_messages_;  ///< Text entries (and entries that did not fit in
+                                                ///< the ring buffer) waiting to be written.
+  /// Binary log entries that did not fit in the ring buffer: (path IDs, timestamps).
+  std::vector<std::pair<std::vector<uint32_t>, std::vector<int64_t>>> buffered_entries_;
   std::mutex buffered_messages_mutex_;          ///< The mutex for the buffered_messages_.
 
+  std::thread log_writer_thread_;             ///< The background log writer.
+  std::atomic<bool> log_writer_stop_{false};  ///< Whether the log writer must stop.
+  std::mutex log_writer_mutex_;               ///< The mutex for log_writer_cv_.
+  std::condition_variable log_writer_cv_;     ///< Wakes up the log writer when it must stop.
+
   uint64_t logfile_messages_ =
       0;  ///< The number of messages logged to the log file, used for writing to the log file.
 };
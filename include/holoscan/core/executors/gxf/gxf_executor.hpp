@@ -114,8 +114,8 @@ class GXFExecutor : public holoscan::Executor {
    *
    * If there is no condition specified for the port, a default condition
    * (MessageAvailableCondition) is created.
-   * It currently supports ConditionType::kMessageAvailable and ConditionType::kNone condition
-   * types.
+   * It currently supports ConditionType::kMessageAvailable,
+   * ConditionType::kBatchMessageAvailable and ConditionType::kNone condition types.
    *
    * This function is a static function so that it can be called from other classes without
    * dependency on this class.
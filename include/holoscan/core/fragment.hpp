@@ -28,6 +28,7 @@
 #include <unordered_set>
 #include <tuple>
 #include <utility>  // for std::pair
+#include <vector>
 
 #include "common.hpp"
 #include "config.hpp"
@@ -35,6 +36,7 @@
 #include "executor.hpp"
 #include "graph.hpp"
 #include "network_context.hpp"
+#include "operator_stats.hpp"
 #include "scheduler.hpp"
 
 namespace holoscan {
@@ -627,6 +629,35 @@ class Fragment {
    */
   DataFlowTracker* data_flow_tracker() { return data_flow_tracker_.get(); }
 
+  /**
+   * @brief Turn on the collection of per-operator execution statistics.
+   *
+   * This must be called before the fragment is run. The number of `compute()` calls, their
+   * duration, the time operators wait between two calls, the number of messages queued on their
+   * input ports and the number of messages emitted on their output ports are then recorded for
+   * every operator of the fragment.
+   *
+   * The statistics can also be enabled by setting the `HOLOSCAN_OPERATOR_STATS` environment
+   * variable to `true` (in which case they are printed at the end of the run).
+   *
+   * @param print_on_exit Whether to log the statistics when the fragment stops running.
+   */
+  void enable_operator_stats(bool print_on_exit = true);
+
+  /// Whether the collection of per-operator execution statistics is enabled.
+  bool is_operator_stats_enabled() const { return operator_stats_enabled_; }
+
+  /**
+   * @brief Get a snapshot of the execution statistics of the operators.
+   *
+   * This can be called while the fragment is running or after it has run.
+   *
+   * @return The statistics of the operators of the fragment (empty if the statistics are not
+   * enabled). For an application, the statistics of the operators of all the fragments run by this
+   * process are returned and the operator names are prefixed with the fragment names.
+   */
+  virtual std::vector<OperatorStatsSnapshot> operator_stats();
+
   /**
    * @brief Calls compose() if the graph is not composed yet.
    */
@@ -684,6 +715,8 @@ class Fragment {
   std::shared_ptr<NetworkContext> network_context_;  ///< The network_context used by the executor
   std::shared_ptr<DataFlowTracker> data_flow_tracker_;  ///< The DataFlowTracker for the fragment
   bool is_composed_ = false;                            ///< Whether the graph is composed or not.
+  bool operator_stats_enabled_ = false;  ///< Whether the operator statistics are collected.
+  bool print_operator_stats_ = false;    ///< Whether the operator statistics are printed at exit.
 };
 
 }  // namespace holoscan
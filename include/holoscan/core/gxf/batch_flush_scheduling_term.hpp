@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_GXF_BATCH_FLUSH_SCHEDULING_TERM_HPP
+#define HOLOSCAN_CORE_GXF_BATCH_FLUSH_SCHEDULING_TERM_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "gxf/std/receiver.hpp"
+#include "gxf/std/scheduling_term.hpp"
+
+namespace holoscan::gxf {
+
+/**
+ * @brief GXF scheduling term for operators batching the messages of several receivers.
+ *
+ * The term permits execution when any receiver of its entity has a message, or when the flush
+ * requested by the operator with `request_flush()` is due. It lets an operator keep a partial
+ * batch across executions (e.g., frames of several streams) and still be executed once the batch
+ * must be flushed, even if no other message arrives. The receivers should have no other
+ * condition, so that one of them getting a message is enough to execute the operator.
+ *
+ * The flush delay is measured with the timestamps given by the scheduler (its clock), from the
+ * first state update after the request.
+ *
+ * This component is used through holoscan::BatchFlushCondition.
+ */
+class BatchFlushSchedulingTerm : public nvidia::gxf::SchedulingTerm {
+ public:
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t initialize() override;
+
+  gxf_result_t check_abi(int64_t timestamp, nvidia::gxf::SchedulingConditionType* type,
+                         int64_t* target_timestamp) const override;
+  gxf_result_t onExecute_abi(int64_t dt) override;
+  gxf_result_t update_state_abi(int64_t timestamp) override;
+
+  /**
+   * @brief Request an execution once the given delay has passed, even without a new message.
+   *
+   * A request is valid for one execution: it is typically renewed at the end of each execution
+   * as long as the operator has a pending batch. Can be called from any thread.
+   *
+   * @param delay_ns The delay in nanoseconds (a negative value is handled as 0).
+   */
+  void request_flush(int64_t delay_ns);
+
+ private:
+  /// Value of requested_delay_ns_ when no flush was requested since the last state update
+  static constexpr int64_t kNoRequest = -1;
+
+  /// Whether any receiver has a message (main or back stage).
+  bool has_message() const;
+
+  std::vector<nvidia::gxf::Handle<nvidia::gxf::Receiver>> receivers_;
+  std::atomic<int64_t> requested_delay_ns_{kNoRequest};
+  /// Time at which the requested flush is due, or -1 if no flush is pending
+  int64_t flush_time_ = -1;
+};
+
+}  // namespace holoscan::gxf
+
+#endif /* HOLOSCAN_CORE_GXF_BATCH_FLUSH_SCHEDULING_TERM_HPP */
@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef HOLOSCAN_CORE_GXF_BATCH_MESSAGE_AVAILABLE_SCHEDULING_TERM_HPP
+#define HOLOSCAN_CORE_GXF_BATCH_MESSAGE_AVAILABLE_SCHEDULING_TERM_HPP
+
+#include <cstdint>
+
+#include "gxf/std/receiver.hpp"
+#include "gxf/std/scheduling_term.hpp"
+
+namespace holoscan::gxf {
+
+/**
+ * @brief GXF scheduling term that batches the messages of a receiver by count or by time.
+ *
+ * The term permits execution when the receiver has at least `max_batch_size` messages, or when
+ * it has at least one message and `max_delay_ns` nanoseconds have passed since the term first
+ * saw the receiver non-empty (the batch is then flushed with the messages available). While a
+ * partial batch is pending, the term waits for the flush time so that the scheduler checks it
+ * again even if no other message arrives.
+ *
+ * The delay is measured with the timestamps given by the scheduler (its clock), so the messages
+ * do not need a timestamp component.
+ *
+ * This component is used through holoscan::BatchMessageAvailableCondition.
+ */
+class BatchMessageAvailableSchedulingTerm : public nvidia::gxf::SchedulingTerm {
+ public:
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t initialize() override;
+
+  gxf_result_t check_abi(int64_t timestamp, nvidia::gxf::SchedulingConditionType* type,
+                         int64_t* target_timestamp) const override;
+  gxf_result_t onExecute_abi(int64_t dt) override;
+  gxf_result_t update_state_abi(int64_t timestamp) override;
+
+ private:
+  /// Number of messages in the receiver (main and back stages).
+  uint64_t num_messages() const;
+
+  nvidia::gxf::Parameter<nvidia::gxf::Handle<nvidia::gxf::Receiver>> receiver_;
+  nvidia::gxf::Parameter<int64_t> max_batch_size_;
+  nvidia::gxf::Parameter<int64_t> max_delay_ns_;
+
+  /// Time at which the term first saw the current (partial) batch, or -1 if the receiver is empty
+  int64_t batch_start_time_ = -1;
+};
+
+}  // namespace holoscan::gxf
+
+#endif /* HOLOSCAN_CORE_GXF_BATCH_MESSAGE_AVAILABLE_SCHEDULING_TERM_HPP */
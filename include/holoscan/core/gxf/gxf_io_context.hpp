@@ -27,6 +27,8 @@
 namespace holoscan::gxf {
 
 nvidia::gxf::Receiver* get_gxf_receiver(const std::unique_ptr<IOSpec>& input_spec);
+nvidia::gxf::Receiver* get_gxf_receiver(IOSpec* input_spec);
+nvidia::gxf::Transmitter* get_gxf_transmitter(IOSpec* output_spec);
 
 /**
  * @brief Class to hold the input context for a GXF Operator.
@@ -59,9 +61,25 @@ class GXFInputContext : public InputContext {
    */
   gxf_context_t gxf_context() const;
 
+  /**
+   * @brief Resolve the GXF receivers of all the input ports once.
+   *
+   * The receivers are then not looked up again on each receive. This is meant for a context
+   * that is reused across ticks (e.g., the one created by GXFWrapper when the operator starts).
+   */
+  void cache_connectors();
+
  protected:
   bool empty_impl(const char* name = nullptr) override;
   std::any receive_impl(const char* name = nullptr, bool no_error_message = false) override;
+  nvidia::gxf::Entity receive_entity_impl(IOSpec* input_spec) override;
+  size_t num_available_impl(IOSpec* input_spec) override;
+
+  /// Get the GXF receiver of the input port (from the cache if `cache_connectors()` was called).
+  nvidia::gxf::Receiver* gxf_receiver(IOSpec* input_spec);
+
+ private:
+  std::unordered_map<const IOSpec*, nvidia::gxf::Receiver*> gxf_receivers_;
 };
 
 /**
@@ -95,9 +113,32 @@ class GXFOutputContext : public OutputContext {
    */
   gxf_context_t gxf_context() const;
 
+  /**
+   * @brief Resolve the GXF transmitters of all the output ports once.
+   *
+   * The transmitters are then not looked up again on each emit. This is meant for a context
+   * that is reused across ticks (e.g., the one created by GXFWrapper when the operator starts).
+   * The messages emitted through cached transmitters are counted in the operator statistics
+   * when they are enabled.
+   */
+  void cache_connectors();
+
  protected:
   void emit_impl(std::any data, const char* name = nullptr,
                  OutputType out_type = OutputType::kSharedPointer) override;
+
+  /// The transmitters of an output port.
+  struct Transmitters {
+    holoscan::Transmitter* transmitter = nullptr;  ///< nullptr if not a holoscan::Transmitter
+    nvidia::gxf::Transmitter* gxf_transmitter = nullptr;
+    int stats_index = -1;  ///< Index of the port in the operator statistics (-1 if not counted)
+  };
+
+  /// Get the transmitters of the output port (from the cache if `cache_connectors()` was called).
+  Transmitters transmitters(IOSpec* output_spec);
+
+ private:
+  std::unordered_map<const IOSpec*, Transmitters> transmitters_;
 };
 
 }  // namespace holoscan::gxf
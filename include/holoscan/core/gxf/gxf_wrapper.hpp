@@ -18,6 +18,10 @@
 #ifndef HOLOSCAN_CORE_GXF_GXF_WRAPPER_HPP
 #define HOLOSCAN_CORE_GXF_GXF_WRAPPER_HPP
 
+#include <memory>
+#include <vector>
+
+#include "holoscan/core/gxf/gxf_execution_context.hpp"
 #include "holoscan/core/gxf/gxf_operator.hpp"
 
 #include "gxf/std/codelet.hpp"
@@ -52,6 +56,12 @@ class GXFWrapper : public nvidia::gxf::Codelet {
   void store_exception();
 
   Operator* op_ = nullptr;
+  /// Execution context (with its input/output contexts) created at start and reused on each tick
+  std::unique_ptr<GXFExecutionContext> exec_context_;
+  /// Execution statistics counters of the operator (nullptr if not enabled)
+  OperatorStats* stats_ = nullptr;
+  /// The receivers of the input ports, in the order of the statistics' input indices
+  std::vector<nvidia::gxf::Receiver*> stats_receivers_;
 };
 
 }  // namespace holoscan::gxf
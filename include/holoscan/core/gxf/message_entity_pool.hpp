@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_GXF_MESSAGE_ENTITY_POOL_HPP
+#define HOLOSCAN_CORE_GXF_MESSAGE_ENTITY_POOL_HPP
+
+#include <gxf/core/gxf.h>
+
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "gxf/core/entity.hpp"
+#include "gxf/core/expected.hpp"
+#include "gxf/core/handle.hpp"
+#include "holoscan/core/message.hpp"
+
+namespace holoscan::gxf {
+
+/**
+ * @brief Pool of GXF entities holding a holoscan::Message component.
+ *
+ * Emitting a value (std::shared_ptr or std::any) from a native operator wraps it in a GXF entity
+ * with a Message component. Instead of creating a new entity for every emit() call, the output
+ * context reuses the entities of this pool: an entity can be reused once its reference count
+ * drops back to one, i.e., when the pool holds the only reference because all the receivers have
+ * consumed the message.
+ *
+ * One pool is owned by each holoscan::Transmitter (output port). The pool is not thread-safe;
+ * it is only used by the operator owning the output port.
+ *
+ * The value of a consumed message is released by the next acquire() call (or by clear()). Until
+ * then, the pooled entity keeps it alive, so the pool capacity should stay small.
+ */
+class MessageEntityPool {
+ public:
+  /// Default number of entities per pool.
+  static constexpr size_t kDefaultCapacity = 4;
+
+  /**
+   * @brief Construct a new MessageEntityPool object.
+   *
+   * The capacity can be overridden by the `HOLOSCAN_MESSAGE_POOL_SIZE` environment variable
+   * (zero disables pooling).
+   */
+  MessageEntityPool();
+
+  /**
+   * @brief Construct a new MessageEntityPool object with the given capacity.
+   *
+   * @param capacity The maximum number of pooled entities (zero disables pooling).
+   */
+  explicit MessageEntityPool(size_t capacity);
+
+  MessageEntityPool(const MessageEntityPool&) = delete;
+  MessageEntityPool& operator=(const MessageEntityPool&) = delete;
+
+  /**
+   * @brief Get an entity whose Message component holds `value`.
+   *
+   * A free pooled entity is reused if any. Otherwise, a new entity is created and added to the
+   * pool if the pool is not full. The values held by the other free pooled entities are released.
+   *
+   * @param context The GXF context.
+   * @param value The value of the message (moved into the Message component).
+   * @return The entity to publish, or an error if the entity cannot be created.
+   */
+  nvidia::gxf::Expected<nvidia::gxf::Entity> acquire(gxf_context_t context, std::any&& value);
+
+  /// Release all the pooled entities (must be called before the GXF context is destroyed).
+  void clear();
+
+  /// The maximum number of pooled entities.
+  size_t capacity() const { return capacity_; }
+  /// The number of pooled entities.
+  size_t size() const { return entries_.size(); }
+  /// The number of acquire() calls that reused a pooled entity.
+  uint64_t reuse_count() const { return reuse_count_; }
+
+ private:
+  struct Entry {
+    nvidia::gxf::Entity entity;
+    nvidia::gxf::Handle<Message> message;
+  };
+
+  /// Create an entity with a Message component holding `value`.
+  static nvidia::gxf::Expected<Entry> create_entry(gxf_context_t context, std::any&& value);
+
+  size_t capacity_ = kDefaultCapacity;
+  std::vector<Entry> entries_;
+  size_t next_index_ = 0;  ///< Index of the entry checked first (the least recently used one).
+  uint64_t reuse_count_ = 0;
+};
+
+}  // namespace holoscan::gxf
+
+#endif /* HOLOSCAN_CORE_GXF_MESSAGE_ENTITY_POOL_HPP */
@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef HOLOSCAN_CORE_GXF_SHARED_WORKER_POOL_HPP
+#define HOLOSCAN_CORE_GXF_SHARED_WORKER_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "holoscan/core/system/topology.hpp"
+
+namespace holoscan::gxf {
+
+/**
+ * @brief Pool of worker threads shared by several schedulers of the same process.
+ *
+ * Each fragment of an application has its own GXF context and scheduler. When several fragments
+ * run in the same process, their schedulers can attach to the same pool (identified by its name)
+ * instead of creating their own worker threads, so that the process does not run more workers
+ * than there are CPUs.
+ *
+ * Each worker executes the work of the attached clients by decreasing priority (clients of the
+ * same priority are served in turn). A client can limit the number of workers executing its work
+ * at the same time.
+ *
+ * Pools are reference counted: a pool is created by the first `acquire()` call for its name and
+ * its workers are stopped when the last reference is released.
+ */
+class SharedWorkerPool {
+ public:
+  /**
+   * @brief Client of the pool (typically a scheduler).
+   */
+  class Client {
+   public:
+    virtual ~Client() = default;
+
+    /**
+     * @brief Execute at most one unit of work.
+     *
+     * This is called concurrently by the workers of the pool.
+     *
+     * @param worker_index The index of the calling worker in the pool.
+     * @return true if some work was executed, false if the client had nothing to execute.
+     */
+    virtual bool run_once(size_t worker_index) = 0;
+  };
+
+  /// Options used to create a pool (ignored if the pool already exists).
+  struct Options {
+    size_t num_workers = 1;
+    /// CPU each worker is pinned to (worker i uses the entry i modulo the number of entries)
+    std::vector<int64_t> cpu_cores;
+    /// NUMA node each worker is pinned to (ignored if `cpu_cores` is not empty)
+    std::vector<int64_t> numa_nodes;
+  };
+
+  ~SharedWorkerPool();
+
+  SharedWorkerPool(const SharedWorkerPool&) = delete;
+  SharedWorkerPool& operator=(const SharedWorkerPool&) = delete;
+
+  /**
+   * @brief Get the pool with the given name, creating it if it does not exist.
+   *
+   * @param name The name of the pool.
+   * @param options The options used if the pool is created.
+   * @return The pool.
+   */
+  static std::shared_ptr<SharedWorkerPool> acquire(const std::string& name,
+                                                   const Options& options);
+
+  const std::string& name() const { return name_; }
+  size_t num_workers() const { return threads_.size(); }
+
+  /**
+   * @brief Attach a client to the pool.
+   *
+   * @param client The client (it must stay valid until it is detached).
+   * @param priority The priority of the client (clients with a higher priority are served first).
+   * @param max_workers The maximum number of workers executing the work of the client at the
+   * same time (0 means no limit).
+   */
+  void attach(Client* client, int64_t priority, size_t max_workers);
+
+  /**
+   * @brief Detach a client from the pool.
+   *
+   * This waits until no worker executes the work of the client anymore. It must not be called
+   * from a worker of the pool.
+   *
+   * @param client The client.
+   */
+  void detach(Client* client);
+
+  /**
+   * @brief Notify the pool that a client has new work to execute.
+   *
+   * Idle workers sleep until they are notified, so a client must call this every time it has new
+   * work (a worker that finds no work after a notification goes back to sleep).
+   */
+  void notify();
+
+ private:
+  struct ClientEntry;
+  using ClientList = std::vector<std::shared_ptr<ClientEntry>>;
+
+  SharedWorkerPool(std::string name, Options options);
+
+  void worker_thread(size_t worker_index);
+  /// Execute one unit of work of the client if its quota allows it.
+  bool run_client(ClientEntry& entry, size_t worker_index);
+  void pin_worker(size_t worker_index);
+
+  const std::string name_;
+  const Options options_;
+  std::unique_ptr<Topology> topology_;
+  std::vector<std::thread> threads_;
+
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable detach_cv_;
+  /// Attached clients ordered by decreasing priority (replaced, never modified, under mutex_)
+  std::shared_ptr<const ClientList> clients_;
+  size_t pending_notifications_ = 0;
+  bool stopping_ = false;
+};
+
+}  // namespace holoscan::gxf
+
+#endif /* HOLOSCAN_CORE_GXF_SHARED_WORKER_POOL_HPP */
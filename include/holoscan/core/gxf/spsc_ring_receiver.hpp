@@ -0,0 +1,68 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef HOLOSCAN_CORE_GXF_SPSC_RING_RECEIVER_HPP
+#define HOLOSCAN_CORE_GXF_SPSC_RING_RECEIVER_HPP
+
+#include <cstdint>
+#include <memory>
+
+#include "gxf/std/receiver.hpp"
+#include "holoscan/core/spsc_ring.hpp"
+
+namespace holoscan::gxf {
+
+/**
+ * @brief GXF receiver queuing the messages in a lock-free single-producer/single-consumer ring.
+ *
+ * Unlike nvidia::gxf::DoubleBufferReceiver, the receiver has no back stage: a message pushed by
+ * the upstream entity is available to the receiving entity right away, without a mutex or a
+ * synchronization step. `back_size()` is therefore always 0 and `sync()` does nothing.
+ *
+ * The receiver must have a single upstream transmitter (one connection), which is always the
+ * case for the input ports of operators in a fragment.
+ *
+ * The `capacity` and `policy` parameters have the same meaning as for DoubleBufferReceiver
+ * (policy 0: drop the oldest message, 1: reject the new message, 2: fault).
+ *
+ * This component is used through holoscan::SpscRingReceiver.
+ */
+class SpscRingReceiver : public nvidia::gxf::Receiver {
+ public:
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t initialize() override;
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t pop_abi(gxf_uid_t* uid) override;
+  gxf_result_t push_abi(gxf_uid_t other) override;
+  gxf_result_t peek_abi(gxf_uid_t* uid, int32_t index) override;
+  gxf_result_t peek_back_abi(gxf_uid_t* uid, int32_t index) override;
+  size_t capacity_abi() override;
+  size_t size_abi() override;
+  gxf_result_t receive_abi(gxf_uid_t* uid) override;
+  size_t back_size_abi() override;
+  gxf_result_t sync_abi() override;
+
+ private:
+  nvidia::gxf::Parameter<uint64_t> capacity_;
+  nvidia::gxf::Parameter<uint64_t> policy_;
+
+  std::unique_ptr<SpscRing<gxf_uid_t>> ring_;
+};
+
+}  // namespace holoscan::gxf
+
+#endif /* HOLOSCAN_CORE_GXF_SPSC_RING_RECEIVER_HPP */
@@ -0,0 +1,206 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef HOLOSCAN_CORE_GXF_WORK_STEALING_SCHEDULER_HPP
+#define HOLOSCAN_CORE_GXF_WORK_STEALING_SCHEDULER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "gxf/std/clock.hpp"
+#include "gxf/std/scheduler.hpp"
+#include "holoscan/core/gxf/shared_worker_pool.hpp"
+#include "holoscan/core/system/topology.hpp"
+
+namespace holoscan::gxf {
+
+/**
+ * @brief Counters of the scheduling decisions made by a WorkStealingScheduler.
+ */
+struct WorkStealingSchedulerStats {
+  uint64_t executions = 0;     ///< Number of entity executions (ticks or condition checks)
+  uint64_t local_pops = 0;     ///< Executions of entities taken from the worker's own queue
+  uint64_t steals = 0;         ///< Executions of entities stolen from another worker's queue
+  uint64_t affinity_hits = 0;  ///< Executions on the worker that last executed the entity
+  uint64_t migrations = 0;     ///< Executions on another worker than the one that last ran it
+  uint64_t idle_waits = 0;  ///< Number of times a worker found no work (own workers only)
+  uint64_t event_wakeups = 0;  ///< Waiting entities queued because of an event notification
+  uint64_t timed_wakeups = 0;  ///< Entities queued because their target time was reached
+  uint64_t polls = 0;          ///< Waiting entities queued by the periodic condition check
+};
+
+/**
+ * @brief GXF scheduler executing entities on a pool of workers with work stealing.
+ *
+ * Each worker has its own queue of ready entities. An entity that is ready again after its
+ * execution is queued on the same worker, and an entity that becomes ready (on an event or when
+ * its target time is reached) is queued on the worker that last executed it, so that the data
+ * it touches stays in the caches of that worker. A worker without queued entities steals from
+ * the other workers.
+ *
+ * Workers can be pinned to CPU cores or NUMA nodes, and entities can be pinned to a worker (such
+ * entities are never stolen).
+ *
+ * When `python_workers` is set, the entities listed in `python_operators` (the operators
+ * implemented in Python) are only executed by these workers and the other entities only by the
+ * other workers: the Python operators take turns holding the GIL on a few workers instead of
+ * blocking all the workers while waiting for it.
+ *
+ * When `shared_pool` is set, the scheduler does not create its own workers but executes its
+ * entities on a SharedWorkerPool, shared with the other schedulers of the process that use the
+ * same pool name (e.g., the schedulers of several fragments running in the same process).
+ *
+ * This component is used through holoscan::WorkStealingScheduler.
+ */
+class WorkStealingScheduler : public nvidia::gxf::Scheduler, private SharedWorkerPool::Client {
+ public:
+  WorkStealingScheduler();
+  ~WorkStealingScheduler() override;
+
+  gxf_result_t registerInterface(nvidia::gxf::Registrar* registrar) override;
+  gxf_result_t initialize() override;
+  gxf_result_t deinitialize() override;
+
+  gxf_result_t prepare_abi(nvidia::gxf::EntityExecutor* executor) override;
+  gxf_result_t schedule_abi(gxf_uid_t eid) override;
+  gxf_result_t unschedule_abi(gxf_uid_t eid) override;
+  gxf_result_t runAsync_abi() override;
+  gxf_result_t stop_abi() override;
+  gxf_result_t wait_abi() override;
+  gxf_result_t event_notify_abi(gxf_uid_t eid, gxf_event_t event) override;
+
+  /**
+   * @brief Get the counters of the scheduling decisions.
+   *
+   * The counters can be read while the scheduler is running.
+   *
+   * @return The counters accumulated since the scheduler started.
+   */
+  WorkStealingSchedulerStats stats() const;
+
+ private:
+  struct EntityState;
+  struct Worker;
+
+  void worker_thread(size_t worker_index);
+  /// Execute one entity on a worker of the shared pool (SharedWorkerPool::Client interface).
+  bool run_once(size_t worker_index) override;
+  void dispatcher_thread();
+  /// Bind the calling worker thread to the CPU core or NUMA node configured for it.
+  void pin_worker(size_t worker_index);
+
+  EntityState* pop_local(Worker& worker);
+  /// Take an entity queued on another worker (skipping the workers that are locked, unless
+  /// `wait_for_lock` is true).
+  EntityState* steal(size_t thief_index, bool wait_for_lock = false);
+  void execute(size_t worker_index, EntityState* entity);
+  /// Queue the entity on a worker (the entity must be in the queued state).
+  void enqueue(EntityState* entity, size_t worker_index);
+  /// Queue the entity if it is in the given state. Returns false if it is not.
+  bool wake(EntityState* entity, int from_state, bool polled = false);
+  size_t preferred_worker(EntityState* entity);
+  void finish(gxf_result_t code);
+  int find_entity_affinity(gxf_uid_t eid) const;
+  /// Whether the entity is one of the `python_operators` (always false without `python_workers`)
+  bool is_python_entity(gxf_uid_t eid) const;
+  /// Whether the entity is executed by the worker (Python entities only run on Python workers)
+  bool runs_on(const EntityState* entity, const Worker& worker) const;
+
+  nvidia::gxf::Parameter<nvidia::gxf::Handle<nvidia::gxf::Clock>> clock_;
+  nvidia::gxf::Parameter<int64_t> worker_thread_number_;
+  nvidia::gxf::Parameter<bool> stop_on_deadlock_;
+  nvidia::gxf::Parameter<int64_t> stop_on_deadlock_timeout_;
+  nvidia::gxf::Parameter<int64_t> max_duration_ms_;
+  nvidia::gxf::Parameter<double> check_recession_period_ms_;
+  nvidia::gxf::Parameter<std::vector<int64_t>> worker_cpu_cores_;
+  nvidia::gxf::Parameter<std::vector<int64_t>> worker_numa_nodes_;
+  nvidia::gxf::Parameter<std::vector<std::string>> operator_affinity_;
+  nvidia::gxf::Parameter<std::string> shared_pool_;
+  nvidia::gxf::Parameter<int64_t> pool_priority_;
+  nvidia::gxf::Parameter<int64_t> pool_max_workers_;
+  nvidia::gxf::Parameter<std::vector<int64_t>> python_workers_;
+  nvidia::gxf::Parameter<std::vector<std::string>> python_operators_;
+
+  nvidia::gxf::EntityExecutor* executor_ = nullptr;
+  nvidia::gxf::Clock* clock_ptr_ = nullptr;
+  bool manual_clock_ = false;
+  std::unique_ptr<Topology> topology_;
+  /// Pool executing the entities (null if the scheduler has its own workers)
+  std::shared_ptr<SharedWorkerPool> pool_;
+  /// Entity name (operator name) to worker index, from the `operator_affinity` parameter
+  std::unordered_map<std::string, size_t> entity_affinity_;
+
+  mutable std::shared_mutex entities_mutex_;
+  std::unordered_map<gxf_uid_t, std::unique_ptr<EntityState>> entities_;
+
+  /// Protects `workers_` while it is rebuilt against stats() (the worker threads only start once
+  /// it is built)
+  mutable std::mutex workers_mutex_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  /// Indices of the workers executing the Python entities, and of the other workers (both empty
+  /// if the Python entities are not routed to dedicated workers)
+  std::vector<size_t> python_worker_indices_;
+  std::vector<size_t> native_worker_indices_;
+  std::vector<std::thread> threads_;
+  std::thread dispatcher_;
+  std::atomic<size_t> next_worker_{0};
+  std::atomic<int> num_idle_workers_{0};
+  /// Number of entities queued or being executed
+  std::atomic<int64_t> num_active_{0};
+  std::atomic<int64_t> num_done_{0};
+  /// Number of entities waiting for an asynchronous event
+  std::atomic<int64_t> num_event_waiting_{0};
+  std::atomic<bool> stopping_{false};
+  std::atomic<bool> running_{false};
+  std::atomic<gxf_result_t> result_{GXF_SUCCESS};
+  /// Number of executions that were not fruitless condition checks (used for deadlock detection)
+  std::atomic<uint64_t> activity_count_{0};
+
+  /// Entity waiting for a target time. The entry is stale if the entity was woken up by an event
+  /// before the target time (its state or its generation changed since).
+  struct TimedEntry {
+    int64_t target_time;
+    uint64_t generation;
+    EntityState* entity;
+
+    bool operator>(const TimedEntry& other) const { return target_time > other.target_time; }
+  };
+
+  // Entities waiting for a target time, ordered by time (protected by dispatcher_mutex_)
+  std::mutex dispatcher_mutex_;
+  std::condition_variable dispatcher_cv_;
+  std::priority_queue<TimedEntry, std::vector<TimedEntry>, std::greater<>> timed_entities_;
+
+  std::atomic<uint64_t> event_wakeups_{0};
+  std::atomic<uint64_t> timed_wakeups_{0};
+  std::atomic<uint64_t> polls_{0};
+};
+
+}  // namespace holoscan::gxf
+
+#endif /* HOLOSCAN_CORE_GXF_WORK_STEALING_SCHEDULER_HPP */
@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_HDR_HISTOGRAM_HPP
+#define HOLOSCAN_CORE_HDR_HISTOGRAM_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace holoscan {
+
+/**
+ * @brief High dynamic range (HDR) histogram of non-negative integer values.
+ *
+ * Values are recorded in buckets whose width grows with the magnitude of the value, so that any
+ * recorded value can be retrieved with a relative error below 1% (two significant decimal digits)
+ * from 0 to `kMaxValue`. Larger values are clamped to `kMaxValue`.
+ *
+ * Recording a value is a single relaxed atomic increment: it is lock-free, allocation-free and
+ * can be done concurrently from multiple threads. Reading the histogram while values are being
+ * recorded gives an approximate (but consistent enough) snapshot.
+ */
+class HdrHistogram {
+ public:
+  /// The largest value that can be recorded without being clamped (2^36, i.e., ~19 hours in us).
+  static constexpr int64_t kMaxValue = int64_t{1} << 36;
+
+  HdrHistogram();
+
+  HdrHistogram(const HdrHistogram&) = delete;
+  HdrHistogram& operator=(const HdrHistogram&) = delete;
+
+  /**
+   * @brief Record a value.
+   *
+   * Negative values are recorded as zero and values larger than `kMaxValue` as `kMaxValue`.
+   *
+   * @param value The value to record.
+   */
+  void record(int64_t value);
+
+  /// The number of recorded values.
+  uint64_t total_count() const;
+
+  /**
+   * @brief Add the counts of this histogram to the given counts.
+   *
+   * This is used to merge several histograms (e.g., per-thread shards) before computing
+   * percentiles with `value_at_percentile()`.
+   *
+   * @param counts The counts to add to (resized to `bucket_array_size()` if empty).
+   */
+  void add_to(std::vector<uint64_t>& counts) const;
+
+  /**
+   * @brief Get the value at the given percentile of the (merged) counts.
+   *
+   * The returned value is the highest value that is equivalent (within the histogram precision)
+   * to the value at the given percentile.
+   *
+   * @param counts The counts of the histogram (see `add_to()`).
+   * @param percentile The percentile, between 0 and 100.
+   * @return The value at the given percentile, or 0 if there is no recorded value.
+   */
+  static int64_t value_at_percentile(const std::vector<uint64_t>& counts, double percentile);
+
+  /// The number of counters of a histogram.
+  static size_t bucket_array_size();
+
+ private:
+  static size_t counts_index(int64_t value);
+  static int64_t highest_equivalent_value(size_t index);
+
+  std::unique_ptr<std::atomic<uint64_t>[]> counts_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_HDR_HISTOGRAM_HPP */
@@ -18,7 +18,9 @@
 #ifndef HOLOSCAN_CORE_IO_CONTEXT_HPP
 #define HOLOSCAN_CORE_IO_CONTEXT_HPP
 
+#include <algorithm>
 #include <any>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -237,25 +239,31 @@ class InputContext {
       // Note that the type of any_param is Parameter<typeT>*, not Parameter<typeT>.
       auto& param = *std::any_cast<Parameter<std::vector<IOSpec*>>*>(any_param);
 
-      std::vector<typename DataT::value_type> input_vector;
-      int num_inputs = param.get().size();
+      using ValueT = typename DataT::value_type;
+      std::vector<ValueT> input_vector;
+      // The receivers of the parameter are bound to the input ports ('<parameter name>:<index>'.
+      // e.g, 'receivers:0') created by the executor, so they are not looked up by name.
+      auto& input_specs = param.get();
+      int num_inputs = input_specs.size();
       input_vector.reserve(num_inputs);
 
       for (int index = 0; index < num_inputs; ++index) {
-        // Check if the input name points to the parameter name of the operator,
-        // and the parameter type is 'std::vector<holoscan::IOSpec*>'.
-        // In other words, find if there is a receiver with a specific label
-        // ('<parameter name>:<index>'. e.g, 'receivers:0') to return an object with
-        // 'std::vector<std::shared_ptr<DataT_ElementT>' type.
-        auto value = receive_impl(fmt::format("{}:{}", name, index).c_str(), true);
+        auto entity = receive_entity_impl(input_specs[index]);
+        if constexpr (!std::is_same_v<ValueT, std::any>) {
+          if (const ValueT* typed_value = get_message_value<ValueT>(entity)) {
+            input_vector.push_back(*typed_value);
+            continue;
+          }
+        }
+        auto value = entity_to_any(std::move(entity));
 
         try {
           // If the received data is nullptr, any_cast will try to cast to appropriate pointer
           // type. Otherwise it will register an error.
-          if constexpr (std::is_same_v<typename DataT::value_type, std::any>) {
+          if constexpr (std::is_same_v<ValueT, std::any>) {
             input_vector.push_back(std::move(value));
           } else {
-            auto casted_value = std::move(std::any_cast<typename DataT::value_type>(value));
+            auto casted_value = std::move(std::any_cast<ValueT>(value));
             input_vector.push_back(std::move(casted_value));
           }
         } catch (const std::bad_any_cast& e) {
@@ -266,7 +274,7 @@ class InputContext {
                           e.what());
           try {
             // An empty holoscan::gxf::Entity will be added to the vector.
-            typename DataT::value_type placeholder;
+            ValueT placeholder;
             input_vector.push_back(std::move(placeholder));
             error_message =
                 fmt::format("{}\tA placeholder value is added to the vector for input '{}:{}'.",
@@ -287,97 +295,81 @@ class InputContext {
           }
         }
       }
-      return std::any_cast<DataT>(input_vector);
+      return input_vector;
     } else {
       // If it is not a vector then try to get the input directly and convert for respective data
       // type for an input
-      auto value = receive_impl(name);
-      // If the received data is nullptr, then check whether nullptr or empty holoscan::gxf::Entity
-      // can be sent
-      if (value.type() == typeid(nullptr_t)) {
-        HOLOSCAN_LOG_DEBUG("nullptr is received from the input port with name '{}'", name);
-        // If it is a shared pointer, or raw pointer then return nullptr because it might be a valid
-        // nullptr
-        if constexpr (holoscan::is_shared_ptr_v<DataT>) {
-          return nullptr;
-        } else if constexpr (std::is_pointer_v<DataT>) {
-          return nullptr;
-        }
-        // If it's holoscan::gxf::Entity then return an error message
-        if constexpr (is_one_of_derived_v<DataT, nvidia::gxf::Entity>) {
-          auto error_message = fmt::format(
-              "Null received in place of nvidia::gxf::Entity or derived type for input {}", name);
-          return make_unexpected<holoscan::RuntimeError>(
-              holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
-        } else if constexpr (is_one_of_derived_v<DataT, holoscan::TensorMap>) {
-          auto error_message = fmt::format(
-              "Null received in place of holoscan::TensorMap or derived type for input {}", name);
-          return make_unexpected<holoscan::RuntimeError>(
-              holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
-        }
-      }
-      try {
-        // Check if the types of value and DataT are the same or not
-        if constexpr (std::is_same_v<DataT, std::any>) { return value; }
-        DataT return_value = std::any_cast<DataT>(value);
-        return return_value;
-      } catch (const std::bad_any_cast& e) {
-        // If it is of the type of holoscan::gxf::Entity then show a specific error message
-        if constexpr (is_one_of_derived_v<DataT, nvidia::gxf::Entity>) {
-          auto error_message = fmt::format(
-              "Unable to cast the received data to the specified type (holoscan::gxf::"
-              "Entity) for input {}: {}",
-              name,
-              e.what());
-          HOLOSCAN_LOG_DEBUG(error_message);
-          return make_unexpected<holoscan::RuntimeError>(
-              holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
-        } else if constexpr (is_one_of_derived_v<DataT, holoscan::TensorMap>) {
-          TensorMap tensor_map;
-          try {
-            auto gxf_entity = std::any_cast<holoscan::gxf::Entity>(value);
-
-            auto components_expected = gxf_entity.findAll();
-            auto components = components_expected.value();
-            for (size_t i = 0; i < components.size(); i++) {
-              const auto component = components[i];
-              const auto component_name = component->name();
-
-              if (std::string(component_name).compare("message_label") == 0) {
-                // Skip checking for Tensor as it's message label for DFFT
-                continue;
-              }
-              if (std::string(component_name).compare("cuda_stream_id_") == 0) {
-                // Skip checking for Tensor as it's a stream ID from CudaStreamHandler
-                continue;
-              }
-              std::shared_ptr<holoscan::Tensor> holoscan_tensor =
-                  gxf_entity.get<holoscan::Tensor>(component_name);
-              if (holoscan_tensor) { tensor_map.insert({component_name, holoscan_tensor}); }
-            }
-          } catch (const std::bad_any_cast& e) {
-            auto error_message = fmt::format(
-                "Unable to cast the received data to the specified type (holoscan::TensorMap) for "
-                "input {}: {}",
-                name,
-                e.what());
-            HOLOSCAN_LOG_DEBUG(error_message);
-            return make_unexpected<holoscan::RuntimeError>(
-                holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
-          }
-          return tensor_map;
-        }
-        auto error_message = fmt::format(
-            "Unable to cast the received data to the specified type (DataT) for input {}: {}",
-            name,
-            e.what());
-        HOLOSCAN_LOG_DEBUG(error_message);
-        return make_unexpected<holoscan::RuntimeError>(
-            holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
+      IOSpec* input_spec = find_input_spec(name);
+      if (input_spec == nullptr) {
+        // Let receive_impl() report that the input port is not found
+        return convert_received_value<DataT>(receive_impl(name), name);
       }
+
+      auto entity = receive_entity_impl(input_spec);
+      if (entity.is_null()) { return convert_received_value<DataT>(nullptr, name); }
+      return convert_received_entity<DataT>(std::move(entity), name);
     }
   }
 
+  /**
+   * @brief Receive all the messages available on the input port, up to a maximum number.
+   *
+   * All the messages queued in the receiver of the port are taken in one call, so an operator
+   * can process a batch of messages per `compute()` call instead of one. This is typically used
+   * with an input port whose queue can hold several messages and whose condition waits for a
+   * batch (see BatchMessageAvailableCondition):
+   *
+   * ```cpp
+   * void setup(OperatorSpec& spec) override {
+   *   spec.input<std::shared_ptr<Frame>>("in")
+   *       .connector(IOSpec::ConnectorType::kDoubleBuffer, Arg("capacity", 8UL))
+   *       .condition(ConditionType::kBatchMessageAvailable,
+   *                  Arg("max_batch_size", static_cast<int64_t>(8)),
+   *                  Arg("max_delay_ns", static_cast<int64_t>(2'000'000)));
+   * }
+   *
+   * void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+   *   auto frames = op_input.receive_batch<std::shared_ptr<Frame>>("in").value();
+   *   ...
+   * }
+   * ```
+   *
+   * The messages are returned in arrival order. If a message cannot be converted to `DataT`, an
+   * error is returned (the messages received until then are dropped).
+   *
+   * Vector inputs (`std::vector<IOSpec*>` parameters) are not supported: use `receive()` for them.
+   *
+   * @tparam DataT The type of the data to receive.
+   * @param name The name of the input port to receive the data from.
+   * @param max_n The maximum number of messages to receive.
+   * @return The received data (empty if no message is available).
+   */
+  template <typename DataT>
+  holoscan::expected<std::vector<DataT>, holoscan::RuntimeError> receive_batch(
+      const char* name = nullptr, size_t max_n = std::numeric_limits<size_t>::max()) {
+    IOSpec* input_spec = find_input_spec(name);
+    if (input_spec == nullptr) {
+      auto error_message =
+          fmt::format("Unable to find input port with name '{}'", name == nullptr ? "" : name);
+      HOLOSCAN_LOG_DEBUG(error_message);
+      return make_unexpected<holoscan::RuntimeError>(
+          holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
+    }
+    const char* input_name = input_spec->name().c_str();
+
+    std::vector<DataT> batch;
+    const size_t num_messages = std::min(max_n, num_available_impl(input_spec));
+    batch.reserve(num_messages);
+    for (size_t i = 0; i < num_messages; ++i) {
+      auto entity = receive_entity_impl(input_spec);
+      if (entity.is_null()) { break; }
+      auto value = convert_received_entity<DataT>(std::move(entity), input_name);
+      if (!value) { return make_unexpected<holoscan::RuntimeError>(std::move(value.error())); }
+      batch.push_back(std::move(value.value()));
+    }
+    return batch;
+  }
+
  protected:
   /**
    * @brief The implementation of the `empty` method.
@@ -405,11 +397,179 @@ class InputContext {
     (void)no_error_message;
     return nullptr;
   }
+  /**
+   * @brief Receive the entity from the given input port.
+   *
+   * Unlike `receive_impl`, the input port is not looked up by name and the value of the message
+   * is not copied, so that `receive` can access the typed value directly.
+   *
+   * @param input_spec The input spec of the input port.
+   * @return The received entity, or a null entity if no data is available.
+   */
+  virtual nvidia::gxf::Entity receive_entity_impl(IOSpec* input_spec) {
+    (void)input_spec;
+    return {};
+  }
+  /**
+   * @brief Get the number of messages that can be received from the given input port.
+   *
+   * @param input_spec The input spec of the input port.
+   * @return The number of messages available (0 by default).
+   */
+  virtual size_t num_available_impl(IOSpec* input_spec) {
+    (void)input_spec;
+    return 0;
+  }
 
   ExecutionContext* execution_context_ =
       nullptr;              ///< The execution context that is associated with.
   Operator* op_ = nullptr;  ///< The operator that this context is associated with.
   std::unordered_map<std::string, std::unique_ptr<IOSpec>>& inputs_;  ///< The inputs.
+
+ private:
+  /// Find the input spec of the input port with the given name (nullptr if not found).
+  IOSpec* find_input_spec(const char* name) const {
+    if (name == nullptr || name[0] == '\0') {
+      return inputs_.size() == 1 ? inputs_.begin()->second.get() : nullptr;
+    }
+    auto it = inputs_.find(name);
+    return it != inputs_.end() ? it->second.get() : nullptr;
+  }
+
+  /// Get the value of the Message component of the entity if it is of type `ValueT`.
+  template <typename ValueT>
+  static const ValueT* get_message_value(const nvidia::gxf::Entity& entity) {
+    if (entity.is_null()) { return nullptr; }
+    auto message = entity.get<holoscan::Message>();
+    if (!message) { return nullptr; }
+    return message.value()->template get_if<ValueT>();
+  }
+
+  /// Convert the received entity to std::any in the same way as `receive_impl`.
+  static std::any entity_to_any(nvidia::gxf::Entity&& entity) {
+    if (entity.is_null()) { return nullptr; }
+    auto message = entity.get<holoscan::Message>();
+    if (!message) { return holoscan::gxf::Entity(std::move(entity)); }
+    return message.value()->value();
+  }
+
+  /// Convert a received (non-null) entity to `DataT`.
+  template <typename DataT>
+  holoscan::expected<DataT, holoscan::RuntimeError> convert_received_entity(
+      nvidia::gxf::Entity&& entity, const char* name) {
+    auto message = entity.get<holoscan::Message>();
+    if (!message) {
+      // Handle gxf::Entity as it is
+      holoscan::gxf::Entity gxf_entity(std::move(entity));
+      if constexpr (std::is_same_v<DataT, holoscan::gxf::Entity>) {
+        return gxf_entity;
+      } else if constexpr (is_one_of_derived_v<DataT, holoscan::TensorMap>) {
+        return to_tensor_map(gxf_entity);
+      }
+      return convert_received_value<DataT>(std::move(gxf_entity), name);
+    }
+
+    if constexpr (!std::is_same_v<DataT, std::any>) {
+      // The message holds a value of the expected type: copy it without going through std::any
+      if (const DataT* value = message.value()->template get_if<DataT>()) { return *value; }
+    }
+    return convert_received_value<DataT>(message.value()->value(), name);
+  }
+
+  /// Collect the tensors of the given entity into a TensorMap.
+  static TensorMap to_tensor_map(holoscan::gxf::Entity& gxf_entity) {
+    TensorMap tensor_map;
+    auto components_expected = gxf_entity.findAll();
+    auto components = components_expected.value();
+    for (size_t i = 0; i < components.size(); i++) {
+      const auto component = components[i];
+      const auto component_name = component->name();
+
+      if (std::string(component_name).compare("message_label") == 0) {
+        // Skip checking for Tensor as it's message label for DFFT
+        continue;
+      }
+      if (std::string(component_name).compare("cuda_stream_id_") == 0) {
+        // Skip checking for Tensor as it's a stream ID from CudaStreamHandler
+        continue;
+      }
+      std::shared_ptr<holoscan::Tensor> holoscan_tensor =
+          gxf_entity.get<holoscan::Tensor>(component_name);
+      if (holoscan_tensor) { tensor_map.insert({component_name, holoscan_tensor}); }
+    }
+    return tensor_map;
+  }
+
+  /// Convert the value received from the input port with the given name to `DataT`.
+  template <typename DataT>
+  holoscan::expected<DataT, holoscan::RuntimeError> convert_received_value(std::any value,
+                                                                           const char* name) {
+    // If the received data is nullptr, then check whether nullptr or empty holoscan::gxf::Entity
+    // can be sent
+    if (value.type() == typeid(nullptr_t)) {
+      HOLOSCAN_LOG_DEBUG("nullptr is received from the input port with name '{}'", name);
+      // If it is a shared pointer, or raw pointer then return nullptr because it might be a valid
+      // nullptr
+      if constexpr (holoscan::is_shared_ptr_v<DataT>) {
+        return nullptr;
+      } else if constexpr (std::is_pointer_v<DataT>) {
+        return nullptr;
+      }
+      // If it's holoscan::gxf::Entity then return an error message
+      if constexpr (is_one_of_derived_v<DataT, nvidia::gxf::Entity>) {
+        auto error_message = fmt::format(
+            "Null received in place of nvidia::gxf::Entity or derived type for input {}", name);
+        return make_unexpected<holoscan::RuntimeError>(
+            holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
+      } else if constexpr (is_one_of_derived_v<DataT, holoscan::TensorMap>) {
+        auto error_message = fmt::format(
+            "Null received in place of holoscan::TensorMap or derived type for input {}", name);
+        return make_unexpected<holoscan::RuntimeError>(
+            holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
+      }
+    }
+    try {
+      // Check if the types of value and DataT are the same or not
+      if constexpr (std::is_same_v<DataT, std::any>) { return value; }
+      DataT return_value = std::any_cast<DataT>(value);
+      return return_value;
+    } catch (const std::bad_any_cast& e) {
+      // If it is of the type of holoscan::gxf::Entity then show a specific error message
+      if constexpr (is_one_of_derived_v<DataT, nvidia::gxf::Entity>) {
+        auto error_message = fmt::format(
+            "Unable to cast the received data to the specified type (holoscan::gxf::"
+            "Entity) for input {}: {}",
+            name,
+            e.what());
+        HOLOSCAN_LOG_DEBUG(error_message);
+        return make_unexpected<holoscan::RuntimeError>(
+            holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
+      } else if constexpr (is_one_of_derived_v<DataT, holoscan::TensorMap>) {
+        TensorMap tensor_map;
+        try {
+          auto gxf_entity = std::any_cast<holoscan::gxf::Entity>(value);
+          tensor_map = to_tensor_map(gxf_entity);
+        } catch (const std::bad_any_cast& e) {
+          auto error_message = fmt::format(
+              "Unable to cast the received data to the specified type (holoscan::TensorMap) for "
+              "input {}: {}",
+              name,
+              e.what());
+          HOLOSCAN_LOG_DEBUG(error_message);
+          return make_unexpected<holoscan::RuntimeError>(
+              holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
+        }
+        return tensor_map;
+      }
+      auto error_message = fmt::format(
+          "Unable to cast the received data to the specified type (DataT) for input {}: {}",
+          name,
+          e.what());
+      HOLOSCAN_LOG_DEBUG(error_message);
+      return make_unexpected<holoscan::RuntimeError>(
+          holoscan::RuntimeError(holoscan::ErrorCode::kReceiveError, error_message.c_str()));
+    }
+  }
 };
 
 /**
@@ -507,6 +667,23 @@ class OutputContext {
     emit_impl(data, name);
   }
 
+  /**
+   * @brief Send a shared pointer of the message data to the output port with the given name,
+   * moving the shared pointer into the message.
+   *
+   * Same as `emit(std::shared_ptr<DataT>&, const char*)`, but the shared pointer is moved instead
+   * of copied (e.g., `op_output.emit(std::move(value), "out")`).
+   *
+   * @tparam DataT The type of the data to send.
+   * @param data The shared pointer to the data.
+   * @param name The name of the output port.
+   */
+  template <typename DataT, typename = std::enable_if_t<!holoscan::is_one_of_derived_v<
+                                DataT, nvidia::gxf::Entity, std::any>>>
+  void emit(std::shared_ptr<DataT>&& data, const char* name = nullptr) {
+    emit_impl(std::move(data), name);
+  }
+
   /**
    * @brief Send message data (GXF Entity) to the output port with the given name.
    *
@@ -621,7 +798,7 @@ class OutputContext {
   template <typename DataT,
             typename = std::enable_if_t<!holoscan::is_one_of_derived_v<DataT, nvidia::gxf::Entity>>>
   void emit(DataT data, const char* name = nullptr) {
-    emit_impl(data, name, OutputType::kAny);
+    emit_impl(std::move(data), name, OutputType::kAny);
   }
 
   void emit(holoscan::TensorMap& data, const char* name = nullptr) {
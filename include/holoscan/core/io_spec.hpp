@@ -30,6 +30,7 @@
 
 #include "./condition.hpp"
 #include "./conditions/gxf/asynchronous.hpp"
+#include "./conditions/gxf/batch_message_available.hpp"
 #include "./conditions/gxf/boolean.hpp"
 #include "./conditions/gxf/count.hpp"
 #include "./conditions/gxf/downstream_affordable.hpp"
@@ -37,6 +38,7 @@
 #include "./conditions/gxf/message_available.hpp"
 #include "./resources/gxf/double_buffer_receiver.hpp"
 #include "./resources/gxf/double_buffer_transmitter.hpp"
+#include "./resources/gxf/spsc_ring_receiver.hpp"
 #include "./resources/gxf/ucx_receiver.hpp"
 #include "./resources/gxf/ucx_transmitter.hpp"
 #include "./resource.hpp"
@@ -63,8 +65,15 @@ class IOSpec {
   /**
    * @brief Connector type. Determines the type of Receiver (when IOType is kInput) or Transmitter
    *        (when IOType is kOutput) class used.
+   *
+   * ConnectorType::kSharedMemory is only used for inter-fragment connections between fragments
+   * running on the same host (see the `HOLOSCAN_SHM_TRANSPORT` environment variable).
+   *
+   * ConnectorType::kSpscRing uses a lock-free single-producer/single-consumer ring
+   * (SpscRingReceiver) for an input port within a fragment. For an output port, it is the same
+   * as ConnectorType::kDoubleBuffer (the transmitter is only used by the operator's thread).
    */
-  enum class ConnectorType { kDefault, kDoubleBuffer, kUCX };
+  enum class ConnectorType { kDefault, kDoubleBuffer, kUCX, kSharedMemory, kSpscRing };
 
   /**
    * @brief Construct a new IOSpec object.
@@ -157,6 +166,7 @@ class IOSpec {
    * The following ConditionTypes are supported:
    *
    * - ConditionType::kMessageAvailable
+   * - ConditionType::kBatchMessageAvailable (input only)
    * - ConditionType::kDownstreamAffordable
    * - ConditionType::kNone
    *
@@ -172,6 +182,11 @@ class IOSpec {
         conditions_.emplace_back(
             type, std::make_shared<MessageAvailableCondition>(std::forward<ArgsT>(args)...));
         break;
+      case ConditionType::kBatchMessageAvailable:
+        conditions_.emplace_back(
+            type,
+            std::make_shared<BatchMessageAvailableCondition>(std::forward<ArgsT>(args)...));
+        break;
       case ConditionType::kDownstreamMessageAffordable:
         conditions_.emplace_back(
             type,
@@ -209,6 +224,7 @@ class IOSpec {
    * - ConnectorType::kDefault
    * - ConnectorType::kDoubleBuffer
    * - ConnectorType::kUCX
+   * - ConnectorType::kSpscRing
    *
    * @param type The type of the connector (receiver/transmitter).
    * @param args The arguments of the connector (receiver/transmitter).
@@ -236,6 +252,20 @@ class IOSpec {
           connector_ = std::make_shared<UcxTransmitter>(std::forward<ArgsT>(args)...);
         }
         break;
+      case ConnectorType::kSpscRing:
+        if (io_type_ == IOType::kInput) {
+          connector_ = std::make_shared<SpscRingReceiver>(std::forward<ArgsT>(args)...);
+        } else {
+          connector_ = std::make_shared<DoubleBufferTransmitter>(std::forward<ArgsT>(args)...);
+        }
+        break;
+      case ConnectorType::kSharedMemory:
+        // shared memory connections are realized by operators inserted by the GXFExecutor
+        HOLOSCAN_LOG_ERROR(
+            "ConnectorType::kSharedMemory is reserved for inter-fragment connections and cannot "
+            "be set on '{}'",
+            name_);
+        break;
       default:
         HOLOSCAN_LOG_ERROR("Unknown connector type {}", static_cast<int>(type));
         break;
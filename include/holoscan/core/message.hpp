@@ -70,6 +70,19 @@ class Message {
    */
   std::any value() const { return value_; }
 
+  /**
+   * @brief Get a pointer to the value if it is of the given type.
+   *
+   * Unlike `value()`, the wrapped value is neither copied nor checked with exceptions.
+   *
+   * @tparam ValueT The type of the value.
+   * @return The pointer to the value, or nullptr if the value is not of type `ValueT`.
+   */
+  template <typename ValueT>
+  const ValueT* get_if() const {
+    return std::any_cast<ValueT>(&value_);
+  }
+
   /**
    * @brief Get the value object as a specific type.
    *
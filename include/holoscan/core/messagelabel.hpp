@@ -19,11 +19,15 @@
 #define HOLOSCAN_CORE_MESSAGELABEL_HPP
 
 #include <chrono>
+#include <cstdint>
 #include <iterator>
+#include <memory>
+#include <optional>
 #include <string>
-#include <unordered_set>
 #include <vector>
 
+#include "./errors.hpp"
+#include "./expected.hpp"
 #include "./forward_def.hpp"
 
 namespace holoscan {
@@ -49,7 +53,7 @@ static inline int64_t get_current_time_us() {
  *
  * The class stores information about the timestamps when an operator receives from
  * an input and when it publishes to an output. It also holds a reference to the
- * operator.
+ * operator and the operator ID (see `MessageLabel::operator_id()`).
  *
  * This class is used by MessageLabel to create an array of Operators representing
  * a path.
@@ -64,23 +68,40 @@ struct OperatorTimestampLabel {
    *
    * @param op The pointer to the operator for which the timestamp label is created.
    */
-  explicit OperatorTimestampLabel(Operator* op)
-      : operator_ptr(op), rec_timestamp(get_current_time_us()), pub_timestamp(-1) {}
+  explicit OperatorTimestampLabel(Operator* op);
 
-  OperatorTimestampLabel(Operator* op, int64_t rec_t, int64_t pub_t)
-      : operator_ptr(op), rec_timestamp(rec_t), pub_timestamp(pub_t) {}
+  OperatorTimestampLabel(Operator* op, int64_t rec_t, int64_t pub_t);
 
-  OperatorTimestampLabel(const OperatorTimestampLabel& o)
-      : operator_ptr(o.operator_ptr),
-        rec_timestamp(o.rec_timestamp),
-        pub_timestamp(o.pub_timestamp) {}
+  /**
+   * @brief Construct a new OperatorTimestampLabel object for an operator that is only known by its
+   * name (e.g., an operator of another fragment).
+   *
+   * @param op_name The name of the operator.
+   * @param rec_t The receive timestamp.
+   * @param pub_t The publish timestamp.
+   */
+  OperatorTimestampLabel(const std::string& op_name, int64_t rec_t, int64_t pub_t);
+
+  OperatorTimestampLabel(const OperatorTimestampLabel& o) = default;
 
-  OperatorTimestampLabel& operator=(const OperatorTimestampLabel& o);
+  OperatorTimestampLabel& operator=(const OperatorTimestampLabel& o) = default;
 
   void set_pub_timestamp_to_current() { pub_timestamp = get_current_time_us(); }
 
+  /**
+   * @brief Get the name of the operator.
+   *
+   * @return The name of the operator, from the operator pointer if it is set and from the operator
+   * ID otherwise.
+   */
+  const std::string& operator_name() const;
+
+  // The operator, or nullptr if the operator does not belong to this process
   Operator* operator_ptr = nullptr;
 
+  // The ID of the operator (see MessageLabel::operator_id())
+  uint32_t operator_id = UINT32_MAX;
+
   // The timestamp when an Operator receives from an input
   // For a root Operator, it is the start of the compute call
   int64_t rec_timestamp = 0;
@@ -96,34 +117,31 @@ struct OperatorTimestampLabel {
  *
  * A MessageLabel has a vector of paths, where each path is a vector of Operator references and
  * their publish and receive timestamps.
+ *
+ * Paths are shared copy-on-write: copying a MessageLabel (e.g., for every outgoing message of an
+ * operator) only copies references to its paths, and a path is duplicated only when it is
+ * modified while being shared with another MessageLabel.
  */
 class MessageLabel {
  public:
   using TimestampedPath = std::vector<OperatorTimestampLabel>;
-  using PathOperators = std::unordered_set<std::string>;
 
-  MessageLabel() {
-    // By default, allocate DEFAULT_NUM_PATHS paths in the message_paths
-    message_paths.reserve(DEFAULT_NUM_PATHS);
-  }
+  /// The operator ID of an operator that is not known.
+  static constexpr uint32_t kInvalidOperatorId = UINT32_MAX;
 
-  MessageLabel(const MessageLabel& m)
-      : message_paths(m.message_paths), message_path_operators(m.message_path_operators) {}
+  MessageLabel() = default;
 
-  MessageLabel& operator=(const MessageLabel& m) {
-    if (this != &m) {
-      this->message_paths = m.message_paths;
-      this->message_path_operators = m.message_path_operators;
-    }
-    return *this;
-  }
+  MessageLabel(const MessageLabel& m) = default;
+  MessageLabel(MessageLabel&& m) = default;
+  MessageLabel& operator=(const MessageLabel& m) = default;
+  MessageLabel& operator=(MessageLabel&& m) = default;
 
   /**
    * @brief Get the number of paths in a MessageLabel.
    *
    * @return The number of paths in a MessageLabel.
    */
-  int num_paths() { return message_paths.size(); }
+  int num_paths() const { return message_paths.size(); }
 
   /**
    * @brief Get all the names of the path in formatted string, which is comma-separated values of
@@ -133,7 +151,7 @@ class MessageLabel {
    */
   std::vector<std::string> get_all_path_names();
 
-  std::vector<TimestampedPath> paths() { return message_paths; }
+  std::vector<TimestampedPath> paths();
 
   /**
    * @brief Get the current end-to-end latency of a path in microseconds.
@@ -162,7 +180,7 @@ class MessageLabel {
    * @param path The path for which to get the latency
    * @return The end-to-end latency of the path in ms
    */
-  static double get_path_e2e_latency_ms(TimestampedPath path) {
+  static double get_path_e2e_latency_ms(const TimestampedPath& path) {
     int64_t latency = path.back().pub_timestamp - path.front().rec_timestamp;
     return (static_cast<double>(latency) / 1000);
   }
@@ -173,7 +191,7 @@ class MessageLabel {
    * @param index The index of the path to get
    * @return TimestampedPath& The timestamped path at the given index
    */
-  TimestampedPath get_path(int index);
+  const TimestampedPath& get_path(int index) const;
 
   /**
    * @brief Get the path name string which is comma-separated values of the operator names.
@@ -217,7 +235,16 @@ class MessageLabel {
    * @param op_name The name of the operator to check
    * @return List of path indexes where the operator is present
    */
-  std::vector<int> has_operator(std::string op_name);
+  std::vector<int> has_operator(const std::string& op_name) const;
+
+  /**
+   * @brief Check if an operator is present in the MessageLabel. Returns an empty vector if the
+   * operator is not present in any path.
+   *
+   * @param op_id The ID of the operator to check (see `operator_id()`)
+   * @return List of path indexes where the operator is present
+   */
+  std::vector<int> has_operator(uint32_t op_id) const;
 
   /**
    * @brief Add a new Operator timestamp to all the paths in a message label.
@@ -239,6 +266,21 @@ class MessageLabel {
    */
   void add_new_path(TimestampedPath path);
 
+  /**
+   * @brief Add a path of another MessageLabel to the MessageLabel, without copying it.
+   *
+   * @param label The MessageLabel to add the path from.
+   * @param index The index of the path in `label`.
+   */
+  void add_new_path(const MessageLabel& label, int index);
+
+  /**
+   * @brief Add all the paths of another MessageLabel to the MessageLabel, without copying them.
+   *
+   * @param label The MessageLabel to add the paths from.
+   */
+  void add_paths(const MessageLabel& label);
+
   /**
    * @brief Convert the MessageLabel to a string.
    *
@@ -247,7 +289,7 @@ class MessageLabel {
    */
   std::string to_string() const;
 
-  static std::string to_string(TimestampedPath path);
+  static std::string to_string(const TimestampedPath& path);
 
   /**
    * @brief Print the to_string() in the standard output with a heading for the MessageLabel.
@@ -255,12 +297,70 @@ class MessageLabel {
    */
   void print_all();
 
+  /**
+   * @brief Serialize the MessageLabel in a compact binary representation.
+   *
+   * The operators are written as indices into a table of the operator names of the label, and
+   * the timestamps and indices as variable-length integers (timestamps are delta-encoded).
+   *
+   * @param buffer The buffer to append the serialized MessageLabel to.
+   */
+  void serialize(std::vector<uint8_t>& buffer) const;
+
+  /**
+   * @brief Deserialize a MessageLabel serialized with `serialize()`.
+   *
+   * The operators of the deserialized MessageLabel are only known by their ID (their operator
+   * pointer is nullptr).
+   *
+   * @param data The serialized MessageLabel.
+   * @param size The size of the serialized MessageLabel in bytes.
+   * @return The MessageLabel or an error if the data is malformed.
+   */
+  static expected<MessageLabel, RuntimeError> deserialize(const uint8_t* data, size_t size);
+
+  /**
+   * @brief Get the ID of the operator with the given name.
+   *
+   * Operator IDs are assigned once per operator name for the lifetime of the process, so that
+   * labels can refer to operators (including operators of other fragments) with an integer.
+   *
+   * @param op_name The name of the operator.
+   * @return The ID of the operator.
+   */
+  static uint32_t operator_id(const std::string& op_name);
+
+  /**
+   * @brief Get the ID of the operator with the given name, if the name already has an ID.
+   *
+   * Unlike `operator_id()`, no ID is assigned to an unknown name.
+   *
+   * @param op_name The name of the operator.
+   * @return The ID of the operator, or std::nullopt if the name is not known.
+   */
+  static std::optional<uint32_t> find_operator_id(const std::string& op_name);
+
+  /**
+   * @brief Get the ID of the given operator.
+   *
+   * @param op The operator.
+   * @return The ID of the operator.
+   */
+  static uint32_t operator_id(const Operator* op);
+
+  /**
+   * @brief Get the name of the operator with the given ID.
+   *
+   * @param op_id The ID of the operator.
+   * @return The name of the operator, or an empty string if the ID is not known.
+   */
+  static const std::string& operator_name(uint32_t op_id);
+
  private:
-  std::vector<TimestampedPath> message_paths;
+  /// Get a path that can be modified, copying it first if it is shared with another MessageLabel.
+  TimestampedPath& mutable_path(int index);
 
-  /// List of paths where each path is a set of name of the operators
-  /// This variable is used to quickly check whether an operator is in a path
-  std::vector<PathOperators> message_path_operators;
+  std::vector<std::shared_ptr<TimestampedPath>> message_paths;
 };
 }  // namespace holoscan
 
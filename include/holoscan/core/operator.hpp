@@ -38,6 +38,7 @@
 #include "./forward_def.hpp"
 #include "./messagelabel.hpp"
 #include "./operator_spec.hpp"
+#include "./operator_stats.hpp"
 #include "./resource.hpp"
 
 #include "gxf/core/gxf.h"
@@ -541,13 +542,42 @@ class Operator : public ComponentBase {
    * register_codec<Coordinate>("Coordinate");
    * ```
    *
+   * Large vectors of trivially copyable elements can instead use the zero-copy codec, which
+   * sends the vector's memory as a separate segment of the serialization buffer (the vector must
+   * use `default_init_allocator`, so that the received vector is not zeroed before being filled):
+   *
+   * ```cpp
+   * using FloatVector = std::vector<float, default_init_allocator<float>>;
+   * register_codec<FloatVector, zero_copy_codec<FloatVector>>("FloatVector");
+   * ```
+   *
    * @tparam typeT The type of the argument to register.
+   * @tparam codecT The codec class implementing serialization of typeT (`codec<typeT>` by
+   * default).
    * @param codec_name The name of the codec (must be unique unless overwrite is true).
    * @param overwrite If true and codec_name already exists, the codec will be overwritten.
    */
-  template <typename typeT>
+  template <typename typeT, typename codecT = codec<typeT>>
   static void register_codec(const std::string& codec_name, bool overwrite = true) {
-    CodecRegistry::get_instance().add_codec<typeT>(codec_name, overwrite);
+    CodecRegistry::get_instance().add_codec<typeT, codecT>(codec_name, overwrite);
+  }
+
+  /**
+   * @brief Register the codec generated for a type declared with HOLOSCAN_CODEC_FIELDS.
+   *
+   * ```cpp
+   * HOLOSCAN_CODEC_FIELDS(Detection, label, score, box)
+   * ...
+   * register_codec<Detection>();
+   * ```
+   *
+   * The stringified type name given to HOLOSCAN_CODEC_FIELDS is used as the codec name.
+   *
+   * @tparam typeT The type declared with HOLOSCAN_CODEC_FIELDS.
+   */
+  template <typename typeT, typename = std::enable_if_t<has_codec_fields_v<typeT>>>
+  static void register_codec() {
+    CodecRegistry::get_instance().add_codec<typeT>();
   }
 
   /**
@@ -565,6 +595,14 @@ class Operator : public ComponentBase {
    */
   std::shared_ptr<nvidia::gxf::GraphEntity> graph_entity() { return graph_entity_; }
 
+  /**
+   * @brief Get the execution statistics counters of the operator.
+   *
+   * @return The counters, or nullptr if the operator statistics are not enabled for the fragment
+   * (see Fragment::enable_operator_stats()).
+   */
+  OperatorStats* execution_stats() const { return execution_stats_.get(); }
+
  protected:
   // Making the following classes as friend classes to allow them to access
   // get_consolidated_input_label, num_published_messages_map, update_input_message_label,
@@ -573,6 +611,8 @@ class Operator : public ComponentBase {
   friend class AnnotatedDoubleBufferReceiver;
   friend class AnnotatedDoubleBufferTransmitter;
   friend class DFFTCollector;
+  // MessageLabel reads the cached message label operator ID
+  friend class MessageLabel;
 
   // Make GXFExecutor a friend class so it can call protected initialization methods
   friend class holoscan::gxf::GXFExecutor;
@@ -626,7 +666,7 @@ class Operator : public ComponentBase {
    * @param m The new MessageLabel that will be set for the input port
    */
   void update_input_message_label(std::string input_name, MessageLabel m) {
-    input_message_labels[input_name] = m;
+    input_message_labels[input_name] = std::move(m);
   }
 
   /**
@@ -733,6 +773,7 @@ class Operator : public ComponentBase {
       resources_;                                           ///< The resources used by the operator.
   std::shared_ptr<nvidia::gxf::GraphEntity> graph_entity_;  ///< GXF graph entity corresponding to
                                                             ///< the Operator
+  std::shared_ptr<OperatorStats> execution_stats_;  ///< The execution statistics counters
 
  private:
   ///  Set the operator codelet or any other backend codebase.
@@ -748,6 +789,10 @@ class Operator : public ComponentBase {
 
   /// The backend Codelet or other codebase pointer. It is used for DFFT.
   void* op_backend_ptr = nullptr;
+
+  /// The ID of the operator in message labels (see MessageLabel::operator_id()). It is used for
+  /// DFFT.
+  uint32_t message_label_operator_id_ = UINT32_MAX;
 };
 
 }  // namespace holoscan
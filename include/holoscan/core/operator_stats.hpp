@@ -0,0 +1,185 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_OPERATOR_STATS_HPP
+#define HOLOSCAN_CORE_OPERATOR_STATS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "./hdr_histogram.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Statistics of an input or output port of an operator.
+ */
+struct OperatorPortStats {
+  std::string name;           ///< The name of the port
+  uint64_t num_messages = 0;  ///< Output ports: the number of emitted messages
+  double avg_queue_size = 0;  ///< Input ports: the average number of queued messages at a tick
+  uint64_t max_queue_size = 0;  ///< Input ports: the maximum number of queued messages at a tick
+};
+
+/**
+ * @brief Snapshot of the execution statistics of an operator.
+ *
+ * Times are measured with a monotonic clock around each call of `Operator::compute()`.
+ */
+struct OperatorStatsSnapshot {
+  std::string operator_name;        ///< The name of the operator
+  uint64_t num_ticks = 0;           ///< The number of `compute()` calls
+  uint64_t num_failed_ticks = 0;    ///< The number of `compute()` calls that threw an exception
+  double total_compute_time_ms = 0;  ///< The time spent in `compute()`
+  double avg_compute_time_us = 0;    ///< The average duration of `compute()`
+  double min_compute_time_us = 0;    ///< The shortest duration of `compute()`
+  double max_compute_time_us = 0;    ///< The longest duration of `compute()`
+  double p50_compute_time_us = 0;    ///< The median duration of `compute()`
+  double p99_compute_time_us = 0;    ///< The 99th percentile of the duration of `compute()`
+  /// The time between the end of a `compute()` call and the start of the next one, i.e. the time
+  /// the operator waited for its inputs (or any other scheduling condition) to be ready.
+  double total_idle_time_ms = 0;
+  /// The time spent waiting for the Python GIL before running `compute()` (Python operators
+  /// only, included in the compute time).
+  double total_gil_wait_time_ms = 0;
+  double max_gil_wait_time_us = 0;  ///< The longest wait for the Python GIL
+  std::vector<OperatorPortStats> inputs;   ///< The statistics of the input ports
+  std::vector<OperatorPortStats> outputs;  ///< The statistics of the output ports
+};
+
+/**
+ * @brief Execution statistics counters of an operator.
+ *
+ * The counters are updated by the thread that executes the operator. Since an operator is never
+ * executed by several threads at the same time, every counter has a single writer and is updated
+ * with relaxed atomic loads and stores (no lock and no read-modify-write instruction). A snapshot
+ * can be taken from any thread at any time, including while the operator is running.
+ *
+ * The counters are created for each operator of a fragment when the statistics are enabled with
+ * `Fragment::enable_operator_stats()` (or the `HOLOSCAN_OPERATOR_STATS` environment variable).
+ */
+class OperatorStats {
+ public:
+  /**
+   * @brief Construct the counters of an operator.
+   *
+   * @param operator_name The name of the operator.
+   * @param input_names The names of the input ports.
+   * @param output_names The names of the output ports.
+   */
+  OperatorStats(std::string operator_name, const std::vector<std::string>& input_names,
+                const std::vector<std::string>& output_names);
+
+  OperatorStats(const OperatorStats&) = delete;
+  OperatorStats& operator=(const OperatorStats&) = delete;
+
+  /// Get the current time of the monotonic clock used by the statistics, in nanoseconds.
+  static int64_t now_ns();
+
+  /**
+   * @brief Record a `compute()` call.
+   *
+   * @param start_ns The time at which `compute()` was called (see `now_ns()`).
+   * @param end_ns The time at which `compute()` returned.
+   * @param success Whether `compute()` returned without throwing an exception.
+   */
+  void record_tick(int64_t start_ns, int64_t end_ns, bool success = true);
+
+  /**
+   * @brief Record the number of messages queued on an input port at the start of a tick.
+   *
+   * @param input_index The index of the input port (see `input_index()`).
+   * @param queue_size The number of queued messages.
+   */
+  void record_queue_size(size_t input_index, size_t queue_size);
+
+  /**
+   * @brief Record a message emitted on an output port.
+   *
+   * @param output_index The index of the output port (see `output_index()`).
+   */
+  void record_emit(size_t output_index);
+
+  /**
+   * @brief Record the time a tick waited for the Python GIL (Python operators).
+   *
+   * @param wait_ns The time between the start of the tick and the acquisition of the GIL.
+   */
+  void record_gil_wait(int64_t wait_ns);
+
+  /// Get the index of an input port, or -1 if the operator does not have this input port.
+  int input_index(const std::string& name) const;
+  /// Get the index of an output port, or -1 if the operator does not have this output port.
+  int output_index(const std::string& name) const;
+
+  /// The names of the input ports, in the order of their indices.
+  const std::vector<std::string>& input_names() const { return input_names_; }
+  /// The names of the output ports, in the order of their indices.
+  const std::vector<std::string>& output_names() const { return output_names_; }
+
+  /// Take a snapshot of the counters.
+  OperatorStatsSnapshot snapshot() const;
+
+  /**
+   * @brief Format the statistics of several operators as a table.
+   *
+   * @param stats The statistics of the operators.
+   * @return The table, with one line per operator followed by one line per port.
+   */
+  static std::string format(const std::vector<OperatorStatsSnapshot>& stats);
+
+ private:
+  /// Counters of a port
+  struct PortCounters {
+    std::atomic<uint64_t> num_messages{0};
+    std::atomic<uint64_t> num_samples{0};
+    std::atomic<uint64_t> queue_size_sum{0};
+    std::atomic<uint64_t> max_queue_size{0};
+  };
+
+  /// Add to a counter that is only written by one thread at a time.
+  static void add(std::atomic<uint64_t>& counter, uint64_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+  }
+
+  std::string operator_name_;
+  std::vector<std::string> input_names_;
+  std::vector<std::string> output_names_;
+  std::unique_ptr<PortCounters[]> input_counters_;
+  std::unique_ptr<PortCounters[]> output_counters_;
+
+  std::atomic<uint64_t> num_ticks_{0};
+  std::atomic<uint64_t> num_failed_ticks_{0};
+  std::atomic<uint64_t> total_compute_time_ns_{0};
+  std::atomic<uint64_t> total_idle_time_ns_{0};
+  std::atomic<int64_t> min_compute_time_ns_{INT64_MAX};
+  std::atomic<int64_t> max_compute_time_ns_{0};
+  std::atomic<uint64_t> total_gil_wait_time_ns_{0};
+  std::atomic<int64_t> max_gil_wait_time_ns_{0};
+  /// The time at which the last `compute()` call returned (0 before the first call)
+  std::atomic<int64_t> last_tick_end_ns_{0};
+  /// Histogram of the `compute()` durations, in nanoseconds
+  HdrHistogram compute_time_histogram_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_OPERATOR_STATS_HPP */
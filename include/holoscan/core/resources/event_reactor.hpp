@@ -0,0 +1,157 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_EVENT_REACTOR_HPP
+#define HOLOSCAN_CORE_RESOURCES_EVENT_REACTOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "../conditions/gxf/asynchronous.hpp"
+#include "../errors.hpp"
+#include "../expected.hpp"
+#include "../resource.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Native resource driving asynchronous conditions from a single epoll thread.
+ *
+ * Instead of spawning one thread per asynchronous operator, operators register file descriptors
+ * (sockets, serial devices, V4L2 devices, ...) or timers with a reactor shared by the fragment.
+ * A single thread waits for all of them with epoll and, when a registration fires, sets its
+ * AsynchronousCondition from `EVENT_WAITING` to `EVENT_DONE`, which notifies the scheduler that
+ * the operator is ready to execute.
+ *
+ * File descriptor registrations are one-shot: once fired, they are disabled until `arm()` is
+ * called (typically at the end of `compute()`, once the data was consumed). `arm()` also sets
+ * the condition back to `EVENT_WAITING`. Periodic timers keep running; an expiration while the
+ * condition is not waiting is dropped.
+ *
+ * The reactor thread is started on the first registration and stopped when the reactor is
+ * destroyed. Callbacks are executed on the reactor thread and must not block.
+ *
+ * ==Parameters==
+ *
+ * - **max_events** (int64_t, optional): Maximum number of events handled per wakeup of the
+ *   reactor thread (default: `64`).
+ */
+class EventReactor : public Resource {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS(EventReactor)
+
+  /// Identifier of a registration
+  using RegistrationId = int64_t;
+  /**
+   * @brief Callback executed on the reactor thread when a registration fires.
+   *
+   * The argument is the epoll event mask (e.g., `EPOLLIN`) for a file descriptor registration,
+   * or the number of expirations since the last callback for a timer registration.
+   */
+  using Callback = std::function<void(uint64_t)>;
+
+  EventReactor() = default;
+  ~EventReactor() override;
+
+  void setup(ComponentSpec& spec) override;
+
+  /**
+   * @brief Watch a file descriptor.
+   *
+   * The file descriptor is not owned by the reactor (it is not closed by `remove()`).
+   *
+   * @param fd The file descriptor.
+   * @param events The epoll events to wait for (e.g., `EPOLLIN`).
+   * @param condition The condition set to `EVENT_DONE` when the file descriptor is ready (can be
+   * null if only the callback is needed). It is set to `EVENT_WAITING` by this call.
+   * @param callback The callback executed when the file descriptor is ready (optional).
+   * @return The registration identifier, or an error.
+   */
+  expected<RegistrationId, RuntimeError> add_fd(
+      int fd, uint32_t events, const std::shared_ptr<AsynchronousCondition>& condition,
+      Callback callback = {});
+
+  /**
+   * @brief Add a timer.
+   *
+   * @param period The period (or the delay of a one-shot timer).
+   * @param condition The condition set to `EVENT_DONE` when the timer expires (can be null if
+   * only the callback is needed). It is set to `EVENT_WAITING` by this call.
+   * @param callback The callback executed when the timer expires (optional).
+   * @param periodic Whether the timer is periodic. A one-shot timer is restarted by `arm()`.
+   * @return The registration identifier, or an error.
+   */
+  expected<RegistrationId, RuntimeError> add_timer(
+      std::chrono::nanoseconds period, const std::shared_ptr<AsynchronousCondition>& condition,
+      Callback callback = {}, bool periodic = true);
+
+  /**
+   * @brief Wait for the next event of a registration.
+   *
+   * Sets the condition of the registration to `EVENT_WAITING` and re-enables the file
+   * descriptor (or restarts a one-shot timer).
+   *
+   * @param id The registration identifier.
+   * @return An error if the registration does not exist or cannot be re-enabled.
+   */
+  expected<void, RuntimeError> arm(RegistrationId id);
+
+  /**
+   * @brief Remove a registration.
+   *
+   * When called from another thread than the reactor thread, the callback of the registration
+   * is guaranteed not to be running anymore once this method returns.
+   *
+   * @param id The registration identifier.
+   * @return An error if the registration does not exist.
+   */
+  expected<void, RuntimeError> remove(RegistrationId id);
+
+  /// The number of registrations.
+  size_t num_registrations() const;
+
+ private:
+  struct Registration;
+
+  expected<RegistrationId, RuntimeError> add(std::shared_ptr<Registration> registration);
+  expected<void, RuntimeError> start();
+  void stop();
+  void run();
+  void dispatch(Registration& registration, uint32_t events);
+
+  Parameter<int64_t> max_events_;
+
+  mutable std::mutex mutex_;  ///< Protects the registrations and the reactor startup
+  std::unordered_map<RegistrationId, std::shared_ptr<Registration>> registrations_;
+  RegistrationId next_id_ = 0;
+  /// Held by the reactor thread while dispatching a batch of events
+  std::mutex dispatch_mutex_;
+  int epoll_fd_ = -1;
+  int wake_fd_ = -1;  ///< eventfd used to stop the reactor thread
+  std::thread thread_;
+  std::atomic<bool> stop_requested_{false};
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_EVENT_REACTOR_HPP */
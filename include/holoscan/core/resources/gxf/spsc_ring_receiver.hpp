@@ -0,0 +1,53 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_RESOURCES_GXF_SPSC_RING_RECEIVER_HPP
+#define HOLOSCAN_CORE_RESOURCES_GXF_SPSC_RING_RECEIVER_HPP
+
+#include "../../gxf/spsc_ring_receiver.hpp"
+#include "./receiver.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Lock-free single-producer/single-consumer ring receiver class.
+ *
+ * The SpscRingReceiver class is used to receive messages from another operator within a
+ * fragment (IOSpec::ConnectorType::kSpscRing). Messages are available to the receiving operator
+ * as soon as they are published, without the lock and the synchronization step of the double
+ * buffer receiver.
+ *
+ * It has the same `capacity` and `policy` parameters as DoubleBufferReceiver.
+ */
+class SpscRingReceiver : public Receiver {
+ public:
+  HOLOSCAN_RESOURCE_FORWARD_ARGS_SUPER(SpscRingReceiver, Receiver)
+  SpscRingReceiver() = default;
+
+  const char* gxf_typename() const override { return "holoscan::gxf::SpscRingReceiver"; }
+
+  void setup(ComponentSpec& spec) override;
+
+  gxf::SpscRingReceiver* get() const;
+
+  Parameter<uint64_t> capacity_;
+  Parameter<uint64_t> policy_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_RESOURCES_GXF_SPSC_RING_RECEIVER_HPP */
@@ -23,6 +23,7 @@
 #include <gxf/std/transmitter.hpp>
 
 #include "../../gxf/gxf_resource.hpp"
+#include "../../gxf/message_entity_pool.hpp"
 
 namespace holoscan {
 
@@ -40,6 +41,17 @@ class Transmitter : public gxf::GXFResource {
   const char* gxf_typename() const override { return "nvidia::gxf::Transmitter"; }
 
   nvidia::gxf::Transmitter* get() const;
+
+  /**
+   * @brief Get the pool of message entities used to emit values (std::shared_ptr or std::any)
+   * through this transmitter.
+   *
+   * @return The reference to the message entity pool.
+   */
+  gxf::MessageEntityPool& message_entity_pool() { return message_entity_pool_; }
+
+ private:
+  gxf::MessageEntityPool message_entity_pool_;
 };
 
 }  // namespace holoscan
@@ -75,7 +75,7 @@
 
 namespace holoscan {
 
-enum class SchedulerType { kDefault, kGreedy, kMultiThread, kEventBased };
+enum class SchedulerType { kDefault, kGreedy, kMultiThread, kEventBased, kWorkStealing };
 
 /**
  * @brief Base class for all schedulers.
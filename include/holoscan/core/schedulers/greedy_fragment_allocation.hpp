@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "../fragment_scheduler.hpp"
+#include "../system/topology.hpp"
 
 namespace holoscan {
 
@@ -33,6 +34,22 @@ class GreedyFragmentAllocationStrategy : public FragmentAllocationStrategy {
   void on_add_resource_requirement(const SystemResourceRequirement& resource_requirement) override;
   holoscan::expected<std::unordered_map<std::string, std::string>, std::string> schedule() override;
 
+  /**
+   * @brief Assign the fragments running in the same process to NUMA nodes.
+   *
+   * Fragments are placed from the most to the least demanding one (in CPU), each on the NUMA
+   * node that has the most CPUs left, so that the CPU requirements are balanced across the
+   * nodes. A fragment without CPU requirement counts as one CPU.
+   *
+   * @param resource_requirements The resource requirements of the fragments.
+   * @param numa_nodes The NUMA nodes of the host (see Topology::numa_nodes()).
+   * @return The mapping from fragment name to NUMA node (OS index), or an error message if no
+   * NUMA node is available.
+   */
+  static holoscan::expected<std::unordered_map<std::string, int32_t>, std::string>
+  assign_numa_nodes(const std::vector<SystemResourceRequirement>& resource_requirements,
+                    const std::vector<NumaNodeInfo>& numa_nodes);
+
  private:
   struct AvailableSystemResourceComparator {
     bool operator()(const AvailableSystemResource& a, const AvailableSystemResource& b) const;
@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_SCHEDULER_GXF_WORK_STEALING_SCHEDULER_HPP
+#define HOLOSCAN_CORE_SCHEDULER_GXF_WORK_STEALING_SCHEDULER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../gxf/gxf_scheduler.hpp"
+#include "../../gxf/work_stealing_scheduler.hpp"
+#include "../../resources/gxf/clock.hpp"
+#include "../../resources/gxf/realtime_clock.hpp"
+
+namespace holoscan {
+
+/**
+ * @brief Multi-threaded scheduler with per-worker queues and work stealing.
+ *
+ * Operators that become ready are queued on the worker that last executed them and idle workers
+ * steal queued operators from busy workers. Workers can be pinned to CPU cores
+ * (`worker_cpu_cores`) or NUMA nodes (`worker_numa_nodes`), and operators can be pinned to a
+ * worker (`operator_affinity`, with `"<operator name>:<worker index>"` entries).
+ *
+ * Schedulers of the same process (e.g., of several fragments running in the same process) can
+ * share their workers by using the same `shared_pool` name. The pool is created (with
+ * `worker_thread_number` workers pinned according to `worker_cpu_cores`/`worker_numa_nodes`) by
+ * the first scheduler that starts, and each scheduler has a priority (`pool_priority`) and a
+ * maximum number of workers executing its operators at the same time (`pool_max_workers`).
+ *
+ * Operators holding the Python GIL while they run (`python_operators`, filled with the operators
+ * implemented in Python by the Python API) can be routed to dedicated workers (`python_workers`,
+ * with worker indices): these operators then only run on these workers and the other operators
+ * only on the other workers, so that the native operators do not wait for the GIL.
+ *
+ * The scheduling counters (see gxf::WorkStealingSchedulerStats) are available with `stats()`.
+ */
+class WorkStealingScheduler : public gxf::GXFScheduler {
+ public:
+  HOLOSCAN_SCHEDULER_FORWARD_ARGS_SUPER(WorkStealingScheduler, gxf::GXFScheduler)
+  WorkStealingScheduler() = default;
+
+  const char* gxf_typename() const override { return "holoscan::gxf::WorkStealingScheduler"; }
+
+  std::shared_ptr<Clock> clock() override { return clock_.get(); }
+
+  void setup(ComponentSpec& spec) override;
+  void initialize() override;
+
+  // Parameter getters used for printing scheduler description (e.g. for Python __repr__)
+  int64_t worker_thread_number() { return worker_thread_number_; }
+  bool stop_on_deadlock() { return stop_on_deadlock_; }
+  double check_recession_period_ms() { return check_recession_period_ms_; }
+  int64_t stop_on_deadlock_timeout() { return stop_on_deadlock_timeout_; }
+  // could return std::optional<int64_t>, but just using int64_t simplifies the Python bindings
+  int64_t max_duration_ms() { return max_duration_ms_.has_value() ? max_duration_ms_.get() : -1; }
+  std::vector<int64_t> worker_cpu_cores() { return worker_cpu_cores_; }
+  std::vector<int64_t> worker_numa_nodes() { return worker_numa_nodes_; }
+  std::vector<std::string> operator_affinity() { return operator_affinity_; }
+  std::string shared_pool() { return shared_pool_; }
+  int64_t pool_priority() { return pool_priority_; }
+  int64_t pool_max_workers() { return pool_max_workers_; }
+  std::vector<int64_t> python_workers() { return python_workers_; }
+  std::vector<std::string> python_operators() { return python_operators_; }
+
+  /**
+   * @brief Get the scheduling counters.
+   *
+   * @return The counters accumulated since the scheduler started (all zero if the scheduler was
+   * not initialized yet).
+   */
+  gxf::WorkStealingSchedulerStats stats() const;
+
+  gxf::WorkStealingScheduler* get() const;
+
+ private:
+  Parameter<std::shared_ptr<Clock>> clock_;
+  Parameter<int64_t> worker_thread_number_;
+  Parameter<bool> stop_on_deadlock_;
+  Parameter<double> check_recession_period_ms_;
+  Parameter<int64_t> max_duration_ms_;
+  Parameter<int64_t> stop_on_deadlock_timeout_;  // in ms
+  Parameter<std::vector<int64_t>> worker_cpu_cores_;
+  Parameter<std::vector<int64_t>> worker_numa_nodes_;
+  Parameter<std::vector<std::string>> operator_affinity_;
+  Parameter<std::string> shared_pool_;
+  Parameter<int64_t> pool_priority_;
+  Parameter<int64_t> pool_max_workers_;
+  Parameter<std::vector<int64_t>> python_workers_;
+  Parameter<std::vector<std::string>> python_operators_;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_SCHEDULER_GXF_WORK_STEALING_SCHEDULER_HPP */
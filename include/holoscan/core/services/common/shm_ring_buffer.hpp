@@ -0,0 +1,189 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_SERVICES_COMMON_SHM_RING_BUFFER_HPP
+#define HOLOSCAN_CORE_SERVICES_COMMON_SHM_RING_BUFFER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "holoscan/core/errors.hpp"
+#include "holoscan/core/expected.hpp"
+
+namespace holoscan {
+
+// Forward declarations
+struct ShmRingHeader;
+
+/**
+ * @brief Single-producer/single-consumer ring of fixed-size slots in POSIX shared memory.
+ *
+ * The ring is used to pass messages between fragments running on the same host without going
+ * through the network stack. The receiving side creates the shared memory segment (see
+ * ShmRingBuffer::create()) and the transmitting side attaches to it by name (see
+ * ShmRingBuffer::open()).
+ *
+ * Free and ready slots are counted by process-shared semaphores stored in the segment. A slot
+ * handed to the reader stays reserved until the returned ReadLease is destroyed, so that the slot
+ * memory can be referenced (e.g., by a tensor) without copying it out of the ring.
+ */
+class ShmRingBuffer : public std::enable_shared_from_this<ShmRingBuffer> {
+ public:
+  /// Alignment (in bytes) of each slot's data in the shared memory segment.
+  static constexpr size_t kSlotAlignment = 256;
+
+  /// Status returned by wait_readable().
+  enum class ReadStatus {
+    kReady,    ///< A slot is ready to be read with acquire_read().
+    kTimeout,  ///< No slot became ready within the timeout.
+    kClosed,   ///< The writer is closed and all written slots were consumed.
+  };
+
+  /// Slot reserved by acquire_write(). Must be passed to commit_write() or discard_write().
+  struct WriteSlot {
+    uint64_t index = 0;         ///< The sequence number of the slot.
+    std::byte* data = nullptr;  ///< The slot data.
+    size_t capacity = 0;        ///< The capacity of the slot data in bytes.
+  };
+
+  /**
+   * @brief Slot reserved by acquire_read().
+   *
+   * The slot is given back to the writer when the lease is destroyed. The lease keeps the ring
+   * (and its memory mapping) alive.
+   */
+  class ReadLease {
+   public:
+    ReadLease(std::shared_ptr<ShmRingBuffer> ring, uint64_t index, const std::byte* data,
+              size_t size)
+        : ring_(std::move(ring)), index_(index), data_(data), size_(size) {}
+    ~ReadLease();
+
+    ReadLease(const ReadLease&) = delete;
+    ReadLease& operator=(const ReadLease&) = delete;
+
+    /// The slot data.
+    const std::byte* data() const { return data_; }
+    /// The number of bytes written to the slot.
+    size_t size() const { return size_; }
+
+   private:
+    std::shared_ptr<ShmRingBuffer> ring_;
+    uint64_t index_;
+    const std::byte* data_;
+    size_t size_;
+  };
+
+  ~ShmRingBuffer();
+
+  ShmRingBuffer(const ShmRingBuffer&) = delete;
+  ShmRingBuffer& operator=(const ShmRingBuffer&) = delete;
+
+  /**
+   * @brief Create the shared memory segment (reader side).
+   *
+   * Fails if a segment with the same name already exists, unless the process that created it is
+   * no longer running (a segment left over by a crashed process), in which case it is replaced.
+   * The segment is unlinked when the returned object is destroyed.
+   *
+   * @param name The name of the POSIX shared memory object (e.g.,
+   * "/holoscan_shm_1234_5f3a9c2e81d04b7a_0", see AppDriver).
+   * @param slot_count The number of slots in the ring.
+   * @param slot_size The capacity of each slot in bytes.
+   * @return The ring buffer or an error.
+   */
+  static expected<std::shared_ptr<ShmRingBuffer>, RuntimeError> create(const std::string& name,
+                                                                      uint32_t slot_count,
+                                                                      uint64_t slot_size);
+
+  /**
+   * @brief Attach to a shared memory segment created by create() (writer side).
+   *
+   * Waits until the segment exists and is initialized.
+   *
+   * @param name The name of the POSIX shared memory object.
+   * @param timeout The maximum time to wait for the segment.
+   * @return The ring buffer or an error.
+   */
+  static expected<std::shared_ptr<ShmRingBuffer>, RuntimeError> open(
+      const std::string& name, std::chrono::milliseconds timeout);
+
+  /// The name of the shared memory object.
+  const std::string& name() const { return name_; }
+  /// The number of slots in the ring.
+  uint32_t slot_count() const;
+  /// The capacity of each slot in bytes.
+  uint64_t slot_size() const;
+
+  /**
+   * @brief Reserve the next slot for writing (writer side).
+   *
+   * @param timeout The maximum time to wait for a free slot.
+   * @return The reserved slot, or an error if no slot became free or the reader is closed.
+   */
+  expected<WriteSlot, RuntimeError> acquire_write(std::chrono::milliseconds timeout);
+
+  /// Publish `size` bytes written to the slot to the reader.
+  void commit_write(const WriteSlot& slot, size_t size);
+
+  /// Give a reserved slot back without publishing it.
+  void discard_write(const WriteSlot& slot);
+
+  /// Whether the reader was closed (no slot will be read anymore).
+  bool reader_closed() const;
+
+  /// Mark the writer as closed. The reader gets ReadStatus::kClosed once all slots are consumed.
+  void close_writer();
+
+  /**
+   * @brief Wait until a slot can be read (reader side).
+   *
+   * Each call returning ReadStatus::kReady must be followed by exactly one acquire_read() call.
+   *
+   * @param timeout The maximum time to wait.
+   * @return The read status.
+   */
+  ReadStatus wait_readable(std::chrono::milliseconds timeout);
+
+  /// Take the slot made ready by the last successful wait_readable() call.
+  std::shared_ptr<ReadLease> acquire_read();
+
+  /// Mark the reader as closed so that a blocked writer gives up.
+  void close_reader();
+
+ private:
+  ShmRingBuffer(std::string name, bool owner, void* base, size_t mapped_size);
+
+  /// Called by ReadLease to give the slot back to the writer.
+  void release(uint64_t index);
+
+  std::byte* slot_data(uint64_t index) const;
+
+  std::string name_;
+  bool owner_ = false;  ///< Whether this object created (and unlinks) the segment.
+  void* base_ = nullptr;
+  size_t mapped_size_ = 0;
+  ShmRingHeader* header_ = nullptr;
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_SERVICES_COMMON_SHM_RING_BUFFER_HPP */
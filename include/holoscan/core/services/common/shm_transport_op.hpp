@@ -0,0 +1,155 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_SERVICES_COMMON_SHM_TRANSPORT_OP_HPP
+#define HOLOSCAN_CORE_SERVICES_COMMON_SHM_TRANSPORT_OP_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "holoscan/core/conditions/gxf/asynchronous.hpp"
+#include "holoscan/core/operator.hpp"
+#include "holoscan/core/services/common/shm_ring_buffer.hpp"
+
+namespace holoscan::ops {
+
+/// Default number of slots of the shared memory ring used by an inter-fragment connection.
+constexpr uint32_t kDefaultShmSlotCount = 4;
+/// Default capacity (in bytes) of each slot of the shared memory ring.
+constexpr uint32_t kDefaultShmSlotSize = 8 * 1024 * 1024;
+
+/**
+ * @brief Shared memory transmitter operator.
+ *
+ * Used instead of a UCX transmitter (see VirtualTransmitterOp) when the fragments at both ends of
+ * an inter-fragment connection run on the same host (IOSpec::ConnectorType::kSharedMemory).
+ *
+ * The received data is written to a slot of the ShmRingBuffer created by the ShmReceiverOp of
+ * the target fragment. A holoscan::Message is serialized with the codec registered in the
+ * CodecRegistry. An entity is sent as its tensors: the tensor descriptors are followed by the
+ * tensor data, which is copied once into the slot. An entity with other components (except the
+ * message label) cannot be sent and is dropped with an error.
+ *
+ * The ring is opened when the operator starts. A background thread reserves the next free slot
+ * and drives the operator's AsynchronousCondition, so the operator is only executed once a slot
+ * is available and `compute()` never waits for the receiver.
+ *
+ * ==Named Inputs==
+ *
+ * - **in** : gxf::Entity or any type with a registered codec
+ *   - The data to send.
+ *
+ * ==Parameters==
+ *
+ * - **segment_name**: The name of the POSIX shared memory segment.
+ * - **slot_count**: The number of slots of the ring (default: `kDefaultShmSlotCount`).
+ * - **slot_size**: The capacity of each slot in bytes (default: `kDefaultShmSlotSize`).
+ * - **async_condition**: AsynchronousCondition driven by the slot reservation thread. Optional
+ *   (created by `initialize()` if not provided).
+ */
+class ShmTransmitterOp : public holoscan::Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(ShmTransmitterOp)
+
+  ShmTransmitterOp() = default;
+
+  void setup(OperatorSpec& spec) override;
+  void initialize() override;
+  void start() override;
+  void compute(InputContext& op_input, OutputContext& op_output,
+               ExecutionContext& context) override;
+  void stop() override;
+
+ private:
+  /// Reserves free slots and sets the asynchronous condition (runs in `reserve_thread_`).
+  void reserve_slots();
+
+  Parameter<std::string> segment_name_;
+  Parameter<uint32_t> slot_count_;
+  Parameter<uint32_t> slot_size_;
+  Parameter<std::shared_ptr<AsynchronousCondition>> async_condition_;
+
+  std::shared_ptr<ShmRingBuffer> ring_;
+  std::thread reserve_thread_;
+  std::mutex mutex_;
+  std::condition_variable slot_consumed_;
+  /// Slot reserved for the next compute() call (guarded by mutex_).
+  std::optional<ShmRingBuffer::WriteSlot> slot_;
+  std::atomic<bool> should_stop_{false};
+};
+
+/**
+ * @brief Shared memory receiver operator.
+ *
+ * Counterpart of ShmTransmitterOp in the target fragment. It creates the ShmRingBuffer and emits
+ * each message written to it. A background thread waits for the ring and drives the operator's
+ * AsynchronousCondition, so the operator does not poll. Host tensors are emitted by descriptor:
+ * they reference the ring slot, which is given back to the transmitter once the last tensor
+ * referencing it is destroyed.
+ *
+ * ==Named Outputs==
+ *
+ * - **out** : gxf::Entity or any type with a registered codec
+ *   - The received data.
+ *
+ * ==Parameters==
+ *
+ * - **segment_name**: The name of the POSIX shared memory segment.
+ * - **slot_count**: The number of slots of the ring (default: `kDefaultShmSlotCount`).
+ * - **slot_size**: The capacity of each slot in bytes (default: `kDefaultShmSlotSize`).
+ * - **async_condition**: AsynchronousCondition driven by the receiving thread. Optional (created
+ *   by `initialize()` if not provided).
+ */
+class ShmReceiverOp : public holoscan::Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(ShmReceiverOp)
+
+  ShmReceiverOp() = default;
+
+  void setup(OperatorSpec& spec) override;
+  void initialize() override;
+  void start() override;
+  void compute(InputContext& op_input, OutputContext& op_output,
+               ExecutionContext& context) override;
+  void stop() override;
+
+ private:
+  /// Waits for ready slots and sets the asynchronous condition (runs in `wait_thread_`).
+  void wait_for_slots();
+
+  Parameter<std::string> segment_name_;
+  Parameter<uint32_t> slot_count_;
+  Parameter<uint32_t> slot_size_;
+  Parameter<std::shared_ptr<AsynchronousCondition>> async_condition_;
+
+  std::shared_ptr<ShmRingBuffer> ring_;
+  std::thread wait_thread_;
+  std::mutex mutex_;
+  std::condition_variable slot_consumed_;
+  bool slot_ready_ = false;  ///< A slot was made ready by the waiting thread (guarded by mutex_).
+  std::atomic<bool> should_stop_{false};
+};
+
+}  // namespace holoscan::ops
+
+#endif /* HOLOSCAN_CORE_SERVICES_COMMON_SHM_TRANSPORT_OP_HPP */
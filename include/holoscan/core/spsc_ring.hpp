@@ -0,0 +1,177 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef HOLOSCAN_CORE_SPSC_RING_HPP
+#define HOLOSCAN_CORE_SPSC_RING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace holoscan {
+
+/**
+ * @brief Bounded lock-free single-producer/single-consumer ring of trivially copyable values.
+ *
+ * `try_push()` and `pop_oldest()` must only be called by the producer thread, `try_pop()` and
+ * `peek()` only by the consumer thread. `size()` and `capacity()` can be called from any thread.
+ *
+ * The head (consumer) and tail (producer) indices live on separate cache lines, together with
+ * the copy of the other side's index that each side caches to avoid touching the other cache
+ * line on every operation.
+ *
+ * The producer may drop the oldest value of a full ring (`pop_oldest()`) to make room for a new
+ * one, so the head index is advanced with a compare-and-swap: a value is owned by whichever side
+ * advances the head past it.
+ *
+ * @tparam T The type of the values (must be lock-free as a std::atomic).
+ */
+template <typename T>
+class SpscRing {
+  static_assert(std::is_trivially_copyable_v<T>, "SpscRing values must be trivially copyable");
+
+ public:
+  /**
+   * @brief Construct a new ring.
+   *
+   * @param capacity The maximum number of values in the ring (at least 1).
+   */
+  explicit SpscRing(size_t capacity)
+      : capacity_(capacity == 0 ? 1 : capacity),
+        mask_(round_up_pow2(capacity_) - 1),
+        slots_(new std::atomic<T>[mask_ + 1]) {}
+
+  SpscRing(const SpscRing&) = delete;
+  SpscRing& operator=(const SpscRing&) = delete;
+
+  /// Maximum number of values in the ring.
+  size_t capacity() const { return capacity_; }
+
+  /// Number of values in the ring (a snapshot if called while the ring is in use).
+  size_t size() const {
+    // Load the head first: the tail can only be ahead of it
+    const uint64_t head = head_.load(std::memory_order_acquire);
+    const uint64_t tail = tail_.load(std::memory_order_acquire);
+    return static_cast<size_t>(tail - head);
+  }
+
+  /// Whether the ring is empty (a snapshot if called while the ring is in use).
+  bool empty() const { return size() == 0; }
+
+  /**
+   * @brief Add a value to the ring (producer only).
+   *
+   * @param value The value to add.
+   * @return false if the ring is full.
+   */
+  bool try_push(T value) {
+    const uint64_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ >= capacity_) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ >= capacity_) { return false; }
+    }
+    slots_[tail & mask_].store(value, std::memory_order_relaxed);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Remove the oldest value of the ring (consumer only).
+   *
+   * @param value The removed value.
+   * @return false if the ring is empty.
+   */
+  bool try_pop(T& value) {
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    while (true) {
+      if (head >= cached_tail_) {
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        if (head >= cached_tail_) { return false; }
+      }
+      value = slots_[head & mask_].load(std::memory_order_relaxed);
+      // Fails only if the producer dropped this value in the meantime (`head` is reloaded)
+      if (head_.compare_exchange_weak(
+              head, head + 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+  }
+
+  /**
+   * @brief Remove the oldest value of the ring from the producer side (producer only).
+   *
+   * This is used to make room for a new value in a full ring.
+   *
+   * @param value The removed value.
+   * @return false if the ring is empty.
+   */
+  bool pop_oldest(T& value) {
+    const uint64_t tail = tail_.load(std::memory_order_relaxed);
+    uint64_t head = head_.load(std::memory_order_acquire);
+    while (head < tail) {
+      value = slots_[head & mask_].load(std::memory_order_relaxed);
+      if (head_.compare_exchange_weak(
+              head, head + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        cached_head_ = head + 1;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Get a value of the ring without removing it (consumer only).
+   *
+   * If the producer drops values concurrently (`pop_oldest()`), the value may be a newer one.
+   *
+   * @param index The index of the value from the oldest one.
+   * @param value The value.
+   * @return false if the ring has no value at this index.
+   */
+  bool peek(size_t index, T& value) const {
+    const uint64_t head = head_.load(std::memory_order_acquire);
+    const uint64_t tail = tail_.load(std::memory_order_acquire);
+    if (head + index >= tail) { return false; }
+    value = slots_[(head + index) & mask_].load(std::memory_order_relaxed);
+    return true;
+  }
+
+ private:
+  static size_t round_up_pow2(size_t value) {
+    size_t result = 1;
+    while (result < value) { result <<= 1; }
+    return result;
+  }
+
+  const size_t capacity_;
+  const uint64_t mask_;
+  std::unique_ptr<std::atomic<T>[]> slots_;
+
+  // Consumer side
+  alignas(64) std::atomic<uint64_t> head_{0};
+  uint64_t cached_tail_ = 0;  ///< Last tail seen by the consumer
+
+  // Producer side
+  alignas(64) std::atomic<uint64_t> tail_{0};
+  uint64_t cached_head_ = 0;  ///< Last head seen by the producer
+};
+
+}  // namespace holoscan
+
+#endif /* HOLOSCAN_CORE_SPSC_RING_HPP */
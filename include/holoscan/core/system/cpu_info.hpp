@@ -28,7 +28,8 @@ enum : uint64_t {
   CORE_COUNT = 0x01,
   CPU_COUNT = 0x02,
   AVAILABLE_PROCESSOR_COUNT = 0x04,
-  COUNT = CORE_COUNT | CPU_COUNT | AVAILABLE_PROCESSOR_COUNT,
+  NUMA_NODE_COUNT = 0x40,
+  COUNT = CORE_COUNT | CPU_COUNT | AVAILABLE_PROCESSOR_COUNT | NUMA_NODE_COUNT,
   CPU_USAGE = 0x8,
   MEMORY_USAGE = 0x10,
   SHARED_MEMORY_USAGE = 0x20,
@@ -46,6 +47,7 @@ struct CPUInfo {
   int32_t num_cores = 0;                 ///< The number of cores
   int32_t num_cpus = 0;                  ///< The number of CPUs
   int32_t num_processors = 0;            ///< The number of available processors
+  int32_t num_numa_nodes = 0;            ///< The number of NUMA nodes
   float cpu_usage = 0.0f;                ///< The CPU usage (in percent)
   uint64_t memory_total = 0;             ///< The total memory (in bytes)
   uint64_t memory_free = 0;              ///< The free memory (in bytes)
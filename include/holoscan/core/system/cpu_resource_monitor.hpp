@@ -40,6 +40,7 @@ constexpr uint64_t kDefaultCpuMetrics =
  * - `CORE_COUNT`: Number of cores (num_cores)
  * - `CPU_COUNT`: Number of CPUs (num_cpus)
  * - `AVAILABLE_PROCESSOR_COUNT`: Number of available processors (num_processors)
+ * - `NUMA_NODE_COUNT`: Number of NUMA nodes (num_numa_nodes)
  * - `CPU_USAGE`: CPU usage (cpu_usage)
  * - `MEMORY_USAGE`: Memory usage (memory_total, memory_free, memory_available, memory_usage)
  * - `SHARED_MEMORY_USAGE`: Shared memory usage (shared_memory_total, shared_memory_free,
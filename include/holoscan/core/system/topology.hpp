@@ -18,10 +18,24 @@
 #ifndef HOLOSCAN_CORE_SYSTEM_TOPOLOGY_HPP
 #define HOLOSCAN_CORE_SYSTEM_TOPOLOGY_HPP
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace holoscan {
 
+/**
+ * @brief NumaNodeInfo struct
+ *
+ * This struct is responsible for holding the information of a NUMA node.
+ */
+struct NumaNodeInfo {
+  int32_t os_index = -1;      ///< The OS index of the NUMA node
+  int32_t num_cores = 0;      ///< The number of cores of the NUMA node
+  int32_t num_cpus = 0;       ///< The number of CPUs (processing units) of the NUMA node
+  uint64_t memory_total = 0;  ///< The local memory of the NUMA node (in bytes)
+};
+
 /**
  * @brief Topology class
  *
@@ -47,6 +61,31 @@ class Topology {
    */
   void* context() const;
 
+  /**
+   * @brief Get the NUMA nodes of the system
+   *
+   * The topology must be loaded.
+   *
+   * @return The NUMA nodes, ordered by OS index
+   */
+  std::vector<NumaNodeInfo> numa_nodes() const;
+
+  /**
+   * @brief Bind the calling thread to a CPU
+   *
+   * @param cpu The OS index of the CPU (processing unit)
+   * @return 0 on success, -1 on failure (with errno set)
+   */
+  int bind_thread_to_cpu(int64_t cpu) const;
+
+  /**
+   * @brief Bind the calling thread to the CPUs of a NUMA node
+   *
+   * @param numa_node The OS index of the NUMA node
+   * @return 0 on success, -1 on failure (with errno set, ENOENT if the node does not exist)
+   */
+  int bind_thread_to_numa_node(int64_t numa_node) const;
+
  protected:
   void* context_ = nullptr;  ///< The pointer to the topology object
 };
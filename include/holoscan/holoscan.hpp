@@ -41,6 +41,8 @@
 
 // Conditions
 #include "./core/conditions/gxf/asynchronous.hpp"
+#include "./core/conditions/gxf/batch_flush.hpp"
+#include "./core/conditions/gxf/batch_message_available.hpp"
 #include "./core/conditions/gxf/boolean.hpp"
 #include "./core/conditions/gxf/count.hpp"
 #include "./core/conditions/gxf/downstream_affordable.hpp"
@@ -57,8 +59,10 @@
 #include "./core/resources/gxf/double_buffer_receiver.hpp"
 #include "./core/resources/gxf/double_buffer_transmitter.hpp"
 #include "./core/resources/gxf/realtime_clock.hpp"
+#include "./core/resources/event_reactor.hpp"
 #include "./core/resources/gxf/cuda_stream_pool.hpp"
 #include "./core/resources/gxf/serialization_buffer.hpp"
+#include "./core/resources/gxf/spsc_ring_receiver.hpp"
 #include "./core/resources/gxf/std_component_serializer.hpp"
 #include "./core/resources/gxf/std_entity_serializer.hpp"
 #include "./core/resources/gxf/unbounded_allocator.hpp"
@@ -73,6 +77,7 @@
 #include "./core/schedulers/gxf/event_based_scheduler.hpp"
 #include "./core/schedulers/gxf/greedy_scheduler.hpp"
 #include "./core/schedulers/gxf/multithread_scheduler.hpp"
+#include "./core/schedulers/gxf/work_stealing_scheduler.hpp"
 
 // Operators
 #include "./core/gxf/gxf_operator.hpp"
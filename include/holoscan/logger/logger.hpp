@@ -21,10 +21,17 @@
 #include <fmt/format.h>
 #include <fmt/ranges.h>  // allows fmt to format std::array, std::vector, etc.
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
 #define HOLOSCAN_LOG_LEVEL_TRACE 0
@@ -145,6 +152,55 @@ enum class LogLevel {
   OFF = 6,       ///< SPDLOG_LEVEL_OFF
 };
 
+/**
+ * @brief What a thread logging a message does when the asynchronous logging queue is full.
+ */
+enum class LogOverflowPolicy {
+  kDrop,   ///< Discard the message (see Logger::dropped_message_count())
+  kBlock,  ///< Wait until the logging thread makes room for the message
+};
+
+namespace detail {
+
+/// Maximum size (in bytes) of the arguments of a message formatted by the logging thread.
+constexpr size_t kDeferredLogArgsCapacity = 64;
+
+/// Function formatting a message from its format string and its serialized arguments.
+using DeferredLogFormatter = void (*)(const unsigned char* args, fmt::string_view format,
+                                      fmt::memory_buffer& out);
+
+/**
+ * @brief Whether the formatting of a message can be deferred to the asynchronous logging thread.
+ *
+ * This is the case when the format string can be copied as a string and all arguments are
+ * arithmetic or enum values (whose copy does not reference the caller's data), as long as they fit
+ * in `kDeferredLogArgsCapacity` bytes.
+ */
+template <typename FormatT, typename... ArgsT>
+inline constexpr bool is_deferrable_log_call_v =
+    std::is_convertible_v<const FormatT&, fmt::string_view> &&
+    (... && (std::is_arithmetic_v<std::decay_t<ArgsT>> || std::is_enum_v<std::decay_t<ArgsT>>)) &&
+    (0 + ... + sizeof(std::decay_t<ArgsT>)) <= kDeferredLogArgsCapacity;
+
+template <typename... ArgsT>
+void format_deferred_log_args(const unsigned char* args, fmt::string_view format,
+                              fmt::memory_buffer& out) {
+  std::tuple<ArgsT...> values;
+  size_t offset = 0;
+  std::apply(
+      [&](auto&... value) {
+        ((std::memcpy(&value, args + offset, sizeof(value)), offset += sizeof(value)), ...);
+      },
+      values);
+  std::apply(
+      [&](const auto&... value) {
+        fmt::vformat_to(std::back_inserter(out), format, fmt::make_format_args(value...));
+      },
+      values);
+}
+
+}  // namespace detail
+
 /**
  * @brief A logger class that wraps spdlog.
  *
@@ -162,6 +218,27 @@ class Logger {
   template <typename FormatT, typename... ArgsT>
   static void log(const char* file, int line, const char* function_name, LogLevel level,
                   const FormatT& format, ArgsT&&... args) {
+    if constexpr (detail::is_deferrable_log_call_v<FormatT, ArgsT...>) {
+      // Copy the arguments and let the logging thread format the message
+      if (is_async()) {
+        std::array<unsigned char, std::max<size_t>(1, (0 + ... + sizeof(std::decay_t<ArgsT>)))>
+            values;
+        size_t offset = 0;
+        ((std::memcpy(values.data() + offset, &args, sizeof(std::decay_t<ArgsT>)),
+          offset += sizeof(std::decay_t<ArgsT>)),
+         ...);
+        if (log_deferred(file,
+                         line,
+                         function_name,
+                         level,
+                         format,
+                         values.data(),
+                         offset,
+                         &detail::format_deferred_log_args<std::decay_t<ArgsT>...>)) {
+          return;
+        }
+      }
+    }
     log_message(file,
                 line,
                 function_name,
@@ -175,6 +252,46 @@ class Logger {
     log_message(level, format, fmt::make_args_checked<ArgsT...>(format, args...));
   }
 
+  /**
+   * @brief Enable asynchronous logging.
+   *
+   * Messages are queued in a lock-free ring buffer and written by a background thread, so that
+   * logging does not block the calling thread on I/O. Messages whose arguments are all arithmetic
+   * or enum values are also formatted by the background thread. Messages at the ERROR level and
+   * above are still written synchronously (after the queued messages) so that they are not lost if
+   * the process terminates.
+   *
+   * Calling this method again replaces the queue (queued messages are written first).
+   *
+   * @param queue_size The number of messages the queue can hold (rounded up to a power of two).
+   * @param overflow_policy What to do when the queue is full.
+   */
+  static void enable_async(size_t queue_size = kDefaultAsyncQueueSize,
+                           LogOverflowPolicy overflow_policy = LogOverflowPolicy::kDrop);
+
+  /**
+   * @brief Disable asynchronous logging.
+   *
+   * The queued messages are written before this method returns.
+   */
+  static void disable_async();
+
+  /// Whether asynchronous logging is enabled.
+  static bool is_async();
+
+  /**
+   * @brief Wait until all the messages queued so far are written.
+   *
+   * This method does nothing if asynchronous logging is disabled.
+   */
+  static void flush();
+
+  /// The number of messages discarded because the asynchronous logging queue was full.
+  static uint64_t dropped_message_count();
+
+  /// The default number of messages the asynchronous logging queue can hold.
+  static constexpr size_t kDefaultAsyncQueueSize = 8192;
+
   /**
    * @brief Flag to indicate if the log pattern was set by the user.
    */
@@ -193,6 +310,11 @@ class Logger {
   static void log_message(const char* file, int line, const char* function_name, LogLevel level,
                           fmt::string_view format, fmt::format_args args);
   static void log_message(LogLevel level, fmt::string_view format, fmt::format_args args);
+  /// Queue a message to be formatted by the logging thread. Returns false if it was not queued
+  /// and must be logged with log_message().
+  static bool log_deferred(const char* file, int line, const char* function_name, LogLevel level,
+                           fmt::string_view format, const unsigned char* args, size_t args_size,
+                           detail::DeferredLogFormatter formatter);
 };
 
 /**
@@ -253,6 +375,28 @@ inline LogLevel log_level() {
  */
 void set_log_pattern(std::string pattern = "");
 
+/**
+ * @brief Enable or disable asynchronous logging.
+ *
+ * If the environment variable `HOLOSCAN_LOG_ASYNC` is set, it overrides `enabled` ("1", "true",
+ * "on" or "yes" to enable asynchronous logging, any other value to disable it). The queue size and
+ * the overflow policy can be overridden with the `HOLOSCAN_LOG_ASYNC_QUEUE_SIZE` and
+ * `HOLOSCAN_LOG_ASYNC_OVERFLOW` ("drop" or "block") environment variables.
+ *
+ * ```bash
+ * export HOLOSCAN_LOG_ASYNC=true
+ * export HOLOSCAN_LOG_ASYNC_OVERFLOW=block
+ * ```
+ *
+ * See Logger::enable_async() for details.
+ *
+ * @param enabled Whether to enable asynchronous logging.
+ * @param queue_size The number of messages the queue can hold.
+ * @param overflow_policy What to do when the queue is full.
+ */
+void set_log_async(bool enabled, size_t queue_size = Logger::kDefaultAsyncQueueSize,
+                   LogOverflowPolicy overflow_policy = LogOverflowPolicy::kDrop);
+
 /**
  * @brief Print a trace message to the log.
  *
@@ -40,6 +40,8 @@ namespace holoscan::ops {
  * - **delay**: Ping delay in ms. Optional (default: `10L`)
  * - **async_condition**: AsynchronousCondition adding async support to the operator.
  *   Optional (default: `nullptr`)
+ * - **reactor**: EventReactor driving the asynchronous condition with a timer, instead of a
+ *   thread owned by the operator. Optional (default: `nullptr`)
  */
 class AsyncPingRxOp : public Operator {
  public:
@@ -58,10 +60,12 @@ class AsyncPingRxOp : public Operator {
  private:
   Parameter<int64_t> delay_;
   Parameter<std::shared_ptr<AsynchronousCondition>> async_condition_;
+  Parameter<std::shared_ptr<EventReactor>> reactor_;
 
   // internal state
   std::atomic<bool> should_stop_{false};
   std::thread async_thread_;
+  EventReactor::RegistrationId reactor_id_ = -1;
 };
 
 }  // namespace holoscan::ops
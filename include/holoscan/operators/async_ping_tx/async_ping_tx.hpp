@@ -42,6 +42,8 @@ namespace holoscan::ops {
  * - **count**: Ping count. Optional (default: `0UL`)
  * - **async_condition**: AsynchronousCondition adding async support to the operator.
  *   Optional (default: `nullptr`)
+ * - **reactor**: EventReactor driving the asynchronous condition with a timer, instead of a
+ *   thread owned by the operator. Optional (default: `nullptr`)
  */
 class AsyncPingTxOp : public Operator {
  public:
@@ -61,11 +63,13 @@ class AsyncPingTxOp : public Operator {
   Parameter<int64_t> delay_;
   Parameter<uint64_t> count_;
   Parameter<std::shared_ptr<AsynchronousCondition>> async_condition_;
+  Parameter<std::shared_ptr<EventReactor>> reactor_;
 
   // internal state
   std::atomic<uint64_t> index_{0};
   std::atomic<bool> should_stop_{false};
   std::thread async_thread_;
+  EventReactor::RegistrationId reactor_id_ = -1;
 };
 
 }  // namespace holoscan::ops
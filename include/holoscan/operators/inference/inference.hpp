@@ -23,6 +23,7 @@
 #include <string>
 #include <vector>
 
+#include "holoscan/core/conditions/gxf/batch_flush.hpp"
 #include "holoscan/core/io_context.hpp"
 #include "holoscan/core/io_spec.hpp"
 #include "holoscan/core/operator.hpp"
@@ -30,6 +31,7 @@
 #include "holoscan/utils/cuda_stream_handler.hpp"
 
 #include <holoinfer.hpp>
+#include <holoinfer_batcher.hpp>
 #include <holoinfer_buffer.hpp>
 #include <holoinfer_utils.hpp>
 
@@ -46,6 +48,9 @@ namespace holoscan::ops {
  *     will search across all messages for tensors matching those specified in
  *     `in_tensor_names`. These are the set of input tensors used by the models in
  *     `inference_map`.
+ *   - With dynamic batching (`max_batch_size` > 1), each message is a frame of the stream of
+ *     its port and must hold all the tensors of `in_tensor_names`. The operator is then executed
+ *     as soon as any port has a frame (the ports have no MessageAvailableCondition).
  *
  * ==Named Outputs==
  *
@@ -53,6 +58,8 @@ namespace holoscan::ops {
  *   - A message containing tensors corresponding to the inference results from all models
  *     will be emitted. The names of the tensors transmitted correspond to those in
  *     `out_tensor_names`.
+ *   - With dynamic batching, a message is emitted per batch. It holds the results of every frame
+ *     of the batch, named `<tensor name>_<index of the receiver port of the frame>`.
  *
  * ==Parameters==
  *
@@ -75,6 +82,22 @@ namespace holoscan::ops {
  * - **infer_on_cpu**: Whether to run the computation on the CPU instead of GPU. Optional
  *   (default: `false`).
  * - **parallel_inference**: Whether to enable parallel execution. Optional (default: `true`).
+ * - **intra_op_num_threads**: Number of threads executing each operator of a model, on CPU
+ *   (onnxruntime only, `0` for one thread per physical core). Optional (default: `1`).
+ * - **inter_op_num_threads**: Number of threads executing independent operators of a model
+ *   concurrently, on CPU (onnxruntime only, used when `execution_mode` is `"parallel"`).
+ *   Optional (default: `1`).
+ * - **execution_mode**: Execution mode of the operators of a model (onnxruntime only):
+ *   `"sequential"` or `"parallel"`. Optional (default: `"sequential"`).
+ * - **intra_op_thread_affinity**: CPU cores to pin the intra-op threads to, one per thread
+ *   besides the calling thread (onnxruntime only, `std::vector<int>`). Optional (default: `[]`).
+ * - **max_batch_size**: Maximum number of frames inferred at once (dynamic batching). Frames
+ *   received on the `receivers` ports are stacked along the batch dimension of the models,
+ *   which must be dynamic. Only supported by the `"onnxrt"` backend with host input and output
+ *   buffers. Optional (default: `1`, no batching).
+ * - **max_batch_delay_ms**: Maximum time a frame waits for other frames to fill a batch. A
+ *   BatchFlushCondition executes the operator when the delay expires, even if no other frame
+ *   arrives. Optional (default: `0`, the frames received in one execution are batched together).
  * - **input_on_cuda**: Whether the input buffer is on the GPU. Optional (default: `true`).
  * - **output_on_cuda**: Whether the output buffer is on the GPU. Optional (default: `true`).
  * - **transmit_on_cuda**: Whether to transmit the message on the GPU. Optional (default: `true`).
@@ -155,6 +178,26 @@ class InferenceOp : public holoscan::Operator {
   ///  @brief Flag to enable parallel inference. Default is True.
   Parameter<bool> parallel_inference_;
 
+  ///  @brief Number of intra-op threads of the inference on CPU (onnxruntime only). Default is 1.
+  Parameter<int> intra_op_num_threads_;
+
+  ///  @brief Number of inter-op threads of the inference on CPU (onnxruntime only). Default is 1.
+  Parameter<int> inter_op_num_threads_;
+
+  ///  @brief Execution mode of the operators of a model (onnxruntime only). Supported values:
+  ///  "sequential", "parallel". Default is "sequential".
+  Parameter<std::string> execution_mode_;
+
+  ///  @brief CPU cores of the intra-op threads besides the calling thread (onnxruntime only).
+  ///  Threads are not pinned if empty.
+  Parameter<std::vector<int>> intra_op_thread_affinity_;
+
+  ///  @brief Maximum number of frames inferred at once. Default is 1 (no batching).
+  Parameter<int> max_batch_size_;
+
+  ///  @brief Maximum time in ms a frame waits for other frames to fill a batch. Default is 0.
+  Parameter<double> max_batch_delay_ms_;
+
   ///  @brief Flag showing if input buffers are on CUDA. Default is True.
   Parameter<bool> input_on_cuda_;
 
@@ -199,6 +242,22 @@ class InferenceOp : public holoscan::Operator {
   /// Operator Identifier, used in reporting.
   const std::string module_{"Inference Operator"};
 
+  /// Batcher of the received frames (dynamic batching only)
+  std::unique_ptr<HoloInfer::DynamicBatcher> batcher_;
+
+  /// Input data of the frame being received (dynamic batching only)
+  HoloInfer::DataMap frame_inputs_;
+
+  /// Output data per frame of the last batch (dynamic batching only)
+  std::vector<HoloInfer::DataMap> frame_outputs_;
+
+  /// Executes the operator when a frame arrives or the pending batch is due (dynamic batching)
+  std::shared_ptr<BatchFlushCondition> batch_flush_condition_;
+
+  /// Compute with dynamic batching of the received frames
+  void compute_batched(InputContext& op_input, OutputContext& op_output,
+                       ExecutionContext& context);
+
   CudaStreamHandler cuda_stream_handler_;
 };
 
@@ -69,6 +69,8 @@ namespace holoscan::ops {
  * - **cuda_stream_pool**: `holoscan::CudaStreamPool` instance to allocate CUDA streams.
  *   Optional (default: `nullptr`).
  * - **config_path**: File path to the config file. Optional (default: `""`).
+ * - **num_threads**: Number of threads used by the CPU based processing operations (large inputs
+ *   are split over rows). Optional (default: `1`).
  * - **disable_transmitter**: If `true`, disable the transmitter output port of the operator.
  *   Optional (default: `false`).
  */
@@ -144,6 +146,9 @@ class InferenceProcessorOp : public holoscan::Operator {
   ///  Supported value: False
   Parameter<bool> transmit_on_cuda_;
 
+  ///  @brief Number of threads used by the CPU based processing operations. Default is 1.
+  Parameter<int> num_threads_;
+
   ///  @brief Vector of input receivers. Multiple receivers supported.
   Parameter<std::vector<IOSpec*>> receivers_;
 
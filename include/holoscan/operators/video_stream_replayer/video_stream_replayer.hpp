@@ -18,6 +18,8 @@
 #ifndef HOLOSCAN_OPERATORS_STREAM_PLAYBACK_VIDEO_STREAM_REPLAYER_HPP
 #define HOLOSCAN_OPERATORS_STREAM_PLAYBACK_VIDEO_STREAM_REPLAYER_HPP
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -28,6 +30,9 @@
 
 namespace holoscan::ops {
 
+class MappedFile;
+class EntityReadAhead;
+
 /**
  * @brief Operator class to replay a video stream from a file.
  *
@@ -53,6 +58,12 @@ namespace holoscan::ops {
  * - **count**: Number of frame counts to playback. If zero value is specified, it is ignored.
  *   If the count is less than the number of frames in the video, it would finish early.
  *   Optional (default: `0`).
+ * - **read_ahead**: Number of entities read ahead of time by a background thread from the
+ *   memory-mapped entity file (they are still deserialized in `compute()`). If zero value is
+ *   specified, entities are read synchronously in `compute()`. Optional (default: `0`).
+ *
+ * The index file is memory-mapped, so that the playback position can be changed at any time in
+ * constant time with `seek()` (or in logarithmic time with `seek_to_timestamp()`).
  */
 class VideoStreamReplayerOp : public holoscan::Operator {
  public:
@@ -65,10 +76,46 @@ class VideoStreamReplayerOp : public holoscan::Operator {
   void setup(OperatorSpec& spec) override;
 
   void initialize() override;
+  void start() override;
+  void stop() override;
   void compute(InputContext& op_input, OutputContext& op_output,
                ExecutionContext& context) override;
 
+  /**
+   * @brief Get the number of frames (entities) in the recording.
+   *
+   * @return The number of frames, or 0 if the operator is not initialized.
+   */
+  uint64_t num_frames() const;
+
+  /**
+   * @brief Change the playback position.
+   *
+   * This method can be called from any thread. The new position is applied at the next
+   * `compute()` call, and the realtime playback timing restarts from it.
+   *
+   * @param frame_index The index of the next frame to play back.
+   * @return false if the frame index is out of range.
+   */
+  bool seek(uint64_t frame_index);
+
+  /**
+   * @brief Change the playback position to the first frame logged at or after a timestamp.
+   *
+   * The timestamps of the index file are expected to be non-decreasing.
+   *
+   * @param timestamp The timestamp (`log_time` of the index file) to seek to.
+   * @return false if no frame was logged at or after the timestamp.
+   */
+  bool seek_to_timestamp(uint64_t timestamp);
+
  private:
+  /// Value of `pending_seek_` when there is no seek to apply
+  static constexpr uint64_t kNoPendingSeek = UINT64_MAX;
+
+  void apply_seek(uint64_t frame_index);
+  const nvidia::gxf::EntityIndex* indices() const;
+
   Parameter<holoscan::IOSpec*> transmitter_;
   Parameter<std::shared_ptr<holoscan::Resource>> entity_serializer_;
   Parameter<std::shared_ptr<BooleanCondition>> boolean_scheduling_term_;
@@ -80,15 +127,24 @@ class VideoStreamReplayerOp : public holoscan::Operator {
   Parameter<bool> realtime_;
   Parameter<bool> repeat_;
   Parameter<uint64_t> count_;
+  Parameter<size_t> read_ahead_;
 
   // Internal state
-  // File stream for entities
+  // File stream for entities (used if read_ahead is zero)
   nvidia::gxf::FileStream entity_file_stream_;
-  // File stream for index
-  nvidia::gxf::FileStream index_file_stream_;
+  // Memory-mapped index file (array of nvidia::gxf::EntityIndex).
+  // Note: std::shared_ptr (not std::unique_ptr) keeps the helper types incomplete in this header,
+  //       as the inlined forwarding constructors would otherwise need their destructors.
+  std::shared_ptr<MappedFile> index_file_;
+  // Memory-mapped entity file and background reader (used if read_ahead is non-zero)
+  std::shared_ptr<MappedFile> entity_file_;
+  std::shared_ptr<EntityReadAhead> entity_read_ahead_;
+  // Frame index requested by seek(), applied at the next compute() call
+  std::atomic<uint64_t> pending_seek_{kNoPendingSeek};
 
   uint64_t playback_index_ = 0;
   uint64_t playback_count_ = 0;
+  uint64_t timing_start_count_ = 0;
   uint64_t index_start_timestamp_ = 0;
   uint64_t index_last_timestamp_ = 0;
   uint64_t index_timestamp_duration_ = 0;
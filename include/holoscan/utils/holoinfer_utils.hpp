@@ -22,6 +22,7 @@
 #include <string>
 #include <vector>
 
+#include "holoscan/core/gxf/entity.hpp"
 #include "holoscan/core/io_context.hpp"
 #include "holoscan/utils/cuda_stream_handler.hpp"
 
@@ -51,6 +52,29 @@ gxf_result_t get_data_per_model(InputContext& op_input, const std::vector<std::s
                                 bool cuda_buffer_out, const std::string& module,
                                 gxf_context_t& context, CudaStreamHandler& cuda_stream_handler);
 
+/**
+ * Extracts data from received messages.
+ *
+ * The tensors are searched for in the messages in order, the first match is used.
+ *
+ * @param messages Received messages
+ * @param in_tensors Input tensor names
+ * @param data_per_input_tensor Map is updated with output tensor name as key mapped to data
+ * buffer
+ * @param dims_per_tensor Map is updated with tensor name as key mapped to dimension of input tensor
+ * @param cuda_buffer_out Flag defining the location of output memory (Device or Host)
+ * @param module Module that called for data extraction
+ * @param context GXF execution context
+ * @param cuda_stream_handler Cuda steam handler
+ * @returns GXF result code
+ */
+gxf_result_t get_data_per_model(const std::vector<holoscan::gxf::Entity>& messages,
+                                const std::vector<std::string>& in_tensors,
+                                HoloInfer::DataMap& data_per_input_tensor,
+                                std::map<std::string, std::vector<int>>& dims_per_tensor,
+                                bool cuda_buffer_out, const std::string& module,
+                                gxf_context_t& context, CudaStreamHandler& cuda_stream_handler);
+
 /**
  * Transmits multiple buffers via GXF Transmitters.
  *
@@ -77,10 +77,13 @@ class _HOLOSCAN_EXTERNAL_API_ ProcessorContext {
    *
    * @param process_operations   Map of tensor name as key, mapped to list of operations to be
    *                             applied in sequence on the tensor
+   * @param config_path          Path to the processing configuration settings
+   * @param num_threads          Number of threads used by the CPU based operations
    *
    * @returns InferStatus with appropriate holoinfer_code and message.
    */
-  InferStatus initialize(const MultiMappings& process_operations, const std::string config_path);
+  InferStatus initialize(const MultiMappings& process_operations, const std::string config_path,
+                         size_t num_threads = 1);
 
   /**
    * Process the tensors with operations as initialized.
@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _HOLOSCAN_INFER_BATCHER_H
+#define _HOLOSCAN_INFER_BATCHER_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "holoinfer_buffer.hpp"
+#include "holoinfer_constants.hpp"
+
+namespace holoscan {
+namespace inference {
+
+/**
+ * @brief Dynamic batcher of the input tensors of inferences, across frames and streams.
+ *
+ * A frame holds the input tensors of one inference, received from one stream. Frames are queued
+ * until `max_batch_size` frames are pending or the oldest pending frame waited `max_delay`. The
+ * queued frames are then stacked along the leading (batch) dimension of each tensor, inferred
+ * once, and the batched outputs are split back into one output per frame, in the order of the
+ * frames. Only the host buffers are batched.
+ */
+class _HOLOSCAN_EXTERNAL_API_ DynamicBatcher {
+ public:
+  /**
+   * @brief Constructor
+   * @param tensor_names Names of the input tensors of a frame
+   * @param max_batch_size Maximum number of frames in a batch
+   * @param max_delay Maximum time the first frame of a batch waits for the other frames
+   */
+  DynamicBatcher(const std::vector<std::string>& tensor_names, size_t max_batch_size,
+                 std::chrono::nanoseconds max_delay);
+
+  /**
+   * @brief Queue a frame. The host buffers of its tensors are copied.
+   *
+   * All the frames of a batch must have the same data type and number of elements per tensor.
+   *
+   * @param stream_id Identifier of the stream the frame was received from
+   * @param frame Map of tensor name to the data of the frame
+   * @returns InferStatus with appropriate holoinfer_code and message.
+   */
+  InferStatus add(int64_t stream_id, const DataMap& frame);
+
+  /// @brief Check if the pending frames must be inferred: the batch is full or the oldest frame
+  /// waited the maximum delay.
+  bool ready(const TimePoint& now = std::chrono::steady_clock::now()) const;
+
+  /// @brief Check if a frame of the given stream is pending
+  bool contains(int64_t stream_id) const;
+
+  /// @brief Number of pending frames
+  size_t size() const { return stream_ids_.size(); }
+
+  /// @brief Check if no frame is pending
+  bool empty() const { return stream_ids_.empty(); }
+
+  /// @brief Maximum number of frames in a batch
+  size_t max_batch_size() const { return max_batch_size_; }
+
+  /// @brief Maximum time the first frame of a batch waits for the other frames
+  std::chrono::nanoseconds max_delay() const { return max_delay_; }
+
+  /// @brief Stream identifiers of the pending frames, in their order in the batch
+  const std::vector<int64_t>& stream_ids() const { return stream_ids_; }
+
+  /// @brief Arrival time of the oldest pending frame
+  TimePoint oldest_arrival() const { return oldest_arrival_; }
+
+  /**
+   * @brief Stack the pending frames into one buffer per tensor.
+   *
+   * The buffers of `batched_inputs` are reused when they exist, the frames stay pending until
+   * clear() is called.
+   *
+   * @param batched_inputs Map is updated with tensor name as key mapped to the batched data
+   * @returns InferStatus with appropriate holoinfer_code and message.
+   */
+  InferStatus stack(DataMap& batched_inputs) const;
+
+  /**
+   * @brief Split batched outputs back into one output per pending frame.
+   *
+   * Every tensor of `batched_outputs` must hold size() times the number of elements of the
+   * output of one frame.
+   *
+   * @param batched_outputs Map of tensor name to the batched output data
+   * @param frame_outputs Resized to size(), the output of each frame, in the order of the frames.
+   *                      Existing buffers are reused.
+   * @returns InferStatus with appropriate holoinfer_code and message.
+   */
+  InferStatus scatter(const DataMap& batched_outputs, std::vector<DataMap>& frame_outputs) const;
+
+  /// @brief Drop the pending frames
+  void clear();
+
+ private:
+  /// Pending frames of a tensor, stacked
+  struct StagingBuffer {
+    holoinfer_datatype type = holoinfer_datatype::h_Float32;
+    size_t frame_elements = 0;
+    std::vector<byte> data;
+  };
+
+  std::vector<std::string> tensor_names_;
+  size_t max_batch_size_;
+  std::chrono::nanoseconds max_delay_;
+
+  std::vector<StagingBuffer> staging_;
+  std::vector<int64_t> stream_ids_;
+  TimePoint oldest_arrival_{};
+};
+
+}  // namespace inference
+}  // namespace holoscan
+
+#endif
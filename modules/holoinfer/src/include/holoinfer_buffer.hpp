@@ -191,6 +191,28 @@ using Mappings = std::map<std::string, std::string>;
 using DimType = std::map<std::string, std::vector<std::vector<int64_t>>>;
 using MultiMappings = std::map<std::string, std::vector<std::string>>;
 
+/**
+ * @brief Threading options of the inference on CPU (used by the ONNX Runtime backend).
+ */
+struct CpuInferenceOptions {
+  /// @brief Number of threads executing each operator of a model, including the calling thread.
+  /// 0 lets the backend use one thread per physical core. Default is 1.
+  int intra_op_num_threads = 1;
+
+  /// @brief Number of threads executing independent operators of a model concurrently, used in
+  /// parallel execution mode only. 0 lets the backend use one thread per physical core.
+  /// Default is 1.
+  int inter_op_num_threads = 1;
+
+  /// @brief Flag to execute the independent operators of a model concurrently (parallel execution
+  /// mode) instead of sequentially. Default is False.
+  bool parallel_execution = false;
+
+  /// @brief CPU cores to pin the intra-op threads to, one per thread besides the calling thread
+  /// (intra_op_num_threads - 1 values). Threads are not pinned if empty.
+  std::vector<int> intra_op_thread_affinity;
+};
+
 /**
  * @brief Struct that holds specifications related to inference, along with input and
  * output data buffer.
@@ -285,6 +307,9 @@ struct InferenceSpecs {
   ///  @brief Flag showing if output buffers are on CUDA. Default is True.
   bool cuda_buffer_out_ = true;
 
+  /// @brief Threading options of the inference on CPU
+  CpuInferenceOptions cpu_options_;
+
   /// @brief Input Data Map with key as tensor name and value as DataBuffer
   DataMap data_per_tensor_;
 
@@ -17,7 +17,9 @@
 #include "core.hpp"
 
 #include <onnxruntime_cxx_api.h>
+#include <onnxruntime_session_options_config_keys.h>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <string>
@@ -31,10 +33,12 @@ namespace inference {
 class OnnxInferImpl {
  public:
   // Internal only
-  OnnxInferImpl(const std::string& model_file_path, bool cuda_flag);
+  OnnxInferImpl(const std::string& model_file_path, bool cuda_flag,
+                const CpuInferenceOptions& cpu_options);
 
   std::string model_path_{""};
   bool use_cuda_ = true;
+  CpuInferenceOptions cpu_options_;
 
   Ort::SessionOptions session_options_;
   OrtCUDAProviderOptions cuda_options_{};
@@ -49,6 +53,9 @@ class OnnxInferImpl {
   std::vector<std::vector<int64_t>> input_dims_{};
   std::vector<std::vector<int64_t>> output_dims_{};
 
+  /// Flags showing if the first dimension of a tensor is a dynamic batch dimension
+  std::vector<bool> input_dynamic_batch_, output_dynamic_batch_;
+
   std::vector<holoinfer_datatype> input_type_, output_type_;
 
   std::vector<const char*> input_names_;
@@ -63,6 +70,13 @@ class OnnxInferImpl {
   std::vector<Ort::Value> input_tensors_gpu_;
   std::vector<Ort::Value> output_tensors_gpu_;
 
+  /// Binding of the input and output tensors, kept across inferences. A tensor is only created and
+  /// bound again when the host buffer it wraps is reallocated.
+  std::unique_ptr<Ort::IoBinding> io_binding_;
+  std::vector<const void*> bound_inputs_;
+  std::vector<const void*> bound_outputs_;
+  int64_t bound_batch_size_ = 1;
+
   Ort::MemoryInfo memory_info_ = Ort::MemoryInfo::CreateCpu(OrtAllocatorType::OrtArenaAllocator,
                                                             OrtMemType::OrtMemTypeDefault);
 
@@ -74,8 +88,6 @@ class OnnxInferImpl {
 
   Ort::Value create_tensor(const std::shared_ptr<DataBuffer>& input_buffer,
                            const std::vector<int64_t>& dims);
-  void transfer_to_output(std::vector<std::shared_ptr<DataBuffer>>& output_buffer,
-                          const size_t& index);
 
   // Wrapped Public APIs
   InferStatus do_inference(const std::vector<std::shared_ptr<DataBuffer>>& input_buffer,
@@ -102,14 +114,6 @@ Ort::Value create_tensor_core(const std::shared_ptr<DataBuffer>& input_buffer,
                                      dims.size());
 }
 
-template <typename T>
-void transfer_to_host(std::shared_ptr<DataBuffer>& output_buffer, Ort::Value& output_tensor,
-                      const size_t& output_tensor_size) {
-  memcpy(output_buffer->host_buffer.data(),
-         output_tensor.GetTensorMutableData<T>(),
-         output_tensor_size * sizeof(T));
-}
-
 void OnnxInfer::print_model_details() {
   impl_->print_model_details();
 }
@@ -162,6 +166,7 @@ void OnnxInferImpl::populate_model_details() {
     ONNXTensorElementDataType tensor_element_type = input_tensor_info.GetElementType();
     input_type_.push_back(get_holoinfer_datatype(tensor_element_type));
     auto indim = input_tensor_info.GetShape();
+    input_dynamic_batch_.push_back(indim[0] <= 0);
     if (indim[0] <= 0) { indim[0] = 1; }
     input_dims_.push_back(indim);
   }
@@ -178,6 +183,7 @@ void OnnxInferImpl::populate_model_details() {
 
     output_type_.push_back(get_holoinfer_datatype(tensor_element_type));
     auto outdim = output_tensor_info.GetShape();
+    output_dynamic_batch_.push_back(outdim[0] <= 0);
     if (outdim[0] <= 0) { outdim[0] = 1; }
     output_dims_.push_back(outdim);
   }
@@ -190,19 +196,55 @@ int OnnxInfer::set_holoscan_inf_onnx_session_options() {
 }
 
 int OnnxInferImpl::set_holoscan_inf_onnx_session_options() {
-  session_options_.SetIntraOpNumThreads(1);
-  session_options_.SetInterOpNumThreads(1);
+  if (cpu_options_.intra_op_num_threads < 0 || cpu_options_.inter_op_num_threads < 0) {
+    HOLOSCAN_LOG_ERROR("ONNX session options: number of threads must be non-negative.");
+    return 1;
+  }
+  session_options_.SetIntraOpNumThreads(cpu_options_.intra_op_num_threads);
+  session_options_.SetInterOpNumThreads(cpu_options_.inter_op_num_threads);
+  session_options_.SetExecutionMode(cpu_options_.parallel_execution
+                                        ? ExecutionMode::ORT_PARALLEL
+                                        : ExecutionMode::ORT_SEQUENTIAL);
+
+  const auto& affinity = cpu_options_.intra_op_thread_affinity;
+  if (!affinity.empty()) {
+    // The calling thread takes part in the intra-op work, only the other threads are pinned
+    if (static_cast<int>(affinity.size()) + 1 != cpu_options_.intra_op_num_threads) {
+      HOLOSCAN_LOG_ERROR(
+          "ONNX session options: intra-op thread affinity needs {} cores (one per intra-op "
+          "thread besides the calling thread), {} given.",
+          std::max(cpu_options_.intra_op_num_threads - 1, 0),
+          affinity.size());
+      return 1;
+    }
+    // Onnxruntime expects 1-based processor ids separated by ';'
+    std::string affinity_str;
+    for (size_t a = 0; a < affinity.size(); a++) {
+      if (affinity[a] < 0) {
+        HOLOSCAN_LOG_ERROR("ONNX session options: invalid core {} in intra-op thread affinity.",
+                           affinity[a]);
+        return 1;
+      }
+      if (a > 0) { affinity_str += ';'; }
+      affinity_str += std::to_string(affinity[a] + 1);
+    }
+    session_options_.AddConfigEntry(kOrtSessionOptionsConfigIntraOpThreadAffinities,
+                                    affinity_str.c_str());
+  }
+
   if (use_cuda_) { session_options_.AppendExecutionProvider_CUDA(cuda_options_); }
   session_options_.SetGraphOptimizationLevel(GraphOptimizationLevel::ORT_ENABLE_EXTENDED);
   return 0;
 }
 
-extern "C" OnnxInfer* NewOnnxInfer(const std::string& model_file_path, bool cuda_flag) {
-  return new OnnxInfer(model_file_path, cuda_flag);
+extern "C" OnnxInfer* NewOnnxInfer(const std::string& model_file_path, bool cuda_flag,
+                                   const CpuInferenceOptions& cpu_options) {
+  return new OnnxInfer(model_file_path, cuda_flag, cpu_options);
 }
 
-OnnxInfer::OnnxInfer(const std::string& model_file_path, bool cuda_flag)
-    : impl_(new OnnxInferImpl(model_file_path, cuda_flag)) {}
+OnnxInfer::OnnxInfer(const std::string& model_file_path, bool cuda_flag,
+                     const CpuInferenceOptions& cpu_options)
+    : impl_(new OnnxInferImpl(model_file_path, cuda_flag, cpu_options)) {}
 
 OnnxInfer::~OnnxInfer() {
   if (impl_) {
@@ -211,10 +253,13 @@ OnnxInfer::~OnnxInfer() {
   }
 }
 
-OnnxInferImpl::OnnxInferImpl(const std::string& model_file_path, bool cuda_flag)
-    : model_path_(model_file_path), use_cuda_(cuda_flag) {
+OnnxInferImpl::OnnxInferImpl(const std::string& model_file_path, bool cuda_flag,
+                             const CpuInferenceOptions& cpu_options)
+    : model_path_(model_file_path), use_cuda_(cuda_flag), cpu_options_(cpu_options) {
   try {
-    set_holoscan_inf_onnx_session_options();
+    if (set_holoscan_inf_onnx_session_options() != 0) {
+      throw std::runtime_error("Invalid Onnxruntime session options");
+    }
 
     auto env_local = std::make_unique<Ort::Env>(ORT_LOGGING_LEVEL_WARNING, "test");
     env_ = std::move(env_local);
@@ -227,6 +272,12 @@ OnnxInferImpl::OnnxInferImpl(const std::string& model_file_path, bool cuda_flag)
     }
     session_ = std::move(_session);
     populate_model_details();
+
+    io_binding_ = std::make_unique<Ort::IoBinding>(*session_);
+    input_tensors_.resize(input_nodes_);
+    output_tensors_.resize(output_nodes_);
+    bound_inputs_.assign(input_nodes_, nullptr);
+    bound_outputs_.assign(output_nodes_, nullptr);
   } catch (const Ort::Exception& exception) {
     HOLOSCAN_LOG_ERROR(exception.what());
     throw;
@@ -251,28 +302,6 @@ Ort::Value OnnxInferImpl::create_tensor(const std::shared_ptr<DataBuffer>& input
   }
 }
 
-void OnnxInferImpl::transfer_to_output(std::vector<std::shared_ptr<DataBuffer>>& output_buffer,
-                                       const size_t& index) {
-  size_t output_tensor_size = accumulate(
-      output_dims_[index].begin(), output_dims_[index].end(), 1, std::multiplies<size_t>());
-
-  auto data_type = output_buffer[index]->get_datatype();
-
-  switch (data_type) {
-    case holoinfer_datatype::h_Float32:
-      transfer_to_host<float>(output_buffer[index], output_tensors_[index], output_tensor_size);
-      break;
-    case holoinfer_datatype::h_Int8:
-      transfer_to_host<int8_t>(output_buffer[index], output_tensors_[index], output_tensor_size);
-      break;
-    case holoinfer_datatype::h_Int32:
-      transfer_to_host<int32_t>(output_buffer[index], output_tensors_[index], output_tensor_size);
-      break;
-    default:
-      throw std::runtime_error("Unsupported datatype");
-  }
-}
-
 InferStatus OnnxInfer::do_inference(const std::vector<std::shared_ptr<DataBuffer>>& input_buffer,
                                     std::vector<std::shared_ptr<DataBuffer>>& output_buffer) {
   return impl_->do_inference(input_buffer, output_buffer);
@@ -284,9 +313,6 @@ InferStatus OnnxInferImpl::do_inference(
   InferStatus status = InferStatus(holoinfer_code::H_ERROR);
 
   try {
-    input_tensors_.clear();
-    output_tensors_.clear();
-
     if (input_nodes_ != input_buffer.size()) {
       status.set_message("ONNX inference core: Input buffer size not equal to input nodes.");
       return status;
@@ -296,47 +322,85 @@ InferStatus OnnxInferImpl::do_inference(
       return status;
     }
 
+    // Inputs with a dynamic batch dimension may hold several frames, stacked (dynamic batching)
+    int64_t batch_size = 1;
     for (size_t a = 0; a < input_buffer.size(); a++) {
-      if (input_buffer[a]->host_buffer.size() == 0) {
+      const size_t buffer_size = input_buffer[a]->host_buffer.size();
+      if (buffer_size == 0) {
         status.set_message("ONNX inference core: Input Host buffer empty.");
         return status;
       }
+      const size_t frame_size = accumulate(
+          input_dims_[a].begin(), input_dims_[a].end(), 1, std::multiplies<size_t>());
+      if (!input_dynamic_batch_[a] || buffer_size <= frame_size) { continue; }
 
-      Ort::Value i_tensor = create_tensor(input_buffer[a], input_dims_[a]);
+      const auto input_batch_size = static_cast<int64_t>(buffer_size / frame_size);
+      if (buffer_size % frame_size != 0 || (batch_size > 1 && input_batch_size != batch_size)) {
+        status.set_message("ONNX inference core: Input buffers do not hold a batch of frames.");
+        return status;
+      }
+      batch_size = input_batch_size;
+    }
+    if (batch_size != bound_batch_size_) {
+      std::fill(bound_inputs_.begin(), bound_inputs_.end(), nullptr);
+      std::fill(bound_outputs_.begin(), bound_outputs_.end(), nullptr);
+      bound_batch_size_ = batch_size;
+    }
+
+    // Tensors wrap the host buffers, so they only need to be created (and bound) again when a
+    // buffer moved or the batch size changed
+    for (size_t a = 0; a < input_buffer.size(); a++) {
+      const void* data = input_buffer[a]->host_buffer.data();
+      if (data == bound_inputs_[a]) { continue; }
+
+      auto dims = input_dims_[a];
+      if (input_dynamic_batch_[a]) { dims[0] = batch_size; }
+      Ort::Value i_tensor = create_tensor(input_buffer[a], dims);
 
       if (!i_tensor) {
         status.set_message("Onnxruntime: Error creating Ort tensor.");
         return status;
       }
-      input_tensors_.push_back(std::move(i_tensor));
+      io_binding_->BindInput(input_names_[a], i_tensor);
+      input_tensors_[a] = std::move(i_tensor);
+      bound_inputs_[a] = data;
     }
 
-    for (unsigned int a = 0; a < output_buffer.size(); a++) {
+    for (size_t a = 0; a < output_buffer.size(); a++) {
       if (output_buffer[a]->host_buffer.size() == 0) {
         status.set_message("ONNX inference core: Output Host buffer empty.");
         return status;
       }
+      auto dims = output_dims_[a];
+      if (output_dynamic_batch_[a]) {
+        dims[0] = batch_size;
+        const size_t batch_output_size =
+            accumulate(dims.begin(), dims.end(), 1, std::multiplies<size_t>());
+        if (output_buffer[a]->host_buffer.size() != batch_output_size) {
+          output_buffer[a]->host_buffer.resize(batch_output_size);
+        }
+      } else if (batch_size > 1) {
+        status.set_message("ONNX inference core: Output " + std::string(output_names_[a]) +
+                           " has no dynamic batch dimension.");
+        return status;
+      }
+      const void* data = output_buffer[a]->host_buffer.data();
+      if (data == bound_outputs_[a]) { continue; }
 
-      Ort::Value o_tensor = create_tensor(output_buffer[a], output_dims_[a]);
+      Ort::Value o_tensor = create_tensor(output_buffer[a], dims);
 
       if (!o_tensor) {
         status.set_message("Onnxruntime: Error creating output Ort tensor.");
         return status;
       }
-      output_tensors_.push_back(std::move(o_tensor));
+      io_binding_->BindOutput(output_names_[a], o_tensor);
+      output_tensors_[a] = std::move(o_tensor);
+      bound_outputs_[a] = data;
     }
 
-    session_->Run(Ort::RunOptions{nullptr},
-                  input_names_.data(),
-                  input_tensors_.data(),
-                  input_tensors_.size(),
-                  output_names_.data(),
-                  output_tensors_.data(),
-                  output_tensors_.size());
-
-    for (unsigned int a = 0; a < output_buffer.size(); a++) {
-      transfer_to_output(output_buffer, a);
-    }
+    // Results are written directly in the output host buffers
+    session_->Run(Ort::RunOptions{nullptr}, *io_binding_);
+    if (use_cuda_) { io_binding_->SynchronizeOutputs(); }
   } catch (const Ort::Exception& exception) {
     HOLOSCAN_LOG_ERROR(exception.what());
     throw;
@@ -381,6 +445,9 @@ void OnnxInfer::cleanup() {
 }
 
 void OnnxInferImpl::cleanup() {
+  io_binding_.reset();
+  input_tensors_.clear();
+  output_tensors_.clear();
   session_.reset();
   env_.reset();
 }
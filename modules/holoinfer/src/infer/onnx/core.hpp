@@ -44,8 +44,10 @@ class OnnxInfer : public InferBase {
    * @brief Constructor
    * @param model_file_path Path to onnx model file
    * @param cuda_flag Flag to show if inference will happen using CUDA
+   * @param cpu_options Threading options of the inference on CPU
    * */
-  OnnxInfer(const std::string& model_file_path, bool cuda_flag);
+  OnnxInfer(const std::string& model_file_path, bool cuda_flag,
+            const CpuInferenceOptions& cpu_options = {});
 
   /**
    * @brief Destructor
@@ -74,6 +76,7 @@ class OnnxInfer : public InferBase {
 
   /**
    * @brief Create session options for inference
+   * @return 0 on success, 1 if the options are invalid
    * */
   int set_holoscan_inf_onnx_session_options();
 
@@ -18,6 +18,7 @@
 
 #include <dlfcn.h>
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <set>
@@ -254,7 +255,8 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<InferenceSpecs>&
             return status;
           }
           HOLOSCAN_LOG_INFO("Found ONNX Runtime libraries");
-          using NewOnnxInfer = OnnxInfer* (*)(const std::string&, bool);
+          using NewOnnxInfer =
+              OnnxInfer* (*)(const std::string&, bool, const CpuInferenceOptions&);
           auto new_ort_infer = reinterpret_cast<NewOnnxInfer>(dlsym(handle, "NewOnnxInfer"));
           if (!new_ort_infer) {
             HOLOSCAN_LOG_ERROR(dlerror());
@@ -262,7 +264,8 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<InferenceSpecs>&
             return status;
           }
           dlclose(handle);
-          auto context = new_ort_infer(model_path, inference_specs->oncuda_);
+          auto context =
+              new_ort_infer(model_path, inference_specs->oncuda_, inference_specs->cpu_options_);
           holo_infer_context_[model_name] = std::unique_ptr<OnnxInfer>(context);
 #else
           HOLOSCAN_LOG_ERROR("Onnxruntime backend not supported or incorrectly installed.");
@@ -451,10 +454,22 @@ InferStatus ManagerInfer::set_inference_params(std::shared_ptr<InferenceSpecs>&
   }
 
   parallel_processing_ = inference_specs->parallel_processing_;
+
+  // Create the worker threads once, instead of launching a thread per model on every inference
+  model_names_.clear();
+  for (const auto& [model_name, _] : infer_param_) { model_names_.push_back(model_name); }
+  worker_pool_.reset();
+  if (parallel_processing_ && model_names_.size() > 1) {
+    worker_pool_ = std::make_unique<WorkerPool>(model_names_.size());
+    model_status_.assign(model_names_.size(), InferStatus());
+  }
   return InferStatus();
 }
 
 void ManagerInfer::cleanup() {
+  // Stop the worker threads before releasing the inference contexts they use
+  worker_pool_.reset();
+
   for (auto& [_, context] : holo_infer_context_) {
     context->cleanup();
     context.reset();
@@ -669,37 +684,35 @@ InferStatus ManagerInfer::execute_inference(DataMap& permodel_preprocess_data,
   std::chrono::steady_clock::time_point s_time;
   std::chrono::steady_clock::time_point e_time;
 
-  std::map<std::string, std::future<InferStatus>> inference_futures;
   s_time = std::chrono::steady_clock::now();
-  for (const auto& [model_instance, _] : infer_param_) {
-    if (!parallel_processing_) {
-      InferStatus infer_status =
-          run_core_inference(model_instance, permodel_preprocess_data, permodel_output_data);
+  if (worker_pool_) {
+    auto infer_model = [this, &permodel_preprocess_data, &permodel_output_data](size_t index) {
+      model_status_[index] =
+          run_core_inference(model_names_[index], permodel_preprocess_data, permodel_output_data);
+    };
+    // An exception thrown by the inference of a model is rethrown here, as when the inference is
+    // not run in parallel
+    worker_pool_->run(infer_model);
+
+    for (size_t index = 0; index < model_names_.size(); ++index) {
+      const auto& infer_status = model_status_[index];
       if (infer_status.get_code() != holoinfer_code::H_SUCCESS) {
         status.set_code(holoinfer_code::H_ERROR);
         infer_status.display_message();
         status.set_message("Inference manager, Inference failed in execution for " +
-                           model_instance);
+                           model_names_[index]);
         return status;
       }
-    } else {
-      inference_futures.insert({model_instance,
-                                std::async(std::launch::async,
-                                           std::bind(&ManagerInfer::run_core_inference,
-                                                     this,
-                                                     model_instance,
-                                                     permodel_preprocess_data,
-                                                     permodel_output_data))});
     }
-  }
-
-  if (parallel_processing_) {
-    for (auto& inf_fut : inference_futures) {
-      InferStatus infer_status = inf_fut.second.get();
+  } else {
+    for (const auto& [model_instance, _] : infer_param_) {
+      InferStatus infer_status =
+          run_core_inference(model_instance, permodel_preprocess_data, permodel_output_data);
       if (infer_status.get_code() != holoinfer_code::H_SUCCESS) {
         status.set_code(holoinfer_code::H_ERROR);
         infer_status.display_message();
-        status.set_message("Inference manager, Inference failed in execution for " + inf_fut.first);
+        status.set_message("Inference manager, Inference failed in execution for " +
+                           model_instance);
         return status;
       }
     }
@@ -18,12 +18,12 @@
 #define _HOLOSCAN_INFER_MANAGER_H
 
 #include <functional>
-#include <future>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <holoinfer.hpp>
 #include <holoinfer_buffer.hpp>
@@ -42,6 +42,8 @@
 #include <infer/trt/core.hpp>
 #include <params/infer_param.hpp>
 
+#include "worker_pool.hpp"
+
 namespace holoscan {
 namespace inference {
 /**
@@ -113,6 +115,16 @@ class ManagerInfer {
   /// Flag to infer models in parallel. Defaults to False
   bool parallel_processing_ = false;
 
+  /// Names of the models, in the order of the tasks of the worker pool
+  std::vector<std::string> model_names_;
+
+  /// Persistent worker threads for parallel inference, one per model (the calling thread infers
+  /// the first model). Created in set_inference_params if parallel_processing_ is enabled.
+  std::unique_ptr<WorkerPool> worker_pool_;
+
+  /// Status of the inference of each model with the worker pool
+  std::vector<InferStatus> model_status_;
+
   /// Flag to demonstrate if input data buffer is on cuda
   bool cuda_buffer_in_ = false;
 
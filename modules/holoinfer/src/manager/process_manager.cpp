@@ -26,14 +26,15 @@ namespace holoscan {
 namespace inference {
 
 InferStatus ManagerProcessor::initialize(const MultiMappings& process_operations,
-                                         const std::string config_path = {}) {
+                                         const std::string config_path = {},
+                                         size_t num_threads) {
   try {
     infer_data_ = std::make_unique<DataProcessor>();
   } catch (const std::bad_alloc&) {
     return InferStatus(holoinfer_code::H_ERROR,
                        "Process Manager, Holoscan out data core: Memory allocation error");
   }
-  return infer_data_->initialize(process_operations, config_path);
+  return infer_data_->initialize(process_operations, config_path, num_threads);
 }
 
 InferStatus ManagerProcessor::process_multi_tensor_operation(
@@ -226,8 +227,9 @@ InferStatus ProcessorContext::process(const MultiMappings& tensor_to_oper_map,
 }
 
 InferStatus ProcessorContext::initialize(const MultiMappings& process_operations,
-                                         const std::string config_path = {}) {
-  return process_manager->initialize(process_operations, config_path);
+                                         const std::string config_path = {},
+                                         size_t num_threads) {
+  return process_manager->initialize(process_operations, config_path, num_threads);
 }
 
 }  // namespace inference
@@ -50,10 +50,13 @@ class ManagerProcessor {
    * @param process_operations Map where tensor name is the key, and operations to perform on
    * the tensor as vector of strings. Each value in the vector of strings is the supported
    * operation.
+   * @param config_path Path to the processing configuration settings
+   * @param num_threads Number of threads used by the CPU based operations
    *
    * @returns InferStatus with appropriate code and message
    */
-  InferStatus initialize(const MultiMappings& process_operations, const std::string config_path);
+  InferStatus initialize(const MultiMappings& process_operations, const std::string config_path,
+                         size_t num_threads = 1);
 
   /*
    * @brief Executes post processing operations and generates the result
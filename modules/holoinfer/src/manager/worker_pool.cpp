@@ -0,0 +1,123 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "worker_pool.hpp"
+
+#include <utility>
+
+namespace holoscan {
+namespace inference {
+
+namespace {
+
+/// Number of checks of the latch count before blocking
+constexpr int kLatchSpinCount = 1024;
+
+}  // namespace
+
+void CompletionLatch::reset(size_t count) {
+  count_.store(count, std::memory_order_relaxed);
+}
+
+void CompletionLatch::count_down() {
+  if (count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    // Lock so that the notification cannot be lost between the check and the wait in wait()
+    std::lock_guard<std::mutex> lock(mutex_);
+    cv_.notify_one();
+  }
+}
+
+void CompletionLatch::wait() {
+  for (int i = 0; i < kLatchSpinCount; ++i) {
+    if (count_.load(std::memory_order_acquire) == 0) { return; }
+    std::this_thread::yield();
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this]() { return count_.load(std::memory_order_acquire) == 0; });
+}
+
+WorkerPool::WorkerPool(size_t num_tasks) {
+  if (num_tasks > 1) {
+    workers_.reserve(num_tasks - 1);
+    for (size_t index = 1; index < num_tasks; ++index) {
+      workers_.emplace_back(&WorkerPool::worker_loop, this, index);
+    }
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  for (auto& worker : workers_) { worker.join(); }
+}
+
+void WorkerPool::run_impl(TaskFunc func, void* task) {
+  if (!workers_.empty()) {
+    latch_.reset(workers_.size());
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      task_func_ = func;
+      task_ = task;
+      ++generation_;
+    }
+    cv_.notify_all();
+  }
+
+  run_task(func, task, 0);
+
+  // The task is referenced by the workers until they are all done, even if a task threw
+  if (!workers_.empty()) { latch_.wait(); }
+
+  std::exception_ptr exception;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    exception = std::exchange(exception_, nullptr);
+  }
+  if (exception) { std::rethrow_exception(exception); }
+}
+
+void WorkerPool::run_task(TaskFunc func, void* task, size_t index) {
+  try {
+    func(task, index);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!exception_) { exception_ = std::current_exception(); }
+  }
+}
+
+void WorkerPool::worker_loop(size_t index) {
+  uint64_t generation = 0;
+  while (true) {
+    TaskFunc func = nullptr;
+    void* task = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this, generation]() { return stop_ || generation_ != generation; });
+      if (stop_) { return; }
+      generation = generation_;
+      func = task_func_;
+      task = task_;
+    }
+    run_task(func, task, index);
+    latch_.count_down();
+  }
+}
+
+}  // namespace inference
+}  // namespace holoscan
@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _HOLOSCAN_INFER_WORKER_POOL_H
+#define _HOLOSCAN_INFER_WORKER_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace holoscan {
+namespace inference {
+
+/**
+ * @brief Single-use countdown latch that is reset before every use.
+ *
+ * Counting down is a single atomic operation unless the count reaches zero. The waiting thread
+ * spins for a short while before blocking, as the tasks it waits for are usually short.
+ */
+class CompletionLatch {
+ public:
+  /**
+   * @brief Reset the latch. Must not be called while a thread is waiting on the latch.
+   *
+   * @param count Number of count_down() calls needed to release the waiting thread
+   */
+  void reset(size_t count);
+
+  /// @brief Decrement the count, releasing the waiting thread when it reaches zero
+  void count_down();
+
+  /// @brief Wait until the count reaches zero
+  void wait();
+
+ private:
+  std::atomic<size_t> count_{0};
+  std::mutex mutex_;
+  std::condition_variable cv_;
+};
+
+/**
+ * @brief Pool of persistent worker threads, each bound to a task index.
+ *
+ * The threads are created once and reused for every call to run(), so that no thread is created
+ * or joined per frame. Worker i always executes the task index i + 1 while the calling thread
+ * executes the task index 0, so that a task (e.g. the inference of a model) always runs on the
+ * same thread.
+ */
+class WorkerPool {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param num_tasks Number of tasks executed by each call to run(). num_tasks - 1 threads are
+   * created.
+   */
+  explicit WorkerPool(size_t num_tasks);
+
+  /**
+   * @brief Destructor. Stops and joins the worker threads.
+   */
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  /// @brief Number of tasks executed by each call to run()
+  size_t num_tasks() const { return workers_.size() + 1; }
+
+  /**
+   * @brief Execute task(index) for every index in [0, num_tasks()) and wait for all of them.
+   *
+   * The task is not copied: no memory is allocated per call. If some tasks throw, the first
+   * exception caught is rethrown once all the tasks are done, and the pool stays usable.
+   *
+   * @param task Callable with a size_t task index parameter.
+   */
+  template <typename TaskT>
+  void run(TaskT& task) {
+    run_impl([](void* task, size_t index) { (*static_cast<TaskT*>(task))(index); }, &task);
+  }
+
+ private:
+  using TaskFunc = void (*)(void*, size_t);
+
+  void run_impl(TaskFunc func, void* task);
+  void worker_loop(size_t index);
+  /// Execute a task, keeping the exception it throws (if it is the first one of the run)
+  void run_task(TaskFunc func, void* task, size_t index);
+
+  std::vector<std::thread> workers_;
+  CompletionLatch latch_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  uint64_t generation_ = 0;  ///< Incremented for every call to run()
+  bool stop_ = false;
+  TaskFunc task_func_ = nullptr;
+  void* task_ = nullptr;
+  std::exception_ptr exception_;  ///< First exception thrown by a task of the current run
+};
+
+}  // namespace inference
+}  // namespace holoscan
+
+#endif
@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cpu_kernels.hpp"
+
+#include <initializer_list>
+
+#include "cpu_kernels_impl.hpp"
+
+namespace holoscan {
+namespace inference {
+namespace cpu_kernels {
+
+namespace {
+
+struct ScalarVec {
+  static constexpr size_t kWidth = 1;
+  static constexpr size_t kQuantizeBlock = 1;
+  using Float = float;
+
+  static Float load(const float* p) { return *p; }
+  static void store(float* p, Float v) { *p = v; }
+  static Float set1(float v) { return v; }
+  static Float max(Float v, Float acc) { return (acc < v) ? v : acc; }
+  static Float min(Float v, Float acc) { return (acc > v) ? v : acc; }
+  static uint32_t equal_mask(Float a, Float b) { return (a == b) ? 1 : 0; }
+  static uint32_t greater_mask(Float a, Float b) { return (a > b) ? 1 : 0; }
+  static void quantize(const float* in, Float min, Float range, Float scale, uint8_t* out) {
+    *out = static_cast<uint8_t>(scale * ((*in - min) / range));
+  }
+};
+
+const Kernels& scalar_kernels() {
+  static const Kernels kernels = detail::make_kernels<ScalarVec>();
+  return kernels;
+}
+
+}  // namespace
+
+const char* isa_name(Isa isa) {
+  switch (isa) {
+    case Isa::kNeon:
+      return "NEON";
+    case Isa::kAvx2:
+      return "AVX2";
+    case Isa::kAvx512:
+      return "AVX-512";
+    default:
+      return "scalar";
+  }
+}
+
+bool isa_supported(Isa isa) {
+  switch (isa) {
+    case Isa::kScalar:
+      return true;
+#if defined(__x86_64__)
+    case Isa::kAvx2:
+      return __builtin_cpu_supports("avx2");
+    case Isa::kAvx512:
+      return __builtin_cpu_supports("avx512f");
+#endif
+#if defined(__aarch64__)
+    case Isa::kNeon:
+      return true;  // part of the ARMv8-A baseline
+#endif
+    default:
+      return false;
+  }
+}
+
+Isa best_isa() {
+  for (auto isa : {Isa::kAvx512, Isa::kAvx2, Isa::kNeon}) {
+    if (isa_supported(isa)) { return isa; }
+  }
+  return Isa::kScalar;
+}
+
+const Kernels& get_kernels(Isa isa) {
+  switch (isa) {
+#if defined(__x86_64__)
+    case Isa::kAvx2:
+      return avx2_kernels();
+    case Isa::kAvx512:
+      return avx512_kernels();
+#endif
+#if defined(__aarch64__)
+    case Isa::kNeon:
+      return neon_kernels();
+#endif
+    default:
+      return scalar_kernels();
+  }
+}
+
+}  // namespace cpu_kernels
+}  // namespace inference
+}  // namespace holoscan
@@ -0,0 +1,125 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _HOLOSCAN_INFER_CPU_KERNELS_H
+#define _HOLOSCAN_INFER_CPU_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace holoscan {
+namespace inference {
+namespace cpu_kernels {
+
+/// Instruction sets for which the CPU processing kernels are implemented
+enum class Isa { kScalar, kNeon, kAvx2, kAvx512 };
+
+/// Size of the lane buffers passed to the kernels, in number of floats per channel
+constexpr size_t kMaxVectorWidth = 16;
+
+/// Number of bins of the intensity histograms
+constexpr size_t kHistogramBins = 256;
+
+/// Number of partial histograms filled by quantize_histogram (summed by the caller)
+constexpr size_t kPartialHistograms = 4;
+
+/**
+ * @brief Table of the CPU processing kernels of one instruction set.
+ *
+ * All kernels produce the same results for all instruction sets. The buffers passed to the
+ * kernels are owned by the caller so that the kernels do not allocate memory.
+ */
+struct Kernels {
+  /**
+   * @brief Update min and max with the minimum and maximum values of data. NaNs are ignored.
+   */
+  void (*min_max)(const float* data, size_t size, float* min, float* max);
+
+  /**
+   * @brief Quantize values to [0, 255] with uint8_t(255 * ((value - min) / range)) and count the
+   * quantized values.
+   *
+   * @param bins Output quantized values (size elements)
+   * @param histograms kPartialHistograms * kHistogramBins counts, incremented (not reset)
+   */
+  void (*quantize_histogram)(const float* data, size_t size, float min, float range,
+                             uint8_t* bins, uint32_t* histograms);
+
+  /**
+   * @brief Update max_values with the maximum value of each channel of HWC data.
+   *
+   * @param lanes Buffer of channels * kMaxVectorWidth floats
+   */
+  void (*channel_max)(const float* data, size_t num_pixels, size_t channels, float* lanes,
+                      float* max_values);
+
+  /**
+   * @brief Find the first pixel at which each channel of HWC data is equal to its target value.
+   *
+   * Channels whose target is NaN are ignored. first_pixel is only written for the channels that
+   * are found.
+   *
+   * @param lanes Buffer of channels * kMaxVectorWidth floats
+   * @param first_pixel Output index of the first matching pixel, per channel
+   * @param pending Number of channels to find, the search stops when all of them are found
+   * @returns Number of channels that were not found
+   */
+  size_t (*find_first)(const float* data, size_t num_pixels, size_t channels,
+                       const float* targets, float* lanes, size_t* first_pixel, size_t pending);
+
+  /**
+   * @brief Set the RGBA pixels of rgba to color where mask is greater than threshold. The other
+   * pixels are left unchanged.
+   *
+   * @param color RGBA color (4 floats)
+   */
+  void (*mask_fill)(const float* mask, size_t num_pixels, float threshold, const float* color,
+                    float* rgba);
+};
+
+/**
+ * @brief Get the name of an instruction set
+ */
+const char* isa_name(Isa isa);
+
+/**
+ * @brief Check if the kernels of an instruction set are available on this CPU
+ */
+bool isa_supported(Isa isa);
+
+/**
+ * @brief Get the fastest instruction set available on this CPU
+ */
+Isa best_isa();
+
+/**
+ * @brief Get the kernels of an instruction set. The instruction set must be supported.
+ */
+const Kernels& get_kernels(Isa isa);
+
+#if defined(__x86_64__)
+const Kernels& avx2_kernels();
+const Kernels& avx512_kernels();
+#endif
+#if defined(__aarch64__)
+const Kernels& neon_kernels();
+#endif
+
+}  // namespace cpu_kernels
+}  // namespace inference
+}  // namespace holoscan
+
+#endif
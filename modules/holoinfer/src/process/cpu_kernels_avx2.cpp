@@ -0,0 +1,75 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+// Compiled with -mavx2 (see CMakeLists.txt): only called after checking the CPU support.
+
+#include <immintrin.h>
+
+#include "cpu_kernels_impl.hpp"
+
+namespace holoscan {
+namespace inference {
+namespace cpu_kernels {
+
+namespace {
+
+struct Avx2Vec {
+  static constexpr size_t kWidth = 8;
+  static constexpr size_t kQuantizeBlock = 32;
+  using Float = __m256;
+
+  static Float load(const float* p) { return _mm256_loadu_ps(p); }
+  static void store(float* p, Float v) { _mm256_storeu_ps(p, v); }
+  static Float set1(float v) { return _mm256_set1_ps(v); }
+  // vmaxps/vminps return the second operand if either operand is NaN
+  static Float max(Float v, Float acc) { return _mm256_max_ps(v, acc); }
+  static Float min(Float v, Float acc) { return _mm256_min_ps(v, acc); }
+  static uint32_t equal_mask(Float a, Float b) {
+    return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+  }
+  static uint32_t greater_mask(Float a, Float b) {
+    return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ)));
+  }
+
+  static __m256i quantize_vector(const float* in, Float min, Float range, Float scale) {
+    return _mm256_cvttps_epi32(
+        _mm256_mul_ps(scale, _mm256_div_ps(_mm256_sub_ps(_mm256_loadu_ps(in), min), range)));
+  }
+
+  static void quantize(const float* in, Float min, Float range, Float scale, uint8_t* out) {
+    const __m256i q0 = quantize_vector(in, min, range, scale);
+    const __m256i q1 = quantize_vector(in + 8, min, range, scale);
+    const __m256i q2 = quantize_vector(in + 16, min, range, scale);
+    const __m256i q3 = quantize_vector(in + 24, min, range, scale);
+    // The packs interleave the 128-bit lanes: restore the order of the 32-bit groups
+    const __m256i packed =
+        _mm256_packus_epi16(_mm256_packus_epi32(q0, q1), _mm256_packus_epi32(q2, q3));
+    const __m256i ordered =
+        _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), ordered);
+  }
+};
+
+}  // namespace
+
+const Kernels& avx2_kernels() {
+  static const Kernels kernels = detail::make_kernels<Avx2Vec>();
+  return kernels;
+}
+
+}  // namespace cpu_kernels
+}  // namespace inference
+}  // namespace holoscan
@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+// Compiled with -mavx512f (see CMakeLists.txt): only called after checking the CPU support.
+
+#include <immintrin.h>
+
+#include "cpu_kernels_impl.hpp"
+
+namespace holoscan {
+namespace inference {
+namespace cpu_kernels {
+
+namespace {
+
+struct Avx512Vec {
+  static constexpr size_t kWidth = 16;
+  static constexpr size_t kQuantizeBlock = 16;
+  using Float = __m512;
+
+  static Float load(const float* p) { return _mm512_loadu_ps(p); }
+  static void store(float* p, Float v) { _mm512_storeu_ps(p, v); }
+  static Float set1(float v) { return _mm512_set1_ps(v); }
+  // vmaxps/vminps return the second operand if either operand is NaN
+  static Float max(Float v, Float acc) { return _mm512_max_ps(v, acc); }
+  static Float min(Float v, Float acc) { return _mm512_min_ps(v, acc); }
+  static uint32_t equal_mask(Float a, Float b) {
+    return static_cast<uint32_t>(_mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ));
+  }
+  static uint32_t greater_mask(Float a, Float b) {
+    return static_cast<uint32_t>(_mm512_cmp_ps_mask(a, b, _CMP_GT_OQ));
+  }
+
+  static void quantize(const float* in, Float min, Float range, Float scale, uint8_t* out) {
+    const __m512i q = _mm512_cvttps_epi32(
+        _mm512_mul_ps(scale, _mm512_div_ps(_mm512_sub_ps(_mm512_loadu_ps(in), min), range)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm512_cvtepi32_epi8(q));
+  }
+};
+
+}  // namespace
+
+const Kernels& avx512_kernels() {
+  static const Kernels kernels = detail::make_kernels<Avx512Vec>();
+  return kernels;
+}
+
+}  // namespace cpu_kernels
+}  // namespace inference
+}  // namespace holoscan
@@ -0,0 +1,261 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _HOLOSCAN_INFER_CPU_KERNELS_IMPL_H
+#define _HOLOSCAN_INFER_CPU_KERNELS_IMPL_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "cpu_kernels.hpp"
+
+// Generic implementation of the CPU processing kernels, included by the translation unit of each
+// instruction set (compiled with the matching target flags). The kernels are templates on a vector
+// traits type V, defined in an anonymous namespace of each translation unit, which provides:
+//  - kWidth: number of floats per vector, kQuantizeBlock: number of values per quantize() call
+//  - Float: vector type, load(), store(), set1()
+//  - max(v, acc), min(v, acc): element-wise max/min returning acc where v is NaN
+//  - equal_mask(a, b): bit i set if lane i of a and b are equal
+//  - greater_mask(a, b): bit i set if lane i of a is greater than lane i of b (false for NaN)
+//  - quantize(in, min, range, scale, out): out = uint8_t(scale * ((in - min) / range))
+// Everything in this file must stay a template on V: non-template inline functions would be
+// compiled with different target flags in each translation unit and merged by the linker.
+
+namespace holoscan {
+namespace inference {
+namespace cpu_kernels {
+namespace detail {
+
+/// Number of values quantized before they are counted, so that the counted bins are in L1 cache
+constexpr size_t kQuantizeChunk = 4096;
+
+template <typename V>
+void min_max(const float* data, size_t size, float* min, float* max) {
+  constexpr size_t W = V::kWidth;
+  size_t i = 0;
+  if (size >= 2 * W) {
+    auto vmin0 = V::set1(*min), vmin1 = vmin0;
+    auto vmax0 = V::set1(*max), vmax1 = vmax0;
+    for (; i + 2 * W <= size; i += 2 * W) {
+      const auto v0 = V::load(data + i);
+      const auto v1 = V::load(data + i + W);
+      vmin0 = V::min(v0, vmin0);
+      vmax0 = V::max(v0, vmax0);
+      vmin1 = V::min(v1, vmin1);
+      vmax1 = V::max(v1, vmax1);
+    }
+    float lanes[2][W];
+    V::store(lanes[0], V::min(vmin0, vmin1));
+    V::store(lanes[1], V::max(vmax0, vmax1));
+    for (size_t j = 0; j < W; ++j) {
+      if (*min > lanes[0][j]) { *min = lanes[0][j]; }
+      if (*max < lanes[1][j]) { *max = lanes[1][j]; }
+    }
+  }
+  for (; i < size; ++i) {
+    const float v = data[i];
+    if (*max < v) { *max = v; }
+    if (*min > v) { *min = v; }
+  }
+}
+
+template <typename V>
+void quantize_histogram(const float* data, size_t size, float min, float range, uint8_t* bins,
+                        uint32_t* histograms) {
+  constexpr size_t B = V::kQuantizeBlock;
+  static_assert(kQuantizeChunk % B == 0, "quantize block must divide the chunk size");
+  const auto vmin = V::set1(min);
+  const auto vrange = V::set1(range);
+  const auto vscale = V::set1(255.0f);
+  uint32_t* h0 = histograms;
+  uint32_t* h1 = histograms + kHistogramBins;
+  uint32_t* h2 = histograms + 2 * kHistogramBins;
+  uint32_t* h3 = histograms + 3 * kHistogramBins;
+
+  for (size_t begin = 0; begin < size; begin += kQuantizeChunk) {
+    const size_t end = (size - begin > kQuantizeChunk) ? begin + kQuantizeChunk : size;
+    size_t i = begin;
+    for (; i + B <= end; i += B) { V::quantize(data + i, vmin, vrange, vscale, bins + i); }
+    for (; i < end; ++i) { bins[i] = static_cast<uint8_t>(255.0f * ((data[i] - min) / range)); }
+
+    // Four partial histograms avoid stalls on consecutive increments of the same bin
+    i = begin;
+    for (; i + 4 <= end; i += 4) {
+      ++h0[bins[i]];
+      ++h1[bins[i + 1]];
+      ++h2[bins[i + 2]];
+      ++h3[bins[i + 3]];
+    }
+    for (; i < end; ++i) { ++h0[bins[i]]; }
+  }
+}
+
+/// Accumulate the max of W pixels per iteration in lanes (channels * W floats, lane k being the
+/// channel k % channels) and return the number of pixels processed.
+template <typename V, size_t C>
+size_t channel_max_fixed(const float* data, size_t num_pixels, float* lanes) {
+  constexpr size_t W = V::kWidth;
+  typename V::Float acc[C];
+  for (size_t k = 0; k < C; ++k) { acc[k] = V::load(lanes + k * W); }
+  size_t p = 0;
+  for (; p + W <= num_pixels; p += W) {
+    const float* in = data + p * C;
+    for (size_t k = 0; k < C; ++k) { acc[k] = V::max(V::load(in + k * W), acc[k]); }
+  }
+  for (size_t k = 0; k < C; ++k) { V::store(lanes + k * W, acc[k]); }
+  return p;
+}
+
+template <typename V>
+size_t channel_max_generic(const float* data, size_t num_pixels, size_t channels, float* lanes) {
+  constexpr size_t W = V::kWidth;
+  size_t p = 0;
+  for (; p + W <= num_pixels; p += W) {
+    const float* in = data + p * channels;
+    for (size_t k = 0; k < channels; ++k) {
+      V::store(lanes + k * W, V::max(V::load(in + k * W), V::load(lanes + k * W)));
+    }
+  }
+  return p;
+}
+
+template <typename V>
+void channel_max(const float* data, size_t num_pixels, size_t channels, float* lanes,
+                 float* max_values) {
+  // W consecutive pixels are channels vectors of W floats in which the lane k of the vector j is
+  // the channel (j * W + k) % channels, for any number of channels.
+  constexpr size_t W = V::kWidth;
+  const size_t num_lanes = channels * W;
+  for (size_t k = 0; k < num_lanes; ++k) { lanes[k] = max_values[k % channels]; }
+
+  size_t p = 0;
+  switch (channels) {
+    case 1:
+      p = channel_max_fixed<V, 1>(data, num_pixels, lanes);
+      break;
+    case 2:
+      p = channel_max_fixed<V, 2>(data, num_pixels, lanes);
+      break;
+    case 3:
+      p = channel_max_fixed<V, 3>(data, num_pixels, lanes);
+      break;
+    case 4:
+      p = channel_max_fixed<V, 4>(data, num_pixels, lanes);
+      break;
+    default:
+      p = channel_max_generic<V>(data, num_pixels, channels, lanes);
+      break;
+  }
+
+  for (size_t k = 0; k < num_lanes; ++k) {
+    float& max_value = max_values[k % channels];
+    if (max_value < lanes[k]) { max_value = lanes[k]; }
+  }
+  for (; p < num_pixels; ++p) {
+    const float* in = data + p * channels;
+    for (size_t c = 0; c < channels; ++c) {
+      if (max_values[c] < in[c]) { max_values[c] = in[c]; }
+    }
+  }
+}
+
+template <typename V>
+size_t find_first(const float* data, size_t num_pixels, size_t channels, const float* targets,
+                  float* lanes, size_t* first_pixel, size_t pending) {
+  constexpr size_t W = V::kWidth;
+  const size_t num_lanes = channels * W;
+  const float nan = __builtin_nanf("");
+  if (pending == 0) { return 0; }
+
+  // Same lane layout as channel_max. The lanes of a channel are set to NaN once it is found, so
+  // that they never match again.
+  for (size_t k = 0; k < num_lanes; ++k) { lanes[k] = targets[k % channels]; }
+  auto found = [&](size_t lane, size_t pixel) {
+    const size_t c = lane % channels;
+    first_pixel[c] = pixel;
+    for (size_t k = c; k < num_lanes; k += channels) { lanes[k] = nan; }
+    return --pending == 0;
+  };
+
+  size_t p = 0;
+  for (; p + W <= num_pixels; p += W) {
+    const float* in = data + p * channels;
+    for (size_t j = 0; j < channels; ++j) {
+      uint32_t mask = V::equal_mask(V::load(in + j * W), V::load(lanes + j * W));
+      while (mask != 0) {
+        const size_t lane = j * W + __builtin_ctz(mask);
+        mask &= mask - 1;
+        // Skip the later lanes of a channel found in the same vector
+        if (lanes[lane] != lanes[lane]) { continue; }
+        if (found(lane, p + lane / channels)) { return 0; }
+      }
+    }
+  }
+  for (; p < num_pixels; ++p) {
+    const float* in = data + p * channels;
+    for (size_t c = 0; c < channels; ++c) {
+      if (in[c] == lanes[c] && found(c, p)) { return 0; }
+    }
+  }
+  return pending;
+}
+
+template <typename V>
+void mask_fill(const float* mask, size_t num_pixels, float threshold, const float* color,
+               float* rgba) {
+  constexpr size_t W = V::kWidth;
+  size_t p = 0;
+  if constexpr (W % 4 == 0) {
+    // A vector holds W / 4 RGBA pixels: W pixels of color are 4 stores of the repeated color
+    float pattern[W];
+    for (size_t k = 0; k < W; ++k) { pattern[k] = color[k % 4]; }
+    const auto vcolor = V::load(pattern);
+    const auto vthreshold = V::set1(threshold);
+    constexpr uint32_t kAllLanes = static_cast<uint32_t>((uint64_t{1} << W) - 1);
+    for (; p + W <= num_pixels; p += W) {
+      uint32_t lanes = V::greater_mask(V::load(mask + p), vthreshold);
+      if (lanes == 0) { continue; }
+      float* out = rgba + 4 * p;
+      if (lanes == kAllLanes) {
+        for (size_t k = 0; k < 4; ++k) { V::store(out + k * W, vcolor); }
+        continue;
+      }
+      while (lanes != 0) {
+        float* pixel = out + 4 * __builtin_ctz(lanes);
+        lanes &= lanes - 1;
+        for (size_t c = 0; c < 4; ++c) { pixel[c] = color[c]; }
+      }
+    }
+  }
+  for (; p < num_pixels; ++p) {
+    if (mask[p] > threshold) {
+      for (size_t c = 0; c < 4; ++c) { rgba[4 * p + c] = color[c]; }
+    }
+  }
+}
+
+template <typename V>
+Kernels make_kernels() {
+  return Kernels{
+      &min_max<V>, &quantize_histogram<V>, &channel_max<V>, &find_first<V>, &mask_fill<V>};
+}
+
+}  // namespace detail
+}  // namespace cpu_kernels
+}  // namespace inference
+}  // namespace holoscan
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <arm_neon.h>
+
+#include "cpu_kernels_impl.hpp"
+
+namespace holoscan {
+namespace inference {
+namespace cpu_kernels {
+
+namespace {
+
+struct NeonVec {
+  static constexpr size_t kWidth = 4;
+  static constexpr size_t kQuantizeBlock = 16;
+  using Float = float32x4_t;
+
+  static Float load(const float* p) { return vld1q_f32(p); }
+  static void store(float* p, Float v) { vst1q_f32(p, v); }
+  static Float set1(float v) { return vdupq_n_f32(v); }
+  // fmaxnm/fminnm return the number if one of the operands is a (quiet) NaN
+  static Float max(Float v, Float acc) { return vmaxnmq_f32(v, acc); }
+  static Float min(Float v, Float acc) { return vminnmq_f32(v, acc); }
+  static uint32_t equal_mask(Float a, Float b) {
+    static const int32_t kShifts[4] = {0, 1, 2, 3};
+    const uint32x4_t bits = vshrq_n_u32(vceqq_f32(a, b), 31);
+    return vaddvq_u32(vshlq_u32(bits, vld1q_s32(kShifts)));
+  }
+  static uint32_t greater_mask(Float a, Float b) {
+    static const int32_t kShifts[4] = {0, 1, 2, 3};
+    const uint32x4_t bits = vshrq_n_u32(vcgtq_f32(a, b), 31);
+    return vaddvq_u32(vshlq_u32(bits, vld1q_s32(kShifts)));
+  }
+
+  static uint32x4_t quantize_vector(const float* in, Float min, Float range, Float scale) {
+    return vcvtq_u32_f32(vmulq_f32(scale, vdivq_f32(vsubq_f32(vld1q_f32(in), min), range)));
+  }
+
+  static void quantize(const float* in, Float min, Float range, Float scale, uint8_t* out) {
+    const uint16x8_t low = vcombine_u16(vmovn_u32(quantize_vector(in, min, range, scale)),
+                                        vmovn_u32(quantize_vector(in + 4, min, range, scale)));
+    const uint16x8_t high = vcombine_u16(vmovn_u32(quantize_vector(in + 8, min, range, scale)),
+                                         vmovn_u32(quantize_vector(in + 12, min, range, scale)));
+    vst1q_u8(out, vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+  }
+};
+
+}  // namespace
+
+const Kernels& neon_kernels() {
+  static const Kernels kernels = detail::make_kernels<NeonVec>();
+  return kernels;
+}
+
+}  // namespace cpu_kernels
+}  // namespace inference
+}  // namespace holoscan
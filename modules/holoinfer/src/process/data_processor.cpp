@@ -16,17 +16,32 @@
  */
 #include "data_processor.hpp"
 
+#include <algorithm>
 #include <functional>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace holoscan {
 namespace inference {
 
+namespace {
+
+/// Minimum number of values of an input for a CPU based operation to be split over threads
+constexpr size_t kMinParallelSize = size_t{1} << 18;
+
+}  // namespace
+
 InferStatus DataProcessor::initialize(const MultiMappings& process_operations,
-                                      const std::string config_path = {}) {
+                                      const std::string config_path = {}, size_t num_threads) {
+  set_num_threads(num_threads);
+  HOLOSCAN_LOG_DEBUG("Data processor, CPU operations: {} kernels, {} thread(s)",
+                     cpu_kernels::isa_name(isa_),
+                     num_threads);
+
   if (config_path.length() > 0) {
     if (std::filesystem::exists(config_path)) {
       config_path_ = config_path;
@@ -52,6 +67,7 @@ InferStatus DataProcessor::initialize(const MultiMappings& process_operations,
             auto key = fmt::format("{}-{}", p_op.first, _op);
             HOLOSCAN_LOG_INFO("Transform map updated with key: {}", key);
             transforms_.insert({key, std::make_unique<GenerateBoxes>(config_path_)});
+            transforms_.at(key)->set_cpu_resources(worker_pool_.get(), kernels_);
 
             std::vector<std::string> tensor_tokens;
             string_split(p_op.first, tensor_tokens, ':');
@@ -79,6 +95,29 @@ InferStatus DataProcessor::initialize(const MultiMappings& process_operations,
   return InferStatus();
 }
 
+void DataProcessor::set_num_threads(size_t num_threads) {
+  worker_pool_.reset();
+  if (num_threads > 1) { worker_pool_ = std::make_unique<WorkerPool>(num_threads); }
+  for (auto& [key, transform] : transforms_) {
+    transform->set_cpu_resources(worker_pool_.get(), kernels_);
+  }
+}
+
+bool DataProcessor::set_cpu_isa(cpu_kernels::Isa isa) {
+  if (!cpu_kernels::isa_supported(isa)) { return false; }
+  isa_ = isa;
+  kernels_ = &cpu_kernels::get_kernels(isa);
+  for (auto& [key, transform] : transforms_) {
+    transform->set_cpu_resources(worker_pool_.get(), kernels_);
+  }
+  return true;
+}
+
+size_t DataProcessor::num_cpu_tasks(size_t size, size_t rows) const {
+  if (!worker_pool_ || size < kMinParallelSize || rows < worker_pool_->num_tasks()) { return 1; }
+  return worker_pool_->num_tasks();
+}
+
 InferStatus DataProcessor::process_transform(const std::string& transform, const std::string& key,
                                              const std::map<std::string, void*>& indata,
                                              const std::map<std::string, std::vector<int>>& indim,
@@ -199,19 +238,49 @@ InferStatus DataProcessor::scale_intensity_cpu(const std::vector<int>& dimension
   auto processed_data =
       static_cast<uint8_t*>(processed_data_map.at(out_tensor_name)->host_buffer.data());
   auto input_data = static_cast<const float*>(indata);
-  float max = 0, min = 100000;
 
-  for (auto index = 0; index < dsize; index++) {
-    float v = input_data[index];
-    if (max < v) { max = v; }
-    if (min > v) { min = v; }
+  // Rows are split over the tasks, which run the vectorized kernels on their rows
+  const size_t rows = dimensions[1];
+  const size_t cols = dimensions[2];
+  const size_t num_tasks = num_cpu_tasks(dsize, rows);
+  auto task_range = [rows, cols, num_tasks](size_t index) {
+    return std::make_pair(rows * index / num_tasks * cols, rows * (index + 1) / num_tasks * cols);
+  };
+
+  task_min_.assign(num_tasks, 100000);
+  task_max_.assign(num_tasks, 0);
+  auto min_max_task = [&](size_t index) {
+    auto [begin, end] = task_range(index);
+    kernels_->min_max(input_data + begin, end - begin, &task_min_[index], &task_max_[index]);
+  };
+  run_cpu_tasks(num_tasks, min_max_task);
+
+  float max = 0, min = 100000;
+  for (size_t index = 0; index < num_tasks; index++) {
+    if (max < task_max_[index]) { max = task_max_[index]; }
+    if (min > task_min_[index]) { min = task_min_[index]; }
   }
+  // A constant input is quantized to 0
+  const float range = (max > min) ? max - min : 1.0f;
+
+  // Quantized values are kept to be mapped through the equalized histogram below
+  intensity_bins_.resize(dsize);
+  const size_t histograms_per_task = cpu_kernels::kPartialHistograms * cpu_kernels::kHistogramBins;
+  task_histograms_.assign(num_tasks * histograms_per_task, 0);
+  auto quantize_task = [&](size_t index) {
+    auto [begin, end] = task_range(index);
+    kernels_->quantize_histogram(input_data + begin,
+                                 end - begin,
+                                 min,
+                                 range,
+                                 intensity_bins_.data() + begin,
+                                 task_histograms_.data() + index * histograms_per_task);
+  };
+  run_cpu_tasks(num_tasks, quantize_task);
 
   std::vector<uint32_t> histogram(256, 0);
-
-  for (auto index = 0; index < dsize; index++) {
-    auto value = uint8_t(255 * ((input_data[index] - min) / (max - min)));
-    histogram[value]++;
+  for (size_t i = 0; i < task_histograms_.size(); i++) {
+    histogram[i % 256] += task_histograms_[i];
   }
 
   std::vector<uint32_t> cdf_histogram(256);
@@ -232,12 +301,16 @@ InferStatus DataProcessor::scale_intensity_cpu(const std::vector<int>& dimension
         (uint32_t)(255.0 * (cdf_histogram[i] - cdf_histogram_min) / (dsize - cdf_histogram_min));
   }
 
-  for (auto index = 0; index < dsize; index++) {
-    auto dm_index = channels * index;
-    auto fvalue = uint32_t(255 * ((input_data[index] - min) / (max - min)));
-    auto value = updated_histogram[fvalue];
-    for (int c = 0; c < channels; c++) { processed_data[dm_index + c] = value; }
-  }
+  auto equalize_task = [&](size_t index) {
+    auto [begin, end] = task_range(index);
+    const uint8_t* bins = intensity_bins_.data();
+    for (size_t i = begin; i < end; i++) {
+      const uint8_t value = updated_histogram[bins[i]];
+      uint8_t* out = processed_data + channels * i;
+      for (int c = 0; c < channels; c++) { out[c] = value; }
+    }
+  };
+  run_cpu_tasks(num_tasks, equalize_task);
 
   return InferStatus();
 }
@@ -278,33 +351,72 @@ InferStatus DataProcessor::compute_max_per_channel_cpu(
 
   auto input_data = static_cast<const float*>(indata);
   auto processed_data = static_cast<float*>(outdata);
-  std::vector<unsigned int> max_x_per_channel, max_y_per_channel;
-
-  max_x_per_channel.resize(out_channels, 0);
-  max_y_per_channel.resize(out_channels, 0);
-  std::vector<float> maxV(out_channels, -1999);
-
-  for (unsigned int i = 0; i < rows; i++) {
-    for (unsigned int j = 0; j < cols; j++) {
-      for (unsigned int c = 1; c < out_channels; c++) {
-        unsigned int index = i * cols * out_channels + j * out_channels + c;
-        float v1 = input_data[index];
-        if (maxV[c] < v1) {
-          maxV[c] = v1;
-          max_x_per_channel[c] = i;
-          max_y_per_channel[c] = j;
-        }
-      }
+
+  // The location of the max of a channel is its first location in row-major order: the max values
+  // are computed first, then the first pixel holding each of them is searched.
+  const size_t num_pixels = rows * cols;
+  const size_t num_tasks = num_cpu_tasks(num_pixels * out_channels, rows);
+  auto task_range = [rows, cols, num_tasks](size_t index) {
+    return std::make_pair(rows * index / num_tasks * cols, rows * (index + 1) / num_tasks * cols);
+  };
+  const size_t lanes_per_task = out_channels * cpu_kernels::kMaxVectorWidth;
+  task_lanes_.resize(num_tasks * lanes_per_task);
+
+  task_channel_max_.assign(num_tasks * out_channels, -1999);
+  auto max_task = [&](size_t index) {
+    auto [begin, end] = task_range(index);
+    kernels_->channel_max(input_data + begin * out_channels,
+                          end - begin,
+                          out_channels,
+                          task_lanes_.data() + index * lanes_per_task,
+                          task_channel_max_.data() + index * out_channels);
+  };
+  run_cpu_tasks(num_tasks, max_task);
+
+  // Channel 0 is not processed, and a channel without values above -1999 is located at (0, 0)
+  channel_targets_.assign(out_channels, std::numeric_limits<float>::quiet_NaN());
+  size_t pending = 0;
+  for (size_t c = 1; c < out_channels; c++) {
+    float max_value = -1999;
+    for (size_t index = 0; index < num_tasks; index++) {
+      max_value = std::max(max_value, task_channel_max_[index * out_channels + c]);
+    }
+    if (max_value > -1999) {
+      channel_targets_[c] = max_value;
+      pending++;
     }
   }
 
-  for (unsigned int i = 0; i < out_channels; i++) {
-    processed_data[2 * i] = static_cast<float>(max_x_per_channel[i]) / static_cast<float>(rows);
-    processed_data[2 * i + 1] = static_cast<float>(max_y_per_channel[i]) / static_cast<float>(cols);
+  constexpr size_t kNotFound = std::numeric_limits<size_t>::max();
+  task_first_pixel_.assign(num_tasks * out_channels, kNotFound);
+  auto find_task = [&](size_t index) {
+    auto [begin, end] = task_range(index);
+    size_t* first_pixel = task_first_pixel_.data() + index * out_channels;
+    kernels_->find_first(input_data + begin * out_channels,
+                         end - begin,
+                         out_channels,
+                         channel_targets_.data(),
+                         task_lanes_.data() + index * lanes_per_task,
+                         first_pixel,
+                         pending);
+    for (size_t c = 0; c < out_channels; c++) {
+      if (first_pixel[c] != kNotFound) { first_pixel[c] += begin; }
+    }
+  };
+  run_cpu_tasks(num_tasks, find_task);
+
+  for (size_t c = 0; c < out_channels; c++) {
+    size_t pixel = 0;
+    for (size_t index = 0; index < num_tasks; index++) {
+      if (task_first_pixel_[index * out_channels + c] != kNotFound) {
+        pixel = task_first_pixel_[index * out_channels + c];
+        break;
+      }
+    }
+    processed_data[2 * c] = static_cast<float>(pixel / cols) / static_cast<float>(rows);
+    processed_data[2 * c + 1] = static_cast<float>(pixel % cols) / static_cast<float>(cols);
   }
 
-  max_x_per_channel.clear();
-  max_y_per_channel.clear();
   return InferStatus();
 }
 
@@ -31,6 +31,8 @@
 #include <holoinfer_constants.hpp>
 #include <holoinfer_utils.hpp>
 
+#include <manager/worker_pool.hpp>
+#include <process/cpu_kernels.hpp>
 #include <process/transforms/generate_boxes.hpp>
 
 namespace holoscan {
@@ -66,10 +68,34 @@ class DataProcessor {
    * the tensor as vector of strings. Each value in the vector of strings is the supported
    * operation.
    * @param config_path Path to the processing configuration settings
+   * @param num_threads Number of threads used by the CPU based operations
    *
    * @returns InferStatus with appropriate code and message
    */
-  InferStatus initialize(const MultiMappings& process_operations, const std::string config_path);
+  InferStatus initialize(const MultiMappings& process_operations, const std::string config_path,
+                         size_t num_threads = 1);
+
+  /**
+   * @brief Sets the number of threads used by the CPU based operations. Large inputs are split
+   * over the rows, smaller inputs are processed by the calling thread.
+   *
+   * @param num_threads Number of threads, including the calling thread
+   */
+  void set_num_threads(size_t num_threads);
+
+  /**
+   * @brief Selects the instruction set of the CPU based operations. By default, the fastest one
+   * supported by the CPU is used.
+   *
+   * @param isa Instruction set
+   * @returns false if the instruction set is not supported by the CPU
+   */
+  bool set_cpu_isa(cpu_kernels::Isa isa);
+
+  /**
+   * @brief Gets the instruction set used by the CPU based operations
+   */
+  cpu_kernels::Isa cpu_isa() const { return isa_; }
 
   /**
    * @brief Executes an operation via function callback. (Currently CPU based)
@@ -182,6 +208,35 @@ class DataProcessor {
   // Map with operation name as key, with pointer to its object
   std::map<std::string, std::unique_ptr<TransformBase>> transforms_;
 
+  /// Number of tasks over which a CPU operation on size values of rows rows is split
+  size_t num_cpu_tasks(size_t size, size_t rows) const;
+
+  /// Executes task(index) for index in [0, num_tasks), num_tasks being 1 or the pool size
+  template <typename TaskT>
+  void run_cpu_tasks(size_t num_tasks, TaskT& task) {
+    if (num_tasks > 1) {
+      worker_pool_->run(task);
+    } else {
+      task(0);
+    }
+  }
+
+  /// Instruction set and kernels of the CPU based operations
+  cpu_kernels::Isa isa_ = cpu_kernels::best_isa();
+  const cpu_kernels::Kernels* kernels_ = &cpu_kernels::get_kernels(isa_);
+
+  /// Threads of the CPU based operations (null when single-threaded)
+  std::unique_ptr<WorkerPool> worker_pool_;
+
+  /// Buffers of the CPU based operations, reused across calls. Indexed per task where applicable.
+  std::vector<float> task_min_, task_max_;
+  std::vector<uint8_t> intensity_bins_;
+  std::vector<uint32_t> task_histograms_;
+  std::vector<float> task_channel_max_;
+  std::vector<float> task_lanes_;
+  std::vector<float> channel_targets_;
+  std::vector<size_t> task_first_pixel_;
+
   inline static const std::map<std::string, holoinfer_data_processor> supported_print_operations_{
       {"print", holoinfer_data_processor::h_HOST},
       {"print_int32", holoinfer_data_processor::h_HOST},
@@ -24,6 +24,8 @@
 #include <vector>
 
 #include <holoinfer_buffer.hpp>
+#include <manager/worker_pool.hpp>
+#include <process/cpu_kernels.hpp>
 
 namespace holoscan {
 namespace inference {
@@ -49,6 +51,13 @@ class TransformBase {
   virtual InferStatus initialize(const std::vector<std::string>& input_tensors) {
     return InferStatus();
   }
+
+  /**
+   * @brief Set the threads and kernels of the CPU based operations of the transform
+   * @param worker_pool Pool of worker threads owned by the caller, null when single-threaded
+   * @param kernels CPU processing kernels
+   * */
+  virtual void set_cpu_resources(WorkerPool* worker_pool, const cpu_kernels::Kernels* kernels) {}
 };
 
 }  // namespace inference
@@ -16,6 +16,7 @@
  */
 #include "generate_boxes.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <map>
 #include <memory>
@@ -25,6 +26,16 @@
 namespace holoscan {
 namespace inference {
 
+namespace {
+
+/// Minimum number of pixels of the masks for their compositing to be split over threads
+constexpr size_t kMinParallelPixels = size_t{1} << 16;
+
+/// Number of pixels composited at once, so that the output pixels stay in cache across masks
+constexpr size_t kMaskChunk = 4096;
+
+}  // namespace
+
 InferStatus GenerateBoxes::create_tensor_map(const std::vector<std::string>& input_tensors) {
   for (auto& tensor_key : input_tensors) {
     if (tensor_key.find("scores") != std::string::npos) {
@@ -188,9 +199,59 @@ InferStatus GenerateBoxes::initialize(const std::vector<std::string>& input_tens
     }
   }
 
+  create_label_tables();
+
   return create_tensor_map(input_tensors);
 }
 
+void GenerateBoxes::set_cpu_resources(WorkerPool* worker_pool,
+                                      const cpu_kernels::Kernels* kernels) {
+  worker_pool_ = worker_pool;
+  kernels_ = kernels;
+}
+
+void GenerateBoxes::create_label_tables() {
+  // Detections with a label that is not in label_count are displayed as "object"
+  auto objects = label_count;
+  objects.insert({"object", 0});
+
+  object_outputs_.clear();
+  std::map<std::string, size_t> object_index;
+  for (const auto& [object_name, max_objects] : objects) {
+    ObjectOutputs outputs;
+    outputs.name = object_name;
+    outputs.configured = label_count.find(object_name) != label_count.end();
+    outputs.max_objects = outputs.configured ? max_objects : 0;
+    for (int i = 0; i < outputs.max_objects; i++) {
+      outputs.box_keys.push_back(fmt::format("{}{}", object_name, i));
+      outputs.text_keys.push_back(fmt::format("{}text{}", object_name, i));
+    }
+    object_index.insert({object_name, object_outputs_.size()});
+    object_outputs_.push_back(std::move(outputs));
+  }
+  default_object_ = object_index.at("object");
+  object_box_counts_.assign(object_outputs_.size(), 0);
+
+  auto object_color = [this](const std::string& object_name) -> std::array<float, 4> {
+    auto color = color_map.find(object_name);
+    if (color == color_map.end()) { return {1, 1, 1, 1}; }
+    return {color->second[0], color->second[1], color->second[2], color->second[3]};
+  };
+  default_color_ = object_color("object");
+
+  label_objects_.clear();
+  label_colors_.clear();
+  for (const auto& label : label_strings) {
+    if (label_count.find(label) != label_count.end()) {
+      label_objects_.push_back(object_index.at(label));
+      label_colors_.push_back(object_color(label));
+    } else {
+      label_objects_.push_back(default_object_);
+      label_colors_.push_back(default_color_);
+    }
+  }
+}
+
 InferStatus GenerateBoxes::execute_mask(const std::map<std::string, void*>& indata,
                                         const std::map<std::string, std::vector<int>>& indim,
                                         DataMap& processed_data, DimType& processed_dims) {
@@ -199,7 +260,10 @@ InferStatus GenerateBoxes::execute_mask(const std::map<std::string, void*>& inda
     processed_data.insert({key, std::make_shared<DataBuffer>()});
     processed_dims.insert({key, {{height, width, 4}}});
   }
-  processed_data.at(key)->host_buffer.resize(height * width * 4);
+  // The buffer is cleared while compositing the masks, it is only reallocated if its size changes
+  const size_t num_pixels = static_cast<size_t>(height) * width;
+  auto& host_buffer = processed_data.at(key)->host_buffer;
+  if (host_buffer.size() != num_pixels * 4) { host_buffer.resize(num_pixels * 4); }
 
   float* scores = static_cast<float*>(indata.at(tensor_to_output_map.at("scores")));
   float* masks = static_cast<float*>(indata.at(tensor_to_output_map.at("masks")));
@@ -209,40 +273,37 @@ InferStatus GenerateBoxes::execute_mask(const std::map<std::string, void*>& inda
 
   size_t size_scores =
       accumulate(dims_scores.begin(), dims_scores.end(), 1, std::multiplies<size_t>());
-  auto buffer = reinterpret_cast<float*>(processed_data.at(key)->host_buffer.data());
+  auto buffer = reinterpret_cast<float*>(host_buffer.data());
 
-  for (int i = 0; i < size_scores; i++) {
+  mask_detections_.clear();
+  for (size_t i = 0; i < size_scores; i++) {
     if (scores[i] > threshold) {
-      std::string key_mask = "object";
-      // if the label is not found in config, object is used as label
-      if (labels[i] < label_strings.size()) {  // it has to be a valid label
-        if (label_count.find(label_strings[labels[i]]) != label_count.end()) {
-          key_mask = label_strings[labels[i]];
-        }
-      }
-
-      float red = 1, blue = 1, green = 1, alpha = 1;
-      if (color_map.find(key_mask) != color_map.end()) {
-        red = color_map.at(key_mask)[0];
-        green = color_map.at(key_mask)[1];
-        blue = color_map.at(key_mask)[2];
-        alpha = color_map.at(key_mask)[3];
-      }
+      mask_detections_.push_back({masks + i * num_pixels, label_color(labels[i])});
+    }
+  }
 
-      for (int a = 0; a < height; a++) {
-        for (int b = 0; b < width; b++) {
-          auto index = i * width * height + a * width + b;
-          auto hindex = (a * width + b) * 4;
-
-          if (masks[index] > threshold) {
-            buffer[hindex] = red;
-            buffer[hindex + 1] = green;
-            buffer[hindex + 2] = blue;
-            buffer[hindex + 3] = alpha;
-          }
-        }
+  // The rows are split over the tasks. Each task composites the masks in detection order (later
+  // detections overwrite earlier ones) on chunks of its pixels that stay in cache.
+  const size_t rows = height;
+  const size_t num_tasks =
+      (worker_pool_ && num_pixels >= kMinParallelPixels && rows >= worker_pool_->num_tasks())
+          ? worker_pool_->num_tasks()
+          : 1;
+  auto task = [&](size_t index) {
+    const size_t end = (rows * (index + 1) / num_tasks) * width;
+    for (size_t begin = (rows * index / num_tasks) * width; begin < end; begin += kMaskChunk) {
+      const size_t count = std::min(kMaskChunk, end - begin);
+      float* rgba = buffer + 4 * begin;
+      std::fill(rgba, rgba + 4 * count, 0.0f);
+      for (const auto& [mask, color] : mask_detections_) {
+        kernels_->mask_fill(mask + begin, count, threshold, color, rgba);
       }
     }
+  };
+  if (num_tasks > 1) {
+    worker_pool_->run(task);
+  } else {
+    task(0);
   }
 
   return InferStatus();
@@ -276,10 +337,10 @@ InferStatus GenerateBoxes::execute(const std::map<std::string, void*>& indata,
         "Generate boxes, Input data must have a 'boxes' tensor when the dimension map does.");
   }
   // reset all tensors to be displayed in holoviz
-  for (const auto& [object_name, max_objects] : label_count) {
-    for (int i = 0; i < max_objects; i++) {
-      auto key = fmt::format("{}{}", object_name, i);
-      auto key_text = fmt::format("{}text{}", object_name, i);
+  for (const auto& outputs : object_outputs_) {
+    for (int i = 0; i < outputs.max_objects; i++) {
+      const auto& key = outputs.box_keys[i];
+      const auto& key_text = outputs.text_keys[i];
 
       if (processed_data.find(key) == processed_data.end()) {
         processed_data.insert({key, std::make_shared<DataBuffer>()});
@@ -314,51 +375,40 @@ InferStatus GenerateBoxes::execute(const std::map<std::string, void*>& indata,
 
     size_t size_scores =
         accumulate(dims_scores.begin(), dims_scores.end(), 1, std::multiplies<size_t>());
-    std::map<std::string, std::vector<std::vector<float>>> valid_boxes;
+    std::fill(object_box_counts_.begin(), object_box_counts_.end(), 0);
 
     // later update with a priority queue
     // Currently the first configured count of the object above threshold is selected
     // Later it will be configured count of the object above threshold with highest score.
-    for (int i = 0; i < size_scores; i++) {
+    for (size_t i = 0; i < size_scores; i++) {
       if (scores[i] > threshold) {
-        std::string key = "object";  // if the label is not found in config, object is used as label
-        if (labels[i] < label_strings.size()) {  // it has to be a valid label
-          if (label_count.find(label_strings[labels[i]]) != label_count.end()) {
-            key = label_strings[labels[i]];
-          }
-        }
-
-        valid_boxes[key].push_back({boxes[4 * i] / width,
-                                    boxes[4 * i + 1] / height,
-                                    boxes[4 * i + 2] / width,
-                                    boxes[4 * i + 3] / height});
+        const size_t object = label_object(labels[i]);
+        const auto& outputs = object_outputs_[object];
+        const int index = object_box_counts_[object]++;
+        if (index >= outputs.max_objects) { continue; }
+
+        auto current_data =
+            static_cast<float*>(processed_data.at(outputs.box_keys[index])->host_buffer.data());
+        current_data[0] = boxes[4 * i] / width;
+        current_data[1] = boxes[4 * i + 1] / height;
+        current_data[2] = boxes[4 * i + 2] / width;
+        current_data[3] = boxes[4 * i + 3] / height;
+
+        auto current_data_text =
+            static_cast<float*>(processed_data.at(outputs.text_keys[index])->host_buffer.data());
+        current_data_text[0] = current_data[2];
+        current_data_text[1] = current_data[1];
       }
     }
 
-    for (const auto& [obj_name, obj_boxes] : valid_boxes) {
-      int size_of_item = obj_boxes.size();
-      HOLOSCAN_LOG_INFO("Valid box count for object {} = {}", obj_name, size_of_item);
-
-      if (label_count.find(obj_name) != label_count.end()) {
-        if (size_of_item > label_count.at(obj_name)) {
-          HOLOSCAN_LOG_INFO("Valid box count more than maximum display limit of {}",
-                            label_count.at(obj_name));
-          size_of_item = label_count.at(obj_name);
-        }
-      } else {
-        size_of_item = 0;
-      }
-
-      for (int i = 0; i < size_of_item; i++) {
-        auto key = fmt::format("{}{}", obj_name, i);
-        std::memcpy(processed_data.at(key)->host_buffer.data(),
-                    obj_boxes[i].data(),
-                    obj_boxes[i].size() * sizeof(float));
-
-        key = fmt::format("{}text{}", obj_name, i);
-        auto current_data_text = static_cast<float*>(processed_data.at(key)->host_buffer.data());
-        current_data_text[0] = obj_boxes[i][2];
-        current_data_text[1] = obj_boxes[i][1];
+    for (size_t object = 0; object < object_outputs_.size(); object++) {
+      const auto& outputs = object_outputs_[object];
+      const int size_of_item = object_box_counts_[object];
+      if (size_of_item == 0) { continue; }
+      HOLOSCAN_LOG_INFO("Valid box count for object {} = {}", outputs.name, size_of_item);
+      if (outputs.configured && size_of_item > outputs.max_objects) {
+        HOLOSCAN_LOG_INFO("Valid box count more than maximum display limit of {}",
+                          outputs.max_objects);
       }
     }
   }
@@ -18,6 +18,7 @@
 #define MODULES_HOLOINFER_TRANSFORMS_GENERATE_BOXES_HPP
 
 #include <bits/stdc++.h>
+#include <array>
 #include <cstring>
 #include <functional>
 #include <iostream>
@@ -87,7 +88,43 @@ class GenerateBoxes : public TransformBase {
                            const std::map<std::string, std::vector<int>>& indim,
                            DataMap& processed_data, DimType& processed_dims);
 
+  /**
+   * @brief Set the threads and kernels used to composite the object masks
+   * @param worker_pool Pool of worker threads owned by the caller, null when single-threaded
+   * @param kernels CPU processing kernels
+   * */
+  void set_cpu_resources(WorkerPool* worker_pool, const cpu_kernels::Kernels* kernels) override;
+
  private:
+  /// Output tensors of an object name. Detections with a label that is not in label_count are
+  /// displayed as "object".
+  struct ObjectOutputs {
+    std::string name;
+    /// True if the object name is in label_count, otherwise nothing is displayed for it
+    bool configured = false;
+    int max_objects = 0;
+    /// Names of the box and text tensors, max_objects of each
+    std::vector<std::string> box_keys;
+    std::vector<std::string> text_keys;
+  };
+
+  /// @brief Build the object outputs and the color of each label from the configuration
+  void create_label_tables();
+
+  /// @brief Index in object_outputs_ of the object displayed for a label
+  size_t label_object(int64_t label) const {
+    return (label >= 0 && static_cast<size_t>(label) < label_objects_.size())
+               ? label_objects_[label]
+               : default_object_;
+  }
+
+  /// @brief RGBA mask color of a label
+  const float* label_color(int64_t label) const {
+    return (label >= 0 && static_cast<size_t>(label) < label_colors_.size())
+               ? label_colors_[label].data()
+               : default_color_.data();
+  }
+
   /// @brief  Path to the configuration file
   std::string config_path_;
 
@@ -118,6 +155,27 @@ class GenerateBoxes : public TransformBase {
 
   /// Color to be displayed for masks per object
   std::map<std::string, std::vector<float>> color_map;
+
+  /// Object outputs, sorted by object name
+  std::vector<ObjectOutputs> object_outputs_;
+
+  /// Index in object_outputs_ of each label (index in label_strings), and of unknown labels
+  std::vector<size_t> label_objects_;
+  size_t default_object_ = 0;
+
+  /// RGBA mask color of each label (index in label_strings), and of unknown labels
+  std::vector<std::array<float, 4>> label_colors_;
+  std::array<float, 4> default_color_ = {1, 1, 1, 1};
+
+  /// Count of valid boxes per object output in the current frame
+  std::vector<int> object_box_counts_;
+
+  /// Mask and color of the valid detections of the current frame
+  std::vector<std::pair<const float*, const float*>> mask_detections_;
+
+  /// Threads (null when single-threaded) and kernels used to composite the masks
+  WorkerPool* worker_pool_ = nullptr;
+  const cpu_kernels::Kernels* kernels_ = &cpu_kernels::get_kernels(cpu_kernels::best_isa());
 };
 }  // namespace inference
 }  // namespace holoscan
@@ -0,0 +1,156 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <holoinfer_batcher.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace holoscan {
+namespace inference {
+
+DynamicBatcher::DynamicBatcher(const std::vector<std::string>& tensor_names,
+                               size_t max_batch_size, std::chrono::nanoseconds max_delay)
+    : tensor_names_(tensor_names),
+      max_batch_size_(std::max<size_t>(max_batch_size, 1)),
+      max_delay_(max_delay),
+      staging_(tensor_names.size()) {
+  stream_ids_.reserve(max_batch_size_);
+}
+
+InferStatus DynamicBatcher::add(int64_t stream_id, const DataMap& frame) {
+  InferStatus status = InferStatus(holoinfer_code::H_ERROR);
+  if (size() >= max_batch_size_) {
+    status.set_message("Dynamic batcher: batch is full.");
+    return status;
+  }
+
+  // Validate the whole frame first, so that a rejected frame leaves the batch unchanged
+  for (size_t a = 0; a < tensor_names_.size(); a++) {
+    auto it = frame.find(tensor_names_[a]);
+    if (it == frame.end() || !it->second) {
+      status.set_message("Dynamic batcher: tensor " + tensor_names_[a] + " not found in frame.");
+      return status;
+    }
+    const auto& buffer = it->second;
+    if (buffer->host_buffer.size() == 0) {
+      status.set_message("Dynamic batcher: host buffer of tensor " + tensor_names_[a] +
+                         " is empty.");
+      return status;
+    }
+    if (!empty() && (buffer->get_datatype() != staging_[a].type ||
+                     buffer->host_buffer.size() != staging_[a].frame_elements)) {
+      status.set_message("Dynamic batcher: tensor " + tensor_names_[a] +
+                         " differs in type or size from the other frames of the batch.");
+      return status;
+    }
+  }
+
+  for (size_t a = 0; a < tensor_names_.size(); a++) {
+    const auto& buffer = frame.at(tensor_names_[a]);
+    auto& staging = staging_[a];
+    if (empty()) {
+      staging.type = buffer->get_datatype();
+      staging.frame_elements = buffer->host_buffer.size();
+      staging.data.reserve(max_batch_size_ * staging.frame_elements *
+                           get_element_size(staging.type));
+    }
+    const auto* data = static_cast<const byte*>(buffer->host_buffer.data());
+    staging.data.insert(staging.data.end(),
+                        data,
+                        data + staging.frame_elements * get_element_size(staging.type));
+  }
+
+  if (empty()) { oldest_arrival_ = std::chrono::steady_clock::now(); }
+  stream_ids_.push_back(stream_id);
+  return InferStatus();
+}
+
+bool DynamicBatcher::ready(const TimePoint& now) const {
+  if (empty()) { return false; }
+  return size() >= max_batch_size_ || now - oldest_arrival_ >= max_delay_;
+}
+
+bool DynamicBatcher::contains(int64_t stream_id) const {
+  return std::find(stream_ids_.begin(), stream_ids_.end(), stream_id) != stream_ids_.end();
+}
+
+InferStatus DynamicBatcher::stack(DataMap& batched_inputs) const {
+  InferStatus status = InferStatus(holoinfer_code::H_ERROR);
+  if (empty()) {
+    status.set_message("Dynamic batcher: no frame to stack.");
+    return status;
+  }
+
+  for (size_t a = 0; a < tensor_names_.size(); a++) {
+    const auto& staging = staging_[a];
+    auto& buffer = batched_inputs[tensor_names_[a]];
+    if (!buffer || buffer->get_datatype() != staging.type) {
+      buffer = std::make_shared<DataBuffer>(staging.type);
+    }
+    const size_t num_elements = size() * staging.frame_elements;
+    if (buffer->host_buffer.size() != num_elements) { buffer->host_buffer.resize(num_elements); }
+    std::memcpy(buffer->host_buffer.data(), staging.data.data(), staging.data.size());
+  }
+  return InferStatus();
+}
+
+InferStatus DynamicBatcher::scatter(const DataMap& batched_outputs,
+                                    std::vector<DataMap>& frame_outputs) const {
+  InferStatus status = InferStatus(holoinfer_code::H_ERROR);
+  const size_t batch_size = size();
+  if (batch_size == 0) {
+    status.set_message("Dynamic batcher: no frame to scatter the outputs to.");
+    return status;
+  }
+
+  frame_outputs.resize(batch_size);
+  for (const auto& [tensor_name, batched] : batched_outputs) {
+    const size_t num_elements = batched->host_buffer.size();
+    if (num_elements == 0 || num_elements % batch_size != 0) {
+      status.set_message("Dynamic batcher: output tensor " + tensor_name + " of " +
+                         std::to_string(num_elements) + " elements is not a batch of " +
+                         std::to_string(batch_size) + " frames.");
+      return status;
+    }
+    const size_t frame_elements = num_elements / batch_size;
+    const size_t frame_bytes = frame_elements * get_element_size(batched->get_datatype());
+    const auto* data = static_cast<const byte*>(batched->host_buffer.data());
+
+    for (size_t b = 0; b < batch_size; b++) {
+      auto& buffer = frame_outputs[b][tensor_name];
+      if (!buffer || buffer->get_datatype() != batched->get_datatype()) {
+        buffer = std::make_shared<DataBuffer>(batched->get_datatype());
+      }
+      if (buffer->host_buffer.size() != frame_elements) {
+        buffer->host_buffer.resize(frame_elements);
+      }
+      std::memcpy(buffer->host_buffer.data(), data + b * frame_bytes, frame_bytes);
+    }
+  }
+  return InferStatus();
+}
+
+void DynamicBatcher::clear() {
+  for (auto& staging : staging_) { staging.data.clear(); }
+  stream_ids_.clear();
+}
+
+}  // namespace inference
+}  // namespace holoscan
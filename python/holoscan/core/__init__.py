@@ -31,6 +31,7 @@ create a custom application.
     holoscan.core.ConditionType
     holoscan.core.Condition
     holoscan.core.Config
+    holoscan.core.DataFlowLogFormat
     holoscan.core.DataFlowMetric
     holoscan.core.DataFlowTracker
     holoscan.core.DLDevice
@@ -44,7 +45,9 @@ create a custom application.
     holoscan.core.Message
     holoscan.core.NetworkContext
     holoscan.core.Operator
+    holoscan.core.OperatorPortStats
     holoscan.core.OperatorSpec
+    holoscan.core.OperatorStatsSnapshot
     holoscan.core.OutputContext
     holoscan.core.ParameterFlag
     holoscan.core.Resource
@@ -76,6 +79,7 @@ from ._core import (
     Condition,
     ConditionType,
     Config,
+    DataFlowLogFormat,
     DataFlowMetric,
     DataFlowTracker,
     DLDevice,
@@ -86,7 +90,7 @@ from ._core import (
 from ._core import Fragment as _Fragment
 from ._core import InputContext, IOSpec, Message, NetworkContext
 from ._core import Operator as _Operator
-from ._core import OutputContext, ParameterFlag
+from ._core import OperatorPortStats, OperatorStatsSnapshot, OutputContext, ParameterFlag
 from ._core import PyOperatorSpec as OperatorSpec
 from ._core import PyTensor as Tensor
 from ._core import (
@@ -113,6 +117,7 @@ __all__ = [
     "ConditionType",
     "Condition",
     "Config",
+    "DataFlowLogFormat",
     "DataFlowMetric",
     "DataFlowTracker",
     "DLDevice",
@@ -127,7 +132,9 @@ __all__ = [
     "Message",
     "NetworkContext",
     "Operator",
+    "OperatorPortStats",
     "OperatorSpec",
+    "OperatorStatsSnapshot",
     "OperatorGraph",
     "OutputContext",
     "ParameterFlag",
@@ -309,6 +316,8 @@ class Tracker:
         *,
         filename=None,
         num_buffered_messages=100,
+        log_format=DataFlowLogFormat.TEXT,
+        use_mmap=False,
         num_start_messages_to_skip=10,
         num_last_messages_to_discard=10,
         latency_threshold=0,
@@ -324,6 +333,10 @@ class Tracker:
         num_buffered_messages : int, optional
             Controls the number of messages buffered between file writing when
             `filename` is not ``None``.
+        log_format : holoscan.core.DataFlowLogFormat, optional
+            The format of the log file (text or compact binary trace).
+        use_mmap : bool, optional
+            Whether to write a binary log file through a memory-mapped window of the file.
         num_start_messages_to_skip : int, optional
             The number of messages to skip at the beginning of the execution. This does not affect
             the log file or the number of source messages metric.
@@ -340,6 +353,8 @@ class Tracker:
             self.logging_kwargs = dict(
                 filename=filename,
                 num_buffered_messages=num_buffered_messages,
+                log_format=log_format,
+                use_mmap=use_mmap,
             )
         self.tracker_kwargs = dict(
             num_start_messages_to_skip=num_start_messages_to_skip,
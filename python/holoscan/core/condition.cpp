@@ -98,7 +98,8 @@ void init_condition(py::module_& m) {
       .value("MESSAGE_AVAILABLE", ConditionType::kMessageAvailable)
       .value("DOWNSTREAM_MESSAGE_AFFORDABLE", ConditionType::kDownstreamMessageAffordable)
       .value("COUNT", ConditionType::kCount)
-      .value("BOOLEAN", ConditionType::kBoolean);
+      .value("BOOLEAN", ConditionType::kBoolean)
+      .value("BATCH_MESSAGE_AVAILABLE", ConditionType::kBatchMessageAvailable);
 
   py::class_<Condition, Component, PyCondition, std::shared_ptr<Condition>>(
       m, "Condition", doc::Condition::doc_Condition)
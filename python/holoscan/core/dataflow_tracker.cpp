@@ -38,7 +38,15 @@ void init_data_flow_tracker(py::module_& m) {
       .value("AVG_E2E_LATENCY", DataFlowMetric::kAvgE2ELatency)
       .value("MIN_E2E_LATENCY", DataFlowMetric::kMinE2ELatency)
       .value("NUM_SRC_MESSAGES", DataFlowMetric::kNumSrcMessages)
-      .value("NUM_DST_MESSAGES", DataFlowMetric::kNumDstMessages);
+      .value("NUM_DST_MESSAGES", DataFlowMetric::kNumDstMessages)
+      .value("P50_E2E_LATENCY", DataFlowMetric::kP50E2ELatency)
+      .value("P99_E2E_LATENCY", DataFlowMetric::kP99E2ELatency)
+      .value("P999_E2E_LATENCY", DataFlowMetric::kP999E2ELatency);
+
+  py::enum_<DataFlowLogFormat>(
+      m, "DataFlowLogFormat", doc::DataFlowLogFormat::doc_DataFlowLogFormat)
+      .value("TEXT", DataFlowLogFormat::kText)
+      .value("BINARY", DataFlowLogFormat::kBinary);
 
   py::class_<DataFlowTracker>(m, "DataFlowTracker", doc::DataFlowTracker::doc_DataFlowTracker)
       .def(py::init<>(), doc::DataFlowTracker::doc_DataFlowTracker)
@@ -46,6 +54,8 @@ void init_data_flow_tracker(py::module_& m) {
            &DataFlowTracker::enable_logging,
            "filename"_a = kDefaultLogfileName,
            "num_buffered_messages"_a = kDefaultNumBufferedMessages,
+           "log_format"_a = DataFlowLogFormat::kText,
+           "use_mmap"_a = false,
            doc::DataFlowTracker::doc_enable_logging)
       .def("end_logging", &DataFlowTracker::end_logging, doc::DataFlowTracker::doc_end_logging)
       // TODO: sphinx API doc build complains if more than one overloaded get_metric method has a
@@ -61,6 +71,9 @@ void init_data_flow_tracker(py::module_& m) {
            "metric"_a = DataFlowMetric::kNumSrcMessages)
       .def(
           "get_num_paths", &DataFlowTracker::get_num_paths, doc::DataFlowTracker::doc_get_num_paths)
+      .def("get_num_dropped_paths",
+           &DataFlowTracker::get_num_dropped_paths,
+           doc::DataFlowTracker::doc_get_num_dropped_paths)
       .def("get_path_strings",
            &DataFlowTracker::get_path_strings,
            doc::DataFlowTracker::doc_get_path_strings)
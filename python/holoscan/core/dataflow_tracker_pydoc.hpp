@@ -33,6 +33,19 @@ Enum class for DataFlowMetric type.
 
 }  // namespace DataFlowMetric
 
+namespace DataFlowLogFormat {
+
+//  Constructor
+PYDOC(DataFlowLogFormat, R"doc(
+Enum class for the format of the data flow tracking log file.
+
+- TEXT: human-readable text.
+- BINARY: compact binary trace, which can be converted to the Chrome trace (Perfetto) JSON format
+  with the `convert_flow_tracking_trace.py` script.
+)doc")
+
+}  // namespace DataFlowLogFormat
+
 namespace DataFlowTracker {
 
 //  Constructor
@@ -70,12 +83,27 @@ There is also an overloaded version of this function that takes only the `metric
 PYDOC(get_num_paths, R"doc(
 The number of tracked paths
 
+Paths that are not tracked because the path table is full are not included (see
+`get_num_dropped_paths`).
+
 Returns
 -------
 num_paths : int
     The number of tracked paths
 )doc")
 
+PYDOC(get_num_dropped_paths, R"doc(
+The number of paths that are not tracked because the path table is full
+
+The capacity of the table can be increased with the `HOLOSCAN_FLOW_TRACKING_MAX_PATHS` environment
+variable.
+
+Returns
+-------
+num_dropped_paths : int
+    The number of untracked paths
+)doc")
+
 PYDOC(get_path_strings, R"doc(
 Return an array of strings which are path names. Each path name is a
 comma-separated list of Operator names in a path. The paths are agnostic to the edges between
@@ -95,15 +123,22 @@ A path consisting of an array of tuples in the form of (an Operator name, messag
 receive timestamp, message publish timestamp) is logged in a file. The logging does not take
 into account the number of message to skip or discard or the threshold latency.
 
-This function buffers a number of lines set by `num_buffered_messages` before flushing the buffer
-to the log file.
+Log entries are buffered in a ring buffer of (at least) `num_buffered_messages` entries and
+written to the log file by a background thread, so that logging does not block the operators.
 
 Parameters
 ----------
 filename : str
     The name of the log file.
 num_buffered_messages : int
-    The number of messages to be buffered before flushing the buffer to the log file.
+    The number of messages that can be buffered before being written to the log file.
+log_format : holoscan.core.DataFlowLogFormat
+    The format of the log file. `DataFlowLogFormat.BINARY` writes a compact binary trace made of
+    fixed-size records, which can be converted to the Chrome trace (Perfetto) JSON format with the
+    `convert_flow_tracking_trace.py` script.
+use_mmap : bool
+    Whether to write a binary log file through a memory-mapped window of the file instead of a
+    user-space buffer (ignored for the text format).
 )doc")
 
 PYDOC(end_logging, R"doc(
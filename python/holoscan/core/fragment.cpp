@@ -24,6 +24,7 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "application_pydoc.hpp"
 #include "fragment_pydoc.hpp"
@@ -34,6 +35,7 @@
 #include "holoscan/core/graph.hpp"
 #include "holoscan/core/network_context.hpp"
 #include "holoscan/core/operator.hpp"
+#include "holoscan/core/operator_stats.hpp"
 #include "holoscan/core/scheduler.hpp"
 #include "kwarg_handling.hpp"
 
@@ -52,6 +54,30 @@ void init_fragment(py::module_& m) {
       .def_property_readonly("config_file", &Config::config_file, doc::Config::doc_config_file)
       .def_property_readonly("prefix", &Config::prefix, doc::Config::doc_prefix);
 
+  py::class_<OperatorPortStats>(
+      m, "OperatorPortStats", doc::OperatorPortStats::doc_OperatorPortStats)
+      .def_readonly("name", &OperatorPortStats::name)
+      .def_readonly("num_messages", &OperatorPortStats::num_messages)
+      .def_readonly("avg_queue_size", &OperatorPortStats::avg_queue_size)
+      .def_readonly("max_queue_size", &OperatorPortStats::max_queue_size);
+
+  py::class_<OperatorStatsSnapshot>(
+      m, "OperatorStatsSnapshot", doc::OperatorStatsSnapshot::doc_OperatorStatsSnapshot)
+      .def_readonly("operator_name", &OperatorStatsSnapshot::operator_name)
+      .def_readonly("num_ticks", &OperatorStatsSnapshot::num_ticks)
+      .def_readonly("num_failed_ticks", &OperatorStatsSnapshot::num_failed_ticks)
+      .def_readonly("total_compute_time_ms", &OperatorStatsSnapshot::total_compute_time_ms)
+      .def_readonly("avg_compute_time_us", &OperatorStatsSnapshot::avg_compute_time_us)
+      .def_readonly("min_compute_time_us", &OperatorStatsSnapshot::min_compute_time_us)
+      .def_readonly("max_compute_time_us", &OperatorStatsSnapshot::max_compute_time_us)
+      .def_readonly("p50_compute_time_us", &OperatorStatsSnapshot::p50_compute_time_us)
+      .def_readonly("p99_compute_time_us", &OperatorStatsSnapshot::p99_compute_time_us)
+      .def_readonly("total_idle_time_ms", &OperatorStatsSnapshot::total_idle_time_ms)
+      .def_readonly("total_gil_wait_time_ms", &OperatorStatsSnapshot::total_gil_wait_time_ms)
+      .def_readonly("max_gil_wait_time_us", &OperatorStatsSnapshot::max_gil_wait_time_us)
+      .def_readonly("inputs", &OperatorStatsSnapshot::inputs)
+      .def_readonly("outputs", &OperatorStatsSnapshot::outputs);
+
   // note: added py::dynamic_attr() to allow dynamically adding attributes in a Python subclass
   //       added std::shared_ptr<Fragment> to allow the custom holder type to be used
   //         (see https://github.com/pybind/pybind11/issues/956)
@@ -139,6 +165,14 @@ void init_fragment(py::module_& m) {
            "latency_threshold"_a = kDefaultLatencyThreshold,
            doc::Application::doc_track,
            py::return_value_policy::reference_internal)
+      .def("enable_operator_stats",
+           &Fragment::enable_operator_stats,
+           "print_on_exit"_a = true,
+           doc::Fragment::doc_enable_operator_stats)
+      .def("is_operator_stats_enabled",
+           &Fragment::is_operator_stats_enabled,
+           doc::Fragment::doc_is_operator_stats_enabled)
+      .def("operator_stats", &Fragment::operator_stats, doc::Fragment::doc_operator_stats)
       .def("run",
            &Fragment::run,
            doc::Fragment::doc_run,
@@ -56,6 +56,31 @@ TODO
 
 }  // namespace Config
 
+namespace OperatorStatsSnapshot {
+
+PYDOC(OperatorStatsSnapshot, R"doc(
+Snapshot of the execution statistics of an operator.
+
+Times are measured with a monotonic clock around each call of `Operator.compute`. The idle time is
+the time between the end of a `compute` call and the start of the next one, i.e. the time the
+operator waited for its inputs (or any other scheduling condition) to be ready. For Python
+operators, `total_gil_wait_time_ms` and `max_gil_wait_time_us` report the time `compute` waited for
+the Python GIL before running (this time is included in the compute time).
+)doc")
+
+}  // namespace OperatorStatsSnapshot
+
+namespace OperatorPortStats {
+
+PYDOC(OperatorPortStats, R"doc(
+Statistics of an input or output port of an operator.
+
+For input ports, the queue sizes are the number of messages queued on the port at the start of
+each `compute` call. For output ports, `num_messages` is the number of emitted messages.
+)doc")
+
+}  // namespace OperatorPortStats
+
 namespace Fragment {
 
 //  Constructor
@@ -227,6 +252,37 @@ latency_threshold : int
     end-to-end latency metric calculations
 )doc")
 
+PYDOC(enable_operator_stats, R"doc(
+Turn on the collection of per-operator execution statistics.
+
+This must be called before the fragment (or application) is run. The number of `compute` calls,
+their duration, the time operators wait between two calls, the number of messages queued on their
+input ports and the number of messages emitted on their output ports are then recorded for every
+operator.
+
+Parameters
+----------
+print_on_exit : bool, optional
+    Whether to log the statistics when the fragment stops running.
+)doc")
+
+PYDOC(is_operator_stats_enabled, R"doc(
+Whether the collection of per-operator execution statistics is enabled.
+)doc")
+
+PYDOC(operator_stats, R"doc(
+Get a snapshot of the execution statistics of the operators.
+
+This can be called while the fragment is running or after it has run. For an application, the
+statistics of the operators of all the fragments run by this process are returned and the operator
+names are prefixed with the fragment names.
+
+Returns
+-------
+list of holoscan.core.OperatorStatsSnapshot
+    The statistics of the operators (empty if the statistics are not enabled).
+)doc")
+
 PYDOC(run, R"doc(
 The run method of the Fragment.
 
@@ -43,15 +43,29 @@ class GILGuardedPyObject {
 
   py::object& obj() { return obj_; }
 
+  /**
+   * @brief Keep a Python object alive as long as this wrapper. Must be called with the GIL held.
+   *
+   * Used to keep the buffers exported for serialization (e.g. out-of-band pickle buffers) alive
+   * until the message is destroyed, as the transport sends them after serialization.
+   */
+  void keep_alive(const py::object& obj) {
+    if (!keep_alive_) { keep_alive_ = py::list(); }
+    py::reinterpret_borrow<py::list>(keep_alive_).append(obj);
+  }
+
   ~GILGuardedPyObject() {
     // Acquire GIL before destroying the PyObject
     py::gil_scoped_acquire scope_guard;
     py::handle handle = obj_.release();
     if (handle) { handle.dec_ref(); }
+    handle = keep_alive_.release();
+    if (handle) { handle.dec_ref(); }
   }
 
  private:
   py::object obj_;
+  py::object keep_alive_;  ///< list of the objects kept alive (null if none)
 };
 
 }  // namespace holoscan
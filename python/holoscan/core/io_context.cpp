@@ -45,36 +45,141 @@ namespace py = pybind11;
 
 namespace holoscan {
 
+namespace {
+
+/// Minimum size of a buffer of a pickled Python object for it to be sent out-of-band, as a
+/// separate segment of the serialization buffer, instead of being copied into the pickle stream
+constexpr size_t kPickleOutOfBandMinBytes = kZeroCopyMinBytes;
+
+#pragma pack(push, 1)
+struct PickledPyObjectHeader {
+  uint64_t pickle_size;
+  uint32_t num_buffers;  ///< followed by the size (uint64_t) of each out-of-band buffer
+};
+#pragma pack(pop)
+
+/// Get the cloudpickle module, imported on first use. Must be called with the GIL held.
+py::module_ cloudpickle_module() {
+  // The reference is never released, the module is cached until the interpreter exits. The GIL
+  // protects the pointer (a function-local static object could deadlock if the import releases
+  // the GIL).
+  static PyObject* module = nullptr;
+  if (module == nullptr) {
+    try {
+      module = py::module_::import("cloudpickle").release().ptr();
+    } catch (const py::error_already_set& e) {
+      if (e.matches(PyExc_ImportError)) {
+        throw pybind11::import_error(
+            fmt::format(e.what() +
+                        "\nThe cloudpickle module is required for Python distributed"s
+                        " apps.\nPlease install it with `python -m pip install cloudpickle`"s));
+      }
+      throw;
+    }
+  }
+  return py::reinterpret_borrow<py::module_>(module);
+}
+
+/// Unpickle a Python object received from a UCX connector. Must be called with the GIL held.
+py::object unpickle(const PickledPyObject& pickled) {
+  py::list buffers;
+  for (const auto& buffer : pickled.buffers) { buffers.append(py::cast(buffer)); }
+  auto pickle = py::memoryview::from_memory(pickled.pickle.data(),
+                                            static_cast<py::ssize_t>(pickled.pickle.size()));
+  return cloudpickle_module().attr("loads")(pickle, "buffers"_a = buffers);
+}
+
+}  // namespace
+
+// Python objects are pickled with protocol 5. The large contiguous buffers of the object (e.g.
+// NumPy arrays) are not copied into the pickle stream but sent as separate segments via
+// Endpoint::write_ptr, and are received in place into PyObjectBuffer objects (see
+// zero_copy_codec in holoscan/core/codecs.hpp).
 template <>
 struct codec<std::shared_ptr<GILGuardedPyObject>> {
   static expected<size_t, RuntimeError> serialize(std::shared_ptr<GILGuardedPyObject> value,
                                                   Endpoint* endpoint) {
     HOLOSCAN_LOG_TRACE("py_emit: cloudpickle serialization of Python object over a UCX connector");
-    std::string serialized_string;
-    {
-      py::gil_scoped_acquire acquire;
-      py::module_ cloudpickle;
-      try {
-        cloudpickle = py::module_::import("cloudpickle");
-      } catch (const py::error_already_set& e) {
-        std::string err_msg = e.what() +
-                              "\nThe cloudpickle module is required for Python distributed apps."s
-                              "\nPlease install it with `python -m pip install cloudpickle`"s;
-        HOLOSCAN_LOG_ERROR(err_msg);
-        return make_unexpected<RuntimeError>(RuntimeError(ErrorCode::kCodecError, err_msg));
-      }
-      py::bytes serialized = cloudpickle.attr("dumps")(value->obj());
-      serialized_string = serialized.cast<std::string>();
+    py::gil_scoped_acquire acquire;
+    std::vector<std::pair<const void*, size_t>> segments;
+    py::bytes serialized;
+    try {
+      // A buffer is sent out-of-band if the callback returns a false value, in-band otherwise
+      py::cpp_function buffer_callback([&value, &segments](py::object pickle_buffer) -> bool {
+        Py_buffer view;
+        if (PyObject_GetBuffer(pickle_buffer.ptr(), &view, PyBUF_ANY_CONTIGUOUS) != 0) {
+          PyErr_Clear();  // non-contiguous buffer
+          return true;
+        }
+        const size_t size = static_cast<size_t>(view.len);
+        const void* data = view.buf;
+        PyBuffer_Release(&view);
+        if (size < kPickleOutOfBandMinBytes) { return true; }
+        // The pickle buffer keeps the memory exported until the message is destroyed
+        value->keep_alive(pickle_buffer);
+        segments.emplace_back(data, size);
+        return false;
+      });
+      serialized = cloudpickle_module().attr("dumps")(
+          value->obj(), "protocol"_a = 5, "buffer_callback"_a = buffer_callback);
+    } catch (const std::exception& e) {
+      std::string err_msg = fmt::format("Unable to pickle the Python object: {}", e.what());
+      HOLOSCAN_LOG_ERROR(err_msg);
+      return make_unexpected<RuntimeError>(RuntimeError(ErrorCode::kCodecError, err_msg));
     }
-    return codec<std::string>::serialize(serialized_string, endpoint);
+
+    char* pickle_data = nullptr;
+    py::ssize_t pickle_size = 0;
+    PyBytes_AsStringAndSize(serialized.ptr(), &pickle_data, &pickle_size);
+
+    PickledPyObjectHeader header;
+    header.pickle_size = static_cast<uint64_t>(pickle_size);
+    header.num_buffers = static_cast<uint32_t>(segments.size());
+    auto size = endpoint->write_trivial_type<PickledPyObjectHeader>(&header);
+    if (!size) { return forward_error(size); }
+    size_t total_bytes = size.value();
+    for (const auto& [data, buffer_size] : segments) {
+      uint64_t segment_size = buffer_size;
+      auto size2 = endpoint->write_trivial_type<uint64_t>(&segment_size);
+      if (!size2) { return forward_error(size2); }
+      total_bytes += size2.value();
+    }
+    auto size3 = endpoint->write(pickle_data, header.pickle_size);
+    if (!size3) { return forward_error(size3); }
+    total_bytes += size3.value();
+    for (const auto& [data, buffer_size] : segments) {
+      auto result = endpoint->write_ptr(data, buffer_size, Endpoint::MemoryStorageType::kSystem);
+      if (!result) { return forward_error(result); }
+      total_bytes += buffer_size;
+    }
+    return total_bytes;
   }
 
-  static expected<std::string, RuntimeError> deserialize(Endpoint* endpoint) {
+  static expected<PickledPyObject, RuntimeError> deserialize(Endpoint* endpoint) {
     HOLOSCAN_LOG_TRACE(
-        "\tdeserialize std::string corresponding to std::shared_ptr<GILGuardedPyObject>");
-    auto maybe_str = codec<std::string>::deserialize(endpoint);
-    if (!maybe_str) { return forward_error(maybe_str); }
-    return maybe_str.value();
+        "\tdeserialize PickledPyObject corresponding to std::shared_ptr<GILGuardedPyObject>");
+    PickledPyObjectHeader header;
+    auto size = endpoint->read_trivial_type<PickledPyObjectHeader>(&header);
+    if (!size) { return forward_error(size); }
+    std::vector<uint64_t> buffer_sizes(header.num_buffers);
+    for (auto& buffer_size : buffer_sizes) {
+      auto size2 = endpoint->read_trivial_type<uint64_t>(&buffer_size);
+      if (!size2) { return forward_error(size2); }
+    }
+    PickledPyObject pickled;
+    pickled.pickle.resize(header.pickle_size);
+    auto size3 = endpoint->read(pickled.pickle.data(), header.pickle_size);
+    if (!size3) { return forward_error(size3); }
+    // register the memory of the buffers as the destination of the received segments
+    for (auto buffer_size : buffer_sizes) {
+      auto buffer = std::make_shared<PyObjectBuffer>();
+      buffer->data.resize(buffer_size);
+      auto result = endpoint->write_ptr(
+          buffer->data.data(), buffer_size, Endpoint::MemoryStorageType::kSystem);
+      if (!result) { return forward_error(result); }
+      pickled.buffers.push_back(std::move(buffer));
+    }
+    return pickled;
   }
 };
 
@@ -266,26 +371,28 @@ py::object PyInputContext::py_receive(const std::string& name) {
       }
       py::tuple result_tuple = vector2pytuple(result);
       return result_tuple;
+    } else if (element_type == typeid(PickledPyObject)) {
+      std::vector<std::shared_ptr<GILGuardedPyObject>> result;
+      try {
+        for (auto& any_item : any_result) {
+          const auto& pickled = std::any_cast<const PickledPyObject&>(any_item);
+          result.push_back(std::make_shared<GILGuardedPyObject>(unpickle(pickled)));
+        }
+      } catch (const std::bad_any_cast& e) {
+        HOLOSCAN_LOG_ERROR(
+            "Unable to receive input (std::vector<PickledPyObject>) with name "
+            "'{}' ({})",
+            name,
+            e.what());
+      }
+      py::tuple result_tuple = vector2pytuple(result);
+      return result_tuple;
     } else if (element_type == typeid(std::string)) {
       std::vector<std::shared_ptr<GILGuardedPyObject>> result;
       try {
         for (auto& any_item : any_result) {
           std::string obj_str = std::any_cast<std::string>(any_item);
-
-          py::module_ cloudpickle;
-          try {
-            cloudpickle = py::module_::import("cloudpickle");
-          } catch (const py::error_already_set& e) {
-            if (e.matches(PyExc_ImportError)) {
-              throw pybind11::import_error(fmt::format(
-                  e.what() +
-                  "\nThe cloudpickle module is required for Python distributed"s
-                  " apps.\nPlease install it with `python -m pip install cloudpickle`"s));
-            } else {
-              throw;
-            }
-          }
-          py::object deserialized = cloudpickle.attr("loads")(py::bytes(obj_str));
+          py::object deserialized = cloudpickle_module().attr("loads")(py::bytes(obj_str));
 
           result.push_back(std::make_shared<GILGuardedPyObject>(deserialized));
         }
@@ -339,23 +446,13 @@ py::object PyInputContext::py_receive(const std::string& name) {
       HOLOSCAN_LOG_DEBUG("py_receive: Python object case");
       auto in_message = std::any_cast<std::shared_ptr<GILGuardedPyObject>>(result);
       return in_message->obj();
+    } else if (result_type == typeid(PickledPyObject)) {
+      HOLOSCAN_LOG_DEBUG("py_receive: pickled Python object case");
+      return unpickle(std::any_cast<const PickledPyObject&>(result));
     } else if (result_type == typeid(std::string)) {
       HOLOSCAN_LOG_DEBUG("py_receive: cloudpickle string case");
       std::string obj_str = std::any_cast<std::string>(result);
-      py::module_ cloudpickle;
-      try {
-        cloudpickle = py::module_::import("cloudpickle");
-      } catch (const py::error_already_set& e) {
-        if (e.matches(PyExc_ImportError)) {
-          throw pybind11::import_error(
-              fmt::format(e.what() +
-                          "\nThe cloudpickle module is required for Python distributed"s
-                          " apps.\nPlease install it with `python -m pip install cloudpickle`"s));
-        } else {
-          throw;
-        }
-      }
-      py::object deserialized = cloudpickle.attr("loads")(py::bytes(obj_str));
+      py::object deserialized = cloudpickle_module().attr("loads")(py::bytes(obj_str));
 
       return deserialized;
     } else if (result_type == typeid(std::vector<holoscan::ops::HolovizOp::InputSpec>)) {
@@ -579,6 +676,16 @@ void init_io_context(py::module_& m) {
       m, "PyOutputContext", R"doc(Output context class.)doc")
       .def("emit", &PyOutputContext::py_emit);
 
+  // out-of-band buffers of the Python objects received from UCX connectors
+  py::class_<PyObjectBuffer, std::shared_ptr<PyObjectBuffer>>(
+      m, "_PyObjectBuffer", py::buffer_protocol())
+      .def_buffer([](PyObjectBuffer& buffer) {
+        return py::buffer_info(buffer.data.data(),
+                               sizeof(uint8_t),
+                               py::format_descriptor<uint8_t>::format(),
+                               static_cast<py::ssize_t>(buffer.data.size()));
+      });
+
   // register a cloudpickle-based serializer for Python objects
   register_py_object_codec();
 }
@@ -20,11 +20,14 @@
 
 #include <pybind11/pybind11.h>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "gil_guarded_pyobject.hpp"
+#include "holoscan/core/codecs.hpp"
 #include "holoscan/core/execution_context.hpp"
 #include "holoscan/core/gxf/gxf_io_context.hpp"
 #include "holoscan/core/io_context.hpp"
@@ -36,6 +39,26 @@ namespace holoscan {
 
 void init_io_context(py::module_&);
 
+/**
+ * @brief Out-of-band buffer of a pickled Python object received from a UCX connector.
+ *
+ * It is exposed to Python with the buffer protocol, so that the unpickled object (e.g. a NumPy
+ * array) references the received data without copying it.
+ */
+struct PyObjectBuffer {
+  std::vector<uint8_t, default_init_allocator<uint8_t>> data;
+};
+
+/**
+ * @brief Python object received from a UCX connector, serialized with pickle protocol 5.
+ *
+ * It is unpickled by PyInputContext::py_receive(), as the GIL is not held on deserialization.
+ */
+struct PickledPyObject {
+  std::string pickle;                                    ///< pickle stream
+  std::vector<std::shared_ptr<PyObjectBuffer>> buffers;  ///< out-of-band buffers
+};
+
 class PyInputContext : public gxf::GXFInputContext {
  public:
   /* Inherit the constructors */
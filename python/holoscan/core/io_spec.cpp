@@ -47,7 +47,9 @@ void init_io_spec(py::module_& m) {
   py::enum_<IOSpec::ConnectorType>(iospec, "ConnectorType", doc::ConnectorType::doc_ConnectorType)
       .value("DEFAULT", IOSpec::ConnectorType::kDefault)
       .value("DOUBLE_BUFFER", IOSpec::ConnectorType::kDoubleBuffer)
-      .value("UCX", IOSpec::ConnectorType::kUCX);
+      .value("UCX", IOSpec::ConnectorType::kUCX)
+      .value("SHARED_MEMORY", IOSpec::ConnectorType::kSharedMemory)
+      .value("SPSC_RING", IOSpec::ConnectorType::kSpscRing);
 
   iospec
       .def(py::init<OperatorSpec*, const std::string&, IOSpec::IOType>(),
@@ -39,6 +39,8 @@ static const std::unordered_map<IOSpec::ConnectorType, const char*> connector_ty
     {IOSpec::ConnectorType::kDefault, "DEFAULT"},
     {IOSpec::ConnectorType::kDoubleBuffer, "DOUBLE_BUFFER"},
     {IOSpec::ConnectorType::kUCX, "UCX"},
+    {IOSpec::ConnectorType::kSharedMemory, "SHARED_MEMORY"},
+    {IOSpec::ConnectorType::kSpscRing, "SPSC_RING"},
 };
 
 }  // namespace holoscan
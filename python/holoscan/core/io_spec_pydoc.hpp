@@ -121,6 +121,7 @@ The following ConditionTypes are supported:
 - `IOSpec.ConnectorType.DEFAULT`
 - `IOSpec.ConnectorType.DOUBLE_BUFFER`
 - `IOSpec.ConnectorType.UCX`
+- `IOSpec.ConnectorType.SPSC_RING` (lock-free ring receiver for an input port within a fragment)
 
 If this method is not been called, the IOSpec's `connector_type` will be
 `ConnectorType.DEFAULT` which will result in a DoubleBuffered receiver or
@@ -34,6 +34,7 @@
 #include "holoscan/core/gxf/entity.hpp"
 #include "holoscan/core/operator.hpp"
 #include "holoscan/core/operator_spec.hpp"
+#include "holoscan/core/operator_stats.hpp"
 #include "holoscan/core/resource.hpp"
 #include "kwarg_handling.hpp"
 #include "operator_pydoc.hpp"
@@ -567,8 +568,12 @@ void PyOperator::compute(InputContext& op_input, OutputContext& op_output,
                          ExecutionContext& context) {
   auto gxf_context = context.context();
 
-  // Get the compute method of the Python Operator class and call it
+  // Get the compute method of the Python Operator class and call it. The time spent waiting for
+  // the GIL is reported in the operator statistics (if enabled).
+  auto* stats = execution_stats();
+  const int64_t gil_wait_start_ns = stats != nullptr ? OperatorStats::now_ns() : 0;
   py::gil_scoped_acquire scope_guard;
+  if (stats != nullptr) { stats->record_gil_wait(OperatorStats::now_ns() - gil_wait_start_ns); }
   auto py_op_input =
       std::make_shared<PyInputContext>(&context, op_input.op(), op_input.inputs(), this->py_op_);
   auto py_op_output = std::make_shared<PyOutputContext>(
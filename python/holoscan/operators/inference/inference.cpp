@@ -86,6 +86,10 @@ class PyInferenceOp : public InferenceOp {
                 bool output_on_cuda = true, bool transmit_on_cuda = true, bool enable_fp16 = false,
                 bool is_engine_path = false,
                 std::shared_ptr<holoscan::CudaStreamPool> cuda_stream_pool = nullptr,
+                int intra_op_num_threads = 1, int inter_op_num_threads = 1,
+                const std::string& execution_mode = "sequential",
+                const std::vector<int>& intra_op_thread_affinity = {}, int max_batch_size = 1,
+                double max_batch_delay_ms = 0.0,
                 // TODO(grelee): handle receivers similarly to HolovizOp?  (default: {})
                 // TODO(grelee): handle transmitter similarly to HolovizOp?
                 const std::string& name = "inference")
@@ -99,7 +103,13 @@ class PyInferenceOp : public InferenceOp {
                             Arg{"output_on_cuda", output_on_cuda},
                             Arg{"transmit_on_cuda", transmit_on_cuda},
                             Arg{"enable_fp16", enable_fp16},
-                            Arg{"is_engine_path", is_engine_path}}) {
+                            Arg{"is_engine_path", is_engine_path},
+                            Arg{"intra_op_num_threads", intra_op_num_threads},
+                            Arg{"inter_op_num_threads", inter_op_num_threads},
+                            Arg{"execution_mode", execution_mode},
+                            Arg{"intra_op_thread_affinity", intra_op_thread_affinity},
+                            Arg{"max_batch_size", max_batch_size},
+                            Arg{"max_batch_delay_ms", max_batch_delay_ms}}) {
     if (cuda_stream_pool) { this->add_arg(Arg{"cuda_stream_pool", cuda_stream_pool}); }
     name_ = name;
     fragment_ = fragment;
@@ -189,6 +199,12 @@ PYBIND11_MODULE(_inference, m) {
                     bool,
                     bool,
                     std::shared_ptr<holoscan::CudaStreamPool>,
+                    int,
+                    int,
+                    const std::string&,
+                    const std::vector<int>&,
+                    int,
+                    double,
                     const std::string&>(),
            "fragment"_a,
            "backend"_a,
@@ -208,6 +224,12 @@ PYBIND11_MODULE(_inference, m) {
            "enable_fp16"_a = false,
            "is_engine_path"_a = false,
            "cuda_stream_pool"_a = py::none(),
+           "intra_op_num_threads"_a = 1,
+           "inter_op_num_threads"_a = 1,
+           "execution_mode"_a = "sequential"s,
+           "intra_op_thread_affinity"_a = std::vector<int>{},
+           "max_batch_size"_a = 1,
+           "max_batch_delay_ms"_a = 0.0,
            "name"_a = "inference"s,
            doc::InferenceOp::doc_InferenceOp)
       .def("initialize", &InferenceOp::initialize, doc::InferenceOp::doc_initialize)
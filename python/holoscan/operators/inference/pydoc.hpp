@@ -87,6 +87,28 @@ is_engine_path : bool, optional
 cuda_stream_pool : holoscan.resources.CudaStreamPool, optional
     ``holoscan.resources.CudaStreamPool`` instance to allocate CUDA streams. Default value is
     ``None``.
+intra_op_num_threads : int, optional
+    Number of threads executing each operator of a model on CPU (onnxruntime only, ``0`` for one
+    thread per physical core). Default value is ``1``.
+inter_op_num_threads : int, optional
+    Number of threads executing independent operators of a model concurrently on CPU
+    (onnxruntime only, used when `execution_mode` is ``"parallel"``). Default value is ``1``.
+execution_mode : str, optional
+    Execution mode of the operators of a model (onnxruntime only): ``"sequential"`` or
+    ``"parallel"``. Default value is ``"sequential"``.
+intra_op_thread_affinity : sequence of int, optional
+    CPU cores to pin the intra-op threads to, one per thread besides the calling thread
+    (onnxruntime only). Threads are not pinned by default.
+max_batch_size : int, optional
+    Maximum number of frames inferred at once (dynamic batching). Each message received on the
+    `receivers` ports is a frame, stacked with the others along the batch dimension of the models,
+    which must be dynamic. The results of a batch are emitted in one message, named
+    ``"<tensor name>_<receiver port index>"``. Only supported by the ``"onnxrt"`` backend with host
+    input and output buffers. Default value is ``1`` (no batching).
+max_batch_delay_ms : float, optional
+    Maximum time a frame waits for other frames to fill a batch. The operator is executed when
+    the pending batch is due, even if no other frame arrives. Default value is ``0.0`` (the frames
+    received in one execution are batched together).
 name : str, optional (constructor only)
     The name of the operator. Default value is ``"inference"``.
 )doc")
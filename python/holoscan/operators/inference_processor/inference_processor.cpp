@@ -82,7 +82,7 @@ class PyInferenceProcessorOp : public InferenceProcessorOp {
                          bool transmit_on_cuda = false, bool disable_transmitter = false,
                          std::shared_ptr<holoscan::CudaStreamPool> cuda_stream_pool = nullptr,
                          const std::string& config_path = std::string(""),
-                         const std::string& name = "postprocessor")
+                         int num_threads = 1, const std::string& name = "postprocessor")
       : InferenceProcessorOp(ArgList{Arg{"allocator", allocator},
                                      Arg{"in_tensor_names", in_tensor_names},
                                      Arg{"out_tensor_names", out_tensor_names},
@@ -90,6 +90,7 @@ class PyInferenceProcessorOp : public InferenceProcessorOp {
                                      Arg{"output_on_cuda", output_on_cuda},
                                      Arg{"transmit_on_cuda", transmit_on_cuda},
                                      Arg{"config_path", config_path},
+                                     Arg{"num_threads", num_threads},
                                      Arg{"disable_transmitter", disable_transmitter}}) {
     if (cuda_stream_pool) { this->add_arg(Arg{"cuda_stream_pool", cuda_stream_pool}); }
     name_ = name;
@@ -171,6 +172,7 @@ PYBIND11_MODULE(_inference_processor, m) {
                     bool,
                     std::shared_ptr<holoscan::CudaStreamPool>,
                     const std::string&,
+                    int,
                     const std::string&>(),
            "fragment"_a,
            "allocator"_a,
@@ -184,6 +186,7 @@ PYBIND11_MODULE(_inference_processor, m) {
            "disable_transmitter"_a = false,
            "cuda_stream_pool"_a = py::none(),
            "config_path"_a = ""s,
+           "num_threads"_a = 1,
            "name"_a = "postprocessor"s,
            doc::InferenceProcessorOp::doc_InferenceProcessorOp)
       .def("initialize",
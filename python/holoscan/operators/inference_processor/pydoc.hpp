@@ -68,6 +68,9 @@ cuda_stream_pool : holoscan.resources.CudaStreamPool, optional
     Default value is ``None``.
 config_path : str, optional
     File path to the config file. Default value is ``""``.
+num_threads : int, optional
+    Number of threads used by the CPU based processing operations (large inputs are split over
+    rows). Default value is ``1``.
 disable_transmitter : bool, optional
     If ``True``, disable the transmitter output port of the operator.
     Default value is ``False``.
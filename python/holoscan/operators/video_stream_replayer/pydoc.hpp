@@ -59,6 +59,11 @@ count : int, optional
     Number of frame counts to playback. If zero value is specified, it is
     ignored. If the count is less than the number of frames in the video, it
     would finish early. Default value is ``0``.
+read_ahead : int, optional
+    Number of entities read ahead of time by a background thread from the
+    memory-mapped entity file (they are still deserialized in ``compute``). If
+    zero value is specified, entities are read synchronously. Default value is
+    ``0``.
 name : str, optional (constructor only)
     The name of the operator. Default value is ``"video_stream_replayer"``.
 )doc")
@@ -79,6 +84,41 @@ spec : holoscan.core.OperatorSpec
     The operator specification.
 )doc")
 
+PYDOC(num_frames, R"doc(
+The number of frames (entities) in the recording.
+)doc")
+
+PYDOC(seek, R"doc(
+Change the playback position.
+
+The new position is applied at the next compute call, and the realtime playback timing
+restarts from it.
+
+Parameters
+----------
+frame_index : int
+    The index of the next frame to play back.
+
+Returns
+-------
+bool
+    ``False`` if the frame index is out of range.
+)doc")
+
+PYDOC(seek_to_timestamp, R"doc(
+Change the playback position to the first frame logged at or after a timestamp.
+
+Parameters
+----------
+timestamp : int
+    The timestamp (log time of the index file) to seek to.
+
+Returns
+-------
+bool
+    ``False`` if no frame was logged at or after the timestamp.
+)doc")
+
 }  // namespace holoscan::doc::VideoStreamReplayerOp
 
 #endif /* HOLOSCAN_OPERATORS_VIDEO_STREAM_REPLAYER_PYDOC_HPP */
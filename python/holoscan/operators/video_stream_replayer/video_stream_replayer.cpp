@@ -57,6 +57,7 @@ class PyVideoStreamReplayerOp : public VideoStreamReplayerOp {
                           const std::string& basename, size_t batch_size = 1UL,
                           bool ignore_corrupted_entities = true, float frame_rate = 0.f,
                           bool realtime = true, bool repeat = false, uint64_t count = 0UL,
+                          size_t read_ahead = 0UL,
                           const std::string& name = "video_stream_replayer")
       : VideoStreamReplayerOp(ArgList{Arg{"directory", directory},
                                       Arg{"basename", basename},
@@ -65,7 +66,8 @@ class PyVideoStreamReplayerOp : public VideoStreamReplayerOp {
                                       Arg{"frame_rate", frame_rate},
                                       Arg{"realtime", realtime},
                                       Arg{"repeat", repeat},
-                                      Arg{"count", count}}) {
+                                      Arg{"count", count},
+                                      Arg{"read_ahead", read_ahead}}) {
     name_ = name;
     fragment_ = fragment;
     spec_ = std::make_shared<OperatorSpec>(fragment);
@@ -106,6 +108,7 @@ PYBIND11_MODULE(_video_stream_replayer, m) {
                     bool,
                     bool,
                     uint64_t,
+                    size_t,
                     const std::string&>(),
            "fragment"_a,
            "directory"_a,
@@ -116,11 +119,23 @@ PYBIND11_MODULE(_video_stream_replayer, m) {
            "realtime"_a = true,
            "repeat"_a = false,
            "count"_a = 0UL,
+           "read_ahead"_a = 0UL,
            "name"_a = "format_converter"s,
            doc::VideoStreamReplayerOp::doc_VideoStreamReplayerOp)
       .def("initialize",
            &VideoStreamReplayerOp::initialize,
            doc::VideoStreamReplayerOp::doc_initialize)
-      .def("setup", &VideoStreamReplayerOp::setup, "spec"_a, doc::VideoStreamReplayerOp::doc_setup);
+      .def("setup", &VideoStreamReplayerOp::setup, "spec"_a, doc::VideoStreamReplayerOp::doc_setup)
+      .def_property_readonly("num_frames",
+                             &VideoStreamReplayerOp::num_frames,
+                             doc::VideoStreamReplayerOp::doc_num_frames)
+      .def("seek",
+           &VideoStreamReplayerOp::seek,
+           "frame_index"_a,
+           doc::VideoStreamReplayerOp::doc_seek)
+      .def("seek_to_timestamp",
+           &VideoStreamReplayerOp::seek_to_timestamp,
+           "timestamp"_a,
+           doc::VideoStreamReplayerOp::doc_seek_to_timestamp);
 }  // PYBIND11_MODULE NOLINT
 }  // namespace holoscan::ops
@@ -19,14 +19,24 @@
     holoscan.schedulers.EventBasedScheduler
     holoscan.schedulers.GreedyScheduler
     holoscan.schedulers.MultiThreadScheduler
+    holoscan.schedulers.WorkStealingScheduler
+    holoscan.schedulers.WorkStealingSchedulerStats
 """
 
 # must first import Clock for the std::shared_ptr<Clock> arguments in the __init__ methods
 from ..resources import Clock  # noqa
-from ._schedulers import EventBasedScheduler, GreedyScheduler, MultiThreadScheduler
+from ._schedulers import (
+    EventBasedScheduler,
+    GreedyScheduler,
+    MultiThreadScheduler,
+    WorkStealingScheduler,
+    WorkStealingSchedulerStats,
+)
 
 __all__ = [
     "EventBasedScheduler",
     "GreedyScheduler",
     "MultiThreadScheduler",
+    "WorkStealingScheduler",
+    "WorkStealingSchedulerStats",
 ]
@@ -40,6 +40,7 @@ namespace holoscan {
 void init_event_based_scheduler(py::module_&);
 void init_greedy_scheduler(py::module_&);
 void init_multithread_scheduler(py::module_&);
+void init_work_stealing_scheduler(py::module_&);
 
 PYBIND11_MODULE(_schedulers, m) {
   m.doc() = R"pbdoc(
@@ -61,5 +62,6 @@ PYBIND11_MODULE(_schedulers, m) {
   init_event_based_scheduler(m);
   init_greedy_scheduler(m);
   init_multithread_scheduler(m);
+  init_work_stealing_scheduler(m);
 }  // PYBIND11_MODULE
 }  // namespace holoscan
@@ -0,0 +1,200 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "./work_stealing_scheduler_pydoc.hpp"
+#include "holoscan/core/component_spec.hpp"
+#include "holoscan/core/fragment.hpp"
+#include "holoscan/core/gxf/gxf_component.hpp"
+#include "holoscan/core/gxf/gxf_scheduler.hpp"
+#include "holoscan/core/graph.hpp"
+#include "holoscan/core/operator.hpp"
+#include "holoscan/core/resources/gxf/clock.hpp"
+#include "holoscan/core/resources/gxf/realtime_clock.hpp"
+#include "holoscan/core/schedulers/gxf/work_stealing_scheduler.hpp"
+
+using std::string_literals::operator""s;
+using pybind11::literals::operator""_a;
+
+namespace py = pybind11;
+
+namespace holoscan {
+
+/* Trampoline classes for handling Python kwargs
+ *
+ * These add a constructor that takes a Fragment for which to initialize the scheduler.
+ * The explicit parameter list and default arguments take care of providing a Pythonic
+ * kwarg-based interface with appropriate default values matching the scheduler's
+ * default parameters in the C++ API `setup` method.
+ *
+ * The sequence of events in this constructor is based on Fragment::make_scheduler<SchedulerT>
+ */
+
+class PyWorkStealingScheduler : public WorkStealingScheduler {
+ public:
+  /* Inherit the constructors */
+  using WorkStealingScheduler::WorkStealingScheduler;
+
+  // Define a constructor that fully initializes the object.
+  explicit PyWorkStealingScheduler(Fragment* fragment, std::shared_ptr<Clock> clock = nullptr,
+                                   int64_t worker_thread_number = 1LL,
+                                   bool stop_on_deadlock = true,
+                                   double check_recession_period_ms = 5.0,
+                                   int64_t max_duration_ms = -1LL,
+                                   int64_t stop_on_deadlock_timeout = 0LL,
+                                   const std::vector<int64_t>& worker_cpu_cores = {},
+                                   const std::vector<int64_t>& worker_numa_nodes = {},
+                                   const std::vector<std::string>& operator_affinity = {},
+                                   const std::string& shared_pool = "",
+                                   int64_t pool_priority = 0LL,
+                                   int64_t pool_max_workers = 0LL,
+                                   const std::vector<int64_t>& python_workers = {},
+                                   const std::string& name = "work_stealing_scheduler")
+      : WorkStealingScheduler(ArgList{Arg{"worker_thread_number", worker_thread_number},
+                                      Arg{"stop_on_deadlock", stop_on_deadlock},
+                                      Arg{"check_recession_period_ms", check_recession_period_ms},
+                                      Arg{"stop_on_deadlock_timeout", stop_on_deadlock_timeout},
+                                      Arg{"worker_cpu_cores", worker_cpu_cores},
+                                      Arg{"worker_numa_nodes", worker_numa_nodes},
+                                      Arg{"operator_affinity", operator_affinity},
+                                      Arg{"shared_pool", shared_pool},
+                                      Arg{"pool_priority", pool_priority},
+                                      Arg{"pool_max_workers", pool_max_workers},
+                                      Arg{"python_workers", python_workers}}) {
+    // max_duration_ms is an optional argument in GXF. We use a negative value in this constructor
+    // to indicate that the argument should not be set.
+    if (max_duration_ms >= 0) { this->add_arg(Arg{"max_duration_ms", max_duration_ms}); }
+    name_ = name;
+    fragment_ = fragment;
+    if (clock) {
+      this->add_arg(Arg{"clock", clock});
+    } else {
+      this->add_arg(Arg{"clock", fragment_->make_resource<RealtimeClock>("realtime_clock")});
+    }
+    spec_ = std::make_shared<ComponentSpec>(fragment);
+    setup(*spec_.get());
+  }
+
+  void initialize() override {
+    // Route the operators implemented in Python to the Python workers (unless the operators were
+    // listed explicitly). The graph is composed when the scheduler is initialized.
+    auto has_python_operators = std::find_if(args().begin(), args().end(), [](const auto& arg) {
+      return (arg.name() == "python_operators");
+    });
+    if (has_python_operators == args().end() && fragment_ != nullptr) {
+      this->add_arg(Arg{"python_operators", python_operator_names()});
+    }
+    WorkStealingScheduler::initialize();
+  }
+
+ private:
+  /// Names of the operators of the fragment whose class is defined in Python (PyOperator)
+  std::vector<std::string> python_operator_names() {
+    std::vector<std::string> names;
+    py::gil_scoped_acquire scope_guard;
+    // Operators wrapping a C++ operator derive from holoscan.core._Operator instead
+    auto python_operator_type = py::module_::import("holoscan.core").attr("Operator");
+    for (const auto& op : fragment_->graph().get_nodes()) {
+      if (py::isinstance(py::cast(op), python_operator_type)) { names.push_back(op->name()); }
+    }
+    return names;
+  }
+};
+
+void init_work_stealing_scheduler(py::module_& m) {
+  py::class_<gxf::WorkStealingSchedulerStats>(
+      m, "WorkStealingSchedulerStats", doc::WorkStealingScheduler::doc_WorkStealingSchedulerStats)
+      .def_readonly("executions", &gxf::WorkStealingSchedulerStats::executions)
+      .def_readonly("local_pops", &gxf::WorkStealingSchedulerStats::local_pops)
+      .def_readonly("steals", &gxf::WorkStealingSchedulerStats::steals)
+      .def_readonly("affinity_hits", &gxf::WorkStealingSchedulerStats::affinity_hits)
+      .def_readonly("migrations", &gxf::WorkStealingSchedulerStats::migrations)
+      .def_readonly("idle_waits", &gxf::WorkStealingSchedulerStats::idle_waits)
+      .def_readonly("event_wakeups", &gxf::WorkStealingSchedulerStats::event_wakeups)
+      .def_readonly("timed_wakeups", &gxf::WorkStealingSchedulerStats::timed_wakeups)
+      .def_readonly("polls", &gxf::WorkStealingSchedulerStats::polls);
+
+  py::class_<WorkStealingScheduler,
+             PyWorkStealingScheduler,
+             gxf::GXFScheduler,
+             Component,
+             gxf::GXFComponent,
+             std::shared_ptr<WorkStealingScheduler>>(
+      m, "WorkStealingScheduler", doc::WorkStealingScheduler::doc_WorkStealingScheduler)
+      .def(py::init<Fragment*,
+                    std::shared_ptr<Clock>,
+                    int64_t,
+                    bool,
+                    double,
+                    int64_t,
+                    int64_t,
+                    const std::vector<int64_t>&,
+                    const std::vector<int64_t>&,
+                    const std::vector<std::string>&,
+                    const std::string&,
+                    int64_t,
+                    int64_t,
+                    const std::vector<int64_t>&,
+                    const std::string&>(),
+           "fragment"_a,
+           py::kw_only(),
+           "clock"_a = py::none(),
+           "worker_thread_number"_a = 1LL,
+           "stop_on_deadlock"_a = true,
+           "check_recession_period_ms"_a = 5.0,
+           "max_duration_ms"_a = -1LL,
+           "stop_on_deadlock_timeout"_a = 0LL,
+           "worker_cpu_cores"_a = std::vector<int64_t>{},
+           "worker_numa_nodes"_a = std::vector<int64_t>{},
+           "operator_affinity"_a = std::vector<std::string>{},
+           "shared_pool"_a = ""s,
+           "pool_priority"_a = 0LL,
+           "pool_max_workers"_a = 0LL,
+           "python_workers"_a = std::vector<int64_t>{},
+           "name"_a = "work_stealing_scheduler"s,
+           doc::WorkStealingScheduler::doc_WorkStealingScheduler_python)
+      .def_property_readonly("clock", &WorkStealingScheduler::clock)
+      .def_property_readonly("worker_thread_number", &WorkStealingScheduler::worker_thread_number)
+      .def_property_readonly("max_duration_ms", &WorkStealingScheduler::max_duration_ms)
+      .def_property_readonly("stop_on_deadlock", &WorkStealingScheduler::stop_on_deadlock)
+      .def_property_readonly("check_recession_period_ms",
+                             &WorkStealingScheduler::check_recession_period_ms)
+      .def_property_readonly("stop_on_deadlock_timeout",
+                             &WorkStealingScheduler::stop_on_deadlock_timeout)
+      .def_property_readonly("worker_cpu_cores", &WorkStealingScheduler::worker_cpu_cores)
+      .def_property_readonly("worker_numa_nodes", &WorkStealingScheduler::worker_numa_nodes)
+      .def_property_readonly("operator_affinity", &WorkStealingScheduler::operator_affinity)
+      .def_property_readonly("shared_pool", &WorkStealingScheduler::shared_pool)
+      .def_property_readonly("pool_priority", &WorkStealingScheduler::pool_priority)
+      .def_property_readonly("pool_max_workers", &WorkStealingScheduler::pool_max_workers)
+      .def_property_readonly("python_workers", &WorkStealingScheduler::python_workers)
+      .def_property_readonly("python_operators", &WorkStealingScheduler::python_operators)
+      .def_property_readonly(
+          "stats", &WorkStealingScheduler::stats, doc::WorkStealingScheduler::doc_stats)
+      .def_property_readonly("gxf_typename",
+                             &WorkStealingScheduler::gxf_typename,
+                             doc::WorkStealingScheduler::doc_gxf_typename);
+}  // PYBIND11_MODULE
+}  // namespace holoscan
@@ -0,0 +1,140 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef PYHOLOSCAN_SCHEDULERS_WORK_STEALING_SCHEDULER_PYDOC_HPP
+#define PYHOLOSCAN_SCHEDULERS_WORK_STEALING_SCHEDULER_PYDOC_HPP
+
+#include <string>
+
+#include "../macros.hpp"
+
+namespace holoscan::doc {
+
+namespace WorkStealingScheduler {
+
+// Constructor
+PYDOC(WorkStealingScheduler, R"doc(
+Work-stealing scheduler class.
+)doc")
+
+// PyWorkStealingScheduler Constructor
+PYDOC(WorkStealingScheduler_python, R"doc(
+Work-stealing scheduler
+
+Each worker thread has its own queue of ready operators. An operator that becomes ready is queued
+on the worker that last executed it, and idle workers steal queued operators from busy workers.
+
+Parameters
+----------
+fragment : Fragment
+    The fragment the condition will be associated with
+clock : holoscan.resources.Clock or None, optional
+    The clock used by the scheduler to define the flow of time. If None, a default-constructed
+    `holoscan.resources.RealtimeClock` will be used.
+worker_thread_number : int
+    The number of worker threads.
+stop_on_deadlock : bool, optional
+    If enabled the scheduler will stop when all entities are in a waiting state, but no periodic
+    entity exists to break the dead end. Should be disabled when scheduling conditions can be
+    changed by external actors, for example by clearing queues manually.
+check_recession_period_ms : float, optional
+    The maximum duration for which the scheduler would wait (in ms) before checking the condition
+    of an operator waiting for an event again.
+max_duration_ms : int, optional
+    The maximum duration for which the scheduler will execute (in ms). If not specified (or if a
+    negative value is provided), the scheduler will run until all work is done. If periodic terms
+    are present, this means the application will run indefinitely.
+stop_on_deadlock_timeout : int, optional
+    The scheduler will wait this amount of time before determining that it is in deadlock
+    and should stop. It will reset if a job comes in during the wait. A negative value means not
+    stop on deadlock. This parameter only applies when `stop_on_deadlock=true`",
+worker_cpu_cores : list of int, optional
+    The CPU core (OS index) each worker thread is pinned to. Worker `i` is pinned to the core at
+    index `i` modulo the number of cores. Workers are not pinned if empty.
+worker_numa_nodes : list of int, optional
+    The NUMA node (OS index) each worker thread is pinned to. Worker `i` is pinned to the node at
+    index `i` modulo the number of nodes. Ignored if `worker_cpu_cores` is set.
+operator_affinity : list of str, optional
+    Operators pinned to a worker thread, as ``"<operator name>:<worker index>"`` entries. A pinned
+    operator is only executed by its worker.
+shared_pool : str, optional
+    Name of a worker pool shared with the other schedulers of the process using the same name
+    (e.g., the schedulers of other fragments). The scheduler creates its own worker threads if
+    empty.
+pool_priority : int, optional
+    Priority of the scheduler in the shared worker pool (the operators of the schedulers with a
+    higher priority are executed first).
+pool_max_workers : int, optional
+    Maximum number of workers of the shared worker pool executing the operators of the scheduler
+    at the same time (0 means no limit).
+python_workers : list of int, optional
+    Indices of the worker threads dedicated to the operators implemented in Python. These
+    operators (which hold the GIL while they run) only run on these workers and the other operators
+    only on the other workers, so that the native operators do not wait for the GIL. At least one
+    worker must be left for the other operators. Not used if empty. The time each Python operator
+    waited for the GIL is reported by `Fragment.operator_stats`.
+name : str, optional
+    The name of the scheduler.
+)doc")
+
+PYDOC(stats, R"doc(
+The scheduling counters accumulated since the scheduler started.
+
+Returns
+-------
+WorkStealingSchedulerStats
+    The counters (all zero if the scheduler was not initialized yet).
+)doc")
+
+PYDOC(gxf_typename, R"doc(
+The GXF type name of the scheduler.
+
+Returns
+-------
+str
+    The GXF type name of the scheduler
+)doc")
+
+PYDOC(WorkStealingSchedulerStats, R"doc(
+Counters of the scheduling decisions made by a WorkStealingScheduler.
+
+Attributes
+----------
+executions : int
+    Number of operator executions (ticks or condition checks).
+local_pops : int
+    Executions of operators taken from the worker's own queue.
+steals : int
+    Executions of operators stolen from another worker's queue.
+affinity_hits : int
+    Executions on the worker that last executed the operator.
+migrations : int
+    Executions on another worker than the one that last executed the operator.
+idle_waits : int
+    Number of times a worker found no local or stealable work.
+event_wakeups : int
+    Waiting operators queued because of an event notification.
+timed_wakeups : int
+    Operators queued because their target time was reached.
+polls : int
+    Waiting operators queued by the periodic condition check.
+)doc")
+
+}  // namespace WorkStealingScheduler
+}  // namespace holoscan::doc
+
+#endif  // PYHOLOSCAN_SCHEDULERS_WORK_STEALING_SCHEDULER_PYDOC_HPP
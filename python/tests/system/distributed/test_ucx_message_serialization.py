@@ -60,6 +60,15 @@ class PingMessageTxOp(Operator):
                 z=cp.zeros((10, 5), dtype=float),
             )
             op_output.emit(tensormap, "out")
+        elif self.value == "numpy-pyobject":
+            # not all values are array-like: sent with pickle, large arrays out-of-band
+            obj = dict(
+                image=np.arange(512 * 512, dtype=np.float32).reshape(512, 512),
+                small=np.ones(4, dtype=np.uint8),
+                strided=np.arange(100000, dtype=np.int32)[::2],
+                label="abc",
+            )
+            op_output.emit(obj, "out")
         elif self.value == "numpy":
             z = np.zeros((16, 8, 4), dtype=np.float32)
             op_output.emit(z, "out")
@@ -91,6 +100,17 @@ def _check_value(value, expected_value):
         assert int(r.max()) == 9999
         assert z.shape == (10, 5)
         assert float(z.max()) == 0.0
+    elif expected_value == "numpy-pyobject":
+        assert isinstance(value, dict)
+        assert value["label"] == "abc"
+        image = value["image"]
+        assert isinstance(image, np.ndarray)
+        assert image.shape == (512, 512)
+        assert image.dtype == np.float32
+        assert image[511, 511] == 512 * 512 - 1
+        assert image.flags.writeable
+        assert np.array_equal(value["small"], np.ones(4, dtype=np.uint8))
+        assert np.array_equal(value["strided"], np.arange(100000, dtype=np.int32)[::2])
     elif expected_value == "numpy":
         # object with __array_attribute__ is deserialized as a NumPy array
         assert isinstance(value, np.ndarray)
@@ -180,6 +200,7 @@ class MultiFragmentPyObjectPingApp(Application):
         3.5,
         dict(a=5, b=7, c=[1, 2, 3], d="abc"),
         "numpy-tensormap",  # dict of numpy arrays
+        "numpy-pyobject",  # dict of numpy arrays and other objects (pickled)
         "cupy-tensormap",  # dict of cupy arrays
         "numpy",  # single numpy array
         "cupy",  # single cupy array
@@ -189,7 +210,7 @@ class MultiFragmentPyObjectPingApp(Application):
 )
 def test_ucx_object_serialization_app(ping_config_file, value, capfd):
     """Testing UCX-based serialization of PyObject, tensors, etc."""
-    if value in ["numpy", "numpy-tensormap"]:
+    if value in ["numpy", "numpy-tensormap", "numpy-pyobject"]:
         pytest.importorskip("numpy")
     elif value in ["cupy", "cupy-complex", "cupy-tensormap"]:
         pytest.importorskip("cupy")
@@ -272,6 +293,7 @@ class MultiFragmentPyObjectReceiversPingApp(Application):
         3.5,
         dict(a=5, b=7, c=[1, 2, 3], d="abc"),
         "numpy-tensormap",  # dict of numpy arrays
+        "numpy-pyobject",  # dict of numpy arrays and other objects (pickled)
         "cupy-tensormap",  # dict of cupy arrays
         "numpy",  # single numpy array
         "cupy",  # single cupy array
@@ -280,7 +302,7 @@ class MultiFragmentPyObjectReceiversPingApp(Application):
 )
 def test_ucx_object_receivers_serialization_app(ping_config_file, value, capfd):
     """Testing UCX-based serialization of PyObject, tensors, etc."""
-    if value == "numpy":
+    if value in ["numpy", "numpy-pyobject"]:
         pytest.importorskip("numpy")
     elif value == "cupy":
         pytest.importorskip("cupy")
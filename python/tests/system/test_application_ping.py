@@ -16,13 +16,14 @@
 """  # noqa: E501
 
 import datetime
+import struct
 import sys
 import time
 
 import pytest
 
 from holoscan.conditions import CountCondition, PeriodicCondition
-from holoscan.core import Application, Operator, OperatorSpec, Tracker
+from holoscan.core import Application, DataFlowLogFormat, Operator, OperatorSpec, Tracker
 from holoscan.resources import ManualClock, RealtimeClock
 from holoscan.schedulers import GreedyScheduler
 
@@ -336,6 +337,26 @@ def test_my_tracker_logging_app(ping_config_file, capfd):
     assert f"tx->out2: {count}" in captured.out
 
 
+def test_my_tracker_binary_logging_app(ping_config_file, tmp_path):
+    count = 10
+    filename = str(tmp_path / "logfile1.bin")
+
+    app = MyPingApp(count=count)
+    app.config(ping_config_file)
+    with Tracker(app, filename=filename, log_format=DataFlowLogFormat.BINARY):
+        app.run()
+
+    with open(filename, "rb") as f:
+        data = f.read()
+    # header magic, followed by fixed-size (40 bytes) records and the string table
+    assert data[:8] == b"HSDFTRC\0"
+    num_records, num_messages = struct.unpack_from("<QQ", data, 24)
+    # every message traverses tx -> mx -> rx (one record per operator)
+    assert num_messages >= count
+    assert num_records >= 3 * num_messages
+    assert b"mx" in data[64 + 40 * num_records :]
+
+
 # This test is intentionally not marked as slow to ensure every
 # run of python-api test will loop an app a few times to try and catch
 # intermittent seg faults
@@ -25,7 +25,7 @@ import holoscan
 from holoscan.conditions import CountCondition
 from holoscan.operators import FormatConverterOp
 from holoscan.resources import UnboundedAllocator
-from holoscan.schedulers import EventBasedScheduler, MultiThreadScheduler
+from holoscan.schedulers import EventBasedScheduler, MultiThreadScheduler, WorkStealingScheduler
 
 cuda_device = cp.cuda.Device()
 # disable CuPy memory pool
@@ -152,20 +152,45 @@ def launch_app(scheduler="multi_thread"):
                 stop_on_deadlock_timeout=500,
                 name="ebs",
             )
+        elif scheduler == "python_workers":
+            # the Python operators run on worker 0, FormatConverterOp on the other workers
+            scheduler = WorkStealingScheduler(
+                app,
+                worker_thread_number=4,
+                stop_on_deadlock=True,
+                stop_on_deadlock_timeout=500,
+                python_workers=[0],
+                name="wss",
+            )
+            app.enable_operator_stats(False)
         else:
-            raise ValueError("scheduler must be one of {'multi_thread', 'event_based'}")
+            raise ValueError(
+                "scheduler must be one of {'multi_thread', 'event_based', 'python_workers'}"
+            )
 
         app.scheduler(scheduler)
         app.run()
+        return app, scheduler
 
 
-@pytest.mark.parametrize("scheduler", ["event_based", "multi_thread"])
+@pytest.mark.parametrize("scheduler", ["event_based", "multi_thread", "python_workers"])
 def test_multithread_tensor_message(scheduler, capfd):
     # Issue 4293741: Python application having more than two operators, using MultiThreadScheduler
     # (including distributed app), and sending Tensor can deadlock at runtime.
     global NUM_MSGS, GPU_MEMORY_HISTORY
 
-    launch_app(scheduler)
+    app, scheduler_obj = launch_app(scheduler)
+    if scheduler == "python_workers":
+        assert sorted(scheduler_obj.python_operators) == [
+            "image_generator",
+            "postprocessor",
+            "watchdog",
+        ]
+        stats = {op_stats.operator_name: op_stats for op_stats in app.operator_stats()}
+        assert stats["postprocessor"].num_ticks == NUM_MSGS
+        assert stats["postprocessor"].max_gil_wait_time_us > 0
+        # the GIL wait is only measured for the operators implemented in Python
+        assert stats["preprocessor"].total_gil_wait_time_ms == 0
 
     # assert that no errors were logged
     captured = capfd.readouterr()
@@ -20,7 +20,12 @@ import pytest
 from holoscan.core import ComponentSpec, Scheduler
 from holoscan.gxf import GXFScheduler
 from holoscan.resources import ManualClock, RealtimeClock
-from holoscan.schedulers import EventBasedScheduler, GreedyScheduler, MultiThreadScheduler
+from holoscan.schedulers import (
+    EventBasedScheduler,
+    GreedyScheduler,
+    MultiThreadScheduler,
+    WorkStealingScheduler,
+)
 
 
 class TestGreedyScheduler:
@@ -189,3 +194,56 @@ class TestEventBasedScheduler:
         with pytest.raises(RuntimeError):
             # value will only be initialized by executor once app.run() is called
             scheduler.stop_on_deadlock_timeout  # noqa: B018
+
+
+class TestWorkStealingScheduler:
+    def test_default_init(self, app):
+        scheduler = WorkStealingScheduler(app)
+        assert isinstance(scheduler, GXFScheduler)
+        assert isinstance(scheduler, Scheduler)
+        assert isinstance(scheduler.spec, ComponentSpec)
+        assert scheduler.gxf_typename == "holoscan::gxf::WorkStealingScheduler"
+
+    @pytest.mark.parametrize("ClockClass", [ManualClock, RealtimeClock])
+    def test_init_kwargs(self, app, ClockClass):  # noqa: N803
+        name = "work-stealing-scheduler"
+        scheduler = WorkStealingScheduler(
+            app,
+            clock=ClockClass(app),
+            worker_thread_number=4,
+            stop_on_deadlock=True,
+            check_recession_period_ms=2.0,
+            max_duration_ms=10000,
+            stop_on_deadlock_timeout=10,
+            worker_cpu_cores=[0, 1],
+            worker_numa_nodes=[0],
+            operator_affinity=["tx:0", "rx:1"],
+            shared_pool="fragments",
+            pool_priority=2,
+            pool_max_workers=3,
+            python_workers=[3],
+            name=name,
+        )
+        assert isinstance(scheduler, GXFScheduler)
+        assert f"name: {name}" in repr(scheduler)
+
+    def test_max_duration_ms(self, app):
+        scheduler = WorkStealingScheduler(app)
+
+        # max_duration_ms is optional and will report -1 if not set
+        assert scheduler.max_duration_ms == -1
+
+    def test_python_workers(self, app):
+        scheduler = WorkStealingScheduler(app, worker_thread_number=3, python_workers=[0])
+        with pytest.raises(RuntimeError):
+            # the operators implemented in Python are listed when the scheduler is initialized
+            scheduler.python_operators  # noqa: B018
+
+    def test_stats(self, app):
+        scheduler = WorkStealingScheduler(app)
+
+        # the counters are all zero until the scheduler runs
+        stats = scheduler.stats
+        assert stats.executions == 0
+        assert stats.steals == 0
+        assert stats.affinity_hits == 0
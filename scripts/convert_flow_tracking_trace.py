@@ -0,0 +1,258 @@
+#!/usr/bin/env python3
+"""
+SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+SPDX-License-Identifier: Apache-2.0
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+"""  # noqa: E501
+
+import argparse
+import json
+import mmap
+import struct
+import sys
+
+MAGIC = b"HSDFTRC\0"
+SUPPORTED_VERSION = 1
+
+# struct DataFlowTraceHeader (include/holoscan/core/dataflow_trace.hpp)
+HEADER_STRUCT = struct.Struct(
+    "<"
+    "8s"  # magic
+    "I"  # version
+    "I"  # record_size
+    "Q"  # records_offset
+    "Q"  # num_records
+    "Q"  # num_messages
+    "Q"  # num_dropped_messages
+    "Q"  # string_table_offset
+    "Q"  # string_table_size
+)
+
+# struct DataFlowTraceRecord
+RECORD_STRUCT = struct.Struct(
+    "<"
+    "Q"  # message_index
+    "I"  # path_id
+    "I"  # operator_id
+    "H"  # path_index
+    "H"  # operator_index
+    "I"  # reserved
+    "q"  # receive_timestamp (us)
+    "q"  # publish_timestamp (us)
+)
+
+
+class DataFlowTrace:
+    """Reader of the binary log files written by DataFlowTracker (DataFlowLogFormat::kBinary)."""
+
+    def __init__(self, data):
+        if len(data) < HEADER_STRUCT.size:
+            raise ValueError("File too small to be a data flow trace")
+        (
+            magic,
+            version,
+            self.record_size,
+            self.records_offset,
+            self.num_records,
+            self.num_messages,
+            self.num_dropped_messages,
+            string_table_offset,
+            string_table_size,
+        ) = HEADER_STRUCT.unpack_from(data, 0)
+        if magic != MAGIC:
+            raise ValueError("Not a data flow trace (bad magic)")
+        if version != SUPPORTED_VERSION:
+            raise ValueError(f"Unsupported data flow trace version {version}")
+        if self.record_size < RECORD_STRUCT.size:
+            raise ValueError(f"Unexpected record size {self.record_size}")
+
+        self.data = data
+        self.is_complete = string_table_offset != 0
+        self.operator_names = []
+        self.paths = {}
+        if self.is_complete:
+            self._read_string_table(string_table_offset, string_table_size)
+        else:
+            # The trace was not closed: read the records up to the end of the file
+            self.num_records = (len(data) - self.records_offset) // self.record_size
+
+    def _read_string_table(self, offset, size):
+        table = self.data[offset : offset + size]
+        pos = 0
+
+        def read_u32():
+            nonlocal pos
+            (value,) = struct.unpack_from("<I", table, pos)
+            pos += 4
+            return value
+
+        for _ in range(read_u32()):
+            name_size = read_u32()
+            self.operator_names.append(bytes(table[pos : pos + name_size]).decode("utf-8"))
+            pos += name_size
+        for _ in range(read_u32()):
+            path_id = read_u32()
+            num_operators = read_u32()
+            self.paths[path_id] = [read_u32() for _ in range(num_operators)]
+
+    def operator_name(self, operator_id):
+        if operator_id < len(self.operator_names):
+            return self.operator_names[operator_id]
+        return f"operator_{operator_id}"
+
+    def path_name(self, path_id):
+        if path_id in self.paths:
+            return ",".join(self.operator_name(op_id) for op_id in self.paths[path_id])
+        return f"path_{path_id}"
+
+    def records(self):
+        """Yield the records as tuples (see RECORD_STRUCT)."""
+        offset = self.records_offset
+        for _ in range(self.num_records):
+            record = RECORD_STRUCT.unpack_from(self.data, offset)
+            if record[0] == 0:
+                # Unwritten part of a memory-mapped trace that was not closed
+                break
+            yield record
+            offset += self.record_size
+
+
+def write_chrome_trace(trace, output, *, flows=True, dedup=True):
+    """Write the trace in the Chrome trace event (JSON) format, which Perfetto can open.
+
+    Each operator execution is a complete event ("X") on the track of its operator, and the hops
+    of a message between operators are flow events ("s"/"f").
+    """
+    output.write('{"displayTimeUnit": "ms", "traceEvents": [\n')
+    first = True
+
+    def emit(event):
+        nonlocal first
+        if not first:
+            output.write(",\n")
+        first = False
+        output.write(json.dumps(event, separators=(",", ":")))
+
+    for operator_id in range(len(trace.operator_names)):
+        emit(
+            {
+                "ph": "M",
+                "pid": 0,
+                "tid": operator_id,
+                "name": "thread_name",
+                "args": {"name": trace.operator_name(operator_id)},
+            }
+        )
+
+    # Operators shared by several paths of a message are reported once per path: keep the first
+    seen = set()
+    previous = None
+    flow_id = 0
+    for message_index, path_id, operator_id, path_index, operator_index, _, rec, pub in (
+        trace.records()
+    ):
+        key = (message_index, operator_id, rec, pub)
+        if not dedup or key not in seen:
+            if dedup:
+                seen.add(key)
+            emit(
+                {
+                    "ph": "X",
+                    "pid": 0,
+                    "tid": operator_id,
+                    "name": trace.operator_name(operator_id),
+                    "ts": rec,
+                    "dur": max(pub - rec, 0),
+                    "args": {"message": message_index, "path": trace.path_name(path_id)},
+                }
+            )
+
+        if flows and previous is not None and operator_index > 0:
+            prev_message, prev_path_index, prev_operator_id, prev_pub = previous
+            if prev_message == message_index and prev_path_index == path_index:
+                flow_id += 1
+                emit(
+                    {
+                        "ph": "s",
+                        "pid": 0,
+                        "tid": prev_operator_id,
+                        "name": "message",
+                        "cat": "flow",
+                        "id": flow_id,
+                        "ts": prev_pub,
+                    }
+                )
+                emit(
+                    {
+                        "ph": "f",
+                        "bp": "e",
+                        "pid": 0,
+                        "tid": operator_id,
+                        "name": "message",
+                        "cat": "flow",
+                        "id": flow_id,
+                        "ts": rec,
+                    }
+                )
+        previous = (message_index, path_index, operator_id, pub)
+
+        # Only the operators of the current message can be shared by its paths
+        if dedup and len(seen) > 4096:
+            seen = {key for key in seen if key[0] == message_index}
+
+    output.write("\n]}\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=(
+            "Convert a binary data flow tracking log (DataFlowLogFormat::kBinary) to the Chrome "
+            "trace event JSON format (viewable in Perfetto or chrome://tracing)."
+        )
+    )
+    parser.add_argument("input", help="Binary data flow tracking log file")
+    parser.add_argument("-o", "--output", default="-", help="Output JSON file (default: stdout)")
+    parser.add_argument(
+        "--no-flows", action="store_true", help="Do not emit flow events between operators"
+    )
+    parser.add_argument(
+        "--no-dedup",
+        action="store_true",
+        help="Emit an operator execution once per path of a message (instead of once)",
+    )
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f, mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) as data:
+        trace = DataFlowTrace(data)
+        if not trace.is_complete:
+            print(
+                "Warning: the trace was not closed, operator names are not available",
+                file=sys.stderr,
+            )
+        if trace.num_dropped_messages:
+            print(
+                f"Warning: {trace.num_dropped_messages} messages were not logged", file=sys.stderr
+            )
+
+        if args.output == "-":
+            write_chrome_trace(trace, sys.stdout, flows=not args.no_flows, dedup=not args.no_dedup)
+        else:
+            with open(args.output, "w") as output:
+                write_chrome_trace(
+                    trace, output, flows=not args.no_flows, dedup=not args.no_dedup
+                )
+
+
+if __name__ == "__main__":
+    main()
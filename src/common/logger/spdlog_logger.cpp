@@ -112,10 +112,26 @@ DefaultSpdlogLogger::DefaultSpdlogLogger(std::string& name, std::string& pattern
     : name_(name), pattern_(pattern), level_(level), sinks_(sinks) {}
 
 void DefaultSpdlogLogger::log(const char* file, int line, const char* name, int level,
-                              const char* log, void*) {
+                              const char* log, void* arg) {
   auto logger = std::static_pointer_cast<spdlog::logger>(loggers_[level]);
   if (logger) {
-    if (file != nullptr) {
+    if (arg != nullptr) {
+      // Message logged on behalf of another thread: keep the time and thread id of the log call
+      const auto spdlog_level = static_cast<spdlog::level::level_enum>(level);
+      if (!logger->should_log(spdlog_level)) { return; }
+      const auto* origin = static_cast<const LogMessageOrigin*>(arg);
+      spdlog::details::log_msg msg(
+          origin->time,
+          file != nullptr ? spdlog::source_loc{file, line, name} : spdlog::source_loc{},
+          logger->name(),
+          spdlog_level,
+          log);
+      msg.thread_id = origin->thread_id;
+      for (auto& sink : logger->sinks()) {
+        if (sink->should_log(spdlog_level)) { sink->log(msg); }
+      }
+      if (spdlog_level >= logger->flush_level()) { logger->flush(); }
+    } else if (file != nullptr) {
       logger->log(
           spdlog::source_loc{file, line, name}, static_cast<spdlog::level::level_enum>(level), log);
     } else {
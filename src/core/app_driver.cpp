@@ -18,12 +18,16 @@
 #include "holoscan/core/app_driver.hpp"
 
 #include <stdlib.h>  // POSIX setenv
+#include <unistd.h>  // getpid
 
 #include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <deque>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <random>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -35,6 +39,7 @@
 #include "holoscan/core/app_worker.hpp"
 #include "holoscan/core/application.hpp"
 #include "holoscan/core/cli_options.hpp"
+#include "holoscan/core/codec_registry.hpp"
 #include "holoscan/core/executors/gxf/gxf_executor.hpp"
 #include "holoscan/core/fragment.hpp"
 #include "holoscan/core/graph.hpp"  // for FragmentNodeType
@@ -47,6 +52,7 @@
 #include "holoscan/core/services/app_driver/server.hpp"
 #include "holoscan/core/services/app_worker/server.hpp"
 #include "holoscan/core/services/common/network_constants.hpp"
+#include "holoscan/core/services/common/shm_transport_op.hpp"
 #include "holoscan/core/signal_handler.hpp"
 #include "holoscan/core/system/network_utils.hpp"
 #include "holoscan/core/system/system_resource_manager.hpp"
@@ -346,6 +352,33 @@ void AppDriver::submit_message(DriverMessage&& message) {
   driver_server_->notify();
 }
 
+void AppDriver::add_worker_codec_names(const std::vector<std::string>& codec_names) {
+  std::lock_guard<std::mutex> lock(codec_table_mutex_);
+  if (!wire_codec_names_) {
+    wire_codec_names_ = codec_names;
+    return;
+  }
+  // Keep only the codecs known to every worker (both lists are sorted)
+  std::vector<std::string> shared_names;
+  std::set_intersection(wire_codec_names_->begin(),
+                        wire_codec_names_->end(),
+                        codec_names.begin(),
+                        codec_names.end(),
+                        std::back_inserter(shared_names));
+  if (shared_names.size() != wire_codec_names_->size()) {
+    HOLOSCAN_LOG_DEBUG(
+        "Codec registries of the workers differ; {} codec(s) will be sent by name instead of ID",
+        wire_codec_names_->size() - shared_names.size());
+  }
+  wire_codec_names_ = std::move(shared_names);
+}
+
+std::vector<std::string> AppDriver::wire_codec_table() {
+  std::lock_guard<std::mutex> lock(codec_table_mutex_);
+  if (!wire_codec_names_) { return {}; }
+  return wire_codec_names_.value();
+}
+
 void AppDriver::process_message_queue() {
   std::lock_guard<std::mutex> lock(message_mutex_);
 
@@ -742,6 +775,7 @@ bool AppDriver::collect_connections(holoscan::FragmentGraph& fragment_graph) {
           }
           index_to_port_map_[port_index] = 0;
           index_to_ip_map_[port_index] = frag_name;
+          index_to_source_ip_map_[port_index] = prev_frag_name;
 
           // Add the connection item to the connection map
           connection_map_[prev_frag].push_back(source_connection_item);
@@ -758,6 +792,29 @@ bool AppDriver::collect_connections(holoscan::FragmentGraph& fragment_graph) {
 }
 
 void AppDriver::correct_connection_map() {
+  // Connections between fragments on the same host can use shared memory instead of UCX.
+  const bool use_shm_transport = get_bool_env_var("HOLOSCAN_SHM_TRANSPORT");
+  uint32_t shm_slot_size = ops::kDefaultShmSlotSize;
+  if (use_shm_transport) {
+    const char* slot_size_str = std::getenv("HOLOSCAN_SHM_SLOT_SIZE");
+    if (slot_size_str != nullptr && slot_size_str[0] != '\0') {
+      uint64_t slot_size = parse_memory_size(slot_size_str);
+      if (slot_size == 0 || slot_size > std::numeric_limits<uint32_t>::max()) {
+        HOLOSCAN_LOG_WARN(
+            "Invalid HOLOSCAN_SHM_SLOT_SIZE '{}'. Using the default slot size ({} bytes).",
+            slot_size_str,
+            shm_slot_size);
+      } else {
+        shm_slot_size = static_cast<uint32_t>(slot_size);
+      }
+    }
+  }
+  uint64_t shm_run_token = 0;
+  if (use_shm_transport) {
+    std::random_device random_device;
+    shm_run_token = (static_cast<uint64_t>(random_device()) << 32) | random_device();
+  }
+
   for (auto& [fragment, connections] : connection_map_) {
     for (auto& connection : connections) {
       // Update port index
@@ -776,6 +833,22 @@ void AppDriver::correct_connection_map() {
           }
         }
       }
+      // Use shared memory if both fragments run on the same host
+      if (use_shm_transport && port_index >= 0 &&
+          index_to_ip_map_[port_index] == index_to_source_ip_map_[port_index]) {
+        // The token keeps the names unique across runs (and drivers) reusing the same PID.
+        auto segment_name =
+            fmt::format("/holoscan_shm_{}_{:016x}_{}", getpid(), shm_run_token, port_index);
+        HOLOSCAN_LOG_DEBUG("Using shared memory segment '{}' for connection '{}' of fragment '{}'",
+                           segment_name,
+                           connection->name,
+                           fragment->name());
+        connection->connector_type = IOSpec::ConnectorType::kSharedMemory;
+        connection->args = ArgList({Arg("segment_name", segment_name),
+                                    Arg("slot_count", ops::kDefaultShmSlotCount),
+                                    Arg("slot_size", shm_slot_size)});
+        continue;
+      }
       // Update IP address
       for (auto& arg : connection->args) {
         if (arg.name() == "address" || arg.name() == "receiver_address") {
@@ -996,7 +1069,8 @@ void AppDriver::check_fragment_schedule(const std::string& worker_address) {
       all_fragment_port_map_->merge(scheduled_fragments_port_info);
     }
 
-    // (populates index_to_port_map_, index_to_ip_map_, connection_map_, receiver_port_map_)
+    // (populates index_to_port_map_, index_to_ip_map_, index_to_source_ip_map_, connection_map_,
+    //  receiver_port_map_)
     if (!collect_connections(fragment_graph)) { HOLOSCAN_LOG_ERROR("Cannot collect connections"); }
 
     // Collect # of connectors for each fragment
@@ -1008,13 +1082,20 @@ void AppDriver::check_fragment_schedule(const std::string& worker_address) {
       }
     }
 
-    // Assign index_to_ip_map_ with the worker's IP address.
+    // Assign index_to_ip_map_ and index_to_source_ip_map_ with the worker's IP address.
     for (auto& [port, fragment_name] : index_to_ip_map_) {
       auto& assigned_worker_id = schedule[fragment_name];
       auto& worker_client = driver_server_->connect_to_worker(assigned_worker_id);
       // Set worker's IP instead of the fragment name
       fragment_name = worker_client->ip_address();
     }
+    for (auto& [port, fragment_name] : index_to_source_ip_map_) {
+      // Source fragments that are not in this schedule keep their name (UCX is used).
+      auto schedule_it = schedule.find(fragment_name);
+      if (schedule_it == schedule.end()) { continue; }
+      auto& worker_client = driver_server_->connect_to_worker(schedule_it->second);
+      fragment_name = worker_client->ip_address();
+    }
 
     // Construct worker_id to the vector of fragment name map
     std::unordered_map<std::string, std::vector<std::string>> worker_fragment_map;
@@ -1079,7 +1160,8 @@ void AppDriver::check_fragment_schedule(const std::string& worker_address) {
 
       auto& worker_client = driver_server_->connect_to_worker(worker_id);
 
-      bool result = worker_client->fragment_execution(fragment_vector, connection_map_);
+      bool result = worker_client->fragment_execution(
+          fragment_vector, connection_map_, wire_codec_table());
       if (!result) {
         HOLOSCAN_LOG_ERROR("Cannot launch fragments on worker {}", worker_id);
 
@@ -1200,6 +1282,10 @@ std::future<void> AppDriver::launch_fragments_async(
     all_fragment_port_map_->try_emplace(fragment->name(), fragment->port_info());
   }
 
+  // All fragments share this process's codec registry, so every codec can use a wire ID.
+  auto& codec_registry = CodecRegistry::get_instance();
+  codec_registry.set_wire_codec_table(codec_registry.codec_names());
+
   if (!collect_connections(fragment_graph)) {
     HOLOSCAN_LOG_ERROR("Cannot collect connections");
     return std::async(std::launch::async, []() {});
@@ -1220,6 +1306,7 @@ std::future<void> AppDriver::launch_fragments_async(
 
   for (int port_index = 0; port_index < required_port_count; ++port_index) {
     index_to_ip_map_[port_index] = "0.0.0.0";
+    index_to_source_ip_map_[port_index] = "0.0.0.0";
     index_to_port_map_[port_index] = unused_ports[port_index];
   }
   correct_connection_map();
@@ -18,10 +18,14 @@
 #include "holoscan/core/application.hpp"
 
 #include <algorithm>
+#include <cstdlib>
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -33,6 +37,9 @@
 #include "holoscan/core/schedulers/gxf/event_based_scheduler.hpp"
 #include "holoscan/core/schedulers/gxf/greedy_scheduler.hpp"
 #include "holoscan/core/schedulers/gxf/multithread_scheduler.hpp"
+#include "holoscan/core/schedulers/gxf/work_stealing_scheduler.hpp"
+#include "holoscan/core/schedulers/greedy_fragment_allocation.hpp"
+#include "holoscan/core/system/topology.hpp"
 
 namespace CLI {
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -114,6 +121,9 @@ Application::Application(const std::vector<std::string>& argv) : Fragment(), arg
   // Set the log format from the environment variable if it exists.
   // Or, set the default log format depending on the log level if it hasn't been set by the user.
   holoscan::set_log_pattern();
+  // Enable (or disable) asynchronous logging if requested with the HOLOSCAN_LOG_ASYNC environment
+  // variable.
+  if (std::getenv("HOLOSCAN_LOG_ASYNC")) { holoscan::set_log_async(Logger::is_async()); }
 
   // Set the application pointer to this
   app_ = this;
@@ -253,6 +263,8 @@ expected<SchedulerType, ErrorCode> Application::get_distributed_app_scheduler_en
       return SchedulerType::kMultiThread;
     } else if (std::strcmp(env_value, "event_based") == 0) {
       return SchedulerType::kEventBased;
+    } else if (std::strcmp(env_value, "work_stealing") == 0) {
+      return SchedulerType::kWorkStealing;
     } else {
       HOLOSCAN_LOG_ERROR("Invalid value for HOLOSCAN_DISTRIBUTED_APP_SCHEDULER: {}", env_value);
       return make_unexpected(ErrorCode::kInvalidArgument);
@@ -325,6 +337,20 @@ expected<double, ErrorCode> Application::get_check_recession_period_ms_env() {
   }
 }
 
+std::vector<OperatorStatsSnapshot> Application::operator_stats() {
+  // The operators of an application without fragments belong to the application itself
+  if (!fragment_graph_ || fragment_graph_->is_empty()) { return Fragment::operator_stats(); }
+
+  std::vector<OperatorStatsSnapshot> stats;
+  for (auto& fragment : fragment_graph_->get_nodes()) {
+    for (auto& op_stats : fragment->operator_stats()) {
+      op_stats.operator_name = fmt::format("{}.{}", fragment->name(), op_stats.operator_name);
+      stats.push_back(std::move(op_stats));
+    }
+  }
+  return stats;
+}
+
 void Application::compose_graph() {
   if (is_composed_) {
     HOLOSCAN_LOG_DEBUG("The application({}) has already been composed. Skipping...", name());
@@ -372,7 +398,11 @@ void Application::set_scheduler_for_fragments(std::vector<FragmentNodeType>& tar
       // TODO: consider use of event-based scheduler?
       auto multi_thread_scheduler =
           std::dynamic_pointer_cast<holoscan::MultiThreadScheduler>(scheduler);
-      if (!multi_thread_scheduler) { scheduler_setting = SchedulerType::kMultiThread; }
+      auto work_stealing_scheduler =
+          std::dynamic_pointer_cast<holoscan::WorkStealingScheduler>(scheduler);
+      if (!multi_thread_scheduler && !work_stealing_scheduler) {
+        scheduler_setting = SchedulerType::kMultiThread;
+      }
     }
 
     switch (scheduler_setting) {
@@ -422,6 +452,25 @@ void Application::set_scheduler_for_fragments(std::vector<FragmentNodeType>& tar
         }
         scheduler->add_arg(holoscan::Arg("worker_thread_number", worker_thread_number));
       } break;
+      case SchedulerType::kWorkStealing: {
+        // Keep the work-stealing scheduler set to the fragment (it can have a pool priority and
+        // quota set by the user)
+        if (!std::dynamic_pointer_cast<holoscan::WorkStealingScheduler>(scheduler)) {
+          scheduler =
+              fragment->make_scheduler<holoscan::WorkStealingScheduler>("work-stealing-scheduler");
+          unsigned int num_processors = std::thread::hardware_concurrency();
+          int64_t worker_thread_number =
+              std::min(fragment->graph().get_nodes().size(), static_cast<size_t>(num_processors));
+          scheduler->add_arg(holoscan::Arg("worker_thread_number", worker_thread_number));
+          scheduler->add_arg(
+              holoscan::Arg("check_recession_period_ms", check_recession_period_ms));
+        }
+        scheduler->add_arg(holoscan::Arg("stop_on_deadlock", stop_on_deadlock));
+        scheduler->add_arg(holoscan::Arg("stop_on_deadlock_timeout", stop_on_deadlock_timeout));
+        if (max_duration_ms >= 0) {
+          scheduler->add_arg(holoscan::Arg("max_duration_ms", max_duration_ms));
+        }
+      } break;
     }
 
     // Override arguments from environment variables
@@ -441,6 +490,114 @@ void Application::set_scheduler_for_fragments(std::vector<FragmentNodeType>& tar
     }
     fragment->scheduler(scheduler);
   }
+
+  set_shared_worker_pools(target_fragments);
+}
+
+void Application::set_shared_worker_pools(std::vector<FragmentNodeType>& target_fragments) {
+  // Work-stealing schedulers that did not select a shared pool
+  std::vector<std::pair<FragmentNodeType, std::shared_ptr<WorkStealingScheduler>>> candidates;
+  for (auto& fragment : target_fragments) {
+    auto scheduler = std::dynamic_pointer_cast<WorkStealingScheduler>(fragment->scheduler());
+    if (!scheduler) { continue; }
+    const auto& args = scheduler->args();
+    if (std::any_of(args.begin(), args.end(), [](const auto& arg) {
+          return arg.name() == "shared_pool";
+        })) {
+      continue;
+    }
+    candidates.emplace_back(fragment, scheduler);
+  }
+  if (candidates.size() < 2 || !AppDriver::get_bool_env_var("HOLOSCAN_SHARED_WORKER_POOL", true)) {
+    return;
+  }
+
+  // As for the number of worker threads of a fragment's scheduler, the CPU demand of a fragment
+  // is estimated from its number of operators.
+  auto num_operators = [](const FragmentNodeType& fragment) {
+    return static_cast<int64_t>(fragment->graph().get_nodes().size());
+  };
+
+  std::vector<NumaNodeInfo> numa_nodes;
+  std::unordered_map<std::string, int32_t> assigned_nodes;
+  if (AppDriver::get_bool_env_var("HOLOSCAN_FRAGMENT_NUMA_PLACEMENT", false)) {
+    Topology topology;
+    if (topology.load() == 0) { numa_nodes = topology.numa_nodes(); }
+    if (numa_nodes.size() > 1) {
+      std::vector<SystemResourceRequirement> requirements;
+      requirements.reserve(candidates.size());
+      for (const auto& [fragment, scheduler] : candidates) {
+        SystemResourceRequirement requirement{};
+        requirement.fragment_name = fragment->name();
+        requirement.cpu = static_cast<float>(num_operators(fragment));
+        requirements.push_back(requirement);
+      }
+      auto result = GreedyFragmentAllocationStrategy::assign_numa_nodes(requirements, numa_nodes);
+      if (result) {
+        assigned_nodes = std::move(result.value());
+      } else {
+        HOLOSCAN_LOG_WARN("Unable to assign the fragments to NUMA nodes: {}", result.error());
+      }
+    } else {
+      HOLOSCAN_LOG_DEBUG("NUMA placement of the fragments skipped ({} NUMA node(s))",
+                         numa_nodes.size());
+    }
+  }
+
+  // Group the schedulers by pool (one pool per NUMA node, or a single pool)
+  struct PoolGroup {
+    int32_t numa_node = -1;
+    int64_t num_cpus = 0;
+    std::vector<std::pair<FragmentNodeType, std::shared_ptr<WorkStealingScheduler>>> members;
+  };
+  std::map<std::string, PoolGroup> pools;
+  for (auto& candidate : candidates) {
+    auto node_it = assigned_nodes.find(candidate.first->name());
+    std::string pool_name = "holoscan_fragments";
+    int32_t numa_node = -1;
+    int64_t num_cpus = static_cast<int64_t>(std::thread::hardware_concurrency());
+    if (node_it != assigned_nodes.end()) {
+      numa_node = node_it->second;
+      pool_name += fmt::format("_numa{}", numa_node);
+      for (const auto& node : numa_nodes) {
+        if (node.os_index == numa_node) { num_cpus = node.num_cpus; }
+      }
+    }
+    auto& group = pools[pool_name];
+    group.numa_node = numa_node;
+    group.num_cpus = num_cpus;
+    group.members.push_back(candidate);
+  }
+
+  for (auto& [pool_name, group] : pools) {
+    // A worker per operator, up to the number of CPUs
+    int64_t num_workers = 0;
+    for (const auto& member : group.members) { num_workers += num_operators(member.first); }
+    num_workers = std::clamp<int64_t>(num_workers, 1, std::max<int64_t>(group.num_cpus, 1));
+
+    std::vector<std::string> fragment_names;
+    for (auto& [fragment, scheduler] : group.members) {
+      fragment_names.push_back(fragment->name());
+      scheduler->add_arg(holoscan::Arg("shared_pool", pool_name));
+      scheduler->add_arg(holoscan::Arg("worker_thread_number", num_workers));
+      if (group.numa_node >= 0) {
+        scheduler->add_arg(holoscan::Arg("worker_numa_nodes",
+                                         std::vector<int64_t>{group.numa_node}));
+      }
+    }
+    if (group.numa_node >= 0) {
+      HOLOSCAN_LOG_INFO("Fragments '{}' share the worker pool '{}' ({} workers on NUMA node {})",
+                        fmt::join(fragment_names, "', '"),
+                        pool_name,
+                        num_workers,
+                        group.numa_node);
+    } else {
+      HOLOSCAN_LOG_INFO("Fragments '{}' share the worker pool '{}' ({} workers)",
+                        fmt::join(fragment_names, "', '"),
+                        pool_name,
+                        num_workers);
+    }
+  }
 }
 
 }  // namespace holoscan
@@ -42,6 +42,7 @@ void AsynchronousCondition::setup(ComponentSpec& spec) {
 }
 
 void AsynchronousCondition::event_state(AsynchronousEventState state) {
+  std::lock_guard<std::mutex> lock(event_state_mutex_);
   auto asynchronous_scheduling_term = get();
   if (asynchronous_scheduling_term) { asynchronous_scheduling_term->setEventState(state); }
   event_state_ = state;
@@ -53,4 +54,13 @@ AsynchronousEventState AsynchronousCondition::event_state() const {
   return event_state_;
 }
 
+bool AsynchronousCondition::compare_exchange_event_state(AsynchronousEventState expected,
+                                                         AsynchronousEventState desired) {
+  std::lock_guard<std::mutex> lock(event_state_mutex_);
+  if (!event_state_.compare_exchange_strong(expected, desired)) { return false; }
+  auto asynchronous_scheduling_term = get();
+  if (asynchronous_scheduling_term) { asynchronous_scheduling_term->setEventState(desired); }
+  return true;
+}
+
 }  // namespace holoscan
@@ -0,0 +1,37 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/conditions/gxf/batch_flush.hpp"
+
+#include "holoscan/core/component_spec.hpp"
+
+namespace holoscan {
+
+void BatchFlushCondition::setup(ComponentSpec& spec) {
+  (void)spec;  // no parameters to set
+}
+
+void BatchFlushCondition::request_flush(std::chrono::nanoseconds delay) {
+  auto term = get();
+  if (term) { term->request_flush(delay.count()); }
+}
+
+gxf::BatchFlushSchedulingTerm* BatchFlushCondition::get() const {
+  return static_cast<gxf::BatchFlushSchedulingTerm*>(gxf_cptr_);
+}
+
+}  // namespace holoscan
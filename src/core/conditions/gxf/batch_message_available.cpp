@@ -0,0 +1,48 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/conditions/gxf/batch_message_available.hpp"
+
+#include "holoscan/core/component_spec.hpp"
+
+namespace holoscan {
+
+void BatchMessageAvailableCondition::setup(ComponentSpec& spec) {
+  spec.param(receiver_,
+             "receiver",
+             "Queue channel",
+             "The scheduling term permits execution when this channel has a full batch of "
+             "messages or when the oldest batch is due.");
+  spec.param(max_batch_size_,
+             "max_batch_size",
+             "Maximum batch size",
+             "The scheduling term permits execution as soon as the receiver has at least this "
+             "number of messages.",
+             static_cast<int64_t>(1));
+  spec.param(max_delay_ns_,
+             "max_delay_ns",
+             "Maximum delay [ns]",
+             "The scheduling term permits execution with the messages available once this delay "
+             "has passed since the first message of the batch was seen.",
+             static_cast<int64_t>(0));
+}
+
+gxf::BatchMessageAvailableSchedulingTerm* BatchMessageAvailableCondition::get() const {
+  return static_cast<gxf::BatchMessageAvailableSchedulingTerm*>(gxf_cptr_);
+}
+
+}  // namespace holoscan
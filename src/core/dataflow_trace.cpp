@@ -0,0 +1,236 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/dataflow_trace.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+namespace {
+
+// The size of the user-space buffer of the records.
+constexpr size_t kTraceBufferSize = 1 << 20;
+// The size of the memory-mapped window of the file (a multiple of the page size).
+constexpr size_t kTraceWindowSize = 64 << 20;
+
+void append(std::vector<char>& data, const void* value, size_t size) {
+  const auto* bytes = static_cast<const char*>(value);
+  data.insert(data.end(), bytes, bytes + size);
+}
+
+void append_u32(std::vector<char>& data, uint32_t value) {
+  append(data, &value, sizeof(value));
+}
+
+}  // namespace
+
+DataFlowTraceWriter::~DataFlowTraceWriter() {
+  if (is_open()) { close(0, 0); }
+}
+
+bool DataFlowTraceWriter::open(const std::string& filename, bool use_mmap) {
+  if (is_open()) { close(0, 0); }
+
+  fd_ = ::open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd_ < 0) {
+    HOLOSCAN_LOG_ERROR("Unable to open the data flow trace file '{}': {}",
+                       filename,
+                       std::strerror(errno));
+    return false;
+  }
+  filename_ = filename;
+  use_mmap_ = use_mmap;
+  num_records_ = 0;
+  operator_ids_.clear();
+  operator_names_.clear();
+  path_operator_ids_.clear();
+  path_ids_.clear();
+
+  // The header of a trace that is not closed yet (string_table_offset is 0)
+  DataFlowTraceHeader header{};
+  std::memcpy(header.magic, kDataFlowTraceMagic, sizeof(header.magic));
+  header.version = kDataFlowTraceVersion;
+  header.record_size = sizeof(DataFlowTraceRecord);
+  header.records_offset = sizeof(DataFlowTraceHeader);
+  if (!write_at(0, &header, sizeof(header))) {
+    ::close(fd_);
+    fd_ = -1;
+    return false;
+  }
+  file_size_ = sizeof(header);
+
+  if (use_mmap_) {
+    if (!map_window(0)) {
+      HOLOSCAN_LOG_WARN("Unable to memory-map the data flow trace file '{}', using buffered writes",
+                        filename_);
+      use_mmap_ = false;
+    }
+  }
+  if (!use_mmap_) {
+    buffer_.resize(kTraceBufferSize);
+    buffer_size_ = 0;
+  }
+  return true;
+}
+
+const std::vector<uint32_t>& DataFlowTraceWriter::path_operator_ids(
+    uint32_t path_id, const std::vector<std::string>& operator_names) {
+  if (path_id >= path_operator_ids_.size()) { path_operator_ids_.resize(path_id + 1); }
+  auto& operator_ids = path_operator_ids_[path_id];
+  if (operator_ids.empty() && !operator_names.empty()) {
+    operator_ids.reserve(operator_names.size());
+    for (const auto& name : operator_names) {
+      auto [it, inserted] =
+          operator_ids_.try_emplace(name, static_cast<uint32_t>(operator_names_.size()));
+      if (inserted) { operator_names_.push_back(name); }
+      operator_ids.push_back(it->second);
+    }
+    path_ids_.push_back(path_id);
+  }
+  return operator_ids;
+}
+
+void DataFlowTraceWriter::write(const DataFlowTraceRecord& record) {
+  if (!is_open()) { return; }
+
+  if (use_mmap_) {
+    if (file_size_ + sizeof(record) > window_offset_ + window_size_) {
+      // Move the window forward (keeping the offset aligned to the page size)
+      const auto page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+      if (!map_window(file_size_ - file_size_ % page_size)) {
+        HOLOSCAN_LOG_ERROR("Unable to memory-map the data flow trace file '{}': {}",
+                           filename_,
+                           std::strerror(errno));
+        return;
+      }
+    }
+    std::memcpy(window_ + (file_size_ - window_offset_), &record, sizeof(record));
+  } else {
+    if (buffer_size_ + sizeof(record) > buffer_.size()) { flush(); }
+    std::memcpy(buffer_.data() + buffer_size_, &record, sizeof(record));
+    buffer_size_ += sizeof(record);
+  }
+  file_size_ += sizeof(record);
+  ++num_records_;
+}
+
+void DataFlowTraceWriter::flush() {
+  if (!is_open() || use_mmap_ || buffer_size_ == 0) { return; }
+  write_at(file_size_ - buffer_size_, buffer_.data(), buffer_size_);
+  buffer_size_ = 0;
+}
+
+void DataFlowTraceWriter::close(uint64_t num_messages, uint64_t num_dropped_messages) {
+  if (!is_open()) { return; }
+
+  flush();
+  unmap_window();
+  // Remove the unused part of the last memory-mapped window
+  if (ftruncate(fd_, static_cast<off_t>(file_size_)) != 0) {
+    HOLOSCAN_LOG_ERROR("Unable to resize the data flow trace file '{}': {}",
+                       filename_,
+                       std::strerror(errno));
+  }
+
+  std::vector<char> string_table;
+  append_u32(string_table, static_cast<uint32_t>(operator_names_.size()));
+  for (const auto& name : operator_names_) {
+    append_u32(string_table, static_cast<uint32_t>(name.size()));
+    append(string_table, name.data(), name.size());
+  }
+  append_u32(string_table, static_cast<uint32_t>(path_ids_.size()));
+  for (auto path_id : path_ids_) {
+    const auto& operator_ids = path_operator_ids_[path_id];
+    append_u32(string_table, path_id);
+    append_u32(string_table, static_cast<uint32_t>(operator_ids.size()));
+    append(string_table, operator_ids.data(), operator_ids.size() * sizeof(uint32_t));
+  }
+
+  DataFlowTraceHeader header{};
+  std::memcpy(header.magic, kDataFlowTraceMagic, sizeof(header.magic));
+  header.version = kDataFlowTraceVersion;
+  header.record_size = sizeof(DataFlowTraceRecord);
+  header.records_offset = sizeof(DataFlowTraceHeader);
+  header.num_records = num_records_;
+  header.num_messages = num_messages;
+  header.num_dropped_messages = num_dropped_messages;
+  header.string_table_offset = file_size_;
+  header.string_table_size = string_table.size();
+  // Write the string table before the header refers to it
+  if (write_at(file_size_, string_table.data(), string_table.size())) {
+    write_at(0, &header, sizeof(header));
+  }
+
+  ::close(fd_);
+  fd_ = -1;
+  buffer_.clear();
+  buffer_.shrink_to_fit();
+}
+
+bool DataFlowTraceWriter::write_at(uint64_t offset, const void* data, size_t size) {
+  const auto* bytes = static_cast<const char*>(data);
+  while (size > 0) {
+    ssize_t written = pwrite(fd_, bytes, size, static_cast<off_t>(offset));
+    if (written < 0) {
+      if (errno == EINTR) { continue; }
+      HOLOSCAN_LOG_ERROR("Unable to write the data flow trace file '{}': {}",
+                         filename_,
+                         std::strerror(errno));
+      return false;
+    }
+    bytes += written;
+    offset += static_cast<uint64_t>(written);
+    size -= static_cast<size_t>(written);
+  }
+  return true;
+}
+
+bool DataFlowTraceWriter::map_window(uint64_t offset) {
+  unmap_window();
+  if (ftruncate(fd_, static_cast<off_t>(offset + kTraceWindowSize)) != 0) { return false; }
+  void* window = mmap(nullptr,
+                      kTraceWindowSize,
+                      PROT_READ | PROT_WRITE,
+                      MAP_SHARED,
+                      fd_,
+                      static_cast<off_t>(offset));
+  if (window == MAP_FAILED) { return false; }
+  window_ = static_cast<char*>(window);
+  window_offset_ = offset;
+  window_size_ = kTraceWindowSize;
+  return true;
+}
+
+void DataFlowTraceWriter::unmap_window() {
+  if (window_ != nullptr) {
+    munmap(window_, window_size_);
+    window_ = nullptr;
+    window_size_ = 0;
+  }
+}
+
+}  // namespace holoscan
@@ -16,45 +16,288 @@
  */
 
 #include <algorithm>
-#include <cassert>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "holoscan/core/app_driver.hpp"
 #include "holoscan/core/dataflow_tracker.hpp"
+#include "holoscan/core/operator.hpp"
 #include "holoscan/logger/logger.hpp"
 
 namespace holoscan {
 
+namespace {
+
+// The maximum number of paths and operators of a log entry stored in the log ring buffer. Larger
+// message labels are formatted by the calling thread.
+constexpr size_t kMaxLoggedPaths = 8;
+constexpr size_t kMaxLoggedOperators = 64;
+
+// The interval at which the log writer checks the ring buffer for new entries.
+constexpr auto kLogWriterPollInterval = std::chrono::milliseconds(10);
+
+// The maximum number of paths of a graph interned ahead of time. The number of paths of a graph
+// grows exponentially with the number of its branches, so they are not all enumerated.
+constexpr size_t kMaxNumGraphPaths = size_t{1} << 16;
+
+size_t round_up_to_power_of_two(size_t value) {
+  size_t result = 1;
+  while (result < value) { result <<= 1; }
+  return result;
+}
+
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+uint64_t hash_bytes(uint64_t hash, const char* data, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= kFnvPrime;
+  }
+  return hash;
+}
+
+// Add `value` to `sum` without locking.
+void atomic_add(std::atomic<double>& sum, double value) {
+  double current = sum.load(std::memory_order_relaxed);
+  while (!sum.compare_exchange_weak(current, current + value, std::memory_order_relaxed)) {}
+}
+
+// Update `max_value` and return true if `value` is the new (or equal to the) maximum.
+bool update_max(std::atomic<double>& max_value, double value) {
+  double current = max_value.load(std::memory_order_relaxed);
+  while (value > current) {
+    if (max_value.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return value == current;
+}
+
+// Update `min_value` and return true if `value` is the new (or equal to the) minimum.
+bool update_min(std::atomic<double>& min_value, double value) {
+  double current = min_value.load(std::memory_order_relaxed);
+  while (value < current) {
+    if (min_value.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return value == current;
+}
+
+// Get the paths of the table that have been updated, sorted by path name.
+std::vector<PathMetrics*> get_updated_paths(const std::atomic<PathMetrics*>* all_path_metrics,
+                                            size_t max_num_paths) {
+  std::vector<PathMetrics*> paths;
+  for (size_t i = 0; i < max_num_paths; ++i) {
+    auto path_metrics = all_path_metrics[i].load(std::memory_order_acquire);
+    if (path_metrics && path_metrics->is_updated.load(std::memory_order_relaxed)) {
+      paths.push_back(path_metrics);
+    }
+  }
+  std::sort(paths.begin(), paths.end(), [](const PathMetrics* a, const PathMetrics* b) {
+    return a->path < b->path;
+  });
+  return paths;
+}
+
+}  // namespace
+
+struct DataFlowTracker::LogRecord {
+  std::atomic<uint64_t> sequence{0};  ///< The position of the record in the ring buffer (+1 if set)
+  uint32_t num_paths = 0;
+  std::array<uint32_t, kMaxLoggedPaths> path_ids{};
+  std::array<int64_t, 2 * kMaxLoggedOperators> timestamps{};  ///< (receive, publish) pairs
+};
+
+PathMetrics::PathMetrics(std::string path, std::vector<std::string> operator_names,
+                         uint64_t num_last_messages_to_discard)
+    : path(std::move(path)),
+      operator_names(std::move(operator_names)),
+      latency_buffer_size_(num_last_messages_to_discard) {
+  if (latency_buffer_size_ > 0) {
+    latency_buffer_ = std::make_unique<std::atomic<double>[]>(latency_buffer_size_);
+  }
+}
+
+PathMetrics::~PathMetrics() {
+  for (auto& shard : shards_) { delete shard.load(std::memory_order_acquire); }
+}
+
 uint64_t PathMetrics::get_buffer_size() {
-  return latency_buffer.size();
+  return std::min(num_pushed_latencies_.load(std::memory_order_relaxed), latency_buffer_size_);
+}
+
+bool PathMetrics::push_latency(double latency, double& oldest_latency) {
+  if (latency_buffer_size_ == 0) {
+    oldest_latency = latency;
+    return true;
+  }
+  // The buffer is used as a circular buffer: the slot of this latency holds the latency that was
+  // pushed latency_buffer_size_ calls ago.
+  uint64_t index = num_pushed_latencies_.fetch_add(1, std::memory_order_relaxed);
+  double previous_latency =
+      latency_buffer_[index % latency_buffer_size_].exchange(latency, std::memory_order_relaxed);
+  if (index < latency_buffer_size_) { return false; }
+  oldest_latency = previous_latency;
+  return true;
+}
+
+void PathMetrics::record(double latency) {
+  auto& cur_shard = shard();
+  cur_shard.histogram.record(std::llround(latency * 1000.0));
+  atomic_add(cur_shard.latency_sum, latency);
+
+  const auto message_id =
+      static_cast<int64_t>(num_dst_messages_.fetch_add(1, std::memory_order_relaxed) + 1);
+  if (update_max(max_latency_, latency)) {
+    max_message_id_.store(message_id, std::memory_order_relaxed);
+  }
+  if (update_min(min_latency_, latency)) {
+    min_message_id_.store(message_id, std::memory_order_relaxed);
+  }
+}
+
+double PathMetrics::get_metric(DataFlowMetric metric) const {
+  switch (metric) {
+    case DataFlowMetric::kMaxMessageID:
+      return static_cast<double>(max_message_id_.load(std::memory_order_relaxed));
+    case DataFlowMetric::kMinMessageID:
+      return static_cast<double>(min_message_id_.load(std::memory_order_relaxed));
+    case DataFlowMetric::kMaxE2ELatency:
+      return max_latency_.load(std::memory_order_relaxed);
+    case DataFlowMetric::kMinE2ELatency:
+      return min_latency_.load(std::memory_order_relaxed);
+    case DataFlowMetric::kNumDstMessages:
+      return static_cast<double>(num_dst_messages_.load(std::memory_order_relaxed));
+    case DataFlowMetric::kAvgE2ELatency: {
+      uint64_t num_messages = num_dst_messages_.load(std::memory_order_relaxed);
+      if (num_messages == 0) { return 0; }
+      double latency_sum = 0;
+      for (auto& shard : shards_) {
+        auto cur_shard = shard.load(std::memory_order_acquire);
+        if (cur_shard) { latency_sum += cur_shard->latency_sum.load(std::memory_order_relaxed); }
+      }
+      return latency_sum / num_messages;
+    }
+    case DataFlowMetric::kP50E2ELatency:
+    case DataFlowMetric::kP99E2ELatency:
+    case DataFlowMetric::kP999E2ELatency: {
+      std::vector<uint64_t> counts;
+      for (auto& shard : shards_) {
+        auto cur_shard = shard.load(std::memory_order_acquire);
+        if (cur_shard) { cur_shard->histogram.add_to(counts); }
+      }
+      double percentile = 50.0;
+      if (metric == DataFlowMetric::kP99E2ELatency) {
+        percentile = 99.0;
+      } else if (metric == DataFlowMetric::kP999E2ELatency) {
+        percentile = 99.9;
+      }
+      return static_cast<double>(HdrHistogram::value_at_percentile(counts, percentile)) / 1000;
+    }
+    default:
+      return -1;
+  }
+}
+
+PathMetrics::Shard& PathMetrics::shard() {
+  static std::atomic<size_t> next_shard_index{0};
+  thread_local const size_t shard_index =
+      next_shard_index.fetch_add(1, std::memory_order_relaxed) % kNumShards;
+
+  auto& shard_ptr = shards_[shard_index];
+  Shard* cur_shard = shard_ptr.load(std::memory_order_acquire);
+  if (cur_shard) { return *cur_shard; }
+
+  auto new_shard = std::make_unique<Shard>();
+  if (shard_ptr.compare_exchange_strong(cur_shard, new_shard.get(), std::memory_order_acq_rel)) {
+    return *new_shard.release();
+  }
+  return *cur_shard;  // allocated concurrently by another thread
+}
+
+DataFlowTracker::DataFlowTracker() {
+  const int64_t max_num_paths =
+      AppDriver::get_int_env_var("HOLOSCAN_FLOW_TRACKING_MAX_PATHS",
+                                 static_cast<int64_t>(kDefaultMaxNumTrackedPaths));
+  reset_path_table(
+      round_up_to_power_of_two(static_cast<size_t>(std::max<int64_t>(1, max_num_paths))));
 }
 
 DataFlowTracker::~DataFlowTracker() {
   end_logging();
+  for (size_t i = 0; i < max_num_paths_; ++i) {
+    delete all_path_metrics_[i].load(std::memory_order_acquire);
+  }
+}
+
+void DataFlowTracker::reset_path_table(size_t max_num_paths) {
+  all_path_metrics_ = std::make_unique<std::atomic<PathMetrics*>[]>(max_num_paths);
+  max_num_paths_ = max_num_paths;
 }
 
 void DataFlowTracker::end_logging() {
-  if (!logger_ofstream_.is_open()) return;
+  is_file_logging_enabled_.store(false, std::memory_order_release);
 
-  // Write out the remaining messages from the log buffer and close ofstream
-  for (auto it : buffered_messages_) { logger_ofstream_ << it << "\n"; }
-  logger_ofstream_.close();
+  // Stop the log writer, which writes out the remaining messages from the log buffer
+  if (log_writer_thread_.joinable()) {
+    {
+      std::scoped_lock lock(log_writer_mutex_);
+      log_writer_stop_.store(true, std::memory_order_release);
+    }
+    log_writer_cv_.notify_all();
+    log_writer_thread_.join();
+  }
+  if (logger_ofstream_.is_open()) { logger_ofstream_.close(); }
+  if (trace_writer_.is_open()) {
+    const uint64_t num_dropped = num_dropped_log_entries_.load(std::memory_order_relaxed);
+    trace_writer_.close(logfile_messages_, num_dropped);
+    if (num_dropped > 0) {
+      HOLOSCAN_LOG_WARN("{} data flow tracking entries could not be written to the binary log '{}'",
+                        num_dropped,
+                        logger_filename_);
+    }
+  }
 }
 
 void DataFlowTracker::print() const {
+  static constexpr DataFlowMetric kPrintedMetrics[] = {DataFlowMetric::kMaxE2ELatency,
+                                                       DataFlowMetric::kMaxMessageID,
+                                                       DataFlowMetric::kAvgE2ELatency,
+                                                       DataFlowMetric::kMinE2ELatency,
+                                                       DataFlowMetric::kMinMessageID,
+                                                       DataFlowMetric::kP50E2ELatency,
+                                                       DataFlowMetric::kP99E2ELatency,
+                                                       DataFlowMetric::kP999E2ELatency,
+                                                       DataFlowMetric::kNumDstMessages};
+
+  auto paths = get_updated_paths(all_path_metrics_.get(), max_num_paths_);
   std::cout << "Data Flow Tracking Results:\n";
-  std::cout << "Total paths: " << all_path_metrics_.size() << "\n\n";
+  std::cout << "Total paths: " << paths.size() << "\n";
+  const uint64_t num_dropped_paths = get_num_dropped_paths();
+  if (num_dropped_paths > 0) {
+    std::cout << "Untracked paths: " << num_dropped_paths
+              << " (the path table is full, see HOLOSCAN_FLOW_TRACKING_MAX_PATHS)\n";
+  }
+  std::cout << "\n";
   int i = 0;
-  for (auto it : all_path_metrics_) {
-    std::cout << "Path " << ++i << ": " << it.first << "\n";
-    for (auto it2 : it.second->metrics) {
-      std::cout << metricToString.at(it2.first) << ": " << it2.second << "\n";
+  for (auto path_metrics : paths) {
+    std::cout << "Path " << ++i << ": " << path_metrics->path << "\n";
+    for (auto metric : kPrintedMetrics) {
+      std::cout << metricToString.at(metric) << ": " << path_metrics->get_metric(metric) << "\n";
     }
     std::cout << "\n";
   }
@@ -66,79 +309,198 @@ void DataFlowTracker::print() const {
   std::cout.flush();  // flush standard output; otherwise output may not be printed
 }
 
-void DataFlowTracker::update_latency(std::string pathstring, double current_latency) {
-  std::scoped_lock lock(all_path_metrics_mutex_);
-
-  if (all_path_metrics_.find(pathstring) == all_path_metrics_.end()) {
-    all_path_metrics_[pathstring] = std::make_shared<PathMetrics>();
-    all_path_metrics_[pathstring]->path = pathstring;
+void DataFlowTracker::add_graph_paths(OperatorGraph& graph) {
+  MessageLabel::TimestampedPath path;
+  size_t num_graph_paths = 0;
+
+  // Call `on_path` for each path from a root operator to a leaf operator (or to the operator
+  // closing a cycle), until kMaxNumGraphPaths paths are found.
+  auto for_each_path = [&](const std::function<void()>& on_path) {
+    num_graph_paths = 0;
+    std::function<void(const OperatorNodeType&)> add_paths_from = [&](const OperatorNodeType& op) {
+      if (num_graph_paths >= kMaxNumGraphPaths) { return; }
+      path.emplace_back(op.get(), 0, 0);
+      auto next_ops = graph.get_next_nodes(op);
+      if (next_ops.empty()) {
+        on_path();
+        ++num_graph_paths;
+      }
+      for (auto& next_op : next_ops) {
+        auto in_path = std::find_if(path.begin(), path.end(), [&next_op](const auto& label) {
+          return label.operator_ptr == next_op.get();
+        });
+        if (in_path == path.end()) {
+          add_paths_from(next_op);
+        } else if (num_graph_paths < kMaxNumGraphPaths) {
+          // A cyclic path ends with the operator that closes the cycle
+          path.emplace_back(next_op.get(), 0, 0);
+          on_path();
+          ++num_graph_paths;
+          path.pop_back();
+        }
+      }
+      path.pop_back();
+    };
+    for (auto& op : graph.get_nodes()) {
+      if (op->is_root() || op->is_user_defined_root()) { add_paths_from(op); }
+    }
+  };
+
+  // Size the table for the paths of the graph, keeping as many free entries for the paths that
+  // cannot be found in the graph. The table can only be replaced while it is empty, i.e., before
+  // the graph is run.
+  for_each_path([]() {});
+  const size_t min_num_paths = round_up_to_power_of_two(2 * num_graph_paths);
+  if (min_num_paths > max_num_paths_) {
+    if (num_interned_paths_.load(std::memory_order_acquire) == 0) {
+      reset_path_table(min_num_paths);
+    } else {
+      HOLOSCAN_LOG_WARN(
+          "DataFlowTracker: the path table ({} entries) cannot hold the {} paths of the graph",
+          max_num_paths_,
+          num_graph_paths);
+    }
   }
 
-  // If the current latency is less than the threshold, then skip this message from latency
-  // calculations
-  if (current_latency < latency_threshold_) {
-    // Do not track this message
-    return;
+  for_each_path([this, &path]() { path_id(path); });
+  HOLOSCAN_LOG_DEBUG("DataFlowTracker: {} paths interned from the graph (table size: {})",
+                     num_graph_paths,
+                     max_num_paths_);
+}
+
+template <typename MatchT>
+uint32_t DataFlowTracker::find_path(uint64_t hash, MatchT&& matches) const {
+  for (size_t i = 0; i < max_num_paths_; ++i) {
+    const size_t index = (hash + i) & (max_num_paths_ - 1);
+    auto path_metrics = all_path_metrics_[index].load(std::memory_order_acquire);
+    if (path_metrics == nullptr) { return kInvalidPathId; }
+    if (path_metrics->hash == hash && matches(*path_metrics)) {
+      return static_cast<uint32_t>(index);
+    }
   }
+  return kInvalidPathId;
+}
 
-  // For a path, if the number of skipped messages at the beginning is less than the
-  // num_start_messages_to_skip_, then do not track this message
-  if (all_path_metrics_[pathstring]->num_skipped_messages < num_start_messages_to_skip_) {
-    all_path_metrics_[pathstring]->num_skipped_messages++;
-    return;
+uint32_t DataFlowTracker::intern_path(uint64_t hash, std::string pathstring,
+                                      std::vector<std::string> operator_names) {
+  auto new_path_metrics = std::make_unique<PathMetrics>(
+      std::move(pathstring), std::move(operator_names), num_last_messages_to_discard_);
+  new_path_metrics->hash = hash;
+
+  for (size_t i = 0; i < max_num_paths_; ++i) {
+    const size_t index = (hash + i) & (max_num_paths_ - 1);
+    PathMetrics* path_metrics = nullptr;
+    if (all_path_metrics_[index].compare_exchange_strong(
+            path_metrics, new_path_metrics.get(), std::memory_order_acq_rel)) {
+      new_path_metrics.release();
+      num_interned_paths_.fetch_add(1, std::memory_order_acq_rel);
+      return static_cast<uint32_t>(index);
+    }
+    // The path may have been interned concurrently by another thread
+    if (path_metrics->hash == hash && path_metrics->path == new_path_metrics->path) {
+      return static_cast<uint32_t>(index);
+    }
   }
 
-  // Push the current latency to the buffer
-  all_path_metrics_[pathstring]->latency_buffer.push(current_latency);
+  std::scoped_lock lock(dropped_paths_mutex_);
+  if (dropped_paths_.insert(new_path_metrics->path).second && dropped_paths_.size() == 1) {
+    HOLOSCAN_LOG_ERROR(
+        "DataFlowTracker: unable to track more than {} paths (see "
+        "HOLOSCAN_FLOW_TRACKING_MAX_PATHS). Path '{}' and new paths are ignored.",
+        max_num_paths_,
+        new_path_metrics->path);
+  }
+  return kInvalidPathId;
+}
 
-  // If the size of the buffer in this path has exceeded the num_last_messages_to_discard_, then get
-  // the oldest element from the buffer and treat it as current latency
-  if (all_path_metrics_[pathstring]->get_buffer_size() > num_last_messages_to_discard_) {
-    // Get the oldest latency from the buffer
-    current_latency = all_path_metrics_[pathstring]->latency_buffer.front();
-    // Remove the oldest latency from the buffer
-    all_path_metrics_[pathstring]->latency_buffer.pop();
-    // Sanity check to make sure that the size of the buffer is equal to
-    // num_last_messages_to_discard_
-    assert(num_last_messages_to_discard_ == all_path_metrics_[pathstring]->get_buffer_size());
+uint32_t DataFlowTracker::path_id(const MessageLabel::TimestampedPath& path) {
+  if (path.empty()) { return kInvalidPathId; }
 
-    // Update Max E2E Latency
-    double prev_max_latency =
-        all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMaxE2ELatency];
+  // Hash the path name (comma-separated operator names) without building it
+  uint64_t hash = kFnvOffsetBasis;
+  for (size_t i = 0; i < path.size(); ++i) {
+    const auto& name = path[i].operator_name();
+    if (name.empty()) {
+      HOLOSCAN_LOG_ERROR("DataFlowTracker::path_id - Operator is not known");
+      return kInvalidPathId;
+    }
+    if (i > 0) { hash = hash_bytes(hash, ",", 1); }
+    hash = hash_bytes(hash, name.data(), name.size());
+  }
 
-    all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMaxE2ELatency] =
-        std::max(current_latency, prev_max_latency);
+  uint32_t id = find_path(hash, [&path](const PathMetrics& path_metrics) {
+    if (path_metrics.operator_names.size() != path.size()) { return false; }
+    for (size_t i = 0; i < path.size(); ++i) {
+      if (path_metrics.operator_names[i] != path[i].operator_name()) { return false; }
+    }
+    return true;
+  });
+  if (id != kInvalidPathId) { return id; }
+
+  std::vector<std::string> operator_names;
+  operator_names.reserve(path.size());
+  std::string pathstring;
+  for (const auto& label : path) {
+    if (!pathstring.empty()) { pathstring += ','; }
+    pathstring += label.operator_name();
+    operator_names.push_back(label.operator_name());
+  }
+  return intern_path(hash, std::move(pathstring), std::move(operator_names));
+}
 
-    // Update Min E2E Latency
-    double prev_min_latency =
-        all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMinE2ELatency];
+uint32_t DataFlowTracker::path_id(const std::string& pathstring) {
+  uint64_t hash = hash_bytes(kFnvOffsetBasis, pathstring.data(), pathstring.size());
+  uint32_t id = find_path(hash, [&pathstring](const PathMetrics& path_metrics) {
+    return path_metrics.path == pathstring;
+  });
+  if (id != kInvalidPathId) { return id; }
+
+  std::vector<std::string> operator_names;
+  size_t start = 0;
+  while (true) {
+    size_t end = pathstring.find(',', start);
+    operator_names.push_back(pathstring.substr(start, end - start));
+    if (end == std::string::npos) { break; }
+    start = end + 1;
+  }
+  return intern_path(hash, pathstring, std::move(operator_names));
+}
 
-    all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMinE2ELatency] =
-        std::min(current_latency, prev_min_latency);
+void DataFlowTracker::update_latency(std::string pathstring, double current_latency) {
+  update_latency(path_id(pathstring), current_latency);
+}
 
-    // Calculate the average latency from total messages and avg latency till now
-    auto tmp_avg_lat = all_path_metrics_[pathstring]->metrics[DataFlowMetric::kAvgE2ELatency];
+void DataFlowTracker::update_latency(uint32_t path_id, double current_latency) {
+  if (path_id >= max_num_paths_) { return; }
+  auto path_metrics = all_path_metrics_[path_id].load(std::memory_order_acquire);
+  if (!path_metrics) { return; }
 
-    auto tmp_tot_messages = all_path_metrics_[pathstring]->metrics[DataFlowMetric::kNumDstMessages];
+  if (!path_metrics->is_updated.load(std::memory_order_relaxed)) {
+    path_metrics->is_updated.store(true, std::memory_order_relaxed);
+  }
 
-    all_path_metrics_[pathstring]->metrics[DataFlowMetric::kAvgE2ELatency] =
-        (tmp_avg_lat * tmp_tot_messages + current_latency) / (tmp_tot_messages + 1);
+  // If the current latency is less than the threshold, then skip this message from latency
+  // calculations
+  if (current_latency < latency_threshold_) {
+    // Do not track this message
+    return;
+  }
 
-    // Update total number of messages
-    all_path_metrics_[pathstring]->metrics[DataFlowMetric::kNumDstMessages] += 1;
+  // For a path, if the number of skipped messages at the beginning is less than the
+  // num_start_messages_to_skip_, then do not track this message
+  if (path_metrics->num_skipped_messages.load(std::memory_order_relaxed) <
+          num_start_messages_to_skip_ &&
+      path_metrics->num_skipped_messages.fetch_add(1, std::memory_order_relaxed) <
+          num_start_messages_to_skip_) {
+    return;
+  }
 
-    // Update kMaxMessageID
-    if (all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMaxE2ELatency] == current_latency) {
-      all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMaxMessageID] =
-          all_path_metrics_[pathstring]->metrics[DataFlowMetric::kNumDstMessages];
-    }
+  // Hold back the last num_last_messages_to_discard_ latencies: the latency that is recorded is
+  // the oldest one of the buffer, once the buffer is full.
+  double oldest_latency = current_latency;
+  if (!path_metrics->push_latency(current_latency, oldest_latency)) { return; }
 
-    // Update kMinMessageID
-    if (all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMinE2ELatency] == current_latency) {
-      all_path_metrics_[pathstring]->metrics[DataFlowMetric::kMinMessageID] =
-          all_path_metrics_[pathstring]->metrics[DataFlowMetric::kNumDstMessages];
-    }
-  }
+  path_metrics->record(oldest_latency);
 }
 
 void DataFlowTracker::update_source_messages_number(std::string source, uint64_t num) {
@@ -147,13 +509,19 @@ void DataFlowTracker::update_source_messages_number(std::string source, uint64_t
 }
 
 int DataFlowTracker::get_num_paths() {
-  return all_path_metrics_.size();
+  return get_updated_paths(all_path_metrics_.get(), max_num_paths_).size();
+}
+
+uint64_t DataFlowTracker::get_num_dropped_paths() const {
+  std::scoped_lock lock(dropped_paths_mutex_);
+  return dropped_paths_.size();
 }
 
 std::vector<std::string> DataFlowTracker::get_path_strings() {
   std::vector<std::string> all_pathstrings;
-  all_pathstrings.reserve(all_path_metrics_.size());
-  for (auto it : all_path_metrics_) { all_pathstrings.push_back(it.first); }
+  for (auto path_metrics : get_updated_paths(all_path_metrics_.get(), max_num_paths_)) {
+    all_pathstrings.push_back(path_metrics->path);
+  }
   return all_pathstrings;
 }
 
@@ -161,13 +529,20 @@ double DataFlowTracker::get_metric(std::string pathstring, holoscan::DataFlowMet
   if (metric == DataFlowMetric::kNumSrcMessages) {
     HOLOSCAN_LOG_ERROR("metric with pathstring must not be DataFlowMetric::kNumSrcMessages");
     return -1;
-  } else if (all_path_metrics_.find(pathstring) == all_path_metrics_.end()) {
+  }
+  uint64_t hash = hash_bytes(kFnvOffsetBasis, pathstring.data(), pathstring.size());
+  uint32_t id = find_path(hash, [&pathstring](const PathMetrics& path_metrics) {
+    return path_metrics.path == pathstring;
+  });
+  auto path_metrics =
+      id != kInvalidPathId ? all_path_metrics_[id].load(std::memory_order_acquire) : nullptr;
+  if (!path_metrics || !path_metrics->is_updated.load(std::memory_order_relaxed)) {
     HOLOSCAN_LOG_ERROR(
         "pathstring not found. make sure messages are not skipped at the beginning or end or with "
         "set_skip_latencies.");
     return -1;
   }
-  return all_path_metrics_[pathstring]->metrics[metric];
+  return path_metrics->get_metric(metric);
 }
 
 std::map<std::string, uint64_t> DataFlowTracker::get_metric(holoscan::DataFlowMetric metric) {
@@ -182,29 +557,255 @@ void DataFlowTracker::set_skip_latencies(int threshold) {
   latency_threshold_ = threshold;
 }
 
-void DataFlowTracker::enable_logging(std::string filename, uint64_t num_buffered_messages) {
-  is_file_logging_enabled_ = true;
+void DataFlowTracker::enable_logging(std::string filename, uint64_t num_buffered_messages,
+                                     DataFlowLogFormat log_format, bool use_mmap) {
+  // Stop the log writer of a previous call
+  end_logging();
+
   this->num_buffered_messages_ = num_buffered_messages;
   logger_filename_ = filename;
-  buffered_messages_.reserve(this->num_buffered_messages_);
   logfile_messages_ = 0;
+  log_format_ = log_format;
+  use_mmap_ = use_mmap;
+  num_dropped_log_entries_.store(0, std::memory_order_relaxed);
+
+  // The capacity of the ring buffer is a power of two
+  uint64_t capacity = 2;
+  while (capacity < num_buffered_messages_) { capacity <<= 1; }
+  log_records_ = std::make_unique<LogRecord[]>(capacity);
+  for (uint64_t i = 0; i < capacity; ++i) {
+    log_records_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  log_records_mask_ = capacity - 1;
+  log_enqueue_pos_.store(0, std::memory_order_relaxed);
+  log_dequeue_pos_ = 0;
+
+  log_writer_stop_.store(false, std::memory_order_relaxed);
+  log_writer_thread_ = std::thread(&DataFlowTracker::run_log_writer, this);
+  is_file_logging_enabled_.store(true, std::memory_order_release);
 }
 
 void DataFlowTracker::write_to_logfile(std::string text) {
-  if (!text.empty() && is_file_logging_enabled_) {
+  if (!text.empty() && is_file_logging_enabled_.load(std::memory_order_acquire)) {
+    if (log_format_ == DataFlowLogFormat::kBinary) {
+      // Free text cannot be stored in the binary trace
+      num_dropped_log_entries_.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    std::scoped_lock lock(buffered_messages_mutex_);
+    buffered_messages_.push_back(std::move(text));
+  }
+}
+
+void DataFlowTracker::write_to_logfile(const MessageLabel& label) {
+  if (!is_file_logging_enabled_.load(std::memory_order_acquire)) { return; }
+
+  const size_t num_paths = label.num_paths();
+  std::array<const MessageLabel::TimestampedPath*, kMaxLoggedPaths> paths;
+  if (num_paths > kMaxLoggedPaths) {
+    if (log_format_ == DataFlowLogFormat::kBinary) {
+      std::vector<const MessageLabel::TimestampedPath*> all_paths(num_paths);
+      for (size_t i = 0; i < num_paths; ++i) { all_paths[i] = &label.get_path(i); }
+      enqueue_log_record(all_paths.data(), num_paths);
+    } else {
+      write_to_logfile(label.to_string());
+    }
+    return;
+  }
+  for (size_t i = 0; i < num_paths; ++i) { paths[i] = &label.get_path(i); }
+  enqueue_log_record(paths.data(), num_paths);
+}
+
+void DataFlowTracker::write_to_logfile(const MessageLabel::TimestampedPath& path) {
+  if (!is_file_logging_enabled_.load(std::memory_order_acquire)) { return; }
+
+  const MessageLabel::TimestampedPath* paths[] = {&path};
+  enqueue_log_record(paths, 1);
+}
+
+void DataFlowTracker::enqueue_log_record(const MessageLabel::TimestampedPath* const* paths,
+                                         size_t num_paths) {
+  if (num_paths == 0) { return; }
+
+  std::array<uint32_t, kMaxLoggedPaths> path_ids;
+  size_t num_operators = 0;
+  bool fits_in_record = num_paths <= kMaxLoggedPaths;
+  for (size_t i = 0; i < num_paths && fits_in_record; ++i) {
+    path_ids[i] = path_id(*paths[i]);
+    num_operators += paths[i]->size();
+    fits_in_record = path_ids[i] != kInvalidPathId && num_operators <= kMaxLoggedOperators;
+  }
+
+  if (fits_in_record) {
+    // Claim a record of the ring buffer (bounded MPSC queue)
+    uint64_t pos = log_enqueue_pos_.load(std::memory_order_relaxed);
+    LogRecord* record = nullptr;
+    while (true) {
+      LogRecord& cur_record = log_records_[pos & log_records_mask_];
+      uint64_t sequence = cur_record.sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+      if (diff == 0) {
+        if (log_enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          record = &cur_record;
+          break;
+        }
+      } else if (diff < 0) {
+        break;  // the ring buffer is full
+      } else {
+        pos = log_enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+
+    if (record) {
+      record->num_paths = static_cast<uint32_t>(num_paths);
+      size_t timestamp_index = 0;
+      for (size_t i = 0; i < num_paths; ++i) {
+        record->path_ids[i] = path_ids[i];
+        for (const auto& label : *paths[i]) {
+          record->timestamps[timestamp_index++] = label.rec_timestamp;
+          record->timestamps[timestamp_index++] = label.pub_timestamp;
+        }
+      }
+      record->sequence.store(pos + 1, std::memory_order_release);
+      return;
+    }
+  }
+
+  if (log_format_ == DataFlowLogFormat::kBinary) {
+    // The entry does not fit in the ring buffer: copy it to the buffered entries
+    std::vector<uint32_t> entry_path_ids(num_paths);
+    std::vector<int64_t> timestamps;
+    for (size_t i = 0; i < num_paths; ++i) {
+      entry_path_ids[i] = path_id(*paths[i]);
+      if (entry_path_ids[i] == kInvalidPathId) {
+        num_dropped_log_entries_.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      for (const auto& label : *paths[i]) {
+        timestamps.push_back(label.rec_timestamp);
+        timestamps.push_back(label.pub_timestamp);
+      }
+    }
+    std::scoped_lock lock(buffered_messages_mutex_);
+    buffered_entries_.emplace_back(std::move(entry_path_ids), std::move(timestamps));
+    return;
+  }
+
+  // The entry does not fit in the ring buffer: format it here
+  std::string text;
+  for (size_t i = 0; i < num_paths; ++i) { text += MessageLabel::to_string(*paths[i]); }
+  write_to_logfile(std::move(text));
+}
+
+size_t DataFlowTracker::drain_log_records() {
+  size_t num_written = 0;
+  const bool is_binary = log_format_ == DataFlowLogFormat::kBinary;
+  auto open_logfile = [this]() {
     if (!logger_ofstream_.is_open()) { logger_ofstream_.open(logger_filename_); }
-    buffered_messages_mutex_.lock();
-    buffered_messages_.push_back(std::to_string(++logfile_messages_) + ":\n" + text);
-    // When the vector's size is equal to buffered number of messages,
-    // flush out the buffer to file
-    // and clear the vector to re-reserve the memory
-    if (buffered_messages_.size() == num_buffered_messages_) {
-      for (auto it : buffered_messages_) { logger_ofstream_ << it << "\n"; }
-      logger_ofstream_ << std::flush;
-      buffered_messages_.clear();
-      buffered_messages_.reserve(num_buffered_messages_);
-    }
-    buffered_messages_mutex_.unlock();
+  };
+  // Open the binary log file, or disable the logging if it cannot be opened
+  auto open_trace = [this]() {
+    if (trace_writer_.is_open()) { return true; }
+    if (trace_writer_.open(logger_filename_, use_mmap_)) { return true; }
+    is_file_logging_enabled_.store(false, std::memory_order_release);
+    num_dropped_log_entries_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  };
+
+  std::vector<std::string> texts;
+  std::vector<std::pair<std::vector<uint32_t>, std::vector<int64_t>>> entries;
+  {
+    std::scoped_lock lock(buffered_messages_mutex_);
+    texts.swap(buffered_messages_);
+    entries.swap(buffered_entries_);
+  }
+  for (const auto& text : texts) {
+    open_logfile();
+    logger_ofstream_ << ++logfile_messages_ << ":\n" << text << "\n";
+    ++num_written;
+  }
+  for (const auto& [path_ids, timestamps] : entries) {
+    if (open_trace()) {
+      write_trace_entry(static_cast<uint32_t>(path_ids.size()), path_ids.data(), timestamps.data());
+    }
+    ++num_written;
+  }
+
+  while (log_records_) {
+    LogRecord& record = log_records_[log_dequeue_pos_ & log_records_mask_];
+    if (record.sequence.load(std::memory_order_acquire) != log_dequeue_pos_ + 1) { break; }
+
+    if (is_binary) {
+      if (open_trace()) {
+        write_trace_entry(record.num_paths, record.path_ids.data(), record.timestamps.data());
+      }
+    } else {
+      // Same format as MessageLabel::to_string()
+      open_logfile();
+      logger_ofstream_ << ++logfile_messages_ << ":\n";
+      size_t timestamp_index = 0;
+      for (uint32_t i = 0; i < record.num_paths; ++i) {
+        auto path_metrics = all_path_metrics_[record.path_ids[i]].load(std::memory_order_acquire);
+        const auto& operator_names = path_metrics->operator_names;
+        for (size_t j = 0; j < operator_names.size(); ++j) {
+          if (j > 0) { logger_ofstream_ << " -> "; }
+          logger_ofstream_ << "(" << operator_names[j] << ","
+                           << record.timestamps[timestamp_index] << ","
+                           << record.timestamps[timestamp_index + 1] << ")";
+          timestamp_index += 2;
+        }
+        logger_ofstream_ << "\n";
+      }
+      logger_ofstream_ << "\n";
+    }
+
+    record.sequence.store(log_dequeue_pos_ + log_records_mask_ + 1, std::memory_order_release);
+    ++log_dequeue_pos_;
+    ++num_written;
+  }
+  return num_written;
+}
+
+void DataFlowTracker::write_trace_entry(uint32_t num_paths, const uint32_t* path_ids,
+                                        const int64_t* timestamps) {
+  DataFlowTraceRecord record{};
+  record.message_index = ++logfile_messages_;
+  size_t timestamp_index = 0;
+  for (uint32_t i = 0; i < num_paths; ++i) {
+    auto path_metrics = all_path_metrics_[path_ids[i]].load(std::memory_order_acquire);
+    const auto& operator_ids =
+        trace_writer_.path_operator_ids(path_ids[i], path_metrics->operator_names);
+    record.path_id = path_ids[i];
+    record.path_index = static_cast<uint16_t>(i);
+    for (size_t j = 0; j < operator_ids.size(); ++j) {
+      record.operator_id = operator_ids[j];
+      record.operator_index = static_cast<uint16_t>(j);
+      record.receive_timestamp = timestamps[timestamp_index++];
+      record.publish_timestamp = timestamps[timestamp_index++];
+      trace_writer_.write(record);
+    }
+  }
+}
+
+void DataFlowTracker::flush_logfile() {
+  if (drain_log_records() == 0) { return; }
+  if (log_format_ == DataFlowLogFormat::kBinary) {
+    trace_writer_.flush();
+  } else {
+    logger_ofstream_ << std::flush;
+  }
+}
+
+void DataFlowTracker::run_log_writer() {
+  while (true) {
+    const bool stop = log_writer_stop_.load(std::memory_order_acquire);
+    flush_logfile();
+    if (stop) { break; }
+
+    std::unique_lock lock(log_writer_mutex_);
+    log_writer_cv_.wait_for(lock, kLogWriterPollInterval, [this]() {
+      return log_writer_stop_.load(std::memory_order_acquire);
+    });
   }
 }
 
@@ -38,6 +38,7 @@
 #include "holoscan/core/application.hpp"
 #include "holoscan/core/arg.hpp"
 #include "holoscan/core/condition.hpp"
+#include "holoscan/core/conditions/gxf/batch_message_available.hpp"
 #include "holoscan/core/conditions/gxf/downstream_affordable.hpp"
 #include "holoscan/core/conditions/gxf/message_available.hpp"
 #include "holoscan/core/config.hpp"
@@ -46,6 +47,8 @@
 #include "holoscan/core/fragment.hpp"
 #include "holoscan/core/graph.hpp"
 #include "holoscan/core/graphs/flow_graph.hpp"
+#include "holoscan/core/gxf/batch_flush_scheduling_term.hpp"
+#include "holoscan/core/gxf/batch_message_available_scheduling_term.hpp"
 #include "holoscan/core/gxf/entity.hpp"
 #include "holoscan/core/gxf/gxf_extension_registrar.hpp"
 #include "holoscan/core/gxf/gxf_network_context.hpp"
@@ -54,6 +57,8 @@
 #include "holoscan/core/gxf/gxf_scheduler.hpp"
 #include "holoscan/core/gxf/gxf_utils.hpp"
 #include "holoscan/core/gxf/gxf_wrapper.hpp"
+#include "holoscan/core/gxf/spsc_ring_receiver.hpp"
+#include "holoscan/core/gxf/work_stealing_scheduler.hpp"
 #include "holoscan/core/message.hpp"
 #include "holoscan/core/messagelabel.hpp"
 #include "holoscan/core/operator.hpp"
@@ -64,6 +69,7 @@
 #include "holoscan/core/resources/gxf/double_buffer_receiver.hpp"
 #include "holoscan/core/resources/gxf/double_buffer_transmitter.hpp"
 #include "holoscan/core/services/common/forward_op.hpp"
+#include "holoscan/core/services/common/shm_transport_op.hpp"
 #include "holoscan/core/services/common/virtual_operator.hpp"
 #include "holoscan/core/signal_handler.hpp"
 
@@ -494,6 +500,9 @@ void GXFExecutor::create_input_port(Fragment* fragment, gxf_context_t gxf_contex
           std::dynamic_pointer_cast<DoubleBufferReceiver>(rx_resource)->track();
         }
         break;
+      case IOSpec::ConnectorType::kSpscRing:
+        rx_resource = std::dynamic_pointer_cast<Receiver>(io_spec->connector());
+        break;
       case IOSpec::ConnectorType::kUCX:
         rx_resource = std::dynamic_pointer_cast<Receiver>(io_spec->connector());
         if (fragment->data_flow_tracker()) {
@@ -579,6 +588,21 @@ void GXFExecutor::create_input_port(Fragment* fragment, gxf_context_t gxf_contex
         message_available_condition->add_to_graph_entity(op);
         break;
       }
+      case ConditionType::kBatchMessageAvailable: {
+        std::shared_ptr<BatchMessageAvailableCondition> batch_condition =
+            std::dynamic_pointer_cast<BatchMessageAvailableCondition>(condition);
+        std::string cond_name =
+            fmt::format("__{}_{}_cond_{}", op->name(), rx_name, condition_index);
+        batch_condition->receiver(connector);
+        batch_condition->name(cond_name);
+        batch_condition->fragment(fragment);
+        auto rx_condition_spec = std::make_shared<ComponentSpec>(fragment);
+        batch_condition->setup(*rx_condition_spec);
+        batch_condition->spec(std::move(rx_condition_spec));
+        // Add to the same entity as the operator and initialize
+        batch_condition->add_to_graph_entity(op);
+        break;
+      }
       case ConditionType::kNone:
         // No condition
         break;
@@ -686,7 +710,8 @@ void GXFExecutor::create_output_port(Fragment* fragment, gxf_context_t gxf_conte
 
   if (fragment->data_flow_tracker()) {
     if ((tx_type != IOSpec::ConnectorType::kDefault) &&
-        (tx_type != IOSpec::ConnectorType::kDoubleBuffer)) {
+        (tx_type != IOSpec::ConnectorType::kDoubleBuffer) &&
+        (tx_type != IOSpec::ConnectorType::kSpscRing)) {
       throw std::runtime_error(
           "Currently the data flow tracking feature requires ConnectorType::kDefault or "
           "ConnectorType::kDoubleBuffer.");
@@ -719,6 +744,7 @@ void GXFExecutor::create_output_port(Fragment* fragment, gxf_context_t gxf_conte
         }
         break;
       case IOSpec::ConnectorType::kDoubleBuffer:
+      case IOSpec::ConnectorType::kSpscRing:  // a double buffer transmitter is used
         tx_resource = std::dynamic_pointer_cast<Transmitter>(io_spec->connector());
         if (fragment->data_flow_tracker()) {
           std::dynamic_pointer_cast<DoubleBufferTransmitter>(tx_resource)->track();
@@ -747,6 +773,7 @@ void GXFExecutor::create_output_port(Fragment* fragment, gxf_context_t gxf_conte
       switch (tx_type) {
         case IOSpec::ConnectorType::kDefault:
         case IOSpec::ConnectorType::kDoubleBuffer:
+        case IOSpec::ConnectorType::kSpscRing:
           dbl_ptr = reinterpret_cast<holoscan::AnnotatedDoubleBufferTransmitter*>(
               tx_resource->gxf_cptr());
           dbl_ptr->op(op);
@@ -842,6 +869,57 @@ ConnectionMapType generate_connection_map(
   return connection_map;
 }
 
+/**
+ * @brief Get the name of an operator inserted in front of the input port `port_name` of `op`.
+ *
+ * If we cannot find the port_name in the op's input, it means that the port name is the parameter
+ * name and the parameter type is 'std::vector<holoscan::IOSpec*>'. In this case, the index of the
+ * next input port ('<port name>:<index>') is appended to avoid name conflicts.
+ */
+std::string input_operator_name(const std::string& prefix,
+                                const holoscan::OperatorGraph::NodeType& op,
+                                const std::string& port_name) {
+  auto op_spec = op->spec();
+  auto& op_spec_inputs = op_spec->inputs();
+  if (op_spec_inputs.find(port_name) != op_spec_inputs.end()) {
+    return fmt::format("{}_{}_{}", prefix, op->name(), port_name);
+  }
+
+  size_t param_index = 0;
+  auto& op_params = op_spec->params();
+  const std::any& any_value = op_params[port_name].value();
+  auto& param = *std::any_cast<Parameter<std::vector<holoscan::IOSpec*>>*>(any_value);
+  auto iospec_vector = param.try_get();
+  if (iospec_vector != std::nullopt) { param_index = iospec_vector.value().size(); }
+  return fmt::format("{}_{}_{}:{}", prefix, op->name(), port_name, param_index);
+}
+
+/**
+ * @brief Connect `op.port_name` to a shared memory transmitter or receiver operator.
+ *
+ * Used for connections with IOSpec::ConnectorType::kSharedMemory (fragments running on the same
+ * host, see AppDriver::correct_connection_map()). No virtual operator is needed because the
+ * shared memory operators are regular operators of the fragment.
+ */
+void create_shm_operator_and_connection(Fragment* fragment,
+                                        const holoscan::OperatorGraph::NodeType& op,
+                                        const std::string& port_name,
+                                        const std::shared_ptr<holoscan::ConnectionItem>& connection,
+                                        int connection_index) {
+  if (connection->io_type == IOSpec::IOType::kOutput) {
+    auto shm_tx = fragment->make_operator<ops::ShmTransmitterOp>(
+        fmt::format("shm_tx_{}_{}_{}", op->name(), port_name, connection_index),
+        connection->args);
+    // Connect op.port_name to shm_tx.in
+    fragment->add_flow(op, shm_tx, {{port_name, "in"}});
+  } else {
+    auto shm_rx = fragment->make_operator<ops::ShmReceiverOp>(
+        input_operator_name("shm_rx", op, port_name), connection->args);
+    // Connect shm_rx.out to op.port_name
+    fragment->add_flow(shm_rx, op, {{"out", port_name}});
+  }
+}
+
 /**
  * @brief Populate virtual_ops vector and add corresponding connections to fragment.
  *
@@ -872,6 +950,11 @@ void create_virtual_operators_and_connections(
     for (auto& [port_name, connections] : port_map) {
       int connection_index = 0;
       for (auto& connection : connections) {
+        if (connection->connector_type == IOSpec::ConnectorType::kSharedMemory) {
+          create_shm_operator_and_connection(
+              fragment, op, port_name, connection, connection_index++);
+          continue;
+        }
         auto io_type = connection->io_type;
 
         std::shared_ptr<ops::VirtualOperator> virtual_op;
@@ -904,31 +987,8 @@ void create_virtual_operators_and_connections(
           // Connect op.port_name to virtual_op.port_name
           fragment->add_flow(op, virtual_op, {{port_name, port_name}});
         } else {
-          int param_index = -1;
-          // If we cannot find the port_name in the op's input, it means that
-          // the port name is the parameter name and the parameter type is
-          // 'std::vector<holoscan::IOSpec*>'.
-          // In this case, we need to use the indexed input port name to avoid
-          // name conflict ('<port name>:<index>').
-          auto op_spec = op->spec();
-          auto& op_spec_inputs = op_spec->inputs();
-          if (op_spec_inputs.find(port_name) == op_spec_inputs.end()) {
-            auto& op_params = op_spec->params();
-            const std::any& any_value = op_params[port_name].value();
-            auto& param = *std::any_cast<Parameter<std::vector<holoscan::IOSpec*>>*>(any_value);
-            auto iospec_vector = param.try_get();
-            if (iospec_vector == std::nullopt) {
-              param_index = 0;
-            } else {
-              param_index = iospec_vector.value().size();
-            }
-          }
-
           // Create and insert a forward operator to connect virtual_op.port_name to op.port_name
-          const std::string forward_op_name =
-              param_index == -1
-                  ? fmt::format("forward_{}_{}", op->name(), port_name)
-                  : fmt::format("forward_{}_{}:{}", op->name(), port_name, param_index);
+          const std::string forward_op_name = input_operator_name("forward", op, port_name);
           auto forward_op = fragment->make_operator<ops::ForwardOp>(forward_op_name);
           auto& in_spec =
               forward_op->spec()->inputs()["in"];  // get the input spec of the forward op
@@ -1049,7 +1109,8 @@ void GXFExecutor::connect_broadcast_to_previous_op(
         // Create a transmitter based on the prev_connector_type.
         switch (prev_connector_type) {
           case IOSpec::ConnectorType::kDefault:
-          case IOSpec::ConnectorType::kDoubleBuffer: {
+          case IOSpec::ConnectorType::kDoubleBuffer:
+          case IOSpec::ConnectorType::kSpscRing: {
             // We don't create a AnnotatedDoubleBufferTransmitter even if DFFT is on because
             // we don't want to annotate a message at the Broadcast component.
 
@@ -1235,6 +1296,7 @@ void GXFExecutor::create_broadcast_components(holoscan::OperatorGraph::NodeType
       switch (connector_type) {
         case IOSpec::ConnectorType::kDefault:
         case IOSpec::ConnectorType::kDoubleBuffer:
+        case IOSpec::ConnectorType::kSpscRing:
         case IOSpec::ConnectorType::kUCX:  // In any case, need to add doubleBufferReceiver.
         {
           // We don't create a holoscan::AnnotatedDoubleBufferReceiver even if data flow
@@ -1606,6 +1668,16 @@ bool GXFExecutor::initialize_operator(Operator* op) {
 
   // Set any parameters based on the specified arguments and parameter value defaults.
   op->set_parameters();
+
+  if (fragment()->is_operator_stats_enabled()) {
+    std::vector<std::string> input_names;
+    std::vector<std::string> output_names;
+    for (const auto& [name, _] : inputs) { input_names.push_back(name); }
+    for (const auto& [name, _] : outputs) { output_names.push_back(name); }
+    std::sort(input_names.begin(), input_names.end());
+    std::sort(output_names.begin(), output_names.end());
+    op->execution_stats_ = std::make_shared<OperatorStats>(op->name(), input_names, output_names);
+  }
   return true;
 }
 
@@ -1704,6 +1776,15 @@ bool GXFExecutor::initialize_gxf_graph(OperatorGraph& graph) {
     auto scheduler = std::dynamic_pointer_cast<gxf::GXFScheduler>(fragment_->scheduler());
     scheduler->initialize();  // will call GXFExecutor::initialize_scheduler
 
+    // Collect the operator statistics if enabled for the fragment, its application or through the
+    // environment
+    auto app = fragment_->application();
+    if (AppDriver::get_bool_env_var("HOLOSCAN_OPERATOR_STATS")) {
+      fragment_->enable_operator_stats();
+    } else if (app && app != fragment_ && app->is_operator_stats_enabled()) {
+      fragment_->enable_operator_stats(static_cast<Fragment*>(app)->print_operator_stats_);
+    }
+
     // Initialize the fragment and its operators
     if (!initialize_fragment()) {
       HOLOSCAN_LOG_ERROR("Failed to initialize fragment");
@@ -1728,6 +1809,9 @@ bool GXFExecutor::initialize_gxf_graph(OperatorGraph& graph) {
           dfft_collector_ptr->add_root_op(op.get());
         }
       }
+
+      // Intern the paths of the graph so that they are not created while the graph is running
+      fragment_->data_flow_tracker()->add_graph_paths(graph);
     }
 
     // network context initialization after connection entities were created (see GXF's program.cpp)
@@ -1886,6 +1970,12 @@ void GXFExecutor::run_gxf_graph() {
   // TODO: do we want to move the log level of these info messages to debug?
   HOLOSCAN_LOG_INFO("{}Graph execution finished.", frag_name_display);
 
+  if (fragment_->print_operator_stats_) {
+    HOLOSCAN_LOG_INFO("{}Operator statistics:\n{}",
+                      frag_name_display,
+                      OperatorStats::format(fragment_->Fragment::operator_stats()));
+  }
+
   // clean up any shared pointers to graph entities within operators, scheulder, network context
   fragment_->reset_graph_entities();
 
@@ -1963,6 +2053,23 @@ void GXFExecutor::register_extensions() {
     extension_factory.add_component<holoscan::DFFTCollector, nvidia::gxf::Monitor>(
         "Holoscan's DFFTCollector based on Monitor", {0xe6f50ca5cad74469, 0xad868076daf2c923});
 
+    extension_factory.add_component<holoscan::gxf::WorkStealingScheduler, nvidia::gxf::Scheduler>(
+        "Holoscan's work-stealing scheduler", {0x5b2e8c1f47a94d3e, 0x9c61f0d2a83b7e45});
+
+    extension_factory.add_component<holoscan::gxf::BatchMessageAvailableSchedulingTerm,
+                                    nvidia::gxf::SchedulingTerm>(
+        "Holoscan's scheduling term batching messages by count or time",
+        {0x8d3f5a2c61e04b97, 0xa4c2e1b0f7d95386});
+
+    extension_factory.add_component<holoscan::gxf::BatchFlushSchedulingTerm,
+                                    nvidia::gxf::SchedulingTerm>(
+        "Holoscan's scheduling term flushing the batches of a multi-receiver operator",
+        {0x2f7c9e41b8a05d63, 0x91d4a6e3c05b8f27});
+
+    extension_factory.add_component<holoscan::gxf::SpscRingReceiver, nvidia::gxf::Receiver>(
+        "Holoscan's lock-free single-producer/single-consumer ring receiver",
+        {0x3e7a9c5b12d84f60, 0xb8f1d6e2a4c07935});
+
     nvidia::gxf::Extension* extension_ptr = nullptr;
     if (!extension_factory.register_extension(&extension_ptr)) {
       HOLOSCAN_LOG_ERROR("Failed to register Holoscan SDK internal extension");
@@ -479,6 +479,20 @@ holoscan::DataFlowTracker& Fragment::track(uint64_t num_start_messages_to_skip,
   return *data_flow_tracker_;
 }
 
+void Fragment::enable_operator_stats(bool print_on_exit) {
+  operator_stats_enabled_ = true;
+  print_operator_stats_ = print_on_exit;
+}
+
+std::vector<OperatorStatsSnapshot> Fragment::operator_stats() {
+  std::vector<OperatorStatsSnapshot> stats;
+  if (!graph_) { return stats; }
+  for (auto& op : graph_->get_nodes()) {
+    if (auto op_stats = op->execution_stats()) { stats.push_back(op_stats->snapshot()); }
+  }
+  return stats;
+}
+
 void Fragment::compose_graph() {
   if (is_composed_) {
     HOLOSCAN_LOG_DEBUG("The fragment({}) has already been composed. Skipping...", name());
@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/gxf/batch_flush_scheduling_term.hpp"
+
+#include <algorithm>
+
+#include "gxf/core/entity.hpp"
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan::gxf {
+
+gxf_result_t BatchFlushSchedulingTerm::registerInterface(nvidia::gxf::Registrar* registrar) {
+  (void)registrar;  // no parameters: the receivers are the ones of the entity
+  return GXF_SUCCESS;
+}
+
+gxf_result_t BatchFlushSchedulingTerm::initialize() {
+  receivers_.clear();
+  auto entity = nvidia::gxf::Entity::Shared(context(), eid());
+  if (!entity) {
+    HOLOSCAN_LOG_ERROR("BatchFlushSchedulingTerm: failed to get the entity of '{}'", name());
+    return nvidia::gxf::ToResultCode(entity);
+  }
+  auto receivers = entity->findAll<nvidia::gxf::Receiver>();
+  if (!receivers) { return nvidia::gxf::ToResultCode(receivers); }
+  for (auto&& receiver : receivers.value()) {
+    if (receiver) { receivers_.push_back(receiver.value()); }
+  }
+  if (receivers_.empty()) {
+    HOLOSCAN_LOG_WARN("BatchFlushSchedulingTerm '{}': the entity has no receiver", name());
+  }
+  requested_delay_ns_ = kNoRequest;
+  flush_time_ = -1;
+  return GXF_SUCCESS;
+}
+
+void BatchFlushSchedulingTerm::request_flush(int64_t delay_ns) {
+  requested_delay_ns_ = std::max<int64_t>(delay_ns, 0);
+}
+
+bool BatchFlushSchedulingTerm::has_message() const {
+  return std::any_of(receivers_.begin(), receivers_.end(), [](const auto& receiver) {
+    return receiver->back_size() + receiver->size() > 0;
+  });
+}
+
+gxf_result_t BatchFlushSchedulingTerm::update_state_abi(int64_t timestamp) {
+  const int64_t delay_ns = requested_delay_ns_.exchange(kNoRequest);
+  if (delay_ns != kNoRequest) { flush_time_ = timestamp + delay_ns; }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t BatchFlushSchedulingTerm::check_abi(int64_t timestamp,
+                                                 nvidia::gxf::SchedulingConditionType* type,
+                                                 int64_t* target_timestamp) const {
+  if (has_message() || (flush_time_ >= 0 && timestamp >= flush_time_)) {
+    *type = nvidia::gxf::SchedulingConditionType::READY;
+  } else if (flush_time_ >= 0) {
+    *type = nvidia::gxf::SchedulingConditionType::WAIT_TIME;
+    *target_timestamp = flush_time_;
+  } else {
+    *type = nvidia::gxf::SchedulingConditionType::WAIT;
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t BatchFlushSchedulingTerm::onExecute_abi(int64_t /* dt */) {
+  // The operator renews the request if its batch is still pending after the execution
+  flush_time_ = -1;
+  return GXF_SUCCESS;
+}
+
+}  // namespace holoscan::gxf
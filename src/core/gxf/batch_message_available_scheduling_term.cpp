@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/gxf/batch_message_available_scheduling_term.hpp"
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan::gxf {
+
+gxf_result_t BatchMessageAvailableSchedulingTerm::registerInterface(
+    nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(receiver_,
+                                 "receiver",
+                                 "Queue channel",
+                                 "The scheduling term permits execution when this channel has a "
+                                 "full batch of messages or when the oldest batch is due.");
+  result &= registrar->parameter(max_batch_size_,
+                                 "max_batch_size",
+                                 "Maximum batch size",
+                                 "The scheduling term permits execution as soon as the receiver "
+                                 "has at least this number of messages.",
+                                 static_cast<int64_t>(1));
+  result &= registrar->parameter(max_delay_ns_,
+                                 "max_delay_ns",
+                                 "Maximum delay [ns]",
+                                 "The scheduling term permits execution with the messages "
+                                 "available once this delay has passed since the first message of "
+                                 "the batch was seen.",
+                                 static_cast<int64_t>(0));
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t BatchMessageAvailableSchedulingTerm::initialize() {
+  if (max_batch_size_.get() < 1) {
+    HOLOSCAN_LOG_ERROR(
+        "BatchMessageAvailableSchedulingTerm: 'max_batch_size' must be >= 1 (got {})",
+        max_batch_size_.get());
+    return GXF_ARGUMENT_OUT_OF_RANGE;
+  }
+  if (max_delay_ns_.get() < 0) {
+    HOLOSCAN_LOG_ERROR("BatchMessageAvailableSchedulingTerm: 'max_delay_ns' must be >= 0 (got {})",
+                       max_delay_ns_.get());
+    return GXF_ARGUMENT_OUT_OF_RANGE;
+  }
+  batch_start_time_ = -1;
+  return GXF_SUCCESS;
+}
+
+uint64_t BatchMessageAvailableSchedulingTerm::num_messages() const {
+  return receiver_.get()->back_size() + receiver_.get()->size();
+}
+
+gxf_result_t BatchMessageAvailableSchedulingTerm::update_state_abi(int64_t timestamp) {
+  if (num_messages() == 0) {
+    batch_start_time_ = -1;
+  } else if (batch_start_time_ < 0) {
+    batch_start_time_ = timestamp;
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t BatchMessageAvailableSchedulingTerm::check_abi(
+    int64_t timestamp, nvidia::gxf::SchedulingConditionType* type,
+    int64_t* target_timestamp) const {
+  const uint64_t size = num_messages();
+  if (size == 0) {
+    *type = nvidia::gxf::SchedulingConditionType::WAIT;
+    return GXF_SUCCESS;
+  }
+  if (size >= static_cast<uint64_t>(max_batch_size_.get())) {
+    *type = nvidia::gxf::SchedulingConditionType::READY;
+    return GXF_SUCCESS;
+  }
+
+  // Partial batch: flush it once its delay has passed
+  const int64_t start_time = batch_start_time_ < 0 ? timestamp : batch_start_time_;
+  const int64_t flush_time = start_time + max_delay_ns_.get();
+  if (timestamp >= flush_time) {
+    *type = nvidia::gxf::SchedulingConditionType::READY;
+  } else {
+    *type = nvidia::gxf::SchedulingConditionType::WAIT_TIME;
+    *target_timestamp = flush_time;
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t BatchMessageAvailableSchedulingTerm::onExecute_abi(int64_t /* dt */) {
+  // The messages left in the receiver (if any) start a new batch at the next state update
+  batch_start_time_ = -1;
+  return GXF_SUCCESS;
+}
+
+}  // namespace holoscan::gxf
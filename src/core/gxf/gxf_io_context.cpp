@@ -22,9 +22,12 @@
 #include <utility>
 #include <unordered_map>
 #include "holoscan/core/execution_context.hpp"
+#include "holoscan/core/fragment.hpp"
 #include "holoscan/core/gxf/gxf_operator.hpp"
 #include "holoscan/core/gxf/gxf_utils.hpp"
 #include "holoscan/core/message.hpp"
+#include "holoscan/core/resources/gxf/receiver.hpp"
+#include "holoscan/core/resources/gxf/transmitter.hpp"
 
 #include "gxf/std/receiver.hpp"
 #include "gxf/std/transmitter.hpp"
@@ -32,7 +35,16 @@
 namespace holoscan::gxf {
 
 nvidia::gxf::Receiver* get_gxf_receiver(const std::unique_ptr<IOSpec>& input_spec) {
+  return get_gxf_receiver(input_spec.get());
+}
+
+nvidia::gxf::Receiver* get_gxf_receiver(IOSpec* input_spec) {
   auto connector = input_spec->connector();
+
+  // Use the component pointer resolved when the receiver was initialized
+  auto receiver = std::dynamic_pointer_cast<holoscan::Receiver>(connector);
+  if (receiver && receiver->gxf_cptr()) { return receiver->get(); }
+
   auto gxf_resource = std::dynamic_pointer_cast<GXFResource>(connector);
   if (gxf_resource == nullptr) {
     HOLOSCAN_LOG_ERROR("Invalid connector type");
@@ -47,6 +59,27 @@ nvidia::gxf::Receiver* get_gxf_receiver(const std::unique_ptr<IOSpec>& input_spe
   return static_cast<nvidia::gxf::Receiver*>(rx_ptr);
 }
 
+nvidia::gxf::Transmitter* get_gxf_transmitter(IOSpec* output_spec) {
+  auto connector = output_spec->connector();
+
+  // Use the component pointer resolved when the transmitter was initialized
+  auto transmitter = std::dynamic_pointer_cast<holoscan::Transmitter>(connector);
+  if (transmitter && transmitter->gxf_cptr()) { return transmitter->get(); }
+
+  auto gxf_resource = std::dynamic_pointer_cast<GXFResource>(connector);
+  if (gxf_resource == nullptr) {
+    HOLOSCAN_LOG_ERROR("Invalid resource type");
+    return nullptr;
+  }
+
+  gxf_tid_t tx_tid{};
+  gxf_context_t context = gxf_resource->gxf_context();
+  HOLOSCAN_GXF_CALL_FATAL(GxfComponentTypeId(context, gxf_resource->gxf_typename(), &tx_tid));
+  void* tx_ptr = nullptr;
+  HOLOSCAN_GXF_CALL_FATAL(GxfComponentPointer(context, gxf_resource->gxf_cid(), tx_tid, &tx_ptr));
+  return static_cast<nvidia::gxf::Transmitter*>(tx_ptr);
+}
+
 GXFInputContext::GXFInputContext(ExecutionContext* execution_context, Operator* op)
     : InputContext(execution_context, op) {}
 
@@ -59,10 +92,28 @@ gxf_context_t GXFInputContext::gxf_context() const {
   return nullptr;
 }
 
+void GXFInputContext::cache_connectors() {
+  gxf_receivers_.clear();
+  for (auto& [_, input_spec] : inputs_) {
+    if (!input_spec->connector()) { continue; }
+    if (auto receiver = get_gxf_receiver(input_spec)) {
+      gxf_receivers_.emplace(input_spec.get(), receiver);
+    }
+  }
+}
+
+nvidia::gxf::Receiver* GXFInputContext::gxf_receiver(IOSpec* input_spec) {
+  if (!gxf_receivers_.empty()) {
+    auto it = gxf_receivers_.find(input_spec);
+    if (it != gxf_receivers_.end()) { return it->second; }
+  }
+  return get_gxf_receiver(input_spec);
+}
+
 bool GXFInputContext::empty_impl(const char* name) {
   std::string input_name = holoscan::get_well_formed_name(name, inputs_);
   auto it = inputs_.find(input_name);
-  auto receiver = get_gxf_receiver(it->second);
+  auto receiver = gxf_receiver(it->second.get());
   return receiver->size() == 0;
 }
 
@@ -111,7 +162,7 @@ std::any GXFInputContext::receive_impl(const char* name, bool no_error_message)
     }
   }
 
-  auto receiver = get_gxf_receiver(it->second);
+  auto receiver = gxf_receiver(it->second.get());
   if (!receiver) {
     return -1;  // to cause a bad_any_cast
   }
@@ -134,6 +185,21 @@ std::any GXFInputContext::receive_impl(const char* name, bool no_error_message)
   return value;
 }
 
+nvidia::gxf::Entity GXFInputContext::receive_entity_impl(IOSpec* input_spec) {
+  auto receiver = gxf_receiver(input_spec);
+  if (!receiver) { return {}; }
+
+  auto entity = receiver->receive();
+  if (!entity) { return {}; }
+  return std::move(entity.value());
+}
+
+size_t GXFInputContext::num_available_impl(IOSpec* input_spec) {
+  auto receiver = gxf_receiver(input_spec);
+  if (!receiver) { return 0; }
+  return receiver->size();
+}
+
 GXFOutputContext::GXFOutputContext(ExecutionContext* execution_context, Operator* op)
     : OutputContext(execution_context, op) {}
 
@@ -147,6 +213,35 @@ gxf_context_t GXFOutputContext::gxf_context() const {
   return nullptr;
 }
 
+void GXFOutputContext::cache_connectors() {
+  transmitters_.clear();
+  for (auto& [_, output_spec] : outputs_) {
+    if (!output_spec->connector()) { continue; }
+    Transmitters output_transmitters;
+    output_transmitters.transmitter =
+        dynamic_cast<holoscan::Transmitter*>(output_spec->connector().get());
+    output_transmitters.gxf_transmitter = get_gxf_transmitter(output_spec.get());
+    if (auto stats = op_->execution_stats()) {
+      output_transmitters.stats_index = stats->output_index(output_spec->name());
+    }
+    if (output_transmitters.gxf_transmitter) {
+      transmitters_.emplace(output_spec.get(), output_transmitters);
+    }
+  }
+}
+
+GXFOutputContext::Transmitters GXFOutputContext::transmitters(IOSpec* output_spec) {
+  if (!transmitters_.empty()) {
+    auto it = transmitters_.find(output_spec);
+    if (it != transmitters_.end()) { return it->second; }
+  }
+  Transmitters output_transmitters;
+  output_transmitters.transmitter =
+      dynamic_cast<holoscan::Transmitter*>(output_spec->connector().get());
+  output_transmitters.gxf_transmitter = get_gxf_transmitter(output_spec);
+  return output_transmitters;
+}
+
 void GXFOutputContext::emit_impl(std::any data, const char* name, OutputType out_type) {
   std::string output_name = holoscan::get_well_formed_name(name, outputs_);
 
@@ -191,41 +286,51 @@ void GXFOutputContext::emit_impl(std::any data, const char* name, OutputType out
     }
   }
 
-  const std::unique_ptr<IOSpec>& output_spec = it->second;
-  auto connector = output_spec->connector();
-
-  auto gxf_resource = std::dynamic_pointer_cast<GXFResource>(connector);
-  if (gxf_resource == nullptr) {
-    HOLOSCAN_LOG_ERROR("Invalid resource type");
-    return;
-  }
-
-  gxf_tid_t tx_tid;
-  gxf_context_t context = gxf_resource->gxf_context();
-  HOLOSCAN_GXF_CALL_FATAL(GxfComponentTypeId(context, gxf_resource->gxf_typename(), &tx_tid));
-
-  void* tx_ptr;
-  HOLOSCAN_GXF_CALL_FATAL(GxfComponentPointer(context, gxf_resource->gxf_cid(), tx_tid, &tx_ptr));
+  auto [transmitter, gxf_transmitter, stats_index] = transmitters(it->second.get());
+  if (gxf_transmitter == nullptr) { return; }
 
   switch (out_type) {
     case OutputType::kSharedPointer:
     case OutputType::kAny: {
-      // Create an Entity object and add a Message object to it.
-      auto gxf_entity = nvidia::gxf::Entity::New(gxf_context());
-      auto buffer = gxf_entity.value().add<Message>();
-      // Set the data to the value of the Message object.
-      buffer.value()->set_value(data);
+      // Get an Entity object holding a Message object with the data. The entity is recycled from
+      // the transmitter's pool when possible. Pooling is not used with data flow tracking because
+      // a MessageLabel is added to the entity each time it is published.
+      nvidia::gxf::Expected<nvidia::gxf::Entity> gxf_entity = nvidia::gxf::Unexpected{GXF_FAILURE};
+      if (transmitter && op_->fragment()->data_flow_tracker() == nullptr) {
+        gxf_entity = transmitter->message_entity_pool().acquire(gxf_context(), std::move(data));
+      } else {
+        // Create an Entity object and add a Message object to it.
+        gxf_entity = nvidia::gxf::Entity::New(gxf_context());
+        if (gxf_entity) {
+          auto buffer = gxf_entity.value().add<Message>();
+          // Set the data to the value of the Message object.
+          if (buffer) {
+            buffer.value()->set_value(std::move(data));
+          } else {
+            gxf_entity = nvidia::gxf::ForwardError(buffer);
+          }
+        }
+      }
+      if (!gxf_entity) {
+        HOLOSCAN_LOG_ERROR("Unable to create a message entity for the output port '{}' of {}: {}",
+                           output_name,
+                           op_->name(),
+                           GxfResultStr(gxf_entity.error()));
+        return;
+      }
       // Publish the Entity object.
       // TODO(gbae): Check error message
-      static_cast<nvidia::gxf::Transmitter*>(tx_ptr)->publish(std::move(gxf_entity.value()));
+      gxf_transmitter->publish(std::move(gxf_entity.value()));
+      if (stats_index >= 0) { op_->execution_stats()->record_emit(stats_index); }
       break;
     }
     case OutputType::kGXFEntity: {
       // Cast to an Entity object and publish it.
       try {
-        auto gxf_entity = std::any_cast<nvidia::gxf::Entity>(data);
+        auto gxf_entity = std::any_cast<nvidia::gxf::Entity>(std::move(data));
         // TODO(gbae): Check error message
-        static_cast<nvidia::gxf::Transmitter*>(tx_ptr)->publish(std::move(gxf_entity));
+        gxf_transmitter->publish(std::move(gxf_entity));
+        if (stats_index >= 0) { op_->execution_stats()->record_emit(stats_index); }
       } catch (const std::bad_any_cast& e) {
         HOLOSCAN_LOG_ERROR("Unable to cast to gxf::Entity: {}", e.what());
       }
@@ -20,8 +20,11 @@
 #include "holoscan/core/common.hpp"
 #include "holoscan/core/fragment.hpp"
 #include "holoscan/core/gxf/gxf_execution_context.hpp"
+#include "holoscan/core/gxf/gxf_io_context.hpp"
 #include "holoscan/core/io_context.hpp"
+#include "holoscan/core/resources/gxf/transmitter.hpp"
 
+#include "gxf/std/receiver.hpp"
 #include "gxf/std/transmitter.hpp"
 
 namespace holoscan::gxf {
@@ -59,6 +62,24 @@ gxf_result_t GXFWrapper::start() {
     return GXF_FAILURE;
   }
 
+  // The execution context and the connectors of the operator do not change between ticks
+  exec_context_ = std::make_unique<GXFExecutionContext>(context(), op_);
+  exec_context_->gxf_input()->cache_connectors();
+  exec_context_->gxf_output()->cache_connectors();
+
+  stats_ = op_->execution_stats();
+  stats_receivers_.clear();
+  if (stats_) {
+    auto& inputs = op_->spec()->inputs();
+    for (const auto& input_name : stats_->input_names()) {
+      auto it = inputs.find(input_name);
+      auto receiver = (it != inputs.end() && it->second->connector())
+                          ? get_gxf_receiver(it->second.get())
+                          : nullptr;
+      stats_receivers_.push_back(receiver);
+    }
+  }
+
   return GXF_SUCCESS;
 }
 
@@ -71,12 +92,22 @@ gxf_result_t GXFWrapper::tick() {
 
   HOLOSCAN_LOG_TRACE("Calling operator: {}", op_->name());
 
-  GXFExecutionContext exec_context(context(), op_);
-  InputContext* op_input = exec_context.input();
-  OutputContext* op_output = exec_context.output();
+  if (!exec_context_) { exec_context_ = std::make_unique<GXFExecutionContext>(context(), op_); }
+  InputContext* op_input = exec_context_->input();
+  OutputContext* op_output = exec_context_->output();
+
+  int64_t start_ns = 0;
+  if (stats_) {
+    for (size_t i = 0; i < stats_receivers_.size(); ++i) {
+      if (stats_receivers_[i]) { stats_->record_queue_size(i, stats_receivers_[i]->size()); }
+    }
+    start_ns = OperatorStats::now_ns();
+  }
+
   try {
-    op_->compute(*op_input, *op_output, exec_context);
+    op_->compute(*op_input, *op_output, *exec_context_);
   } catch (const std::exception& e) {
+    if (stats_) { stats_->record_tick(start_ns, OperatorStats::now_ns(), false); }
     // Note: Rethrowing the exception (using `throw;`) would cause the Python interpreter to exit.
     //       To avoid this, we store the exception and return GXF_FAILURE.
     //       The exception is then rethrown in GXFExecutor::run_gxf_graph().
@@ -85,6 +116,7 @@ gxf_result_t GXFWrapper::tick() {
     return GXF_FAILURE;
   }
 
+  if (stats_) { stats_->record_tick(start_ns, OperatorStats::now_ns()); }
   return GXF_SUCCESS;
 }
 
@@ -106,6 +138,15 @@ gxf_result_t GXFWrapper::stop() {
     return GXF_FAILURE;
   }
 
+  exec_context_.reset();
+  stats_receivers_.clear();
+
+  // Release the pooled message entities while the GXF context is still alive.
+  for (auto& [_, output_spec] : op_->spec()->outputs()) {
+    auto transmitter = std::dynamic_pointer_cast<holoscan::Transmitter>(output_spec->connector());
+    if (transmitter) { transmitter->message_entity_pool().clear(); }
+  }
+
   return GXF_SUCCESS;
 }
 
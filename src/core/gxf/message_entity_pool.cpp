@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/gxf/message_entity_pool.hpp"
+
+#include <algorithm>
+#include <any>
+#include <utility>
+
+#include "holoscan/core/app_driver.hpp"
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan::gxf {
+
+MessageEntityPool::MessageEntityPool()
+    : MessageEntityPool(static_cast<size_t>(std::max<int64_t>(
+          0,
+          AppDriver::get_int_env_var("HOLOSCAN_MESSAGE_POOL_SIZE",
+                                     static_cast<int64_t>(kDefaultCapacity))))) {}
+
+MessageEntityPool::MessageEntityPool(size_t capacity) : capacity_(capacity) {
+  entries_.reserve(capacity_);
+}
+
+nvidia::gxf::Expected<nvidia::gxf::Entity> MessageEntityPool::acquire(gxf_context_t context,
+                                                                      std::any&& value) {
+  // Reuse the first entity (starting from the least recently used one) that is only referenced
+  // by the pool. The values of the other idle entities are released, so that a consumed message
+  // does not keep its value alive until its entity is reused.
+  const size_t entry_count = entries_.size();
+  Entry* reused_entry = nullptr;
+  for (size_t i = 0; i < entry_count; ++i) {
+    const size_t index = (next_index_ + i) % entry_count;
+    auto& entry = entries_[index];
+    int64_t ref_count = 0;
+    if (GxfEntityGetRefCount(context, entry.entity.eid(), &ref_count) != GXF_SUCCESS ||
+        ref_count != 1) {
+      continue;
+    }
+    if (reused_entry == nullptr) {
+      reused_entry = &entry;
+      next_index_ = (index + 1) % entry_count;
+    } else {
+      entry.message->set_value(std::any{});
+    }
+  }
+  if (reused_entry != nullptr) {
+    reused_entry->message->set_value(std::move(value));
+    ++reuse_count_;
+    return reused_entry->entity;
+  }
+
+  auto maybe_entry = create_entry(context, std::move(value));
+  if (!maybe_entry) { return nvidia::gxf::ForwardError(maybe_entry); }
+  if (entries_.size() >= capacity_) {
+    // All pooled entities are in flight: publish an unpooled entity.
+    return std::move(maybe_entry.value().entity);
+  }
+  entries_.push_back(std::move(maybe_entry.value()));
+  return entries_.back().entity;
+}
+
+void MessageEntityPool::clear() {
+  entries_.clear();
+  next_index_ = 0;
+}
+
+nvidia::gxf::Expected<MessageEntityPool::Entry> MessageEntityPool::create_entry(
+    gxf_context_t context, std::any&& value) {
+  auto maybe_entity = nvidia::gxf::Entity::New(context);
+  if (!maybe_entity) {
+    HOLOSCAN_LOG_ERROR("Failed to create a message entity: {}",
+                       GxfResultStr(maybe_entity.error()));
+    return nvidia::gxf::ForwardError(maybe_entity);
+  }
+  auto maybe_message = maybe_entity.value().add<Message>();
+  if (!maybe_message) {
+    HOLOSCAN_LOG_ERROR("Failed to add a message to the entity: {}",
+                       GxfResultStr(maybe_message.error()));
+    return nvidia::gxf::ForwardError(maybe_message);
+  }
+  maybe_message.value()->set_value(std::move(value));
+  return Entry{std::move(maybe_entity.value()), maybe_message.value()};
+}
+
+}  // namespace holoscan::gxf
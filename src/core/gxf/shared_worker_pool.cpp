@@ -0,0 +1,237 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/gxf/shared_worker_pool.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan::gxf {
+
+struct SharedWorkerPool::ClientEntry {
+  ClientEntry(Client* c, int64_t p, size_t max) : client(c), priority(p), max_workers(max) {}
+
+  Client* const client;
+  const int64_t priority;
+  const size_t max_workers;
+  std::atomic<size_t> active{0};  ///< Number of workers executing the work of the client
+  std::atomic<bool> detached{false};
+};
+
+namespace {
+
+std::mutex& pool_registry_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::map<std::string, std::weak_ptr<SharedWorkerPool>>& pool_registry() {
+  static std::map<std::string, std::weak_ptr<SharedWorkerPool>> registry;
+  return registry;
+}
+
+}  // namespace
+
+std::shared_ptr<SharedWorkerPool> SharedWorkerPool::acquire(const std::string& name,
+                                                            const Options& options) {
+  std::lock_guard<std::mutex> lock(pool_registry_mutex());
+  auto& registry = pool_registry();
+  if (auto pool = registry[name].lock()) {
+    if (pool->num_workers() != options.num_workers) {
+      HOLOSCAN_LOG_DEBUG("SharedWorkerPool '{}' already exists with {} workers ({} requested)",
+                         name,
+                         pool->num_workers(),
+                         options.num_workers);
+    }
+    return pool;
+  }
+  // The constructor is private, so std::make_shared cannot be used
+  std::shared_ptr<SharedWorkerPool> pool(new SharedWorkerPool(name, options));
+  registry[name] = pool;
+  return pool;
+}
+
+SharedWorkerPool::SharedWorkerPool(std::string name, Options options)
+    : name_(std::move(name)),
+      options_(std::move(options)),
+      clients_(std::make_shared<const ClientList>()) {
+  if (!options_.cpu_cores.empty() || !options_.numa_nodes.empty()) {
+    topology_ = std::make_unique<Topology>();
+    if (topology_->load() != 0) {
+      HOLOSCAN_LOG_WARN(
+          "SharedWorkerPool '{}': unable to load the hwloc topology, workers are not pinned",
+          name_);
+      topology_.reset();
+    }
+  }
+  const size_t num_workers = std::max<size_t>(options_.num_workers, 1);
+  threads_.reserve(num_workers);
+  for (size_t i = 0; i < num_workers; ++i) {
+    threads_.emplace_back(&SharedWorkerPool::worker_thread, this, i);
+  }
+  HOLOSCAN_LOG_DEBUG("SharedWorkerPool '{}' started with {} workers", name_, num_workers);
+}
+
+SharedWorkerPool::~SharedWorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  work_cv_.notify_all();
+  for (auto& thread : threads_) {
+    if (thread.joinable()) { thread.join(); }
+  }
+
+  std::lock_guard<std::mutex> lock(pool_registry_mutex());
+  auto& registry = pool_registry();
+  auto it = registry.find(name_);
+  if (it != registry.end() && it->second.expired()) { registry.erase(it); }
+}
+
+void SharedWorkerPool::attach(Client* client, int64_t priority, size_t max_workers) {
+  auto entry = std::make_shared<ClientEntry>(client, priority, max_workers);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto clients = std::make_shared<ClientList>(*clients_);
+    // Keep the clients ordered by decreasing priority (in attach order for the same priority)
+    auto position = std::upper_bound(
+        clients->begin(), clients->end(), priority, [](int64_t value, const auto& other) {
+          return value > other->priority;
+        });
+    clients->insert(position, std::move(entry));
+    clients_ = std::move(clients);
+    ++pending_notifications_;
+  }
+  work_cv_.notify_all();
+}
+
+void SharedWorkerPool::detach(Client* client) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto clients = std::make_shared<ClientList>(*clients_);
+  auto it = std::find_if(clients->begin(), clients->end(), [client](const auto& entry) {
+    return entry->client == client;
+  });
+  if (it == clients->end()) { return; }
+  std::shared_ptr<ClientEntry> entry = *it;
+  clients->erase(it);
+  clients_ = std::move(clients);
+
+  // Workers that already took the previous client list skip the entry once it is marked as
+  // detached, but a worker can be executing its work.
+  entry->detached.store(true);
+  detach_cv_.wait(lock, [&entry] { return entry->active.load() == 0; });
+}
+
+void SharedWorkerPool::notify() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_notifications_ = std::min(pending_notifications_ + 1, threads_.size());
+  }
+  work_cv_.notify_one();
+}
+
+void SharedWorkerPool::pin_worker(size_t worker_index) {
+  if (!topology_) { return; }
+  const auto& cores = options_.cpu_cores;
+  const auto& nodes = options_.numa_nodes;
+  int result = 0;
+  std::string target;
+  if (!cores.empty()) {
+    const int64_t core = cores[worker_index % cores.size()];
+    result = topology_->bind_thread_to_cpu(core);
+    target = fmt::format("CPU core {}", core);
+  } else {
+    const int64_t node = nodes[worker_index % nodes.size()];
+    result = topology_->bind_thread_to_numa_node(node);
+    target = fmt::format("NUMA node {}", node);
+  }
+  if (result != 0) {
+    HOLOSCAN_LOG_WARN("SharedWorkerPool '{}': unable to pin worker {} to {}: {}",
+                      name_,
+                      worker_index,
+                      target,
+                      std::strerror(errno));
+  } else {
+    HOLOSCAN_LOG_DEBUG(
+        "SharedWorkerPool '{}': worker {} pinned to {}", name_, worker_index, target);
+  }
+}
+
+bool SharedWorkerPool::run_client(ClientEntry& entry, size_t worker_index) {
+  if (entry.detached.load()) { return false; }
+  const size_t active = entry.active.fetch_add(1);
+  // The detached flag is checked again after the increment: either detach() sees this worker as
+  // active and waits for it, or this worker sees the client as detached.
+  bool executed = false;
+  if (!entry.detached.load() && (entry.max_workers == 0 || active < entry.max_workers)) {
+    executed = entry.client->run_once(worker_index);
+  }
+  if (entry.active.fetch_sub(1) == 1 && entry.detached.load()) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    detach_cv_.notify_all();
+  }
+  return executed;
+}
+
+void SharedWorkerPool::worker_thread(size_t worker_index) {
+  pin_worker(worker_index);
+
+  size_t round = 0;
+
+  while (true) {
+    std::shared_ptr<const ClientList> clients;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stopping_) { break; }
+      clients = clients_;
+    }
+
+    // Serve the clients by decreasing priority. Within a group of clients of the same priority,
+    // each worker starts with a different client (and shifts it at every round) so that they
+    // are served in turn.
+    bool executed = false;
+    const size_t num_clients = clients->size();
+    for (size_t begin = 0; begin < num_clients && !executed;) {
+      size_t end = begin + 1;
+      while (end < num_clients && (*clients)[end]->priority == (*clients)[begin]->priority) {
+        ++end;
+      }
+      const size_t group_size = end - begin;
+      for (size_t offset = 0; offset < group_size && !executed; ++offset) {
+        auto& entry = *(*clients)[begin + (worker_index + round + offset) % group_size];
+        executed = run_client(entry, worker_index);
+      }
+      begin = end;
+    }
+    ++round;
+    if (executed) { continue; }
+
+    // Sleep until new work is notified. Only idle workers consume the notifications and a worker
+    // that executed some work checks the clients again, so no notified work is left behind.
+    std::unique_lock<std::mutex> lock(mutex_);
+    work_cv_.wait(lock, [this] { return pending_notifications_ > 0 || stopping_; });
+    if (pending_notifications_ > 0) { --pending_notifications_; }
+  }
+}
+
+}  // namespace holoscan::gxf
@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/gxf/spsc_ring_receiver.hpp"
+
+#include "gxf/core/gxf.h"
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan::gxf {
+
+namespace {
+
+// Same values as nvidia::gxf::DoubleBufferReceiver's policy parameter
+enum OverflowPolicy : uint64_t {
+  kPop = 0,     ///< Drop the oldest message
+  kReject = 1,  ///< Drop the new message
+  kFault = 2,   ///< Fail the push
+};
+
+}  // namespace
+
+gxf_result_t SpscRingReceiver::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(
+      capacity_, "capacity", "Capacity", "Maximum number of messages in the queue.", 1UL);
+  result &= registrar->parameter(
+      policy_, "policy", "Policy", "0: pop, 1: reject, 2: fault", static_cast<uint64_t>(kFault));
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t SpscRingReceiver::initialize() {
+  if (capacity_.get() == 0) {
+    HOLOSCAN_LOG_ERROR("SpscRingReceiver '{}': 'capacity' must be >= 1", name());
+    return GXF_ARGUMENT_OUT_OF_RANGE;
+  }
+  if (policy_.get() > kFault) {
+    HOLOSCAN_LOG_ERROR("SpscRingReceiver '{}': unknown policy {}", name(), policy_.get());
+    return GXF_ARGUMENT_OUT_OF_RANGE;
+  }
+  ring_ = std::make_unique<SpscRing<gxf_uid_t>>(capacity_.get());
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SpscRingReceiver::deinitialize() {
+  if (ring_) {
+    gxf_uid_t uid = kNullUid;
+    while (ring_->try_pop(uid)) { GxfEntityRefCountDec(context(), uid); }
+    ring_.reset();
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SpscRingReceiver::push_abi(gxf_uid_t other) {
+  if (!ring_) { return GXF_FAILURE; }
+  // The queue holds a reference to the entity until it is received (or dropped)
+  const gxf_result_t code = GxfEntityRefCountInc(context(), other);
+  if (code != GXF_SUCCESS) { return code; }
+  if (ring_->try_push(other)) { return GXF_SUCCESS; }
+
+  switch (policy_.get()) {
+    case kPop: {
+      gxf_uid_t oldest = kNullUid;
+      if (ring_->pop_oldest(oldest)) { GxfEntityRefCountDec(context(), oldest); }
+      // Only this thread pushes, so there is room now
+      if (ring_->try_push(other)) { return GXF_SUCCESS; }
+      break;
+    }
+    case kReject:
+      GxfEntityRefCountDec(context(), other);
+      return GXF_SUCCESS;
+    default:
+      break;
+  }
+  GxfEntityRefCountDec(context(), other);
+  HOLOSCAN_LOG_WARN("Push failed on '{}'", name());
+  return GXF_EXCEEDING_PREALLOCATED_SIZE;
+}
+
+gxf_result_t SpscRingReceiver::pop_abi(gxf_uid_t* uid) {
+  if (uid == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (!ring_) { return GXF_FAILURE; }
+  // The reference held by the queue is handed over to the caller
+  if (!ring_->try_pop(*uid)) { return GXF_FAILURE; }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SpscRingReceiver::receive_abi(gxf_uid_t* uid) {
+  return pop_abi(uid);
+}
+
+gxf_result_t SpscRingReceiver::peek_abi(gxf_uid_t* uid, int32_t index) {
+  if (uid == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (!ring_ || index < 0) { return GXF_FAILURE; }
+  if (!ring_->peek(static_cast<size_t>(index), *uid)) { return GXF_FAILURE; }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t SpscRingReceiver::peek_back_abi(gxf_uid_t* uid, int32_t /* index */) {
+  if (uid == nullptr) { return GXF_ARGUMENT_NULL; }
+  // There is no back stage
+  return GXF_FAILURE;
+}
+
+size_t SpscRingReceiver::capacity_abi() {
+  return ring_ ? ring_->capacity() : 0;
+}
+
+size_t SpscRingReceiver::size_abi() {
+  return ring_ ? ring_->size() : 0;
+}
+
+size_t SpscRingReceiver::back_size_abi() {
+  return 0;
+}
+
+gxf_result_t SpscRingReceiver::sync_abi() {
+  return GXF_SUCCESS;
+}
+
+}  // namespace holoscan::gxf
@@ -0,0 +1,904 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/gxf/work_stealing_scheduler.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "gxf/core/gxf.h"
+#include "gxf/std/entity_executor.hpp"
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan::gxf {
+
+namespace {
+
+enum EntityStateType : int {
+  kWaiting = 0,  ///< Waiting for an event (or for the periodic condition check)
+  kTimed,        ///< Waiting for a target time
+  kQueued,       ///< In the queue of a worker
+  kRunning,      ///< Being executed by a worker
+  kDone,         ///< Never executed again
+};
+
+// Whether an entity is the entity of an operator. The entities of the operators of a fragment
+// are prefixed with '<fragment name>__'.
+bool is_operator_entity(const std::string& entity_name, const std::string& operator_name) {
+  if (entity_name == operator_name) { return true; }
+  const std::string suffix = "__" + operator_name;
+  return entity_name.size() > suffix.size() &&
+         entity_name.compare(entity_name.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+}  // namespace
+
+struct WorkStealingScheduler::EntityState {
+  EntityState(gxf_uid_t id, int pinned, bool is_python)
+      : eid(id), pinned_worker(pinned), python(is_python) {}
+
+  const gxf_uid_t eid;
+  const int pinned_worker;  ///< Worker the entity is pinned to (-1 if it can run on any worker)
+  const bool python;        ///< The entity only runs on the Python workers
+  std::atomic<int> state{kWaiting};
+  std::atomic<bool> notified{false};  ///< An event was received while the entity was running
+  std::atomic<bool> polled{false};    ///< The entity was queued by the periodic condition check
+  std::atomic<bool> event_waiting{false};  ///< The last execution returned WAIT_EVENT
+  std::atomic<bool> unscheduled{false};
+  std::atomic<int> last_worker{-1};
+  uint64_t timed_generation = 0;  ///< Number of timed waits (protected by dispatcher_mutex_)
+};
+
+struct alignas(64) WorkStealingScheduler::Worker {
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<EntityState*> queue;  ///< Popped from the front by the owner, stolen from the back
+  std::atomic<size_t> size{0};     ///< Size of the queue, readable without locking
+  std::atomic<size_t> stealable{0};  ///< Number of queued entities that are not pinned
+  bool wake = false;
+  bool idle = false;  ///< The owner is waiting for work (protected by mutex)
+  bool python = false;  ///< The worker only executes the Python entities
+
+  std::atomic<uint64_t> executions{0};
+  std::atomic<uint64_t> local_pops{0};
+  std::atomic<uint64_t> steals{0};
+  std::atomic<uint64_t> affinity_hits{0};
+  std::atomic<uint64_t> migrations{0};
+  std::atomic<uint64_t> idle_waits{0};
+};
+
+WorkStealingScheduler::WorkStealingScheduler() = default;
+
+WorkStealingScheduler::~WorkStealingScheduler() = default;
+
+gxf_result_t WorkStealingScheduler::registerInterface(nvidia::gxf::Registrar* registrar) {
+  nvidia::gxf::Expected<void> result;
+  result &= registrar->parameter(
+      clock_, "clock", "Clock", "The clock used by the scheduler to define the flow of time.");
+  result &= registrar->parameter(worker_thread_number_,
+                                 "worker_thread_number",
+                                 "Thread Number",
+                                 "Number of worker threads.",
+                                 static_cast<int64_t>(1));
+  result &= registrar->parameter(stop_on_deadlock_,
+                                 "stop_on_deadlock",
+                                 "Stop on dead end",
+                                 "If enabled the scheduler will stop when all entities are in a "
+                                 "waiting state, but no periodic entity exists to break the dead "
+                                 "end.",
+                                 true);
+  result &= registrar->parameter(stop_on_deadlock_timeout_,
+                                 "stop_on_deadlock_timeout",
+                                 "Delay (in ms) until stop_on_deadlock kicks in",
+                                 "Scheduler will wait this amount of time before determining that "
+                                 "it is in deadlock and should stop. It will reset if a job comes "
+                                 "in during the wait. A negative value means not stop on deadlock.",
+                                 static_cast<int64_t>(0));
+  result &= registrar->parameter(max_duration_ms_,
+                                 "max_duration_ms",
+                                 "Max Duration [ms]",
+                                 "The maximum duration for which the scheduler will execute (in "
+                                 "ms). If not specified the scheduler will run until all work is "
+                                 "done. If periodic terms are present this means the application "
+                                 "will run indefinitely.",
+                                 nvidia::gxf::Registrar::NoDefaultParameter(),
+                                 GXF_PARAMETER_FLAGS_OPTIONAL);
+  result &= registrar->parameter(check_recession_period_ms_,
+                                 "check_recession_period_ms",
+                                 "Duration to sleep before checking the condition of an entity "
+                                 "again [ms]",
+                                 "The maximum duration for which the scheduler would wait (in ms) "
+                                 "before checking the condition of an entity waiting for an "
+                                 "event again.",
+                                 5.0);
+  result &= registrar->parameter(worker_cpu_cores_,
+                                 "worker_cpu_cores",
+                                 "Worker CPU cores",
+                                 "CPU core (OS index) each worker thread is pinned to. Worker i is "
+                                 "pinned to the core at index i modulo the number of cores.",
+                                 std::vector<int64_t>{});
+  result &= registrar->parameter(worker_numa_nodes_,
+                                 "worker_numa_nodes",
+                                 "Worker NUMA nodes",
+                                 "NUMA node (OS index) each worker thread is pinned to. Worker i "
+                                 "is pinned to the node at index i modulo the number of nodes. "
+                                 "Ignored if 'worker_cpu_cores' is set.",
+                                 std::vector<int64_t>{});
+  result &= registrar->parameter(operator_affinity_,
+                                 "operator_affinity",
+                                 "Operator affinity",
+                                 "Operators pinned to a worker thread, as "
+                                 "'<operator name>:<worker index>' entries. A pinned operator is "
+                                 "only executed by its worker.",
+                                 std::vector<std::string>{});
+  result &= registrar->parameter(shared_pool_,
+                                 "shared_pool",
+                                 "Shared worker pool",
+                                 "Name of the worker pool (shared with the other schedulers of the "
+                                 "process using the same name) executing the entities. The "
+                                 "scheduler creates its own workers if empty.",
+                                 std::string{});
+  result &= registrar->parameter(pool_priority_,
+                                 "pool_priority",
+                                 "Shared worker pool priority",
+                                 "Priority of the scheduler in the shared worker pool (the "
+                                 "entities of schedulers with a higher priority run first).",
+                                 static_cast<int64_t>(0));
+  result &= registrar->parameter(pool_max_workers_,
+                                 "pool_max_workers",
+                                 "Shared worker pool quota",
+                                 "Maximum number of workers of the shared worker pool executing "
+                                 "the entities of the scheduler at the same time (0 means no "
+                                 "limit).",
+                                 static_cast<int64_t>(0));
+  result &= registrar->parameter(python_workers_,
+                                 "python_workers",
+                                 "Python workers",
+                                 "Indices of the workers dedicated to the 'python_operators'. "
+                                 "These operators only run on these workers and the other "
+                                 "operators only on the other workers. Not used if empty.",
+                                 std::vector<int64_t>{});
+  result &= registrar->parameter(python_operators_,
+                                 "python_operators",
+                                 "Python operators",
+                                 "Names of the operators executed by the 'python_workers' (the "
+                                 "operators holding the Python GIL while they run).",
+                                 std::vector<std::string>{});
+  return nvidia::gxf::ToResultCode(result);
+}
+
+gxf_result_t WorkStealingScheduler::initialize() {
+  if (worker_thread_number_.get() < 1) {
+    HOLOSCAN_LOG_ERROR("WorkStealingScheduler: 'worker_thread_number' must be positive (got {})",
+                       worker_thread_number_.get());
+    return GXF_ARGUMENT_INVALID;
+  }
+  if (pool_max_workers_.get() < 0) {
+    HOLOSCAN_LOG_ERROR("WorkStealingScheduler: 'pool_max_workers' must not be negative (got {})",
+                       pool_max_workers_.get());
+    return GXF_ARGUMENT_INVALID;
+  }
+  const auto num_workers = static_cast<size_t>(worker_thread_number_.get());
+
+  entity_affinity_.clear();
+  for (const auto& entry : operator_affinity_.get()) {
+    const auto separator = entry.rfind(':');
+    size_t worker_index = 0;
+    bool valid = separator != std::string::npos && separator > 0;
+    if (valid) {
+      try {
+        size_t parsed = 0;
+        worker_index = std::stoul(entry.substr(separator + 1), &parsed);
+        valid = parsed == entry.size() - separator - 1;
+      } catch (const std::exception&) { valid = false; }
+    }
+    if (!valid || worker_index >= num_workers) {
+      HOLOSCAN_LOG_ERROR(
+          "WorkStealingScheduler: invalid 'operator_affinity' entry '{}' (expected "
+          "'<operator name>:<worker index>' with a worker index lower than {})",
+          entry,
+          num_workers);
+      return GXF_ARGUMENT_INVALID;
+    }
+    entity_affinity_[entry.substr(0, separator)] = worker_index;
+  }
+
+  std::vector<bool> is_python_worker(num_workers, false);
+  for (int64_t worker_index : python_workers_.get()) {
+    if (worker_index < 0 || worker_index >= worker_thread_number_.get()) {
+      HOLOSCAN_LOG_ERROR(
+          "WorkStealingScheduler: invalid 'python_workers' entry {} (expected a worker index "
+          "lower than {})",
+          worker_index,
+          num_workers);
+      return GXF_ARGUMENT_INVALID;
+    }
+    is_python_worker[worker_index] = true;
+  }
+  if (!python_workers_.get().empty() &&
+      std::all_of(is_python_worker.begin(), is_python_worker.end(), [](bool v) { return v; })) {
+    HOLOSCAN_LOG_ERROR(
+        "WorkStealingScheduler: 'python_workers' must leave at least one worker for the other "
+        "operators ({} workers)",
+        num_workers);
+    return GXF_ARGUMENT_INVALID;
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t WorkStealingScheduler::deinitialize() {
+  std::unique_lock<std::shared_mutex> lock(entities_mutex_);
+  entities_.clear();
+  return GXF_SUCCESS;
+}
+
+gxf_result_t WorkStealingScheduler::prepare_abi(nvidia::gxf::EntityExecutor* executor) {
+  executor_ = executor;
+  return GXF_SUCCESS;
+}
+
+gxf_result_t WorkStealingScheduler::schedule_abi(gxf_uid_t eid) {
+  EntityState* entity = nullptr;
+  {
+    std::unique_lock<std::shared_mutex> lock(entities_mutex_);
+    if (entities_.count(eid) != 0) { return GXF_SUCCESS; }
+    auto state =
+        std::make_unique<EntityState>(eid, find_entity_affinity(eid), is_python_entity(eid));
+    entity = state.get();
+    entities_.emplace(eid, std::move(state));
+  }
+  // Entities scheduled before runAsync_abi() are queued when the workers start
+  if (running_.load(std::memory_order_acquire)) { wake(entity, kWaiting); }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t WorkStealingScheduler::unschedule_abi(gxf_uid_t eid) {
+  std::shared_lock<std::shared_mutex> lock(entities_mutex_);
+  auto it = entities_.find(eid);
+  if (it == entities_.end()) { return GXF_SUCCESS; }
+  EntityState* entity = it->second.get();
+  entity->unscheduled.store(true, std::memory_order_release);
+  // A queued or running entity is retired by the worker executing it
+  for (int from_state : {kWaiting, kTimed}) {
+    int expected = from_state;
+    if (entity->state.compare_exchange_strong(expected, kDone, std::memory_order_acq_rel)) {
+      if (entity->event_waiting.exchange(false, std::memory_order_acq_rel)) {
+        num_event_waiting_.fetch_sub(1, std::memory_order_acq_rel);
+      }
+      num_done_.fetch_add(1, std::memory_order_acq_rel);
+      dispatcher_cv_.notify_one();
+      break;
+    }
+  }
+  return GXF_SUCCESS;
+}
+
+gxf_result_t WorkStealingScheduler::runAsync_abi() {
+  if (executor_ == nullptr) {
+    HOLOSCAN_LOG_ERROR("WorkStealingScheduler: no entity executor (prepare_abi was not called)");
+    return GXF_FAILURE;
+  }
+  if (clock_.get().is_null()) {
+    HOLOSCAN_LOG_ERROR("WorkStealingScheduler: no clock");
+    return GXF_ARGUMENT_NULL;
+  }
+  clock_ptr_ = clock_.get().get();
+  manual_clock_ = dynamic_cast<nvidia::gxf::ManualClock*>(clock_ptr_) != nullptr;
+
+  topology_.reset();
+  pool_.reset();
+  size_t num_workers = static_cast<size_t>(worker_thread_number_.get());
+  if (!shared_pool_.get().empty()) {
+    // The workers are pinned by the pool
+    SharedWorkerPool::Options options;
+    options.num_workers = num_workers;
+    options.cpu_cores = worker_cpu_cores_.get();
+    options.numa_nodes = worker_numa_nodes_.get();
+    pool_ = SharedWorkerPool::acquire(shared_pool_.get(), options);
+    num_workers = pool_->num_workers();
+  } else if (!worker_cpu_cores_.get().empty() || !worker_numa_nodes_.get().empty()) {
+    topology_ = std::make_unique<Topology>();
+    if (topology_->load() != 0) {
+      HOLOSCAN_LOG_WARN("WorkStealingScheduler: unable to load the hwloc topology, workers are "
+                        "not pinned");
+      topology_.reset();
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(workers_mutex_);
+    workers_.clear();
+    for (size_t i = 0; i < num_workers; ++i) { workers_.push_back(std::make_unique<Worker>()); }
+  }
+  python_worker_indices_.clear();
+  native_worker_indices_.clear();
+  if (!python_workers_.get().empty()) {
+    // A shared pool can have fewer workers than the scheduler was configured with
+    for (int64_t worker_index : python_workers_.get()) {
+      workers_[static_cast<size_t>(worker_index) % num_workers]->python = true;
+    }
+    for (size_t i = 0; i < num_workers; ++i) {
+      (workers_[i]->python ? python_worker_indices_ : native_worker_indices_).push_back(i);
+    }
+    if (native_worker_indices_.empty()) {
+      HOLOSCAN_LOG_WARN("WorkStealingScheduler: 'python_workers' covers all the {} workers of the "
+                        "shared pool, Python operators are not routed to dedicated workers",
+                        num_workers);
+      for (auto& worker : workers_) { worker->python = false; }
+      python_worker_indices_.clear();
+      native_worker_indices_.clear();
+    } else {
+      HOLOSCAN_LOG_DEBUG("WorkStealingScheduler: Python operators run on workers {}",
+                         fmt::join(python_worker_indices_, ", "));
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(dispatcher_mutex_);
+    timed_entities_ = {};
+  }
+  next_worker_.store(0, std::memory_order_relaxed);
+  num_idle_workers_.store(0, std::memory_order_relaxed);
+  num_active_.store(0, std::memory_order_relaxed);
+  num_done_.store(0, std::memory_order_relaxed);
+  num_event_waiting_.store(0, std::memory_order_relaxed);
+  activity_count_.store(0, std::memory_order_relaxed);
+  event_wakeups_.store(0, std::memory_order_relaxed);
+  timed_wakeups_.store(0, std::memory_order_relaxed);
+  polls_.store(0, std::memory_order_relaxed);
+  result_.store(GXF_SUCCESS, std::memory_order_relaxed);
+  stopping_.store(false, std::memory_order_release);
+  running_.store(true, std::memory_order_release);
+
+  // Queue all the entities: their scheduling conditions are checked on their first execution.
+  {
+    std::shared_lock<std::shared_mutex> lock(entities_mutex_);
+    for (auto& [eid, entity] : entities_) {
+      if (entity->unscheduled.load(std::memory_order_acquire)) {
+        entity->state.store(kDone, std::memory_order_release);
+        num_done_.fetch_add(1, std::memory_order_acq_rel);
+        continue;
+      }
+      entity->state.store(kWaiting, std::memory_order_release);
+      entity->notified.store(false, std::memory_order_relaxed);
+      entity->event_waiting.store(false, std::memory_order_relaxed);
+      wake(entity.get(), kWaiting);
+    }
+  }
+
+  if (pool_) {
+    pool_->attach(this, pool_priority_.get(), static_cast<size_t>(pool_max_workers_.get()));
+    HOLOSCAN_LOG_DEBUG(
+        "WorkStealingScheduler: using shared worker pool '{}' ({} workers, priority {})",
+        pool_->name(),
+        num_workers,
+        pool_priority_.get());
+  } else {
+    for (size_t i = 0; i < num_workers; ++i) {
+      threads_.emplace_back(&WorkStealingScheduler::worker_thread, this, i);
+    }
+  }
+  dispatcher_ = std::thread(&WorkStealingScheduler::dispatcher_thread, this);
+  return GXF_SUCCESS;
+}
+
+gxf_result_t WorkStealingScheduler::stop_abi() {
+  finish(GXF_SUCCESS);
+  return GXF_SUCCESS;
+}
+
+gxf_result_t WorkStealingScheduler::wait_abi() {
+  for (auto& thread : threads_) {
+    if (thread.joinable()) { thread.join(); }
+  }
+  threads_.clear();
+  if (dispatcher_.joinable()) { dispatcher_.join(); }
+  if (pool_) {
+    pool_->detach(this);
+    pool_.reset();
+  }
+  running_.store(false, std::memory_order_release);
+
+  const auto counters = stats();
+  HOLOSCAN_LOG_DEBUG(
+      "WorkStealingScheduler: {} executions ({} local, {} stolen), {} affinity hits, "
+      "{} migrations, {} idle waits, {} event wakeups, {} timed wakeups, {} polls",
+      counters.executions,
+      counters.local_pops,
+      counters.steals,
+      counters.affinity_hits,
+      counters.migrations,
+      counters.idle_waits,
+      counters.event_wakeups,
+      counters.timed_wakeups,
+      counters.polls);
+  return result_.load(std::memory_order_acquire);
+}
+
+gxf_result_t WorkStealingScheduler::event_notify_abi(gxf_uid_t eid, gxf_event_t event) {
+  (void)event;
+  std::shared_lock<std::shared_mutex> lock(entities_mutex_);
+  auto it = entities_.find(eid);
+  if (it == entities_.end()) { return GXF_SUCCESS; }
+  EntityState* entity = it->second.get();
+
+  // If the entity is running, it is queued again by its worker once the execution is done.
+  entity->notified.store(true, std::memory_order_release);
+  if (running_.load(std::memory_order_acquire) &&
+      (wake(entity, kWaiting) || wake(entity, kTimed))) {
+    event_wakeups_.fetch_add(1, std::memory_order_relaxed);
+  }
+  return GXF_SUCCESS;
+}
+
+WorkStealingSchedulerStats WorkStealingScheduler::stats() const {
+  WorkStealingSchedulerStats counters;
+  std::lock_guard<std::mutex> lock(workers_mutex_);
+  for (const auto& worker : workers_) {
+    counters.executions += worker->executions.load(std::memory_order_relaxed);
+    counters.local_pops += worker->local_pops.load(std::memory_order_relaxed);
+    counters.steals += worker->steals.load(std::memory_order_relaxed);
+    counters.affinity_hits += worker->affinity_hits.load(std::memory_order_relaxed);
+    counters.migrations += worker->migrations.load(std::memory_order_relaxed);
+    counters.idle_waits += worker->idle_waits.load(std::memory_order_relaxed);
+  }
+  counters.event_wakeups = event_wakeups_.load(std::memory_order_relaxed);
+  counters.timed_wakeups = timed_wakeups_.load(std::memory_order_relaxed);
+  counters.polls = polls_.load(std::memory_order_relaxed);
+  return counters;
+}
+
+void WorkStealingScheduler::pin_worker(size_t worker_index) {
+  if (!topology_) { return; }
+  const auto& cores = worker_cpu_cores_.get();
+  const auto& nodes = worker_numa_nodes_.get();
+
+  int result = 0;
+  std::string target;
+  if (!cores.empty()) {
+    const int64_t core = cores[worker_index % cores.size()];
+    result = topology_->bind_thread_to_cpu(core);
+    target = fmt::format("CPU core {}", core);
+  } else {
+    const int64_t node = nodes[worker_index % nodes.size()];
+    result = topology_->bind_thread_to_numa_node(node);
+    target = fmt::format("NUMA node {}", node);
+  }
+
+  if (result != 0) {
+    HOLOSCAN_LOG_WARN("WorkStealingScheduler: unable to pin worker {} to {}: {}",
+                      worker_index,
+                      target,
+                      std::strerror(errno));
+  } else {
+    HOLOSCAN_LOG_DEBUG("WorkStealingScheduler: worker {} pinned to {}", worker_index, target);
+  }
+}
+
+void WorkStealingScheduler::worker_thread(size_t worker_index) {
+  pin_worker(worker_index);
+
+  Worker& self = *workers_[worker_index];
+
+  while (!stopping_.load(std::memory_order_acquire)) {
+    EntityState* entity = pop_local(self);
+    if (entity != nullptr) {
+      self.local_pops.fetch_add(1, std::memory_order_relaxed);
+    } else if ((entity = steal(worker_index)) != nullptr) {
+      self.steals.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (entity == nullptr) {
+      // Sleep until work is queued on this worker or enqueue() wakes it up to steal work queued
+      // on a busy worker. The worker is announced as idle before a last attempt to steal: an
+      // entity queued in between is either found by this attempt (which waits for the locks of
+      // the other workers) or its enqueue() sees the worker as idle.
+      {
+        std::lock_guard<std::mutex> lock(self.mutex);
+        self.idle = true;
+        num_idle_workers_.fetch_add(1);
+      }
+      entity = steal(worker_index, true);
+      std::unique_lock<std::mutex> lock(self.mutex);
+      if (entity == nullptr) {
+        self.idle_waits.fetch_add(1, std::memory_order_relaxed);
+        self.cv.wait(lock, [this, &self] {
+          return !self.queue.empty() || self.wake || stopping_.load(std::memory_order_acquire);
+        });
+      } else {
+        self.steals.fetch_add(1, std::memory_order_relaxed);
+      }
+      self.idle = false;
+      self.wake = false;
+      num_idle_workers_.fetch_sub(1);
+      if (entity == nullptr) { continue; }
+    }
+    execute(worker_index, entity);
+  }
+}
+
+bool WorkStealingScheduler::run_once(size_t worker_index) {
+  if (stopping_.load(std::memory_order_acquire) || worker_index >= workers_.size()) {
+    return false;
+  }
+  Worker& self = *workers_[worker_index];
+  // The pool worker sleeps until the next notification if nothing is found, so the steal waits
+  // for the queues that are locked instead of skipping them
+  EntityState* entity = pop_local(self);
+  if (entity != nullptr) {
+    self.local_pops.fetch_add(1, std::memory_order_relaxed);
+  } else if ((entity = steal(worker_index, true)) != nullptr) {
+    self.steals.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    return false;
+  }
+  execute(worker_index, entity);
+  return true;
+}
+
+WorkStealingScheduler::EntityState* WorkStealingScheduler::pop_local(Worker& worker) {
+  if (worker.size.load(std::memory_order_acquire) == 0) { return nullptr; }
+  std::lock_guard<std::mutex> lock(worker.mutex);
+  if (worker.queue.empty()) { return nullptr; }
+  EntityState* entity = worker.queue.front();
+  worker.queue.pop_front();
+  worker.size.store(worker.queue.size(), std::memory_order_release);
+  if (entity->pinned_worker < 0) { worker.stealable.fetch_sub(1); }
+  return entity;
+}
+
+WorkStealingScheduler::EntityState* WorkStealingScheduler::steal(size_t thief_index,
+                                                                  bool wait_for_lock) {
+  const size_t num_workers = workers_.size();
+  const bool routed = !python_worker_indices_.empty();
+  const bool thief_python = workers_[thief_index]->python;
+  for (size_t offset = 1; offset < num_workers; ++offset) {
+    Worker& victim = *workers_[(thief_index + offset) % num_workers];
+    if (victim.stealable.load() == 0) { continue; }
+    // The entities queued on a worker of the other kind must not run on this worker
+    if (routed && victim.python != thief_python) { continue; }
+    std::unique_lock<std::mutex> lock(victim.mutex, std::defer_lock);
+    if (wait_for_lock) {
+      lock.lock();
+    } else if (!lock.try_lock()) {
+      continue;
+    }
+    // Take the most recently queued entity that is not pinned to the victim: the oldest ones
+    // are the next to run on the victim and the most likely to have their data in its caches.
+    for (auto it = victim.queue.rbegin(); it != victim.queue.rend(); ++it) {
+      if ((*it)->pinned_worker >= 0) { continue; }
+      EntityState* entity = *it;
+      victim.queue.erase(std::next(it).base());
+      victim.size.store(victim.queue.size(), std::memory_order_release);
+      victim.stealable.fetch_sub(1);
+      return entity;
+    }
+  }
+  return nullptr;
+}
+
+void WorkStealingScheduler::execute(size_t worker_index, EntityState* entity) {
+  Worker& self = *workers_[worker_index];
+  const bool polled = entity->polled.exchange(false, std::memory_order_acq_rel);
+  if (entity->event_waiting.exchange(false, std::memory_order_acq_rel)) {
+    num_event_waiting_.fetch_sub(1, std::memory_order_acq_rel);
+  }
+
+  if (entity->unscheduled.load(std::memory_order_acquire)) {
+    entity->state.store(kDone, std::memory_order_release);
+    num_done_.fetch_add(1, std::memory_order_acq_rel);
+    num_active_.fetch_sub(1, std::memory_order_acq_rel);
+    dispatcher_cv_.notify_one();
+    return;
+  }
+
+  entity->state.store(kRunning, std::memory_order_release);
+  entity->notified.store(false, std::memory_order_release);
+  const int last_worker = entity->last_worker.exchange(static_cast<int>(worker_index),
+                                                       std::memory_order_relaxed);
+  if (last_worker == static_cast<int>(worker_index)) {
+    self.affinity_hits.fetch_add(1, std::memory_order_relaxed);
+  } else if (last_worker >= 0) {
+    self.migrations.fetch_add(1, std::memory_order_relaxed);
+  }
+  self.executions.fetch_add(1, std::memory_order_relaxed);
+
+  auto condition = executor_->executeEntity(entity->eid, clock_ptr_->timestamp());
+  if (!condition) {
+    HOLOSCAN_LOG_ERROR("WorkStealingScheduler: failed to execute entity {}: {}",
+                       entity->eid,
+                       GxfResultStr(condition.error()));
+    entity->state.store(kDone, std::memory_order_release);
+    num_done_.fetch_add(1, std::memory_order_acq_rel);
+    num_active_.fetch_sub(1, std::memory_order_acq_rel);
+    finish(condition.error());
+    return;
+  }
+
+  // The entity is queued again (or its waiting state is published) before it stops being
+  // counted as active, so that the deadlock detection never sees a transient idle state.
+  switch (condition->type) {
+    case nvidia::gxf::SchedulingConditionType::READY:
+      activity_count_.fetch_add(1, std::memory_order_acq_rel);
+      entity->state.store(kQueued, std::memory_order_release);
+      enqueue(entity, preferred_worker(entity));
+      break;
+    case nvidia::gxf::SchedulingConditionType::WAIT_TIME:
+      activity_count_.fetch_add(1, std::memory_order_acq_rel);
+      {
+        // The state and the generation change together so that the dispatcher never wakes the
+        // entity up from an entry of a previous timed wait
+        std::lock_guard<std::mutex> lock(dispatcher_mutex_);
+        entity->state.store(kTimed, std::memory_order_release);
+        timed_entities_.push(
+            TimedEntry{condition->target_timestamp, ++entity->timed_generation, entity});
+      }
+      dispatcher_cv_.notify_one();
+      if (entity->notified.exchange(false, std::memory_order_acq_rel) && wake(entity, kTimed)) {
+        event_wakeups_.fetch_add(1, std::memory_order_relaxed);
+      }
+      break;
+    case nvidia::gxf::SchedulingConditionType::WAIT_EVENT:
+      // The entity waits for an asynchronous event (e.g., an AsynchronousCondition), so the
+      // application is not considered in deadlock while it waits.
+      entity->event_waiting.store(true, std::memory_order_release);
+      num_event_waiting_.fetch_add(1, std::memory_order_acq_rel);
+      [[fallthrough]];
+    case nvidia::gxf::SchedulingConditionType::WAIT:
+      // A condition check of a polled entity that is still waiting is not an activity
+      if (!polled) { activity_count_.fetch_add(1, std::memory_order_acq_rel); }
+      entity->state.store(kWaiting, std::memory_order_release);
+      if (entity->notified.exchange(false, std::memory_order_acq_rel) && wake(entity, kWaiting)) {
+        event_wakeups_.fetch_add(1, std::memory_order_relaxed);
+      }
+      break;
+    case nvidia::gxf::SchedulingConditionType::NEVER:
+    default:
+      activity_count_.fetch_add(1, std::memory_order_acq_rel);
+      entity->state.store(kDone, std::memory_order_release);
+      num_done_.fetch_add(1, std::memory_order_acq_rel);
+      dispatcher_cv_.notify_one();
+      break;
+  }
+  num_active_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void WorkStealingScheduler::enqueue(EntityState* entity, size_t worker_index) {
+  num_active_.fetch_add(1, std::memory_order_acq_rel);
+  Worker& worker = *workers_[worker_index];
+  const bool stealable = entity->pinned_worker < 0;
+  bool worker_idle = false;
+  {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.queue.push_back(entity);
+    worker.size.store(worker.queue.size(), std::memory_order_release);
+    if (stealable) { worker.stealable.fetch_add(1); }
+    worker_idle = worker.idle;
+  }
+  if (pool_) {
+    pool_->notify();
+    return;
+  }
+  worker.cv.notify_one();
+
+  // Idle workers block until they are notified, so one of them is woken up to steal the entity
+  // if its preferred worker is busy
+  if (stealable && !worker_idle && num_idle_workers_.load() > 0) {
+    const size_t num_workers = workers_.size();
+    for (size_t offset = 1; offset < num_workers; ++offset) {
+      Worker& other = *workers_[(worker_index + offset) % num_workers];
+      if (!runs_on(entity, other)) { continue; }
+      std::unique_lock<std::mutex> lock(other.mutex);
+      if (!other.idle || other.wake) { continue; }
+      other.wake = true;
+      lock.unlock();
+      other.cv.notify_one();
+      break;
+    }
+  }
+}
+
+bool WorkStealingScheduler::wake(EntityState* entity, int from_state, bool polled) {
+  int expected = from_state;
+  if (!entity->state.compare_exchange_strong(expected, kQueued, std::memory_order_acq_rel)) {
+    return false;
+  }
+  entity->polled.store(polled, std::memory_order_release);
+  enqueue(entity, preferred_worker(entity));
+  return true;
+}
+
+size_t WorkStealingScheduler::preferred_worker(EntityState* entity) {
+  // A shared pool can have fewer workers than the scheduler was configured with
+  if (entity->pinned_worker >= 0) {
+    return static_cast<size_t>(entity->pinned_worker) % workers_.size();
+  }
+  const int last_worker = entity->last_worker.load(std::memory_order_relaxed);
+  if (last_worker >= 0 && runs_on(entity, *workers_[last_worker])) {
+    return static_cast<size_t>(last_worker);
+  }
+  if (!python_worker_indices_.empty()) {
+    const auto& indices = entity->python ? python_worker_indices_ : native_worker_indices_;
+    return indices[next_worker_.fetch_add(1, std::memory_order_relaxed) % indices.size()];
+  }
+  return next_worker_.fetch_add(1, std::memory_order_relaxed) % workers_.size();
+}
+
+bool WorkStealingScheduler::runs_on(const EntityState* entity, const Worker& worker) const {
+  return python_worker_indices_.empty() || entity->python == worker.python;
+}
+
+void WorkStealingScheduler::finish(gxf_result_t code) {
+  if (code != GXF_SUCCESS) {
+    gxf_result_t expected = GXF_SUCCESS;
+    result_.compare_exchange_strong(expected, code, std::memory_order_acq_rel);
+  }
+  {
+    std::lock_guard<std::mutex> lock(dispatcher_mutex_);
+    stopping_.store(true, std::memory_order_release);
+  }
+  dispatcher_cv_.notify_all();
+  for (auto& worker : workers_) {
+    {
+      std::lock_guard<std::mutex> lock(worker->mutex);
+      worker->wake = true;
+    }
+    worker->cv.notify_all();
+  }
+}
+
+int WorkStealingScheduler::find_entity_affinity(gxf_uid_t eid) const {
+  if (entity_affinity_.empty()) { return -1; }
+  const char* name = nullptr;
+  if (GxfEntityGetName(context(), eid, &name) != GXF_SUCCESS || name == nullptr) { return -1; }
+  const std::string entity_name(name);
+  for (const auto& [operator_name, worker_index] : entity_affinity_) {
+    if (is_operator_entity(entity_name, operator_name)) { return static_cast<int>(worker_index); }
+  }
+  return -1;
+}
+
+bool WorkStealingScheduler::is_python_entity(gxf_uid_t eid) const {
+  if (python_workers_.get().empty() || python_operators_.get().empty()) { return false; }
+  const char* name = nullptr;
+  if (GxfEntityGetName(context(), eid, &name) != GXF_SUCCESS || name == nullptr) { return false; }
+  const std::string entity_name(name);
+  return std::any_of(python_operators_.get().begin(),
+                     python_operators_.get().end(),
+                     [&entity_name](const std::string& operator_name) {
+                       return is_operator_entity(entity_name, operator_name);
+                     });
+}
+
+void WorkStealingScheduler::dispatcher_thread() {
+  // The periodic condition check and the deadlock timeout use the steady clock (the scheduler
+  // clock could be a manual clock), the target times of the entities use the scheduler clock.
+  using SteadyClock = std::chrono::steady_clock;
+  const auto recession_period = std::chrono::duration_cast<SteadyClock::duration>(
+      std::chrono::duration<double, std::milli>(std::max(check_recession_period_ms_.get(), 0.0)));
+  const auto max_duration_ms = max_duration_ms_.try_get();
+  const bool has_max_duration = static_cast<bool>(max_duration_ms);
+  const int64_t max_duration_ns = has_max_duration ? max_duration_ms.value() * 1'000'000 : 0;
+  const int64_t start_time = clock_ptr_->timestamp();
+
+  auto next_poll_time = SteadyClock::now() + recession_period;
+  bool poll_pending = false;  // a condition check was issued while nothing else was active
+  uint64_t activity_at_poll = 0;
+  bool idle = false;
+  auto idle_since = SteadyClock::now();
+
+  while (!stopping_.load(std::memory_order_acquire)) {
+    const int64_t now = clock_ptr_->timestamp();
+    const auto steady_now = SteadyClock::now();
+
+    if (has_max_duration && now - start_time >= max_duration_ns) {
+      HOLOSCAN_LOG_DEBUG("WorkStealingScheduler: max duration of {} ms reached",
+                         max_duration_ms.value());
+      finish(GXF_SUCCESS);
+      break;
+    }
+    size_t num_entities = 0;
+    {
+      std::shared_lock<std::shared_mutex> lock(entities_mutex_);
+      num_entities = entities_.size();
+    }
+    if (num_done_.load(std::memory_order_acquire) >= static_cast<int64_t>(num_entities)) {
+      HOLOSCAN_LOG_DEBUG("WorkStealingScheduler: all entities are done");
+      finish(GXF_SUCCESS);
+      break;
+    }
+
+    // Queue the entities whose target time is reached
+    int64_t next_target_time = std::numeric_limits<int64_t>::max();
+    bool has_timed_entities = false;
+    {
+      // Stale entries are dropped whatever their time so that they neither wake the entity up
+      // early nor keep the dispatcher waking up or the deadlock detection waiting for them. The
+      // entity is woken up under the lock, before it can start a new timed wait.
+      std::lock_guard<std::mutex> lock(dispatcher_mutex_);
+      while (!timed_entities_.empty()) {
+        const TimedEntry entry = timed_entities_.top();
+        const bool stale = entry.generation != entry.entity->timed_generation ||
+                           entry.entity->state.load(std::memory_order_acquire) != kTimed;
+        if (!stale && entry.target_time > now) { break; }
+        timed_entities_.pop();
+        if (!stale && wake(entry.entity, kTimed)) {
+          timed_wakeups_.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+      if (!timed_entities_.empty()) {
+        next_target_time = timed_entities_.top().target_time;
+        has_timed_entities = true;
+      }
+    }
+
+    // Deadlock detection: nothing is queued or running, no entity waits for a time or an
+    // asynchronous event, and the last condition check of the waiting entities did not make
+    // anything progress.
+    const bool stop_on_deadlock =
+        stop_on_deadlock_.get() && stop_on_deadlock_timeout_.get() >= 0;
+    const bool no_active = num_active_.load(std::memory_order_acquire) == 0;
+    const bool progress = activity_count_.load(std::memory_order_acquire) != activity_at_poll;
+    if (stop_on_deadlock && no_active && !has_timed_entities && poll_pending && !progress &&
+        num_event_waiting_.load(std::memory_order_acquire) == 0) {
+      if (!idle) {
+        idle = true;
+        idle_since = steady_now;
+      }
+      if (steady_now - idle_since >= std::chrono::milliseconds(stop_on_deadlock_timeout_.get())) {
+        HOLOSCAN_LOG_DEBUG("WorkStealingScheduler: deadlock detected, stopping");
+        finish(GXF_SUCCESS);
+        break;
+      }
+    } else if (progress || !poll_pending) {
+      idle = false;
+    }
+
+    // Check the conditions of the entities waiting for an event again
+    if (steady_now >= next_poll_time) {
+      next_poll_time = steady_now + recession_period;
+      poll_pending = no_active;
+      activity_at_poll = activity_count_.load(std::memory_order_acquire);
+      std::shared_lock<std::shared_mutex> lock(entities_mutex_);
+      for (auto& [eid, entity] : entities_) {
+        if (wake(entity.get(), kWaiting, true)) { polls_.fetch_add(1, std::memory_order_relaxed); }
+      }
+    }
+
+    if (manual_clock_ && has_timed_entities && num_active_.load(std::memory_order_acquire) == 0) {
+      // With a manual clock, time jumps to the next target time when nothing else can run
+      clock_ptr_->sleepUntil(next_target_time);
+      continue;
+    }
+
+    // Sleep until the next target time, the next condition check or a notification
+    std::unique_lock<std::mutex> lock(dispatcher_mutex_);
+    if (stopping_.load(std::memory_order_acquire)) { break; }
+    auto wait_time = next_poll_time - SteadyClock::now();
+    if (!timed_entities_.empty()) {
+      const auto time_to_target =
+          std::chrono::nanoseconds(timed_entities_.top().target_time - clock_ptr_->timestamp());
+      wait_time = std::min<SteadyClock::duration>(wait_time, time_to_target);
+    }
+    if (wait_time > SteadyClock::duration::zero()) { dispatcher_cv_.wait_for(lock, wait_time); }
+  }
+}
+
+}  // namespace holoscan::gxf
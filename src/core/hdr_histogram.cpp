@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/hdr_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace holoscan {
+
+namespace {
+
+// Each bucket is split in 2^kSubBucketHalfCountMagnitude sub-buckets (the first bucket in twice
+// as many), which gives a precision of two significant decimal digits.
+constexpr int kSubBucketHalfCountMagnitude = 7;
+constexpr int64_t kSubBucketHalfCount = int64_t{1} << kSubBucketHalfCountMagnitude;
+constexpr int64_t kSubBucketMask = (kSubBucketHalfCount << 1) - 1;
+
+constexpr size_t compute_bucket_array_size() {
+  int64_t smallest_untrackable_value = kSubBucketHalfCount << 1;
+  size_t bucket_count = 1;
+  while (smallest_untrackable_value <= HdrHistogram::kMaxValue) {
+    smallest_untrackable_value <<= 1;
+    ++bucket_count;
+  }
+  return (bucket_count + 1) * kSubBucketHalfCount;
+}
+
+constexpr size_t kBucketArraySize = compute_bucket_array_size();
+
+}  // namespace
+
+HdrHistogram::HdrHistogram() : counts_(new std::atomic<uint64_t>[kBucketArraySize]) {
+  for (size_t i = 0; i < kBucketArraySize; ++i) {
+    counts_[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+void HdrHistogram::record(int64_t value) {
+  value = std::clamp<int64_t>(value, 0, kMaxValue);
+  counts_[counts_index(value)].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t HdrHistogram::total_count() const {
+  uint64_t total = 0;
+  for (size_t i = 0; i < kBucketArraySize; ++i) {
+    total += counts_[i].load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+void HdrHistogram::add_to(std::vector<uint64_t>& counts) const {
+  if (counts.empty()) { counts.resize(kBucketArraySize, 0); }
+  for (size_t i = 0; i < kBucketArraySize; ++i) {
+    counts[i] += counts_[i].load(std::memory_order_relaxed);
+  }
+}
+
+int64_t HdrHistogram::value_at_percentile(const std::vector<uint64_t>& counts,
+                                          double percentile) {
+  uint64_t total = 0;
+  for (auto count : counts) { total += count; }
+  if (total == 0) { return 0; }
+
+  percentile = std::clamp(percentile, 0.0, 100.0);
+  auto target = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(total)));
+  target = std::max<uint64_t>(target, 1);
+
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < counts.size(); ++i) {
+    cumulative += counts[i];
+    if (cumulative >= target) { return highest_equivalent_value(i); }
+  }
+  return kMaxValue;
+}
+
+size_t HdrHistogram::bucket_array_size() {
+  return kBucketArraySize;
+}
+
+size_t HdrHistogram::counts_index(int64_t value) {
+  // Bucket 0 holds the values [0, 2 * kSubBucketHalfCount) with a unit width. Bucket N > 0 holds
+  // the values [kSubBucketHalfCount << (N + 1), kSubBucketHalfCount << (N + 2)) with a width of
+  // 2^N, so only its upper half of sub-buckets is used.
+  const int pow2_ceiling = 64 - __builtin_clzll(static_cast<uint64_t>(value | kSubBucketMask));
+  const int bucket_index = pow2_ceiling - (kSubBucketHalfCountMagnitude + 1);
+  const int64_t sub_bucket_index = value >> bucket_index;
+  return static_cast<size_t>(((static_cast<int64_t>(bucket_index) + 1)
+                              << kSubBucketHalfCountMagnitude) +
+                             (sub_bucket_index - kSubBucketHalfCount));
+}
+
+int64_t HdrHistogram::highest_equivalent_value(size_t index) {
+  const auto signed_index = static_cast<int64_t>(index);
+  if (signed_index < (kSubBucketHalfCount << 1)) { return signed_index; }
+  const int bucket_index = static_cast<int>(signed_index >> kSubBucketHalfCountMagnitude) - 1;
+  const int64_t sub_bucket_index = (signed_index & (kSubBucketHalfCount - 1)) + kSubBucketHalfCount;
+  const int64_t lowest_value = sub_bucket_index << bucket_index;
+  return lowest_value + (int64_t{1} << bucket_index) - 1;
+}
+
+}  // namespace holoscan
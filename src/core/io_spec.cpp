@@ -36,6 +36,8 @@ YAML::Node IOSpec::to_yaml_node() const {
       {ConnectorType::kDefault, "kDefault"s},
       {ConnectorType::kDoubleBuffer, "kDoubleBuffer"s},
       {ConnectorType::kUCX, "kUCX"s},
+      {ConnectorType::kSharedMemory, "kSharedMemory"s},
+      {ConnectorType::kSpscRing, "kSpscRing"s},
   };
 
   node["name"] = name();
@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: Copyright (c) 2023 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-FileCopyrightText: Copyright (c) 2023-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: Apache-2.0
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
@@ -17,8 +17,13 @@
 
 #include <limits.h>
 #include <algorithm>
+#include <deque>
 #include <iterator>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "holoscan/core/messagelabel.hpp"
@@ -27,13 +32,145 @@
 
 namespace holoscan {
 
-OperatorTimestampLabel& OperatorTimestampLabel::operator=(const OperatorTimestampLabel& o) {
-  if (this != &o) {
-    this->operator_ptr = o.operator_ptr;
-    this->rec_timestamp = o.rec_timestamp;
-    this->pub_timestamp = o.pub_timestamp;
+namespace {
+
+// Process-wide table of the operator names, indexed by operator ID
+struct OperatorIdTable {
+  std::shared_mutex mutex;
+  std::unordered_map<std::string, uint32_t> ids;
+  std::deque<std::string> names;  // a deque keeps references to the names valid
+};
+
+OperatorIdTable& operator_id_table() {
+  static OperatorIdTable table;
+  return table;
+}
+
+// Version of the binary representation written by MessageLabel::serialize()
+constexpr uint8_t kSerializedLabelVersion = 1;
+
+void write_varint(std::vector<uint8_t>& buffer, uint64_t value) {
+  while (value >= 0x80) {
+    buffer.push_back(static_cast<uint8_t>(value) | 0x80);
+    value >>= 7;
+  }
+  buffer.push_back(static_cast<uint8_t>(value));
+}
+
+void write_signed_varint(std::vector<uint8_t>& buffer, int64_t value) {
+  // zigzag encoding so that small negative values are also small
+  write_varint(buffer, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+// Reads the serialized label and reports an error once it runs past the end of the data
+class LabelReader {
+ public:
+  LabelReader(const uint8_t* data, size_t size) : data_(data), end_(data + size) {}
+
+  bool ok() const { return ok_; }
+
+  uint8_t read_byte() {
+    if (data_ == end_) {
+      ok_ = false;
+      return 0;
+    }
+    return *data_++;
+  }
+
+  uint64_t read_varint() {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64 && ok_; shift += 7) {
+      uint8_t byte = read_byte();
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if (!(byte & 0x80)) { return value; }
+    }
+    ok_ = false;
+    return 0;
+  }
+
+  int64_t read_signed_varint() {
+    uint64_t value = read_varint();
+    return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
   }
-  return *this;
+
+  std::string read_string(size_t size) {
+    if (static_cast<size_t>(end_ - data_) < size) {
+      ok_ = false;
+      return {};
+    }
+    std::string value(reinterpret_cast<const char*>(data_), size);
+    data_ += size;
+    return value;
+  }
+
+ private:
+  const uint8_t* data_;
+  const uint8_t* end_;
+  bool ok_ = true;
+};
+
+}  // namespace
+
+OperatorTimestampLabel::OperatorTimestampLabel(Operator* op)
+    : operator_ptr(op),
+      operator_id(MessageLabel::operator_id(op)),
+      rec_timestamp(get_current_time_us()),
+      pub_timestamp(-1) {}
+
+OperatorTimestampLabel::OperatorTimestampLabel(Operator* op, int64_t rec_t, int64_t pub_t)
+    : operator_ptr(op),
+      operator_id(MessageLabel::operator_id(op)),
+      rec_timestamp(rec_t),
+      pub_timestamp(pub_t) {}
+
+OperatorTimestampLabel::OperatorTimestampLabel(const std::string& op_name, int64_t rec_t,
+                                               int64_t pub_t)
+    : operator_id(MessageLabel::operator_id(op_name)), rec_timestamp(rec_t), pub_timestamp(pub_t) {}
+
+const std::string& OperatorTimestampLabel::operator_name() const {
+  if (operator_ptr) { return operator_ptr->name(); }
+  return MessageLabel::operator_name(operator_id);
+}
+
+uint32_t MessageLabel::operator_id(const std::string& op_name) {
+  if (auto op_id = find_operator_id(op_name)) { return op_id.value(); }
+  auto& table = operator_id_table();
+  std::unique_lock lock(table.mutex);
+  auto [it, inserted] = table.ids.try_emplace(op_name, static_cast<uint32_t>(table.names.size()));
+  if (inserted) { table.names.push_back(op_name); }
+  return it->second;
+}
+
+std::optional<uint32_t> MessageLabel::find_operator_id(const std::string& op_name) {
+  auto& table = operator_id_table();
+  std::shared_lock lock(table.mutex);
+  auto it = table.ids.find(op_name);
+  if (it == table.ids.end()) { return std::nullopt; }
+  return it->second;
+}
+
+uint32_t MessageLabel::operator_id(const Operator* op) {
+  if (!op) { return kInvalidOperatorId; }
+  // The ID is cached by the operator when it is initialized
+  if (op->message_label_operator_id_ != kInvalidOperatorId) {
+    return op->message_label_operator_id_;
+  }
+  return operator_id(op->name());
+}
+
+const std::string& MessageLabel::operator_name(uint32_t op_id) {
+  static const std::string empty_name;
+  auto& table = operator_id_table();
+  std::shared_lock lock(table.mutex);
+  if (op_id >= table.names.size()) { return empty_name; }
+  return table.names[op_id];
+}
+
+std::vector<MessageLabel::TimestampedPath> MessageLabel::paths() {
+  std::vector<TimestampedPath> all_paths;
+  all_paths.reserve(message_paths.size());
+  for (const auto& path : message_paths) { all_paths.push_back(*path); }
+  return all_paths;
 }
 
 int64_t MessageLabel::get_e2e_latency(int index) {
@@ -42,7 +179,7 @@ int64_t MessageLabel::get_e2e_latency(int index) {
     return -1;
   }
 
-  auto cur_path = message_paths[index];
+  const auto& cur_path = *message_paths[index];
 
   return (cur_path.back().pub_timestamp - cur_path.front().rec_timestamp);
 }
@@ -59,21 +196,22 @@ void MessageLabel::print_all() {
 
 std::string MessageLabel::to_string() const {
   auto msg_buf = fmt::memory_buffer();
-  for (auto it : message_paths) {
-    fmt::format_to(std::back_inserter(msg_buf), "{}", to_string(it));
+  for (const auto& it : message_paths) {
+    fmt::format_to(std::back_inserter(msg_buf), "{}", to_string(*it));
   }
   return fmt::to_string(msg_buf);
 }
 
-std::string MessageLabel::to_string(MessageLabel::TimestampedPath path) {
+std::string MessageLabel::to_string(const MessageLabel::TimestampedPath& path) {
   auto msg_buf = fmt::memory_buffer();
-  for (auto it : path) {
-    if (!it.operator_ptr) {
-      HOLOSCAN_LOG_ERROR("MessageLabel::to_string - Operator pointer is null");
+  for (const auto& it : path) {
+    const auto& op_name = it.operator_name();
+    if (op_name.empty()) {
+      HOLOSCAN_LOG_ERROR("MessageLabel::to_string - Operator is not known");
     } else {
       fmt::format_to(std::back_inserter(msg_buf),
                      "({},{},{}) -> ",
-                     it.operator_ptr->name(),
+                     op_name,
                      std::to_string(it.rec_timestamp),
                      std::to_string(it.pub_timestamp));
     }
@@ -90,55 +228,68 @@ std::vector<std::string> MessageLabel::get_all_path_names() {
   return all_paths;
 }
 
+MessageLabel::TimestampedPath& MessageLabel::mutable_path(int index) {
+  auto& path = message_paths[index];
+  // The path is only referenced by this label, so it can be modified in place. Another label
+  // releasing its reference concurrently only results in an unnecessary copy.
+  if (path.use_count() > 1) {
+    auto new_path = std::make_shared<TimestampedPath>();
+    new_path->reserve(std::max<size_t>(path->size() + 1, DEFAULT_PATH_LENGTH));
+    new_path->insert(new_path->end(), path->begin(), path->end());
+    path = std::move(new_path);
+  }
+  return *path;
+}
+
 void MessageLabel::add_new_op_timestamp(holoscan::OperatorTimestampLabel o_timestamp) {
   if (message_paths.empty()) {
-    // By default, allocate space for DEFAULT_PATH_LENGTH Operators in a path
-    TimestampedPath new_path;
-    new_path.reserve(DEFAULT_PATH_LENGTH);
-
-    message_paths.push_back(new_path);
-    message_paths[0].push_back(o_timestamp);
-
-    PathOperators new_path_operators;
-    new_path_operators.insert(o_timestamp.operator_ptr->name());
-    message_path_operators.push_back(new_path_operators);
+    // By default, allocate space for DEFAULT_NUM_PATHS paths and DEFAULT_PATH_LENGTH Operators in
+    // a path
+    message_paths.reserve(DEFAULT_NUM_PATHS);
+    auto new_path = std::make_shared<TimestampedPath>();
+    new_path->reserve(DEFAULT_PATH_LENGTH);
+    new_path->push_back(o_timestamp);
+    message_paths.push_back(std::move(new_path));
   } else {
-    for (int i = 0; i < num_paths(); i++) {
-      // By default, allocate space for DEFAULT_PATH_LENGTH Operators in a path
-      if (message_paths[i].capacity() < DEFAULT_PATH_LENGTH)
-        message_paths[i].reserve(DEFAULT_PATH_LENGTH);
-      message_paths[i].push_back(o_timestamp);
-
-      // Add the new operator to the set of operators in the path
-      message_path_operators[i].insert(o_timestamp.operator_ptr->name());
-    }
+    for (int i = 0; i < num_paths(); i++) { mutable_path(i).push_back(o_timestamp); }
   }
 }
 
 void MessageLabel::update_last_op_publish() {
-  for (auto& path : message_paths) { path.back().pub_timestamp = get_current_time_us(); }
+  int64_t current_time = get_current_time_us();
+  for (int i = 0; i < num_paths(); i++) { mutable_path(i).back().pub_timestamp = current_time; }
 }
 
 void MessageLabel::add_new_path(MessageLabel::TimestampedPath path) {
-  message_paths.push_back(path);
-  PathOperators new_path_operators;
-  for (auto& op : path) { new_path_operators.insert(op.operator_ptr->name()); }
-  message_path_operators.push_back(new_path_operators);
+  if (message_paths.empty()) { message_paths.reserve(DEFAULT_NUM_PATHS); }
+  message_paths.push_back(std::make_shared<TimestampedPath>(std::move(path)));
+}
+
+void MessageLabel::add_new_path(const MessageLabel& label, int index) {
+  if (message_paths.empty()) { message_paths.reserve(DEFAULT_NUM_PATHS); }
+  message_paths.push_back(label.message_paths[index]);
 }
 
-MessageLabel::TimestampedPath MessageLabel::get_path(int index) {
-  return message_paths[index];
+void MessageLabel::add_paths(const MessageLabel& label) {
+  if (message_paths.empty()) {
+    message_paths.reserve(std::max<size_t>(label.message_paths.size(), DEFAULT_NUM_PATHS));
+  }
+  message_paths.insert(message_paths.end(), label.message_paths.begin(), label.message_paths.end());
+}
+
+const MessageLabel::TimestampedPath& MessageLabel::get_path(int index) const {
+  return *message_paths[index];
 }
 
 std::string MessageLabel::get_path_name(int index) {
   auto pathstring = fmt::memory_buffer();
-  for (auto oplabel : message_paths[index]) {
-    if (!oplabel.operator_ptr) {
-      HOLOSCAN_LOG_ERROR(
-          "MessageLabel::get_path_name - Operator pointer is null. Path until now: {}.",
-          fmt::to_string(pathstring));
+  for (const auto& oplabel : *message_paths[index]) {
+    const auto& op_name = oplabel.operator_name();
+    if (op_name.empty()) {
+      HOLOSCAN_LOG_ERROR("MessageLabel::get_path_name - Operator is not known. Path until now: {}.",
+                         fmt::to_string(pathstring));
     } else {
-      fmt::format_to(std::back_inserter(pathstring), "{},", oplabel.operator_ptr->name());
+      fmt::format_to(std::back_inserter(pathstring), "{},", op_name);
     }
   }
   pathstring.resize(pathstring.size() - 1);
@@ -146,27 +297,114 @@ std::string MessageLabel::get_path_name(int index) {
 }
 
 OperatorTimestampLabel& MessageLabel::get_operator(int path_index, int op_index) {
-  return message_paths[path_index][op_index];
+  return mutable_path(path_index)[op_index];
 }
 
 void MessageLabel::set_operator_pub_timestamp(int path_index, int op_index, int64_t pub_timestamp) {
-  message_paths[path_index][op_index].pub_timestamp = pub_timestamp;
+  mutable_path(path_index)[op_index].pub_timestamp = pub_timestamp;
 }
 
 void MessageLabel::set_operator_rec_timestamp(int path_index, int op_index, int64_t rec_timestamp) {
-  message_paths[path_index][op_index].rec_timestamp = rec_timestamp;
+  mutable_path(path_index)[op_index].rec_timestamp = rec_timestamp;
 }
 
-std::vector<int> MessageLabel::has_operator(std::string op_name) {
-  std::vector<int> valid_paths;
-  valid_paths.reserve(DEFAULT_NUM_PATHS);
+std::vector<int> MessageLabel::has_operator(const std::string& op_name) const {
+  // An operator without an ID cannot be in any path: do not assign it an ID
+  auto op_id = find_operator_id(op_name);
+  if (!op_id) { return {}; }
+  return has_operator(op_id.value());
+}
 
+std::vector<int> MessageLabel::has_operator(uint32_t op_id) const {
+  std::vector<int> valid_paths;
   for (int i = 0; i < num_paths(); i++) {
-    if (message_path_operators[i].find(op_name) != message_path_operators[i].end()) {
-      valid_paths.push_back(i);
-    }
+    const auto& path = *message_paths[i];
+    auto in_path = std::find_if(path.begin(), path.end(), [op_id](const auto& label) {
+      return label.operator_id == op_id;
+    });
+    if (in_path != path.end()) { valid_paths.push_back(i); }
   }
   return valid_paths;
 }
 
+void MessageLabel::serialize(std::vector<uint8_t>& buffer) const {
+  // Table of the operators of the label: operator ID -> index in the table
+  std::vector<uint32_t> op_ids;
+  auto op_index = [&op_ids](uint32_t op_id) {
+    auto it = std::find(op_ids.begin(), op_ids.end(), op_id);
+    if (it != op_ids.end()) { return static_cast<uint64_t>(it - op_ids.begin()); }
+    op_ids.push_back(op_id);
+    return static_cast<uint64_t>(op_ids.size() - 1);
+  };
+
+  std::vector<uint8_t> paths_buffer;
+  write_varint(paths_buffer, message_paths.size());
+  for (const auto& path : message_paths) {
+    write_varint(paths_buffer, path->size());
+    int64_t previous_timestamp = 0;
+    for (const auto& label : *path) {
+      write_varint(paths_buffer, op_index(label.operator_id));
+      write_signed_varint(paths_buffer, label.rec_timestamp - previous_timestamp);
+      write_signed_varint(paths_buffer, label.pub_timestamp - label.rec_timestamp);
+      previous_timestamp = label.pub_timestamp;
+    }
+  }
+
+  buffer.push_back(kSerializedLabelVersion);
+  write_varint(buffer, op_ids.size());
+  for (uint32_t op_id : op_ids) {
+    const auto& op_name = operator_name(op_id);
+    write_varint(buffer, op_name.size());
+    buffer.insert(buffer.end(), op_name.begin(), op_name.end());
+  }
+  buffer.insert(buffer.end(), paths_buffer.begin(), paths_buffer.end());
+}
+
+expected<MessageLabel, RuntimeError> MessageLabel::deserialize(const uint8_t* data, size_t size) {
+  auto malformed = [](const char* reason) {
+    return make_unexpected<RuntimeError>(
+        RuntimeError(ErrorCode::kCodecError, fmt::format("Malformed MessageLabel: {}", reason)));
+  };
+
+  LabelReader reader(data, size);
+  if (reader.read_byte() != kSerializedLabelVersion) { return malformed("unknown version"); }
+
+  // Operator names are interned into the operator IDs of this process
+  uint64_t num_ops = reader.read_varint();
+  if (!reader.ok() || num_ops > size) { return malformed("invalid number of operators"); }
+  std::vector<uint32_t> op_ids;
+  op_ids.reserve(num_ops);
+  for (uint64_t i = 0; i < num_ops; ++i) {
+    uint64_t name_size = reader.read_varint();
+    std::string op_name = reader.read_string(name_size);
+    if (!reader.ok()) { return malformed("truncated operator name"); }
+    op_ids.push_back(operator_id(op_name));
+  }
+
+  MessageLabel label;
+  uint64_t num_paths = reader.read_varint();
+  if (!reader.ok() || num_paths > size) { return malformed("invalid number of paths"); }
+  label.message_paths.reserve(num_paths);
+  for (uint64_t i = 0; i < num_paths; ++i) {
+    uint64_t path_size = reader.read_varint();
+    if (!reader.ok() || path_size > size) { return malformed("invalid path length"); }
+    auto path = std::make_shared<TimestampedPath>();
+    path->reserve(path_size);
+    int64_t previous_timestamp = 0;
+    for (uint64_t j = 0; j < path_size; ++j) {
+      uint64_t index = reader.read_varint();
+      if (!reader.ok() || index >= op_ids.size()) { return malformed("invalid operator index"); }
+      OperatorTimestampLabel op_label;
+      op_label.operator_id = op_ids[index];
+      op_label.rec_timestamp = previous_timestamp + reader.read_signed_varint();
+      op_label.pub_timestamp = op_label.rec_timestamp + reader.read_signed_varint();
+      previous_timestamp = op_label.pub_timestamp;
+      path->push_back(op_label);
+    }
+    if (!reader.ok()) { return malformed("truncated path"); }
+    label.message_paths.push_back(std::move(path));
+  }
+  return label;
+}
+
 }  // namespace holoscan
@@ -39,9 +39,10 @@ void Operator::initialize() {
   if (fragment_ptr) {
     auto& executor = fragment_ptr->executor();
     if (executor.initialize_operator(this)) {
-      // Set the operator codelet (or other backend). It is utilized for Data Frame Flow Tracking
-      // (DFFT)
+      // Set the operator codelet (or other backend) and message label ID. They are utilized for
+      // Data Frame Flow Tracking (DFFT)
       this->set_op_backend();
+      message_label_operator_id_ = MessageLabel::operator_id(name());
     }
   } else {
     HOLOSCAN_LOG_WARN("Operator::initialize() - Fragment is not set");
@@ -87,11 +88,9 @@ holoscan::MessageLabel Operator::get_consolidated_input_label() {
   MessageLabel m;
 
   if (this->input_message_labels.size()) {
-    // Flatten the message_paths in input_message_labels into a single MessageLabel
-    for (auto it : this->input_message_labels) {
-      MessageLabel everyinput = it.second;
-      for (auto p : everyinput.paths()) { m.add_new_path(p); }
-    }
+    // Flatten the message_paths in input_message_labels into a single MessageLabel (the paths
+    // are shared, not copied)
+    for (const auto& it : this->input_message_labels) { m.add_paths(it.second); }
   } else {  // Root operator
     if (!this->is_root() && !this->is_user_defined_root()) {
       HOLOSCAN_LOG_DEBUG(
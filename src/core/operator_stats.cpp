@@ -0,0 +1,210 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/operator_stats.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace holoscan {
+
+namespace {
+
+constexpr double kNsPerUs = 1e3;
+constexpr double kNsPerMs = 1e6;
+
+int find_index(const std::vector<std::string>& names, const std::string& name) {
+  auto it = std::find(names.begin(), names.end(), name);
+  return it == names.end() ? -1 : static_cast<int>(it - names.begin());
+}
+
+}  // namespace
+
+OperatorStats::OperatorStats(std::string operator_name,
+                             const std::vector<std::string>& input_names,
+                             const std::vector<std::string>& output_names)
+    : operator_name_(std::move(operator_name)),
+      input_names_(input_names),
+      output_names_(output_names),
+      input_counters_(new PortCounters[input_names.size()]),
+      output_counters_(new PortCounters[output_names.size()]) {}
+
+int64_t OperatorStats::now_ns() {
+  // steady_clock is a vDSO clock_gettime(CLOCK_MONOTONIC) call on Linux (no system call)
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void OperatorStats::record_tick(int64_t start_ns, int64_t end_ns, bool success) {
+  const int64_t duration_ns = std::max<int64_t>(end_ns - start_ns, 0);
+
+  const int64_t last_tick_end_ns = last_tick_end_ns_.load(std::memory_order_relaxed);
+  if (last_tick_end_ns != 0 && start_ns > last_tick_end_ns) {
+    add(total_idle_time_ns_, static_cast<uint64_t>(start_ns - last_tick_end_ns));
+  }
+  last_tick_end_ns_.store(end_ns, std::memory_order_relaxed);
+
+  add(total_compute_time_ns_, static_cast<uint64_t>(duration_ns));
+  if (duration_ns < min_compute_time_ns_.load(std::memory_order_relaxed)) {
+    min_compute_time_ns_.store(duration_ns, std::memory_order_relaxed);
+  }
+  if (duration_ns > max_compute_time_ns_.load(std::memory_order_relaxed)) {
+    max_compute_time_ns_.store(duration_ns, std::memory_order_relaxed);
+  }
+  compute_time_histogram_.record(duration_ns);
+  if (!success) { add(num_failed_ticks_, 1); }
+  // Incremented last so that a snapshot does not count a tick whose duration is not recorded yet
+  num_ticks_.store(num_ticks_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void OperatorStats::record_queue_size(size_t input_index, size_t queue_size) {
+  auto& counters = input_counters_[input_index];
+  add(counters.num_samples, 1);
+  add(counters.queue_size_sum, queue_size);
+  if (queue_size > counters.max_queue_size.load(std::memory_order_relaxed)) {
+    counters.max_queue_size.store(queue_size, std::memory_order_relaxed);
+  }
+}
+
+void OperatorStats::record_emit(size_t output_index) {
+  add(output_counters_[output_index].num_messages, 1);
+}
+
+void OperatorStats::record_gil_wait(int64_t wait_ns) {
+  wait_ns = std::max<int64_t>(wait_ns, 0);
+  add(total_gil_wait_time_ns_, static_cast<uint64_t>(wait_ns));
+  if (wait_ns > max_gil_wait_time_ns_.load(std::memory_order_relaxed)) {
+    max_gil_wait_time_ns_.store(wait_ns, std::memory_order_relaxed);
+  }
+}
+
+int OperatorStats::input_index(const std::string& name) const {
+  return find_index(input_names_, name);
+}
+
+int OperatorStats::output_index(const std::string& name) const {
+  return find_index(output_names_, name);
+}
+
+OperatorStatsSnapshot OperatorStats::snapshot() const {
+  OperatorStatsSnapshot stats;
+  stats.operator_name = operator_name_;
+  stats.num_ticks = num_ticks_.load(std::memory_order_acquire);
+  stats.num_failed_ticks = num_failed_ticks_.load(std::memory_order_relaxed);
+  stats.total_compute_time_ms =
+      static_cast<double>(total_compute_time_ns_.load(std::memory_order_relaxed)) / kNsPerMs;
+  stats.total_idle_time_ms =
+      static_cast<double>(total_idle_time_ns_.load(std::memory_order_relaxed)) / kNsPerMs;
+  stats.total_gil_wait_time_ms =
+      static_cast<double>(total_gil_wait_time_ns_.load(std::memory_order_relaxed)) / kNsPerMs;
+  stats.max_gil_wait_time_us =
+      static_cast<double>(max_gil_wait_time_ns_.load(std::memory_order_relaxed)) / kNsPerUs;
+  if (stats.num_ticks > 0) {
+    stats.avg_compute_time_us =
+        stats.total_compute_time_ms * (kNsPerMs / kNsPerUs) / static_cast<double>(stats.num_ticks);
+    stats.min_compute_time_us =
+        static_cast<double>(min_compute_time_ns_.load(std::memory_order_relaxed)) / kNsPerUs;
+    stats.max_compute_time_us =
+        static_cast<double>(max_compute_time_ns_.load(std::memory_order_relaxed)) / kNsPerUs;
+
+    std::vector<uint64_t> counts;
+    compute_time_histogram_.add_to(counts);
+    stats.p50_compute_time_us =
+        static_cast<double>(HdrHistogram::value_at_percentile(counts, 50.0)) / kNsPerUs;
+    stats.p99_compute_time_us =
+        static_cast<double>(HdrHistogram::value_at_percentile(counts, 99.0)) / kNsPerUs;
+  }
+
+  stats.inputs.reserve(input_names_.size());
+  for (size_t i = 0; i < input_names_.size(); ++i) {
+    const auto& counters = input_counters_[i];
+    OperatorPortStats port;
+    port.name = input_names_[i];
+    const uint64_t num_samples = counters.num_samples.load(std::memory_order_relaxed);
+    if (num_samples > 0) {
+      port.avg_queue_size =
+          static_cast<double>(counters.queue_size_sum.load(std::memory_order_relaxed)) /
+          static_cast<double>(num_samples);
+    }
+    port.max_queue_size = counters.max_queue_size.load(std::memory_order_relaxed);
+    stats.inputs.push_back(std::move(port));
+  }
+  stats.outputs.reserve(output_names_.size());
+  for (size_t i = 0; i < output_names_.size(); ++i) {
+    OperatorPortStats port;
+    port.name = output_names_[i];
+    port.num_messages = output_counters_[i].num_messages.load(std::memory_order_relaxed);
+    stats.outputs.push_back(std::move(port));
+  }
+  return stats;
+}
+
+std::string OperatorStats::format(const std::vector<OperatorStatsSnapshot>& stats) {
+  size_t name_width = 8;
+  for (const auto& op_stats : stats) {
+    name_width = std::max(name_width, op_stats.operator_name.size());
+  }
+
+  std::string table = fmt::format("{:<{}} {:>10} {:>7} {:>12} {:>12} {:>12} {:>12} {:>12} {:>12}\n",
+                                  "Operator",
+                                  name_width,
+                                  "Ticks",
+                                  "Failed",
+                                  "Avg (us)",
+                                  "P50 (us)",
+                                  "P99 (us)",
+                                  "Max (us)",
+                                  "Total (ms)",
+                                  "Idle (ms)");
+  for (const auto& op_stats : stats) {
+    table += fmt::format(
+        "{:<{}} {:>10} {:>7} {:>12.1f} {:>12.1f} {:>12.1f} {:>12.1f} {:>12.1f} {:>12.1f}\n",
+        op_stats.operator_name,
+        name_width,
+        op_stats.num_ticks,
+        op_stats.num_failed_ticks,
+        op_stats.avg_compute_time_us,
+        op_stats.p50_compute_time_us,
+        op_stats.p99_compute_time_us,
+        op_stats.max_compute_time_us,
+        op_stats.total_compute_time_ms,
+        op_stats.total_idle_time_ms);
+    if (op_stats.max_gil_wait_time_us > 0) {
+      table += fmt::format("  GIL wait: total {:.1f} ms, max {:.1f} us\n",
+                           op_stats.total_gil_wait_time_ms,
+                           op_stats.max_gil_wait_time_us);
+    }
+    for (const auto& port : op_stats.inputs) {
+      table += fmt::format("  input '{}': avg queue size {:.2f}, max queue size {}\n",
+                           port.name,
+                           port.avg_queue_size,
+                           port.max_queue_size);
+    }
+    for (const auto& port : op_stats.outputs) {
+      table += fmt::format("  output '{}': {} messages\n", port.name, port.num_messages);
+    }
+  }
+  return table;
+}
+
+}  // namespace holoscan
@@ -0,0 +1,316 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/resources/event_reactor.hpp"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "holoscan/core/component_spec.hpp"
+
+namespace holoscan {
+
+namespace {
+
+// epoll data of the eventfd used to stop the reactor thread
+constexpr uint64_t kWakeData = std::numeric_limits<uint64_t>::max();
+
+unexpected<RuntimeError> reactor_error(const std::string& what) {
+  auto err_msg = fmt::format("EventReactor: {} ({})", what, std::strerror(errno));
+  return make_unexpected<RuntimeError>(RuntimeError(ErrorCode::kFailure, err_msg));
+}
+
+itimerspec timer_spec(std::chrono::nanoseconds period, bool periodic) {
+  // A zero it_value disarms the timer, so the shortest delay is 1 ns
+  const int64_t ns = std::max<int64_t>(period.count(), 1);
+  itimerspec spec{};
+  spec.it_value.tv_sec = ns / 1'000'000'000;
+  spec.it_value.tv_nsec = ns % 1'000'000'000;
+  if (periodic) { spec.it_interval = spec.it_value; }
+  return spec;
+}
+
+}  // namespace
+
+struct EventReactor::Registration {
+  RegistrationId id = -1;
+  int fd = -1;
+  uint32_t events = 0;
+  bool is_timer = false;
+  bool periodic = false;
+  std::chrono::nanoseconds period{0};
+  std::shared_ptr<AsynchronousCondition> condition;
+  Callback callback;
+
+  ~Registration() {
+    // timer file descriptors are owned by the reactor
+    if (is_timer && fd >= 0) { ::close(fd); }
+  }
+};
+
+EventReactor::~EventReactor() {
+  stop();
+}
+
+void EventReactor::setup(ComponentSpec& spec) {
+  spec.param(max_events_,
+             "max_events",
+             "Maximum events",
+             "Maximum number of events handled per wakeup of the reactor thread.",
+             64L);
+}
+
+expected<EventReactor::RegistrationId, RuntimeError> EventReactor::add_fd(
+    int fd, uint32_t events, const std::shared_ptr<AsynchronousCondition>& condition,
+    Callback callback) {
+  if (fd < 0) {
+    return make_unexpected<RuntimeError>(
+        RuntimeError(ErrorCode::kInvalidArgument, "EventReactor: invalid file descriptor"));
+  }
+  auto registration = std::make_shared<Registration>();
+  registration->fd = fd;
+  registration->events = events;
+  registration->condition = condition;
+  registration->callback = std::move(callback);
+  return add(std::move(registration));
+}
+
+expected<EventReactor::RegistrationId, RuntimeError> EventReactor::add_timer(
+    std::chrono::nanoseconds period, const std::shared_ptr<AsynchronousCondition>& condition,
+    Callback callback, bool periodic) {
+  auto registration = std::make_shared<Registration>();
+  registration->fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  if (registration->fd < 0) { return reactor_error("unable to create a timer"); }
+  registration->events = EPOLLIN;
+  registration->is_timer = true;
+  registration->periodic = periodic;
+  registration->period = period;
+  registration->condition = condition;
+  registration->callback = std::move(callback);
+  return add(std::move(registration));
+}
+
+expected<EventReactor::RegistrationId, RuntimeError> EventReactor::add(
+    std::shared_ptr<Registration> registration) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto started = start();
+  if (!started) { return make_unexpected<RuntimeError>(std::move(started.error())); }
+
+  registration->id = next_id_++;
+  if (registration->condition) {
+    registration->condition->event_state(AsynchronousEventState::EVENT_WAITING);
+  }
+
+  epoll_event event{};
+  // File descriptors are one-shot (re-enabled by arm()), timers are read on each expiration
+  event.events = registration->is_timer ? EPOLLIN : (registration->events | EPOLLONESHOT);
+  event.data.u64 = static_cast<uint64_t>(registration->id);
+  if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, registration->fd, &event) != 0) {
+    return reactor_error(fmt::format("unable to watch file descriptor {}", registration->fd));
+  }
+  if (registration->is_timer) {
+    auto spec = timer_spec(registration->period, registration->periodic);
+    if (timerfd_settime(registration->fd, 0, &spec, nullptr) != 0) {
+      epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, registration->fd, nullptr);
+      return reactor_error("unable to start a timer");
+    }
+  }
+
+  const RegistrationId id = registration->id;
+  registrations_.emplace(id, std::move(registration));
+  return id;
+}
+
+expected<void, RuntimeError> EventReactor::arm(RegistrationId id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = registrations_.find(id);
+  if (it == registrations_.end()) {
+    return make_unexpected<RuntimeError>(RuntimeError(
+        ErrorCode::kNotFound, fmt::format("EventReactor: no registration with id {}", id)));
+  }
+  auto& registration = *it->second;
+
+  // The condition must be waiting before the event source is re-enabled, otherwise an event
+  // firing in between would be dropped.
+  if (registration.condition) {
+    registration.condition->event_state(AsynchronousEventState::EVENT_WAITING);
+  }
+  if (registration.is_timer) {
+    if (!registration.periodic) {
+      auto spec = timer_spec(registration.period, false);
+      if (timerfd_settime(registration.fd, 0, &spec, nullptr) != 0) {
+        return reactor_error("unable to restart a timer");
+      }
+    }
+  } else {
+    epoll_event event{};
+    event.events = registration.events | EPOLLONESHOT;
+    event.data.u64 = static_cast<uint64_t>(id);
+    if (epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, registration.fd, &event) != 0) {
+      return reactor_error(fmt::format("unable to re-enable file descriptor {}", registration.fd));
+    }
+  }
+  return expected<void, RuntimeError>();
+}
+
+expected<void, RuntimeError> EventReactor::remove(RegistrationId id) {
+  std::shared_ptr<Registration> registration;
+  bool on_reactor_thread = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // thread_ is started under this mutex
+    on_reactor_thread = std::this_thread::get_id() == thread_.get_id();
+    auto it = registrations_.find(id);
+    if (it == registrations_.end()) {
+      return make_unexpected<RuntimeError>(RuntimeError(
+          ErrorCode::kNotFound, fmt::format("EventReactor: no registration with id {}", id)));
+    }
+    registration = std::move(it->second);
+    registrations_.erase(it);
+    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, registration->fd, nullptr);
+  }
+  // Wait for the batch of events being dispatched (which may include this registration)
+  if (!on_reactor_thread) {
+    std::lock_guard<std::mutex> dispatch_lock(dispatch_mutex_);
+  }
+  return expected<void, RuntimeError>();
+}
+
+size_t EventReactor::num_registrations() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return registrations_.size();
+}
+
+expected<void, RuntimeError> EventReactor::start() {
+  if (thread_.joinable()) { return expected<void, RuntimeError>(); }
+
+  epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+  if (epoll_fd_ < 0) { return reactor_error("unable to create an epoll instance"); }
+  wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (wake_fd_ < 0) {
+    auto error = reactor_error("unable to create an eventfd");
+    ::close(epoll_fd_);
+    epoll_fd_ = -1;
+    return error;
+  }
+  epoll_event event{};
+  event.events = EPOLLIN;
+  event.data.u64 = kWakeData;
+  if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &event) != 0) {
+    auto error = reactor_error("unable to watch the eventfd");
+    ::close(wake_fd_);
+    ::close(epoll_fd_);
+    wake_fd_ = epoll_fd_ = -1;
+    return error;
+  }
+
+  stop_requested_ = false;
+  thread_ = std::thread([this] { run(); });
+  HOLOSCAN_LOG_DEBUG("EventReactor '{}': reactor thread started", name());
+  return expected<void, RuntimeError>();
+}
+
+void EventReactor::stop() {
+  if (thread_.joinable()) {
+    stop_requested_ = true;
+    uint64_t value = 1;
+    if (::write(wake_fd_, &value, sizeof(value)) < 0) {
+      HOLOSCAN_LOG_ERROR("EventReactor '{}': unable to wake the reactor thread: {}",
+                         name(),
+                         std::strerror(errno));
+    }
+    thread_.join();
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    registrations_.clear();
+  }
+  if (wake_fd_ >= 0) { ::close(wake_fd_); }
+  if (epoll_fd_ >= 0) { ::close(epoll_fd_); }
+  wake_fd_ = epoll_fd_ = -1;
+}
+
+void EventReactor::run() {
+  const auto max_events =
+      static_cast<size_t>(std::max<int64_t>(max_events_.has_value() ? max_events_.get() : 64, 1));
+  std::vector<epoll_event> events(max_events);
+
+  while (!stop_requested_) {
+    const int count = epoll_wait(epoll_fd_, events.data(), static_cast<int>(events.size()), -1);
+    if (count < 0) {
+      if (errno == EINTR) { continue; }
+      HOLOSCAN_LOG_ERROR("EventReactor '{}': epoll_wait failed: {}", name(), std::strerror(errno));
+      break;
+    }
+
+    std::lock_guard<std::mutex> dispatch_lock(dispatch_mutex_);
+    for (int i = 0; i < count; ++i) {
+      if (events[i].data.u64 == kWakeData) { continue; }
+      std::shared_ptr<Registration> registration;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = registrations_.find(static_cast<RegistrationId>(events[i].data.u64));
+        // The registration may have been removed after the event was received
+        if (it == registrations_.end()) { continue; }
+        registration = it->second;
+      }
+      dispatch(*registration, events[i].events);
+    }
+  }
+}
+
+void EventReactor::dispatch(Registration& registration, uint32_t events) {
+  uint64_t value = events;
+  if (registration.is_timer) {
+    uint64_t expirations = 0;
+    if (::read(registration.fd, &expirations, sizeof(expirations)) !=
+        static_cast<ssize_t>(sizeof(expirations))) {
+      // spurious wakeup (e.g., the timer was restarted in the meantime)
+      return;
+    }
+    value = expirations;
+  }
+
+  if (registration.callback) {
+    try {
+      registration.callback(value);
+    } catch (const std::exception& e) {
+      HOLOSCAN_LOG_ERROR("EventReactor '{}': callback of registration {} failed: {}",
+                         name(),
+                         registration.id,
+                         e.what());
+    }
+  }
+  if (registration.condition) {
+    // Only a waiting condition is notified (an expiration while the operator runs is dropped)
+    registration.condition->compare_exchange_event_state(AsynchronousEventState::EVENT_WAITING,
+                                                         AsynchronousEventState::EVENT_DONE);
+  }
+}
+
+}  // namespace holoscan
@@ -46,7 +46,7 @@ gxf_result_t AnnotatedDoubleBufferReceiver::receive_abi(gxf_uid_t* uid) {
       // Create a new operator timestamp with only receive timestamp
       OperatorTimestampLabel cur_op_timestamp(op());
       // Find whether current operator is already in the paths of message label m
-      auto cyclic_path_indices = m.has_operator(op()->name());
+      auto cyclic_path_indices = m.has_operator(cur_op_timestamp.operator_id);
       if (cyclic_path_indices.empty()) {  // No cyclic paths
         m.add_new_op_timestamp(cur_op_timestamp);
         op()->update_input_message_label(name(), m);
@@ -66,14 +66,14 @@ gxf_result_t AnnotatedDoubleBufferReceiver::receive_abi(gxf_uid_t* uid) {
           if (cycle_index < (int)cyclic_path_indices.size() &&
               i == cyclic_path_indices[cycle_index]) {
             // Update flow tracker here for cyclic paths
-            op()->fragment()->data_flow_tracker()->update_latency(m.get_path_name(i),
-                                                                  m.get_e2e_latency_ms(i));
-            op()->fragment()->data_flow_tracker()->write_to_logfile(
-                MessageLabel::to_string(m.get_path(i)));
+            auto data_flow_tracker = op()->fragment()->data_flow_tracker();
+            data_flow_tracker->update_latency(data_flow_tracker->path_id(m.get_path(i)),
+                                              m.get_e2e_latency_ms(i));
+            data_flow_tracker->write_to_logfile(m.get_path(i));
             cycle_index++;
           } else {
             // For non-cyclic paths, prepare the label_wo_cycles to propagate to the next operator
-            label_wo_cycles.add_new_path(m.get_path(i));
+            label_wo_cycles.add_new_path(m, i);
           }
         }
         if (!label_wo_cycles.num_paths()) {
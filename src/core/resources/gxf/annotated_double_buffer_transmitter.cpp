@@ -43,10 +43,8 @@ gxf_result_t AnnotatedDoubleBufferTransmitter::publish_abi(gxf_uid_t uid) {
       return buffer.error();
     }
 
-    MessageLabel m;
-    m = op()->get_consolidated_input_label();
-    m.update_last_op_publish();
-    *buffer.value() = m;
+    *buffer.value() = op()->get_consolidated_input_label();
+    buffer.value()->update_last_op_publish();
   }
 
   // Call the Base class' publish_abi now
@@ -56,12 +56,12 @@ gxf_result_t DFFTCollector::on_execute_abi(gxf_uid_t eid, uint64_t timestamp, gx
     leaf_ops_[codelet_id]->reset_input_message_labels();
 
     if (m.num_paths()) {
-      auto all_path_names = m.get_all_path_names();
       m.update_last_op_publish();
       for (int i = 0; i < m.num_paths(); i++) {
-        data_flow_tracker_->update_latency(all_path_names[i], m.get_e2e_latency_ms(i));
+        data_flow_tracker_->update_latency(data_flow_tracker_->path_id(m.get_path(i)),
+                                           m.get_e2e_latency_ms(i));
       }
-      data_flow_tracker_->write_to_logfile(m.to_string());
+      data_flow_tracker_->write_to_logfile(m);
     }
 
   } else if (root_ops_.find(codelet_id) != root_ops_.end()) {
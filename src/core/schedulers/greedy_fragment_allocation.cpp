@@ -17,6 +17,7 @@
 
 #include "holoscan/core/schedulers/greedy_fragment_allocation.hpp"
 
+#include <algorithm>
 #include <list>
 #include <queue>
 #include <set>
@@ -173,6 +174,50 @@ GreedyFragmentAllocationStrategy::schedule() {
   return scheduled_fragments;
 }
 
+holoscan::expected<std::unordered_map<std::string, int32_t>, std::string>
+GreedyFragmentAllocationStrategy::assign_numa_nodes(
+    const std::vector<SystemResourceRequirement>& resource_requirements,
+    const std::vector<NumaNodeInfo>& numa_nodes) {
+  if (numa_nodes.empty()) {
+    return holoscan::unexpected<std::string>("No NUMA node is available");
+  }
+
+  auto cpu_demand = [](const SystemResourceRequirement& requirement) {
+    return std::max(requirement.cpu, 1.0f);
+  };
+
+  // Most demanding fragments first (ties are broken by fragment name for a stable placement)
+  std::vector<const SystemResourceRequirement*> fragments;
+  fragments.reserve(resource_requirements.size());
+  for (const auto& requirement : resource_requirements) { fragments.push_back(&requirement); }
+  std::sort(fragments.begin(), fragments.end(), [&cpu_demand](const auto* a, const auto* b) {
+    if (cpu_demand(*a) != cpu_demand(*b)) { return cpu_demand(*a) > cpu_demand(*b); }
+    return a->fragment_name < b->fragment_name;
+  });
+
+  std::vector<float> available_cpus;
+  available_cpus.reserve(numa_nodes.size());
+  for (const auto& node : numa_nodes) {
+    available_cpus.push_back(static_cast<float>(node.num_cpus));
+  }
+
+  std::unordered_map<std::string, int32_t> assigned_nodes;
+  assigned_nodes.reserve(fragments.size());
+  for (const auto* fragment : fragments) {
+    // The node with the most CPUs left (it can be oversubscribed if there are not enough CPUs)
+    const auto node_index = static_cast<size_t>(
+        std::distance(available_cpus.begin(),
+                      std::max_element(available_cpus.begin(), available_cpus.end())));
+    available_cpus[node_index] -= cpu_demand(*fragment);
+    assigned_nodes[fragment->fragment_name] = numa_nodes[node_index].os_index;
+    HOLOSCAN_LOG_DEBUG("fragment '{}' (cpu: {}) is assigned to NUMA node {}",
+                       fragment->fragment_name,
+                       fragment->cpu,
+                       numa_nodes[node_index].os_index);
+  }
+  return assigned_nodes;
+}
+
 bool GreedyFragmentAllocationStrategy::AvailableSystemResourceComparator::operator()(
     const AvailableSystemResource& a, const AvailableSystemResource& b) const {
   // priority:
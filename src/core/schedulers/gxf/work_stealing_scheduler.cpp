@@ -0,0 +1,149 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/schedulers/gxf/work_stealing_scheduler.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "holoscan/core/component_spec.hpp"
+#include "holoscan/core/fragment.hpp"
+
+namespace holoscan {
+
+void WorkStealingScheduler::setup(ComponentSpec& spec) {
+  spec.param(clock_,
+             "clock",
+             "Clock",
+             "The clock used by the scheduler to define flow of time. Typically this "
+             "would be a std::shared_ptr<RealtimeClock>.");
+  spec.param(
+      worker_thread_number_, "worker_thread_number", "Thread Number", "Number of threads", 1L);
+  spec.param(check_recession_period_ms_,
+             "check_recession_period_ms",
+             "Duration to sleep before checking the condition of an operator again [ms]",
+             "The maximum duration for which the scheduler would wait (in ms) before checking "
+             "the condition of an operator waiting for an event again.",
+             5.0);
+  spec.param(stop_on_deadlock_,
+             "stop_on_deadlock",
+             "Stop on dead end",
+             "If enabled the scheduler will stop when all entities are in a waiting state, but "
+             "no periodic entity exists to break the dead end. Should be disabled when "
+             "scheduling conditions can be changed by external actors, for example by clearing "
+             "queues manually.",
+             true);
+  spec.param(max_duration_ms_,
+             "max_duration_ms",
+             "Max Duration [ms]",
+             "The maximum duration for which the scheduler will execute (in ms). If not "
+             "specified the scheduler will run until all work is done. If periodic terms are "
+             "present this means the  application will run indefinitely",
+             ParameterFlag::kOptional);
+  spec.param(stop_on_deadlock_timeout_,
+             "stop_on_deadlock_timeout",
+             "Delay (in ms) until stop_on_deadlock kicks in",
+             "Scheduler will wait this amount of time (in ms) before determining that it is in "
+             "deadlock and should stop. It will reset if a job comes in during the wait. A "
+             "negative value means not stop on deadlock. This parameter only applies when  "
+             "stop_on_deadlock=true",
+             0L);
+  spec.param(worker_cpu_cores_,
+             "worker_cpu_cores",
+             "Worker CPU cores",
+             "CPU core (OS index) each worker thread is pinned to. Worker i is pinned to the core "
+             "at index i modulo the number of cores. Workers are not pinned if empty.",
+             std::vector<int64_t>{});
+  spec.param(worker_numa_nodes_,
+             "worker_numa_nodes",
+             "Worker NUMA nodes",
+             "NUMA node (OS index) each worker thread is pinned to. Worker i is pinned to the "
+             "node at index i modulo the number of nodes. Ignored if 'worker_cpu_cores' is set.",
+             std::vector<int64_t>{});
+  spec.param(operator_affinity_,
+             "operator_affinity",
+             "Operator affinity",
+             "Operators pinned to a worker thread, as '<operator name>:<worker index>' entries. "
+             "A pinned operator is only executed by its worker (it is never stolen).",
+             std::vector<std::string>{});
+  spec.param(shared_pool_,
+             "shared_pool",
+             "Shared worker pool",
+             "Name of the worker pool executing the operators, shared with the other schedulers "
+             "of the process using the same name (e.g., the schedulers of other fragments). The "
+             "scheduler creates its own worker threads if empty.",
+             std::string{});
+  spec.param(pool_priority_,
+             "pool_priority",
+             "Shared worker pool priority",
+             "Priority of the scheduler in the shared worker pool. The operators of the schedulers "
+             "with a higher priority are executed first.",
+             0L);
+  spec.param(pool_max_workers_,
+             "pool_max_workers",
+             "Shared worker pool quota",
+             "Maximum number of workers of the shared worker pool executing the operators of "
+             "the scheduler at the same time (0 means no limit).",
+             0L);
+  spec.param(python_workers_,
+             "python_workers",
+             "Python workers",
+             "Indices of the worker threads dedicated to the 'python_operators'. These operators "
+             "only run on these workers and the other operators only on the other workers (at "
+             "least one worker must be left for them). Not used if empty.",
+             std::vector<int64_t>{});
+  spec.param(python_operators_,
+             "python_operators",
+             "Python operators",
+             "Names of the operators executed by the 'python_workers'. The Python API sets it to "
+             "the operators implemented in Python if it is not specified.",
+             std::vector<std::string>{});
+}
+
+gxf::WorkStealingScheduler* WorkStealingScheduler::get() const {
+  return static_cast<gxf::WorkStealingScheduler*>(gxf_cptr_);
+}
+
+gxf::WorkStealingSchedulerStats WorkStealingScheduler::stats() const {
+  auto scheduler = get();
+  if (scheduler == nullptr) { return {}; }
+  return scheduler->stats();
+}
+
+void WorkStealingScheduler::initialize() {
+  // Set up prerequisite parameters before calling Scheduler::initialize()
+  auto frag = fragment();
+
+  // Find if there is an argument for 'clock'
+  auto has_clock = std::find_if(
+      args().begin(), args().end(), [](const auto& arg) { return (arg.name() == "clock"); });
+  // Create the clock if there was no argument provided.
+  if (has_clock == args().end()) {
+    clock_ =
+        frag->make_resource<holoscan::RealtimeClock>("work_stealing_scheduler__realtime_clock");
+    clock_->gxf_cname(clock_->name().c_str());
+    if (gxf_eid_ != 0) { clock_->gxf_eid(gxf_eid_); }
+    add_arg(clock_.get());
+  }
+
+  // parent class initialize() call must be after the argument additions above
+  Scheduler::initialize();
+}
+
+}  // namespace holoscan
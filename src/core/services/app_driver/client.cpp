@@ -25,6 +25,7 @@
 
 #include "../generated/error_code.pb.h"
 #include "holoscan/core/app_worker.hpp"
+#include "holoscan/core/codec_registry.hpp"
 #include "holoscan/core/fragment.hpp"
 #include "holoscan/logger/logger.hpp"
 
@@ -70,6 +71,11 @@ bool AppDriverClient::fragment_allocation(const std::string& worker_ip,
   available_system_resource->set_shared_memory(cpu_shared_memory_str);
   available_system_resource->set_gpu_memory(gpu_memory_str);
 
+  // Adding codec names for negotiating the wire codec table
+  for (const auto& codec_name : CodecRegistry::get_instance().codec_names()) {
+    request.add_codec_names(codec_name);
+  }
+
   holoscan::service::FragmentAllocationResponse response;
   grpc::ClientContext context;
   grpc::Status status = stub_->AllocateFragments(&context, request, &response);
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <cstdio>
 #include <string>
+#include <vector>
 
 #include "holoscan/core/app_driver.hpp"
 #include "holoscan/logger/logger.hpp"
@@ -108,6 +109,10 @@ grpc::Status AppDriverServiceImpl::AllocateFragments(
   // Store the worker address, the fragment names, and resources in the app_driver_.
   store_worker_info(worker_address, fragment_names, resource);
 
+  // Negotiate the wire codec table with the codecs registered in the worker.
+  app_driver_->add_worker_codec_names(
+      std::vector<std::string>(request->codec_names().begin(), request->codec_names().end()));
+
   // Construct a response.
   holoscan::service::Result* result = new holoscan::service::Result();
   result->set_code(holoscan::service::SUCCESS);
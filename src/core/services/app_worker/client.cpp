@@ -149,9 +149,13 @@ bool AppWorkerClient::fragment_execution(
     const std::vector<std::shared_ptr<Fragment>>& fragments,
     const std::unordered_map<std::shared_ptr<Fragment>,
                              std::vector<std::shared_ptr<holoscan::ConnectionItem>>>&
-        connection_map) {
+        connection_map,
+    const std::vector<std::string>& codec_names) {
   holoscan::service::FragmentExecutionRequest request;
 
+  // Adding the negotiated wire codec table
+  for (const auto& codec_name : codec_names) { request.add_codec_names(codec_name); }
+
   for (const auto& fragment : fragments) {
     if (connection_map.find(fragment) != connection_map.end()) {
       auto& connections = connection_map.at(fragment);
@@ -171,6 +175,7 @@ bool AppWorkerClient::fragment_execution(
 
         switch (connection->connector_type) {
           case IOSpec::ConnectorType::kDefault:
+          case IOSpec::ConnectorType::kSpscRing:  // only used within a fragment
             connection_item->set_connector_type(holoscan::service::ConnectorType::DEFAULT);
             break;
           case IOSpec::ConnectorType::kDoubleBuffer:
@@ -179,9 +184,13 @@ bool AppWorkerClient::fragment_execution(
           case IOSpec::ConnectorType::kUCX:
             connection_item->set_connector_type(holoscan::service::ConnectorType::UCX);
             break;
+          case IOSpec::ConnectorType::kSharedMemory:
+            connection_item->set_connector_type(holoscan::service::ConnectorType::SHARED_MEMORY);
+            break;
         }
 
-        // Currently supporting only arguments for UCX connector (rx_address, address, port)
+        // Currently supporting only arguments for UCX connector (rx_address, address, port) and
+        // shared memory connector (segment_name, slot_count, slot_size)
         for (auto& arg : connection->args) {
           holoscan::service::ConnectorArg* connector_arg = connection_item->add_args();
 
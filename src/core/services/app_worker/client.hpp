@@ -51,7 +51,8 @@ class AppWorkerClient {
       const std::vector<std::shared_ptr<Fragment>>& fragments,
       const std::unordered_map<std::shared_ptr<Fragment>,
                                std::vector<std::shared_ptr<holoscan::ConnectionItem>>>&
-          connection_map);
+          connection_map,
+      const std::vector<std::string>& codec_names = {});
 
   bool terminate_worker(AppWorkerTerminationCode code);
 
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "holoscan/core/app_driver.hpp"
+#include "holoscan/core/codec_registry.hpp"
 #include "holoscan/core/fragment.hpp"
 #include "holoscan/core/system/network_utils.hpp"
 #include "holoscan/logger/logger.hpp"
@@ -152,6 +153,9 @@ grpc::Status AppWorkerServiceImpl::ExecuteFragments(
         case holoscan::service::ConnectorType::UCX:
           connector_type = IOSpec::ConnectorType::kUCX;
           break;
+        case holoscan::service::ConnectorType::SHARED_MEMORY:
+          connector_type = IOSpec::ConnectorType::kSharedMemory;
+          break;
         default:
           HOLOSCAN_LOG_ERROR("Unsupported connector type: {}", connection_item.connector_type());
           return grpc::Status::CANCELLED;
@@ -192,6 +196,10 @@ grpc::Status AppWorkerServiceImpl::ExecuteFragments(
     HOLOSCAN_LOG_DEBUG("");
   }
 
+  // Install the wire codec table negotiated by the driver (an empty table disables codec IDs)
+  CodecRegistry::get_instance().set_wire_codec_table(
+      std::vector<std::string>(request->codec_names().begin(), request->codec_names().end()));
+
   // Setting a response
   auto result = response->mutable_result();
   result->set_code(holoscan::service::ErrorCode::SUCCESS);
@@ -0,0 +1,351 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/services/common/shm_ring_buffer.hpp"
+
+#include <fcntl.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+/// Header at the beginning of the shared memory segment.
+struct ShmRingHeader {
+  std::atomic<uint64_t> magic;  ///< Set last by the creator once the segment is initialized.
+  pid_t creator_pid;            ///< The process that created the segment.
+  uint32_t slot_count;
+  uint64_t slot_size;
+  uint64_t slot_stride;      ///< Distance in bytes between two consecutive slot headers.
+  sem_t free_slots;          ///< Number of slots that can be written.
+  sem_t ready_slots;         ///< Number of slots that can be read (+1 when the writer closes).
+  std::atomic<uint32_t> writer_closed;
+  std::atomic<uint32_t> reader_closed;
+  alignas(64) uint64_t write_index;  ///< Next slot to write (only used by the writer).
+  alignas(64) uint64_t read_index;   ///< Next slot to read (only used by the reader).
+};
+
+namespace {
+
+constexpr uint64_t kShmRingMagic = 0x314d48534f4c4f48ULL;  // "HOLOSHM1"
+
+/// Interval at which blocked calls re-check whether the other side was closed.
+constexpr std::chrono::milliseconds kShmPollInterval{100};
+
+enum ShmSlotState : uint32_t { kSlotFree = 0, kSlotWriting, kSlotReady, kSlotReading };
+
+struct ShmSlotHeader {
+  std::atomic<uint32_t> state;
+  uint64_t size;
+};
+
+constexpr size_t align_up(size_t value, size_t alignment) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+constexpr size_t kHeaderSize = align_up(sizeof(ShmRingHeader), ShmRingBuffer::kSlotAlignment);
+constexpr size_t kSlotHeaderSize = align_up(sizeof(ShmSlotHeader), ShmRingBuffer::kSlotAlignment);
+
+size_t segment_size(uint32_t slot_count, uint64_t slot_size) {
+  return kHeaderSize +
+         slot_count * (kSlotHeaderSize + align_up(slot_size, ShmRingBuffer::kSlotAlignment));
+}
+
+/// Decrement the semaphore, waiting at most `timeout`. Returns false on timeout.
+bool timed_wait(sem_t* sem, std::chrono::milliseconds timeout) {
+  timespec deadline{};
+  clock_gettime(CLOCK_REALTIME, &deadline);
+  auto nsec = deadline.tv_nsec + (timeout.count() % 1000) * 1000000L;
+  deadline.tv_sec += timeout.count() / 1000 + nsec / 1000000000L;
+  deadline.tv_nsec = nsec % 1000000000L;
+  while (sem_timedwait(sem, &deadline) != 0) {
+    if (errno != EINTR) { return false; }
+  }
+  return true;
+}
+
+unexpected<RuntimeError> shm_error(const std::string& name, const std::string& what) {
+  auto err_msg = fmt::format("Shared memory ring '{}': {}", name, what);
+  return make_unexpected<RuntimeError>(RuntimeError(ErrorCode::kFailure, err_msg));
+}
+
+ShmSlotHeader* slot_header(ShmRingHeader* header, uint64_t index) {
+  auto* base = reinterpret_cast<std::byte*>(header);
+  return reinterpret_cast<ShmSlotHeader*>(base + kHeaderSize +
+                                          (index % header->slot_count) * header->slot_stride);
+}
+
+/**
+ * Remove an existing segment if the process that created it is no longer running (e.g., it
+ * crashed before unlinking it). Returns false if the segment may still be in use.
+ */
+bool remove_stale_segment(const std::string& name) {
+  int fd = shm_open(name.c_str(), O_RDONLY, 0);
+  if (fd < 0) { return errno == ENOENT; }  // removed in the meantime
+  struct stat st {};
+  if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < kHeaderSize) {
+    // Being initialized by its creator (or not a ring): leave it alone
+    close(fd);
+    return false;
+  }
+  void* base = mmap(nullptr, kHeaderSize, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) { return false; }
+  const auto* header = static_cast<const ShmRingHeader*>(base);
+  const bool initialized = header->magic.load(std::memory_order_acquire) == kShmRingMagic;
+  const pid_t creator_pid = header->creator_pid;
+  munmap(base, kHeaderSize);
+
+  if (!initialized || creator_pid <= 0 || kill(creator_pid, 0) == 0 || errno != ESRCH) {
+    return false;
+  }
+  HOLOSCAN_LOG_WARN("Removing shared memory ring '{}' left over by process {}", name, creator_pid);
+  return shm_unlink(name.c_str()) == 0 || errno == ENOENT;
+}
+
+}  // namespace
+
+ShmRingBuffer::ReadLease::~ReadLease() {
+  ring_->release(index_);
+}
+
+ShmRingBuffer::ShmRingBuffer(std::string name, bool owner, void* base, size_t mapped_size)
+    : name_(std::move(name)),
+      owner_(owner),
+      base_(base),
+      mapped_size_(mapped_size),
+      header_(static_cast<ShmRingHeader*>(base)) {}
+
+ShmRingBuffer::~ShmRingBuffer() {
+  if (owner_) {
+    close_reader();
+  } else {
+    close_writer();
+  }
+  munmap(base_, mapped_size_);
+  if (owner_) { shm_unlink(name_.c_str()); }
+}
+
+expected<std::shared_ptr<ShmRingBuffer>, RuntimeError> ShmRingBuffer::create(
+    const std::string& name, uint32_t slot_count, uint64_t slot_size) {
+  if (name.size() < 2 || name[0] != '/' || name.find('/', 1) != std::string::npos) {
+    return shm_error(name, "the name must start with '/' and contain no other '/'");
+  }
+  if (slot_count == 0 || slot_size == 0) {
+    return shm_error(name, "slot_count and slot_size must be positive");
+  }
+
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  if (fd < 0 && errno == EEXIST) {
+    if (!remove_stale_segment(name)) {
+      return shm_error(name, "a segment with this name already exists and may be in use");
+    }
+    fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  }
+  if (fd < 0) { return shm_error(name, fmt::format("shm_open failed: {}", strerror(errno))); }
+
+  const size_t total_size = segment_size(slot_count, slot_size);
+  // posix_fallocate (unlike ftruncate) reports a full /dev/shm here instead of raising SIGBUS
+  // on first access.
+  int alloc_result = posix_fallocate(fd, 0, static_cast<off_t>(total_size));
+  if (alloc_result != 0) {
+    close(fd);
+    shm_unlink(name.c_str());
+    return shm_error(name,
+                     fmt::format("cannot allocate {} bytes: {}", total_size, strerror(alloc_result)));
+  }
+
+  void* base = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED) {
+    shm_unlink(name.c_str());
+    return shm_error(name, fmt::format("mmap failed: {}", strerror(errno)));
+  }
+
+  auto* header = new (base) ShmRingHeader();
+  header->creator_pid = getpid();
+  header->slot_count = slot_count;
+  header->slot_size = slot_size;
+  header->slot_stride = kSlotHeaderSize + align_up(slot_size, kSlotAlignment);
+  sem_init(&header->free_slots, 1, slot_count);
+  sem_init(&header->ready_slots, 1, 0);
+  for (uint32_t index = 0; index < slot_count; ++index) {
+    auto* slot = new (slot_header(header, index)) ShmSlotHeader();
+    slot->state.store(kSlotFree, std::memory_order_relaxed);
+  }
+  header->magic.store(kShmRingMagic, std::memory_order_release);
+
+  HOLOSCAN_LOG_DEBUG("Created shared memory ring '{}' ({} slots of {} bytes)",
+                     name,
+                     slot_count,
+                     slot_size);
+  return std::shared_ptr<ShmRingBuffer>(new ShmRingBuffer(name, true, base, total_size));
+}
+
+expected<std::shared_ptr<ShmRingBuffer>, RuntimeError> ShmRingBuffer::open(
+    const std::string& name, std::chrono::milliseconds timeout) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (true) {
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd >= 0) {
+      struct stat st {};
+      if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= kHeaderSize) {
+        const size_t mapped_size = st.st_size;
+        void* base = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (base == MAP_FAILED) {
+          return shm_error(name, fmt::format("mmap failed: {}", strerror(errno)));
+        }
+        auto* header = static_cast<ShmRingHeader*>(base);
+        while (header->magic.load(std::memory_order_acquire) != kShmRingMagic) {
+          if (std::chrono::steady_clock::now() >= deadline) {
+            munmap(base, mapped_size);
+            return shm_error(name, "timed out waiting for the segment to be initialized");
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (mapped_size < segment_size(header->slot_count, header->slot_size)) {
+          munmap(base, mapped_size);
+          return shm_error(name, "the segment is smaller than its header declares");
+        }
+        return std::shared_ptr<ShmRingBuffer>(new ShmRingBuffer(name, false, base, mapped_size));
+      }
+      close(fd);
+    } else if (errno != ENOENT) {
+      return shm_error(name, fmt::format("shm_open failed: {}", strerror(errno)));
+    }
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return shm_error(name, "timed out waiting for the receiver to create the segment");
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+}
+
+uint32_t ShmRingBuffer::slot_count() const {
+  return header_->slot_count;
+}
+
+uint64_t ShmRingBuffer::slot_size() const {
+  return header_->slot_size;
+}
+
+std::byte* ShmRingBuffer::slot_data(uint64_t index) const {
+  return reinterpret_cast<std::byte*>(slot_header(header_, index)) + kSlotHeaderSize;
+}
+
+expected<ShmRingBuffer::WriteSlot, RuntimeError> ShmRingBuffer::acquire_write(
+    std::chrono::milliseconds timeout) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (!timed_wait(&header_->free_slots, std::min(timeout, kShmPollInterval))) {
+    if (header_->reader_closed.load(std::memory_order_acquire)) {
+      return shm_error(name_, "the reader is closed");
+    }
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return shm_error(name_, "timed out waiting for a free slot");
+    }
+  }
+  if (header_->reader_closed.load(std::memory_order_acquire)) {
+    return shm_error(name_, "the reader is closed");
+  }
+
+  const uint64_t index = header_->write_index;
+  auto* slot = slot_header(header_, index);
+  // Slots are written in order but a lease may release them out of order (e.g., when a received
+  // tensor is kept alive downstream), so the next slot may still be held by the reader.
+  while (slot->state.load(std::memory_order_acquire) != kSlotFree) {
+    if (header_->reader_closed.load(std::memory_order_acquire)) {
+      return shm_error(name_, "the reader is closed");
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+  slot->state.store(kSlotWriting, std::memory_order_relaxed);
+  return WriteSlot{index, slot_data(index), header_->slot_size};
+}
+
+void ShmRingBuffer::commit_write(const WriteSlot& slot, size_t size) {
+  auto* header = slot_header(header_, slot.index);
+  header->size = size;
+  header->state.store(kSlotReady, std::memory_order_release);
+  header_->write_index = slot.index + 1;
+  sem_post(&header_->ready_slots);
+}
+
+bool ShmRingBuffer::reader_closed() const {
+  return header_->reader_closed.load(std::memory_order_acquire) != 0;
+}
+
+void ShmRingBuffer::discard_write(const WriteSlot& slot) {
+  slot_header(header_, slot.index)->state.store(kSlotFree, std::memory_order_release);
+  sem_post(&header_->free_slots);
+}
+
+void ShmRingBuffer::close_writer() {
+  if (header_->writer_closed.exchange(1, std::memory_order_acq_rel) == 0) {
+    // Wake up the reader so that it can observe the closed state.
+    sem_post(&header_->ready_slots);
+  }
+}
+
+ShmRingBuffer::ReadStatus ShmRingBuffer::wait_readable(std::chrono::milliseconds timeout) {
+  if (timed_wait(&header_->ready_slots, timeout)) {
+    if (slot_header(header_, header_->read_index)->state.load(std::memory_order_acquire) ==
+        kSlotReady) {
+      return ReadStatus::kReady;
+    }
+    // The extra post from close_writer() is consumed once every written slot was read.
+    return ReadStatus::kClosed;
+  }
+  return header_->writer_closed.load(std::memory_order_acquire) ? ReadStatus::kClosed
+                                                                : ReadStatus::kTimeout;
+}
+
+std::shared_ptr<ShmRingBuffer::ReadLease> ShmRingBuffer::acquire_read() {
+  const uint64_t index = header_->read_index++;
+  auto* slot = slot_header(header_, index);
+  slot->state.store(kSlotReading, std::memory_order_relaxed);
+  return std::make_shared<ReadLease>(shared_from_this(), index, slot_data(index), slot->size);
+}
+
+void ShmRingBuffer::release(uint64_t index) {
+  slot_header(header_, index)->state.store(kSlotFree, std::memory_order_release);
+  sem_post(&header_->free_slots);
+}
+
+void ShmRingBuffer::close_reader() {
+  if (header_->reader_closed.exchange(1, std::memory_order_acq_rel) == 0) {
+    // Wake up a writer blocked on a free slot so that it can observe the closed state.
+    sem_post(&header_->free_slots);
+  }
+}
+
+}  // namespace holoscan
@@ -0,0 +1,670 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "holoscan/core/services/common/shm_transport_op.hpp"
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+#include "gxf/serialization/endpoint.hpp"
+#include "gxf/std/tensor.hpp"
+#include "holoscan/core/codec_registry.hpp"
+#include "holoscan/core/domain/tensor.hpp"
+#include "holoscan/core/execution_context.hpp"
+#include "holoscan/core/fragment.hpp"
+#include "holoscan/core/gxf/entity.hpp"
+#include "holoscan/core/io_context.hpp"
+#include "holoscan/core/message.hpp"
+
+namespace holoscan::ops {
+
+namespace {
+
+/// Maximum time the transmitter waits (when it starts) for the receiver to create the segment.
+constexpr std::chrono::milliseconds kShmOpenTimeout{30000};
+/// Interval at which the waiting threads re-check whether the operator was stopped.
+constexpr std::chrono::milliseconds kShmWaitInterval{100};
+
+/// Kind of payload stored in a slot (first byte of the slot).
+enum class ShmPayloadKind : uint8_t {
+  kMessage = 0,  ///< holoscan::Message serialized with a registered codec.
+  kEntity = 1,   ///< Entity sent as its tensors.
+};
+
+#pragma pack(push, 1)
+struct ShmTensorHeader {
+  uint32_t name_size;
+  int32_t device_type;  ///< DLDeviceType of the source tensor.
+  uint8_t dtype_code;
+  uint8_t dtype_bits;
+  uint16_t dtype_lanes;
+  int32_t ndim;
+  uint64_t nbytes;  ///< Number of bytes spanned by the tensor data (strides included).
+};
+#pragma pack(pop)
+
+/**
+ * @brief nvidia::gxf::Endpoint reading from or writing to a ring slot.
+ *
+ * write_ptr() copies the data in place instead of registering an extra buffer, so codecs relying
+ * on it (e.g., zero_copy_codec) work unchanged.
+ */
+class ShmSlotEndpoint : public nvidia::gxf::Endpoint {
+ public:
+  ShmSlotEndpoint(std::byte* data, size_t size, bool writable)
+      : data_(data), size_(size), writable_(writable) {}
+
+  gxf_result_t is_write_available_abi() override { return writable_ ? GXF_SUCCESS : GXF_FAILURE; }
+  gxf_result_t is_read_available_abi() override { return writable_ ? GXF_FAILURE : GXF_SUCCESS; }
+
+  gxf_result_t write_abi(const void* data, size_t size, size_t* bytes_written) override {
+    auto* dst = reserve(size);
+    if (!writable_ || dst == nullptr) { return GXF_EXCEEDING_PREALLOCATED_SIZE; }
+    std::memcpy(dst, data, size);
+    *bytes_written = size;
+    return GXF_SUCCESS;
+  }
+
+  gxf_result_t read_abi(void* data, size_t size, size_t* bytes_read) override {
+    auto* src = reserve(size);
+    if (writable_ || src == nullptr) { return GXF_FAILURE; }
+    std::memcpy(data, src, size);
+    *bytes_read = size;
+    return GXF_SUCCESS;
+  }
+
+  gxf_result_t write_ptr_abi(const void* pointer, size_t size,
+                             nvidia::gxf::MemoryStorageType type) override {
+    auto* slot_ptr = reserve(size);
+    if (slot_ptr == nullptr) { return GXF_EXCEEDING_PREALLOCATED_SIZE; }
+    const bool is_device = type == nvidia::gxf::MemoryStorageType::kDevice;
+    cudaError_t result = cudaSuccess;
+    if (writable_) {
+      if (is_device) {
+        result = cudaMemcpy(slot_ptr, pointer, size, cudaMemcpyDeviceToHost);
+      } else {
+        std::memcpy(slot_ptr, pointer, size);
+      }
+    } else {
+      // `pointer` is the destination registered by the deserializer
+      auto* dst = const_cast<void*>(pointer);
+      if (is_device) {
+        result = cudaMemcpy(dst, slot_ptr, size, cudaMemcpyHostToDevice);
+      } else {
+        std::memcpy(dst, slot_ptr, size);
+      }
+    }
+    return result == cudaSuccess ? GXF_SUCCESS : GXF_FAILURE;
+  }
+
+  /// Return a pointer to the next `size` bytes of the slot and advance past them.
+  std::byte* reserve(size_t size) {
+    if (size > size_ - offset_) { return nullptr; }
+    auto* ptr = data_ + offset_;
+    offset_ += size;
+    return ptr;
+  }
+
+  /// Advance to the next multiple of `alignment` (relative to the slot start).
+  bool align(size_t alignment) {
+    size_t aligned = (offset_ + alignment - 1) / alignment * alignment;
+    if (aligned > size_) { return false; }
+    offset_ = aligned;
+    return true;
+  }
+
+  template <typename T>
+  bool write_value(const T& value) {
+    size_t written = 0;
+    return write_abi(&value, sizeof(T), &written) == GXF_SUCCESS;
+  }
+
+  template <typename T>
+  bool read_value(T& value) {
+    size_t read = 0;
+    return read_abi(&value, sizeof(T), &read) == GXF_SUCCESS;
+  }
+
+  bool write_string(const std::string& str) {
+    size_t written = 0;
+    return write_value(static_cast<uint32_t>(str.size())) &&
+           write_abi(str.data(), str.size(), &written) == GXF_SUCCESS;
+  }
+
+  bool read_string(std::string& str, uint32_t size) {
+    auto* src = reserve(size);
+    if (writable_ || src == nullptr) { return false; }
+    str.assign(reinterpret_cast<const char*>(src), size);
+    return true;
+  }
+
+  /// The number of bytes written or read so far.
+  size_t offset() const { return offset_; }
+
+ private:
+  std::byte* data_;
+  size_t size_;
+  size_t offset_ = 0;
+  bool writable_;
+};
+
+unexpected<RuntimeError> shm_codec_error(const std::string& what) {
+  return make_unexpected<RuntimeError>(RuntimeError(ErrorCode::kCodecError, what));
+}
+
+unexpected<RuntimeError> slot_overflow_error(size_t slot_size) {
+  return shm_codec_error(
+      fmt::format("message does not fit in a shared memory slot of {} bytes (see "
+                  "HOLOSCAN_SHM_SLOT_SIZE)",
+                  slot_size));
+}
+
+expected<void, RuntimeError> write_message(std::any&& value, ShmSlotEndpoint& endpoint,
+                                           size_t slot_size) {
+  auto& registry = CodecRegistry::get_instance();
+  auto maybe_codec_name = registry.index_to_name(std::type_index(value.type()));
+  if (!maybe_codec_name) { return forward_error(maybe_codec_name); }
+  const std::string& codec_name = maybe_codec_name.value();
+
+  if (!endpoint.write_value(ShmPayloadKind::kMessage) || !endpoint.write_string(codec_name)) {
+    return slot_overflow_error(slot_size);
+  }
+  auto& serializer = registry.get_serializer(codec_name);
+  // The value is moved into the message and serialized in place, without copying the payload
+  auto maybe_size = serializer(Message(std::move(value)), &endpoint);
+  if (!maybe_size) {
+    if (maybe_size.error() == GXF_EXCEEDING_PREALLOCATED_SIZE) {
+      return slot_overflow_error(slot_size);
+    }
+    return shm_codec_error(fmt::format("failed to serialize '{}': {}",
+                                       codec_name,
+                                       GxfResultStr(maybe_size.error())));
+  }
+  return expected<void, RuntimeError>();
+}
+
+expected<void, RuntimeError> write_tensor(const std::string& name, Tensor& tensor,
+                                          ShmSlotEndpoint& endpoint, size_t slot_size) {
+  const DLTensor& dl_tensor = tensor.dl_ctx()->tensor.dl_tensor;
+  const auto ndim = dl_tensor.ndim;
+  std::vector<int64_t> shape(dl_tensor.shape, dl_tensor.shape + ndim);
+  std::vector<int64_t> strides(ndim);  // in number of elements
+  calc_strides(dl_tensor, strides, true);
+
+  // Number of bytes spanned by the tensor data
+  uint64_t nbytes = 0;
+  if (std::all_of(shape.begin(), shape.end(), [](int64_t dim) { return dim > 0; })) {
+    int64_t last_element = 0;
+    for (int32_t i = 0; i < ndim; ++i) {
+      if (strides[i] < 0) {
+        return shm_codec_error(fmt::format("tensor '{}' has negative strides", name));
+      }
+      last_element += (shape[i] - 1) * strides[i];
+    }
+    nbytes = (last_element + 1) * tensor.itemsize();
+  }
+
+  ShmTensorHeader header{static_cast<uint32_t>(name.size()),
+                         static_cast<int32_t>(dl_tensor.device.device_type),
+                         dl_tensor.dtype.code,
+                         dl_tensor.dtype.bits,
+                         dl_tensor.dtype.lanes,
+                         ndim,
+                         nbytes};
+  size_t written = 0;
+  if (!endpoint.write_value(header) ||
+      endpoint.write_abi(name.data(), name.size(), &written) != GXF_SUCCESS ||
+      endpoint.write_abi(shape.data(), ndim * sizeof(int64_t), &written) != GXF_SUCCESS ||
+      endpoint.write_abi(strides.data(), ndim * sizeof(int64_t), &written) != GXF_SUCCESS ||
+      !endpoint.align(ShmRingBuffer::kSlotAlignment)) {
+    return slot_overflow_error(slot_size);
+  }
+  auto* dst = endpoint.reserve(nbytes);
+  if (dst == nullptr) { return slot_overflow_error(slot_size); }
+  if (nbytes == 0) { return expected<void, RuntimeError>(); }
+
+  const auto* src = static_cast<const std::byte*>(dl_tensor.data) + dl_tensor.byte_offset;
+  switch (dl_tensor.device.device_type) {
+    case kDLCPU:
+    case kDLCUDAHost:
+    case kDLCUDAManaged:
+      std::memcpy(dst, src, nbytes);
+      break;
+    case kDLCUDA: {
+      cudaError_t result = cudaMemcpy(dst, src, nbytes, cudaMemcpyDeviceToHost);
+      if (result != cudaSuccess) {
+        return shm_codec_error(fmt::format(
+            "failed to copy tensor '{}' from the device: {}", name, cudaGetErrorString(result)));
+      }
+      break;
+    }
+    default:
+      return shm_codec_error(
+          fmt::format("tensor '{}' has an unsupported device type ({})",
+                      name,
+                      static_cast<int>(dl_tensor.device.device_type)));
+  }
+  return expected<void, RuntimeError>();
+}
+
+expected<void, RuntimeError> write_entity(holoscan::gxf::Entity& entity,
+                                          ShmSlotEndpoint& endpoint, size_t slot_size) {
+  std::vector<std::pair<std::string, std::shared_ptr<Tensor>>> tensors;
+  auto components_expected = entity.findAll();
+  auto tensors_expected = entity.findAll<nvidia::gxf::Tensor>();
+  if (!components_expected || !tensors_expected) {
+    return shm_codec_error("failed to get the components of the entity");
+  }
+  std::vector<gxf_uid_t> tensor_cids;
+  for (const auto& tensor_handle : tensors_expected.value()) {
+    if (tensor_handle) { tensor_cids.push_back(tensor_handle->cid()); }
+  }
+  auto components = components_expected.value();
+  for (size_t i = 0; i < components.size(); i++) {
+    const auto component = components[i];
+    std::string component_name = component->name();
+    // Skip the message label (data flow tracking) and the stream ID from CudaStreamHandler
+    if (component_name == "message_label" || component_name == "cuda_stream_id_") { continue; }
+    // Other components would be silently lost on the receiving side, so the entity is rejected
+    if (std::find(tensor_cids.begin(), tensor_cids.end(), component->cid()) ==
+        tensor_cids.end()) {
+      return shm_codec_error(
+          fmt::format("component '{}' of the entity is not a tensor and cannot be sent through "
+                      "shared memory (unset HOLOSCAN_SHM_TRANSPORT to use UCX)",
+                      component_name));
+    }
+    auto tensor = entity.get<Tensor>(component_name.c_str(), false);
+    if (!tensor) {
+      return shm_codec_error(fmt::format("failed to get tensor '{}'", component_name));
+    }
+    tensors.emplace_back(std::move(component_name), std::move(tensor));
+  }
+
+  if (!endpoint.write_value(ShmPayloadKind::kEntity) ||
+      !endpoint.write_value(static_cast<uint32_t>(tensors.size()))) {
+    return slot_overflow_error(slot_size);
+  }
+  for (auto& [name, tensor] : tensors) {
+    auto result = write_tensor(name, *tensor, endpoint, slot_size);
+    if (!result) { return result; }
+  }
+  return expected<void, RuntimeError>();
+}
+
+/// Owner of the memory referenced by a tensor received from a ring slot.
+struct ShmTensorContext {
+  DLManagedTensor tensor{};
+  std::vector<int64_t> shape;
+  std::vector<int64_t> strides;
+  std::shared_ptr<ShmRingBuffer::ReadLease> lease;  ///< Keeps the slot of a host tensor.
+  void* device_data = nullptr;                      ///< Device copy of a device tensor.
+};
+
+expected<std::shared_ptr<Tensor>, RuntimeError> read_tensor(
+    std::string& name, ShmSlotEndpoint& endpoint,
+    const std::shared_ptr<ShmRingBuffer::ReadLease>& lease) {
+  ShmTensorHeader header{};
+  if (!endpoint.read_value(header) || !endpoint.read_string(name, header.name_size)) {
+    return shm_codec_error("truncated tensor header");
+  }
+  auto ctx = std::make_unique<ShmTensorContext>();
+  ctx->shape.resize(header.ndim);
+  ctx->strides.resize(header.ndim);
+  size_t read = 0;
+  if (endpoint.read_abi(ctx->shape.data(), header.ndim * sizeof(int64_t), &read) != GXF_SUCCESS ||
+      endpoint.read_abi(ctx->strides.data(), header.ndim * sizeof(int64_t), &read) !=
+          GXF_SUCCESS ||
+      !endpoint.align(ShmRingBuffer::kSlotAlignment)) {
+    return shm_codec_error(fmt::format("truncated descriptor of tensor '{}'", name));
+  }
+  auto* data = endpoint.reserve(header.nbytes);
+  if (data == nullptr) { return shm_codec_error(fmt::format("truncated tensor '{}'", name)); }
+
+  DLTensor& dl_tensor = ctx->tensor.dl_tensor;
+  dl_tensor.ndim = header.ndim;
+  dl_tensor.dtype = DLDataType{header.dtype_code, header.dtype_bits, header.dtype_lanes};
+  dl_tensor.shape = ctx->shape.data();
+  dl_tensor.strides = ctx->strides.data();
+  dl_tensor.byte_offset = 0;
+
+  if (header.device_type == kDLCUDA) {
+    int device_id = 0;
+    cudaGetDevice(&device_id);
+    cudaError_t result = cudaMalloc(&ctx->device_data, std::max<uint64_t>(header.nbytes, 1));
+    if (result == cudaSuccess) {
+      result = cudaMemcpy(ctx->device_data, data, header.nbytes, cudaMemcpyHostToDevice);
+    }
+    if (result != cudaSuccess) {
+      if (ctx->device_data) { cudaFree(ctx->device_data); }
+      return shm_codec_error(fmt::format(
+          "failed to copy tensor '{}' to the device: {}", name, cudaGetErrorString(result)));
+    }
+    dl_tensor.data = ctx->device_data;
+    dl_tensor.device = DLDevice{kDLCUDA, device_id};
+  } else {
+    // Host tensors reference the slot directly; the lease gives the slot back when the tensor
+    // is destroyed.
+    dl_tensor.data = data;
+    dl_tensor.device = DLDevice{kDLCPU, 0};
+    ctx->lease = lease;
+  }
+
+  ctx->tensor.manager_ctx = ctx.get();
+  ctx->tensor.deleter = [](DLManagedTensor* self) {
+    auto* tensor_ctx = static_cast<ShmTensorContext*>(self->manager_ctx);
+    if (tensor_ctx->device_data) { cudaFree(tensor_ctx->device_data); }
+    delete tensor_ctx;
+  };
+  auto* dl_managed_tensor = &ctx.release()->tensor;
+  return std::make_shared<Tensor>(dl_managed_tensor);
+}
+
+}  // namespace
+
+void ShmTransmitterOp::setup(OperatorSpec& spec) {
+  spec.input<std::any>("in");
+  spec.param(segment_name_,
+             "segment_name",
+             "Segment name",
+             "The name of the POSIX shared memory segment");
+  spec.param(
+      slot_count_, "slot_count", "Slot count", "The number of slots", kDefaultShmSlotCount);
+  spec.param(slot_size_,
+             "slot_size",
+             "Slot size",
+             "The capacity of each slot in bytes",
+             kDefaultShmSlotSize);
+  spec.param(async_condition_,
+             "async_condition",
+             "asynchronous condition",
+             "AsynchronousCondition driven by the thread reserving ring slots");
+}
+
+void ShmTransmitterOp::initialize() {
+  // Set up prerequisite parameters before calling Operator::initialize()
+  auto frag = fragment();
+
+  // Find if there is an argument for 'async_condition_'
+  auto has_async_condition = std::find_if(args().begin(), args().end(), [](const auto& arg) {
+    return (arg.name() == "async_condition");
+  });
+
+  // Create the AsynchronousCondition if there is no argument provided.
+  if (has_async_condition == args().end()) {
+    async_condition_ = frag->make_condition<holoscan::AsynchronousCondition>("async_condition");
+    add_arg(async_condition_.get());
+  }
+
+  Operator::initialize();
+}
+
+void ShmTransmitterOp::start() {
+  auto maybe_ring = ShmRingBuffer::open(segment_name_.get(), kShmOpenTimeout);
+  if (!maybe_ring) { throw std::runtime_error(maybe_ring.error().what()); }
+  ring_ = maybe_ring.value();
+
+  // The ring was just created so the first slot is free: reserve it before the first compute()
+  // call (the asynchronous condition is initially READY).
+  auto maybe_slot = ring_->acquire_write(kShmOpenTimeout);
+  if (!maybe_slot) { throw std::runtime_error(maybe_slot.error().what()); }
+  slot_ = maybe_slot.value();
+
+  should_stop_ = false;
+  reserve_thread_ = std::thread([this] { reserve_slots(); });
+}
+
+void ShmTransmitterOp::reserve_slots() {
+  while (true) {
+    {
+      // Wait for compute() to use the reserved slot before reserving the next one
+      std::unique_lock<std::mutex> lock(mutex_);
+      slot_consumed_.wait(lock, [this] { return !slot_ || should_stop_; });
+      if (should_stop_) { return; }
+    }
+
+    auto maybe_slot = ring_->acquire_write(kShmWaitInterval);
+    while (!maybe_slot) {
+      if (should_stop_) { return; }
+      if (ring_->reader_closed()) {
+        HOLOSCAN_LOG_DEBUG("ShmTransmitterOp '{}': the receiver is closed", name());
+        async_condition_->event_state(AsynchronousEventState::EVENT_NEVER);
+        return;
+      }
+      maybe_slot = ring_->acquire_write(kShmWaitInterval);
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (should_stop_) {
+        ring_->discard_write(maybe_slot.value());
+        return;
+      }
+      slot_ = maybe_slot.value();
+    }
+    async_condition_->event_state(AsynchronousEventState::EVENT_DONE);
+  }
+}
+
+void ShmTransmitterOp::compute(InputContext& op_input, OutputContext&, ExecutionContext&) {
+  auto maybe_data = op_input.receive<std::any>("in");
+  if (!maybe_data) { return; }
+
+  std::optional<ShmRingBuffer::WriteSlot> reserved_slot;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    reserved_slot = slot_;
+  }
+  if (!reserved_slot) {
+    // Only possible once the receiver is closed (the operator is not executed without a slot)
+    HOLOSCAN_LOG_ERROR("ShmTransmitterOp '{}': dropping message (no free slot)", name());
+    return;
+  }
+
+  auto& slot = reserved_slot.value();
+  ShmSlotEndpoint endpoint(slot.data, slot.capacity, true);
+  auto& data = maybe_data.value();
+  expected<void, RuntimeError> result;
+  if (data.type() == typeid(holoscan::gxf::Entity)) {
+    auto entity = std::any_cast<holoscan::gxf::Entity>(data);
+    result = write_entity(entity, endpoint, slot.capacity);
+  } else {
+    result = write_message(std::move(data), endpoint, slot.capacity);
+  }
+  if (result) {
+    ring_->commit_write(slot, endpoint.offset());
+  } else {
+    ring_->discard_write(slot);
+    HOLOSCAN_LOG_ERROR(
+        "ShmTransmitterOp '{}': dropping message ({})", name(), result.error().what());
+  }
+
+  // Wait for the next slot. The state is changed before the slot is handed back to the
+  // reservation thread so that the thread cannot mark the next slot ready before.
+  async_condition_->event_state(AsynchronousEventState::EVENT_WAITING);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    slot_.reset();
+  }
+  slot_consumed_.notify_one();
+}
+
+void ShmTransmitterOp::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    should_stop_ = true;
+  }
+  slot_consumed_.notify_one();
+  if (reserve_thread_.joinable()) { reserve_thread_.join(); }
+  if (ring_ && slot_) { ring_->discard_write(slot_.value()); }
+  slot_.reset();
+  // Destroying the ring closes the writer so that the receiver stops once all slots are read.
+  ring_.reset();
+}
+
+void ShmReceiverOp::setup(OperatorSpec& spec) {
+  spec.output<std::any>("out");
+  spec.param(segment_name_,
+             "segment_name",
+             "Segment name",
+             "The name of the POSIX shared memory segment");
+  spec.param(
+      slot_count_, "slot_count", "Slot count", "The number of slots", kDefaultShmSlotCount);
+  spec.param(slot_size_,
+             "slot_size",
+             "Slot size",
+             "The capacity of each slot in bytes",
+             kDefaultShmSlotSize);
+  spec.param(async_condition_,
+             "async_condition",
+             "asynchronous condition",
+             "AsynchronousCondition driven by the thread waiting for ring slots");
+}
+
+void ShmReceiverOp::initialize() {
+  // Set up prerequisite parameters before calling Operator::initialize()
+  auto frag = fragment();
+
+  // Find if there is an argument for 'async_condition_'
+  auto has_async_condition = std::find_if(args().begin(), args().end(), [](const auto& arg) {
+    return (arg.name() == "async_condition");
+  });
+
+  // Create the AsynchronousCondition if there is no argument provided.
+  if (has_async_condition == args().end()) {
+    async_condition_ = frag->make_condition<holoscan::AsynchronousCondition>("async_condition");
+    add_arg(async_condition_.get());
+  }
+
+  Operator::initialize();
+}
+
+void ShmReceiverOp::start() {
+  auto maybe_ring =
+      ShmRingBuffer::create(segment_name_.get(), slot_count_.get(), slot_size_.get());
+  if (!maybe_ring) { throw std::runtime_error(maybe_ring.error().what()); }
+  ring_ = maybe_ring.value();
+
+  should_stop_ = false;
+  wait_thread_ = std::thread([this] { wait_for_slots(); });
+}
+
+void ShmReceiverOp::wait_for_slots() {
+  while (!should_stop_) {
+    auto status = ring_->wait_readable(kShmWaitInterval);
+    if (status == ShmRingBuffer::ReadStatus::kTimeout) { continue; }
+    if (status == ShmRingBuffer::ReadStatus::kClosed) {
+      HOLOSCAN_LOG_DEBUG("ShmReceiverOp '{}': the transmitter is closed", name());
+      async_condition_->event_state(AsynchronousEventState::EVENT_NEVER);
+      return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    slot_ready_ = true;
+    async_condition_->event_state(AsynchronousEventState::EVENT_DONE);
+    // Wait for compute() to take the slot before waiting for the next one
+    slot_consumed_.wait(lock, [this] { return !slot_ready_ || should_stop_; });
+  }
+}
+
+void ShmReceiverOp::compute(InputContext&, OutputContext& op_output, ExecutionContext& context) {
+  std::shared_ptr<ShmRingBuffer::ReadLease> lease;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (slot_ready_) { lease = ring_->acquire_read(); }
+  }
+  async_condition_->event_state(AsynchronousEventState::EVENT_WAITING);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    slot_ready_ = false;
+  }
+  slot_consumed_.notify_one();
+
+  // The first compute() call happens before any slot is ready (AsynchronousEventState::READY)
+  if (!lease) { return; }
+
+  ShmSlotEndpoint endpoint(const_cast<std::byte*>(lease->data()), lease->size(), false);
+  ShmPayloadKind kind{};
+  if (!endpoint.read_value(kind)) {
+    HOLOSCAN_LOG_ERROR("ShmReceiverOp '{}': received an empty slot", name());
+    return;
+  }
+
+  switch (kind) {
+    case ShmPayloadKind::kMessage: {
+      uint32_t name_size = 0;
+      std::string codec_name;
+      if (!endpoint.read_value(name_size) || !endpoint.read_string(codec_name, name_size)) {
+        HOLOSCAN_LOG_ERROR("ShmReceiverOp '{}': truncated codec name", name());
+        return;
+      }
+      auto& deserializer = CodecRegistry::get_instance().get_deserializer(codec_name);
+      auto maybe_message = deserializer(&endpoint);
+      if (!maybe_message) {
+        HOLOSCAN_LOG_ERROR("ShmReceiverOp '{}': failed to deserialize '{}': {}",
+                           name(),
+                           codec_name,
+                           GxfResultStr(maybe_message.error()));
+        return;
+      }
+      op_output.emit(maybe_message.value().value(), "out");
+      break;
+    }
+    case ShmPayloadKind::kEntity: {
+      uint32_t tensor_count = 0;
+      if (!endpoint.read_value(tensor_count)) {
+        HOLOSCAN_LOG_ERROR("ShmReceiverOp '{}': truncated entity", name());
+        return;
+      }
+      auto entity = holoscan::gxf::Entity::New(&context);
+      for (uint32_t i = 0; i < tensor_count; ++i) {
+        std::string tensor_name;
+        auto maybe_tensor = read_tensor(tensor_name, endpoint, lease);
+        if (!maybe_tensor) {
+          HOLOSCAN_LOG_ERROR("ShmReceiverOp '{}': {}", name(), maybe_tensor.error().what());
+          return;
+        }
+        entity.add(maybe_tensor.value(), tensor_name.c_str());
+      }
+      op_output.emit(entity, "out");
+      break;
+    }
+    default:
+      HOLOSCAN_LOG_ERROR(
+          "ShmReceiverOp '{}': unknown payload kind {}", name(), static_cast<int>(kind));
+  }
+}
+
+void ShmReceiverOp::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    should_stop_ = true;
+  }
+  slot_consumed_.notify_one();
+  if (wait_thread_.joinable()) { wait_thread_.join(); }
+  // Tensors still referencing slots keep the mapping alive until they are destroyed.
+  ring_.reset();
+}
+
+}  // namespace holoscan::ops
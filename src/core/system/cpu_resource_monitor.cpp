@@ -143,6 +143,11 @@ CPUInfo& CPUResourceMonitor::update(CPUInfo& cpu_info, uint64_t metric_flags) {
         hwloc_get_nbobjs_by_type(static_cast<hwloc_topology_t>(context_), HWLOC_OBJ_PU);
   }
 
+  if (metric_flags & CPUMetricFlag::NUMA_NODE_COUNT) {
+    cpu_info.num_numa_nodes =
+        hwloc_get_nbobjs_by_type(static_cast<hwloc_topology_t>(context_), HWLOC_OBJ_NUMANODE);
+  }
+
   if (metric_flags & CPUMetricFlag::AVAILABLE_PROCESSOR_COUNT) {
     // https://linux.die.net/man/2/sched_getaffinity
     if (sched_getaffinity(0, sizeof(cpu_set_), &cpu_set_) == 0) {
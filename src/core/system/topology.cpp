@@ -18,6 +18,9 @@
 
 #include <hwloc.h>
 
+#include <cerrno>
+#include <vector>
+
 #include "holoscan/logger/logger.hpp"
 
 namespace holoscan {
@@ -35,6 +38,51 @@ void* Topology::context() const {
   return context_;
 }
 
+std::vector<NumaNodeInfo> Topology::numa_nodes() const {
+  auto topology = static_cast<hwloc_topology_t>(context_);
+  std::vector<NumaNodeInfo> nodes;
+  const int num_nodes = hwloc_get_nbobjs_by_type(topology, HWLOC_OBJ_NUMANODE);
+  if (num_nodes <= 0) { return nodes; }
+  nodes.reserve(num_nodes);
+  for (int i = 0; i < num_nodes; ++i) {
+    hwloc_obj_t node = hwloc_get_obj_by_type(topology, HWLOC_OBJ_NUMANODE, i);
+    if (node == nullptr) { continue; }
+    NumaNodeInfo info;
+    info.os_index = static_cast<int32_t>(node->os_index);
+    info.num_cores =
+        hwloc_get_nbobjs_inside_cpuset_by_type(topology, node->cpuset, HWLOC_OBJ_CORE);
+    info.num_cpus = hwloc_get_nbobjs_inside_cpuset_by_type(topology, node->cpuset, HWLOC_OBJ_PU);
+    info.memory_total = node->attr != nullptr ? node->attr->numanode.local_memory : 0;
+    nodes.push_back(info);
+  }
+  return nodes;
+}
+
+int Topology::bind_thread_to_cpu(int64_t cpu) const {
+  if (cpu < 0) {
+    errno = EINVAL;
+    return -1;
+  }
+  hwloc_bitmap_t cpuset = hwloc_bitmap_alloc();
+  hwloc_bitmap_only(cpuset, static_cast<unsigned>(cpu));
+  const int result =
+      hwloc_set_cpubind(static_cast<hwloc_topology_t>(context_), cpuset, HWLOC_CPUBIND_THREAD);
+  hwloc_bitmap_free(cpuset);
+  return result == 0 ? 0 : -1;
+}
+
+int Topology::bind_thread_to_numa_node(int64_t numa_node) const {
+  auto topology = static_cast<hwloc_topology_t>(context_);
+  hwloc_obj_t node = numa_node < 0 ? nullptr
+                                   : hwloc_get_numanode_obj_by_os_index(
+                                         topology, static_cast<unsigned>(numa_node));
+  if (node == nullptr) {
+    errno = ENOENT;
+    return -1;
+  }
+  return hwloc_set_cpubind(topology, node->cpuset, HWLOC_CPUBIND_THREAD) == 0 ? 0 : -1;
+}
+
 Topology::~Topology() {
   // Destroy the hwloc topology object
   hwloc_topology_destroy(static_cast<hwloc_topology_t>(context_));
@@ -17,15 +17,26 @@
 
 #include "holoscan/logger/logger.hpp"
 
+#include <sys/syscall.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdlib>
+#include <cstring>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "common/logger/spdlog_logger.hpp"
 
 namespace holoscan {
 
+using nvidia::logger::LogMessageOrigin;
 using nvidia::logger::SpdlogLogger;
 
 bool Logger::log_pattern_set_by_user = false;
@@ -45,6 +56,314 @@ class HoloscanLogger : public SpdlogLogger {
   using SpdlogLogger::SpdlogLogger;
 };
 
+namespace {
+
+/// Initial capacity of the message strings of the asynchronous logging queue.
+constexpr size_t kInitialMessageCapacity = 128;
+
+/// Whether the calling thread is the asynchronous logging thread.
+thread_local bool is_logging_thread = false;
+
+/// OS thread id of the calling thread (the id printed by the `%t` pattern flag).
+size_t current_thread_id() {
+  static thread_local const auto thread_id = static_cast<size_t>(::syscall(SYS_gettid));
+  return thread_id;
+}
+
+/**
+ * @brief Bounded multi-producer single-consumer queue of log messages.
+ *
+ * Each slot has a sequence number telling whether it can be written by the producer that reserved
+ * its position or read by the consumer (D. Vyukov's bounded queue), so that producers only contend
+ * on the atomic increment of the enqueue position. The messages are written to the logger by a
+ * background thread, which sleeps when the queue is empty.
+ */
+class AsyncLogQueue {
+ public:
+  struct Record {
+    const char* file = nullptr;
+    int line = 0;
+    const char* function_name = nullptr;
+    LogLevel level = LogLevel::INFO;
+    LogMessageOrigin origin;
+    /// The message, or its format string if `formatter` is set
+    std::string text;
+    detail::DeferredLogFormatter formatter = nullptr;
+    unsigned char args[detail::kDeferredLogArgsCapacity];
+  };
+
+  AsyncLogQueue(size_t queue_size, LogOverflowPolicy overflow_policy)
+      : capacity_(round_up_to_power_of_two(std::max<size_t>(queue_size, 2))),
+        mask_(capacity_ - 1),
+        overflow_policy_(overflow_policy),
+        slots_(new Slot[capacity_]) {
+    for (size_t i = 0; i < capacity_; ++i) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+      slots_[i].record.text.reserve(kInitialMessageCapacity);
+    }
+    thread_ = std::thread([this] { run(); });
+    pthread_setname_np(thread_.native_handle(), "holoscan_log");
+  }
+
+  /// Write the queued messages and stop the logging thread.
+  ~AsyncLogQueue() {
+    stopping_.store(true, std::memory_order_relaxed);
+    wake_consumer();
+    thread_.join();
+  }
+
+  AsyncLogQueue(const AsyncLogQueue&) = delete;
+  AsyncLogQueue& operator=(const AsyncLogQueue&) = delete;
+
+  size_t capacity() const { return capacity_; }
+  LogOverflowPolicy overflow_policy() const { return overflow_policy_; }
+  uint64_t dropped_count() const { return dropped_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Queue a message.
+   *
+   * `fill` is called to write the message to the reserved record. If the queue is full, the
+   * message is dropped or the call waits, depending on the overflow policy.
+   */
+  template <typename FillT>
+  void push(FillT&& fill) {
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    for (int attempt = 0;;) {
+      slot = &slots_[pos & mask_];
+      const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) { break; }
+      } else if (diff < 0) {
+        // The queue is full
+        if (overflow_policy_ == LogOverflowPolicy::kDrop) {
+          dropped_.fetch_add(1, std::memory_order_relaxed);
+          return;
+        }
+        wake_consumer();
+        if (++attempt < 64) {
+          std::this_thread::yield();
+        } else {
+          std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+
+    fill(slot->record);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+
+    // Pairs with the fence of the logging thread before it goes to sleep
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (consumer_waiting_.load(std::memory_order_relaxed)) { wake_consumer(); }
+  }
+
+  /// Wait until the messages queued before this call are written.
+  void flush() {
+    const size_t target = enqueue_pos_.load(std::memory_order_acquire);
+    if (written_.load(std::memory_order_acquire) >= target) { return; }
+
+    flush_waiters_.fetch_add(1, std::memory_order_seq_cst);
+    wake_consumer();
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (written_.load(std::memory_order_acquire) < target) {
+        // The timeout only guards against a message whose slot is still being filled
+        flushed_cv_.wait_for(lock, std::chrono::milliseconds(1));
+      }
+    }
+    flush_waiters_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+ private:
+  struct alignas(64) Slot {
+    std::atomic<size_t> sequence{0};
+    Record record;
+  };
+
+  static size_t round_up_to_power_of_two(size_t value) {
+    size_t result = 1;
+    while (result < value) { result <<= 1; }
+    return result;
+  }
+
+  bool has_message() const {
+    return slots_[dequeue_pos_ & mask_].sequence.load(std::memory_order_acquire) ==
+           dequeue_pos_ + 1;
+  }
+
+  void wake_consumer() {
+    // Taking the lock ensures that the logging thread is either before its check for messages or
+    // waiting on the condition variable
+    { std::lock_guard<std::mutex> lock(mutex_); }
+    cv_.notify_one();
+  }
+
+  void run() {
+    is_logging_thread = true;
+    fmt::memory_buffer buffer;
+    uint64_t reported_dropped_count = 0;
+
+    for (;;) {
+      while (has_message()) {
+        Slot& slot = slots_[dequeue_pos_ & mask_];
+        write(slot.record, buffer);
+        slot.sequence.store(dequeue_pos_ + capacity_, std::memory_order_release);
+        ++dequeue_pos_;
+        written_.store(dequeue_pos_, std::memory_order_release);
+      }
+
+      const uint64_t dropped_count = dropped_.load(std::memory_order_relaxed);
+      if (dropped_count != reported_dropped_count) {
+        HoloscanLogger::instance().log(
+            __FILE__,
+            __LINE__,
+            __FUNCTION__,
+            static_cast<int>(LogLevel::WARN),
+            fmt::format("Asynchronous logging queue full: {} message(s) dropped",
+                        dropped_count - reported_dropped_count)
+                .c_str());
+        reported_dropped_count = dropped_count;
+      }
+
+      if (flush_waiters_.load(std::memory_order_seq_cst) > 0) {
+        { std::lock_guard<std::mutex> lock(mutex_); }
+        flushed_cv_.notify_all();
+      }
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      consumer_waiting_.store(true, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (!has_message()) {
+        if (stopping_.load(std::memory_order_relaxed)) { break; }
+        cv_.wait_for(lock, std::chrono::milliseconds(100));
+      }
+      consumer_waiting_.store(false, std::memory_order_relaxed);
+    }
+  }
+
+  static void write(const Record& record, fmt::memory_buffer& buffer) {
+    const char* message = record.text.c_str();
+    if (record.formatter != nullptr) {
+      buffer.clear();
+      try {
+        record.formatter(record.args, fmt::string_view(record.text), buffer);
+      } catch (const std::exception& e) {
+        buffer.clear();
+        fmt::format_to(std::back_inserter(buffer), "{} (format error: {})", record.text, e.what());
+      }
+      buffer.push_back('\0');
+      message = buffer.data();
+    }
+    HoloscanLogger::instance().log(record.file,
+                                   record.line,
+                                   record.function_name,
+                                   static_cast<int>(record.level),
+                                   message,
+                                   const_cast<LogMessageOrigin*>(&record.origin));
+  }
+
+  const size_t capacity_;
+  const size_t mask_;
+  const LogOverflowPolicy overflow_policy_;
+  std::unique_ptr<Slot[]> slots_;
+
+  alignas(64) std::atomic<size_t> enqueue_pos_{0};
+  alignas(64) std::atomic<uint64_t> dropped_{0};
+  alignas(64) size_t dequeue_pos_ = 0;  ///< only accessed by the logging thread
+  std::atomic<size_t> written_{0};
+  std::atomic<bool> consumer_waiting_{false};
+  std::atomic<int> flush_waiters_{0};
+  std::atomic<bool> stopping_{false};
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::condition_variable flushed_cv_;
+  std::thread thread_;
+};
+
+/// The queue used for asynchronous logging (null if asynchronous logging is disabled).
+std::atomic<AsyncLogQueue*> async_log_queue{nullptr};
+/// Number of threads currently using `async_log_queue` (a queue is deleted once unused).
+std::atomic<int> async_log_queue_users{0};
+/// Protects the creation and deletion of the queue.
+std::mutex async_log_queue_mutex;
+/// Messages dropped by the queues that were deleted.
+std::atomic<uint64_t> async_log_dropped_count{0};
+
+/// Pins the queue for the lifetime of the object.
+class AsyncLogQueueRef {
+ public:
+  AsyncLogQueueRef() {
+    async_log_queue_users.fetch_add(1, std::memory_order_seq_cst);
+    queue_ = async_log_queue.load(std::memory_order_seq_cst);
+  }
+  ~AsyncLogQueueRef() { async_log_queue_users.fetch_sub(1, std::memory_order_release); }
+
+  AsyncLogQueueRef(const AsyncLogQueueRef&) = delete;
+  AsyncLogQueueRef& operator=(const AsyncLogQueueRef&) = delete;
+
+  AsyncLogQueue* get() const { return queue_; }
+
+ private:
+  AsyncLogQueue* queue_ = nullptr;
+};
+
+/// Replace the queue (with `nullptr` to disable asynchronous logging), writing the messages of the
+/// previous queue.
+void replace_async_log_queue(std::unique_ptr<AsyncLogQueue> queue) {
+  std::unique_ptr<AsyncLogQueue> previous(
+      async_log_queue.exchange(queue.release(), std::memory_order_seq_cst));
+  if (!previous) { return; }
+  // Wait for the threads that may still be queuing messages to the previous queue
+  while (async_log_queue_users.load(std::memory_order_acquire) > 0) { std::this_thread::yield(); }
+  async_log_dropped_count.fetch_add(previous->dropped_count(), std::memory_order_relaxed);
+  // Deleting the queue writes the queued messages
+  previous.reset();
+}
+
+/// Disables asynchronous logging at exit, before the logger is destroyed.
+struct AsyncLogShutdown {
+  ~AsyncLogShutdown() {
+    std::lock_guard<std::mutex> lock(async_log_queue_mutex);
+    replace_async_log_queue(nullptr);
+  }
+};
+
+/// Whether a message must be logged synchronously (after the queued messages are written).
+bool is_synchronous_log_level(LogLevel level) {
+  return level >= LogLevel::ERROR || is_logging_thread;
+}
+
+/**
+ * @brief Queue a message if asynchronous logging is enabled.
+ *
+ * @return false if asynchronous logging is disabled (the message must be logged synchronously).
+ */
+template <typename FillT>
+bool log_async(const char* file, int line, const char* function_name, LogLevel level,
+               FillT&& fill) {
+  AsyncLogQueueRef queue;
+  if (queue.get() == nullptr) { return false; }
+
+  const auto time = std::chrono::system_clock::now();
+  queue.get()->push([&](AsyncLogQueue::Record& record) {
+    record.file = file;
+    record.line = line;
+    record.function_name = function_name;
+    record.level = level;
+    record.origin.time = time;
+    record.origin.thread_id = current_thread_id();
+    fill(record);
+  });
+  return true;
+}
+
+}  // namespace
+
 static std::string get_concrete_log_pattern(std::string pattern) {
   // Convert to uppercase
   std::string log_pattern = pattern;
@@ -191,13 +510,125 @@ void Logger::set_pattern(std::string pattern, bool* is_overridden_by_env) {
 
 void Logger::log_message(const char* file, int line, const char* name, LogLevel level,
                          fmt::string_view format, fmt::format_args args) {
+  if (is_async()) {
+    if (is_synchronous_log_level(level)) {
+      // Keep the order of the messages
+      flush();
+    } else if (level < Logger::level()) {
+      return;
+    } else {
+      // Format on the calling thread (the arguments may reference its data) and let the logging
+      // thread write the message
+      static thread_local fmt::memory_buffer buffer;
+      buffer.clear();
+      fmt::vformat_to(std::back_inserter(buffer), format, args);
+      if (log_async(file, line, name, level, [](AsyncLogQueue::Record& record) {
+            record.text.assign(buffer.data(), buffer.size());
+            record.formatter = nullptr;
+          })) {
+        return;
+      }
+    }
+  }
+
   HoloscanLogger& logger = HoloscanLogger::instance();
   logger.log(file, line, name, static_cast<int>(level), fmt::vformat(format, args).c_str());
 }
 
 void Logger::log_message(LogLevel level, fmt::string_view format, fmt::format_args args) {
-  HoloscanLogger& logger = HoloscanLogger::instance();
-  logger.log(nullptr, 0, nullptr, static_cast<int>(level), fmt::vformat(format, args).c_str());
+  log_message(nullptr, 0, nullptr, level, format, args);
+}
+
+bool Logger::log_deferred(const char* file, int line, const char* name, LogLevel level,
+                          fmt::string_view format, const unsigned char* args, size_t args_size,
+                          detail::DeferredLogFormatter formatter) {
+  if (is_synchronous_log_level(level)) { return false; }
+  if (level < Logger::level()) { return true; }
+  return log_async(file, line, name, level, [&](AsyncLogQueue::Record& record) {
+    record.text.assign(format.data(), format.size());
+    std::memcpy(record.args, args, args_size);
+    record.formatter = formatter;
+  });
+}
+
+void Logger::enable_async(size_t queue_size, LogOverflowPolicy overflow_policy) {
+  // Construct the logger before the object disabling asynchronous logging at exit, so that it is
+  // destroyed after it
+  HoloscanLogger::instance();
+  static AsyncLogShutdown shutdown;
+
+  std::lock_guard<std::mutex> lock(async_log_queue_mutex);
+  AsyncLogQueue* queue = async_log_queue.load(std::memory_order_acquire);
+  if (queue != nullptr && queue->capacity() >= queue_size &&
+      queue->overflow_policy() == overflow_policy) {
+    return;
+  }
+  replace_async_log_queue(std::make_unique<AsyncLogQueue>(queue_size, overflow_policy));
+}
+
+void Logger::disable_async() {
+  std::lock_guard<std::mutex> lock(async_log_queue_mutex);
+  replace_async_log_queue(nullptr);
+}
+
+bool Logger::is_async() {
+  return async_log_queue.load(std::memory_order_relaxed) != nullptr;
+}
+
+void Logger::flush() {
+  if (is_logging_thread) { return; }
+  AsyncLogQueueRef queue;
+  if (queue.get() != nullptr) { queue.get()->flush(); }
+}
+
+uint64_t Logger::dropped_message_count() {
+  AsyncLogQueueRef queue;
+  uint64_t count = async_log_dropped_count.load(std::memory_order_relaxed);
+  if (queue.get() != nullptr) { count += queue.get()->dropped_count(); }
+  return count;
+}
+
+void set_log_async(bool enabled, size_t queue_size, LogOverflowPolicy overflow_policy) {
+  const char* env_p = std::getenv("HOLOSCAN_LOG_ASYNC");
+  if (env_p) {
+    std::string value(env_p);
+    std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) {
+      return std::tolower(c);
+    });
+    enabled = (value == "1" || value == "true" || value == "on" || value == "yes");
+  }
+  const char* size_p = std::getenv("HOLOSCAN_LOG_ASYNC_QUEUE_SIZE");
+  if (size_p) {
+    char* end = nullptr;
+    const auto size = std::strtoull(size_p, &end, 10);
+    if (end != size_p && size > 0) {
+      queue_size = static_cast<size_t>(size);
+    } else {
+      HOLOSCAN_LOG_WARN("Ignoring invalid HOLOSCAN_LOG_ASYNC_QUEUE_SIZE value '{}'", size_p);
+    }
+  }
+  const char* overflow_p = std::getenv("HOLOSCAN_LOG_ASYNC_OVERFLOW");
+  if (overflow_p) {
+    std::string value(overflow_p);
+    std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) {
+      return std::tolower(c);
+    });
+    if (value == "drop") {
+      overflow_policy = LogOverflowPolicy::kDrop;
+    } else if (value == "block") {
+      overflow_policy = LogOverflowPolicy::kBlock;
+    } else {
+      HOLOSCAN_LOG_WARN("Ignoring invalid HOLOSCAN_LOG_ASYNC_OVERFLOW value '{}' (expected 'drop' "
+                        "or 'block')",
+                        overflow_p);
+    }
+  }
+
+  if (enabled) {
+    Logger::enable_async(queue_size, overflow_policy);
+  } else {
+    Logger::disable_async();
+  }
 }
 
 }  // namespace holoscan
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <chrono>
 #include <memory>
+#include <stdexcept>
 #include <thread>
 
 namespace holoscan::ops {
@@ -49,6 +50,12 @@ void AsyncPingTxOp::setup(OperatorSpec& spec) {
              "async_condition",
              "asynchronous condition",
              "AsynchronousCondition adding async support to the operator");
+  spec.param(reactor_,
+             "reactor",
+             "Event reactor",
+             "EventReactor driving the asynchronous condition with a timer, instead of a thread "
+             "owned by the operator.",
+             ParameterFlag::kOptional);
 }
 
 void AsyncPingTxOp::initialize() {
@@ -70,6 +77,14 @@ void AsyncPingTxOp::initialize() {
 }
 
 void AsyncPingTxOp::start() {
+  if (reactor_.has_value() && reactor_.get()) {
+    // Same behavior as async_ping(), driven by a timer of the shared reactor
+    auto maybe_id = reactor_.get()->add_timer(std::chrono::milliseconds(delay_.get()),
+                                              async_condition_.get());
+    if (!maybe_id) { throw std::runtime_error(maybe_id.error().what()); }
+    reactor_id_ = maybe_id.value();
+    return;
+  }
   async_thread_ = std::thread([this] { async_ping(); });
 }
 
@@ -87,6 +102,12 @@ void AsyncPingTxOp::compute(InputContext&, OutputContext& op_output, ExecutionCo
 }
 
 void AsyncPingTxOp::stop() {
+  if (reactor_id_ >= 0) {
+    auto result = reactor_.get()->remove(reactor_id_);
+    if (!result) { HOLOSCAN_LOG_ERROR("{}", result.error().what()); }
+    reactor_id_ = -1;
+    return;
+  }
   should_stop_ = true;
   async_thread_.join();
 }
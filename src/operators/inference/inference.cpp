@@ -17,6 +17,8 @@
 
 #include "holoscan/operators/inference/inference.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -118,6 +120,28 @@ struct YAML::convert<holoscan::ops::InferenceOp::DataVecMap> {
 
 namespace holoscan::ops {
 
+namespace {
+
+/// Value of the 'max_batch_size' argument (1 if not given), read before the parameters are set
+int max_batch_size_arg(std::vector<Arg>& args) {
+  auto max_batch_size_arg = std::find_if(
+      args.begin(), args.end(), [](const auto& arg) { return arg.name() == "max_batch_size"; });
+  if (max_batch_size_arg == args.end() || !max_batch_size_arg->has_value()) { return 1; }
+
+  std::any& any_arg = max_batch_size_arg->value();
+  try {
+    if (max_batch_size_arg->arg_type().element_type() == ArgElementType::kYAMLNode) {
+      return std::any_cast<YAML::Node&>(any_arg).as<int>();
+    }
+    return std::any_cast<int>(any_arg);
+  } catch (const std::exception& e) {
+    HOLOSCAN_LOG_ERROR("Could not parse parameter 'max_batch_size' as 'int': {}", e.what());
+  }
+  return 1;
+}
+
+}  // namespace
+
 void InferenceOp::setup(OperatorSpec& spec) {
   register_converter<DataMap>();
   register_converter<DataVecMap>();
@@ -156,6 +180,36 @@ void InferenceOp::setup(OperatorSpec& spec) {
   spec.param(transmit_on_cuda_, "transmit_on_cuda", "Transmit message on CUDA", "", true);
 
   spec.param(parallel_inference_, "parallel_inference", "Parallel inference", "", true);
+  spec.param(intra_op_num_threads_,
+             "intra_op_num_threads",
+             "Intra-op threads",
+             "Number of threads executing each operator of a model on CPU (onnxruntime).",
+             1);
+  spec.param(inter_op_num_threads_,
+             "inter_op_num_threads",
+             "Inter-op threads",
+             "Number of threads executing independent operators of a model on CPU (onnxruntime).",
+             1);
+  spec.param(execution_mode_,
+             "execution_mode",
+             "Execution mode",
+             "Execution mode of the operators of a model (sequential or parallel, onnxruntime).",
+             std::string("sequential"));
+  spec.param(intra_op_thread_affinity_,
+             "intra_op_thread_affinity",
+             "Intra-op thread affinity",
+             "CPU cores of the intra-op threads besides the calling thread (onnxruntime).",
+             std::vector<int>{});
+  spec.param(max_batch_size_,
+             "max_batch_size",
+             "Maximum batch size",
+             "Maximum number of frames inferred at once (dynamic batching, onnxruntime).",
+             1);
+  spec.param(max_batch_delay_ms_,
+             "max_batch_delay_ms",
+             "Maximum batch delay",
+             "Maximum time in ms a frame waits for other frames to fill a batch.",
+             0.0);
   spec.param(receivers_, "receivers", "Receivers", "List of receivers", {});
   spec.param(transmitter_, "transmitter", "Transmitter", "Transmitter", {&transmitter});
   cuda_stream_handler_.define_params(spec);
@@ -164,6 +218,20 @@ void InferenceOp::setup(OperatorSpec& spec) {
 void InferenceOp::initialize() {
   register_converter<DataMap>();
   register_converter<DataVecMap>();
+
+  // With dynamic batching, a frame of any stream executes the operator (instead of waiting for a
+  // frame of every stream), and the BatchFlushCondition executes it when the pending batch is due.
+  if (max_batch_size_arg(args()) > 1) {
+    for (auto& [name, io_spec] : spec()->inputs()) {
+      if (name.rfind("receivers:", 0) == 0 && io_spec->conditions().empty()) {
+        io_spec->condition(ConditionType::kNone);
+      }
+    }
+    batch_flush_condition_ =
+        fragment()->make_condition<BatchFlushCondition>("batch_flush_condition");
+    add_arg(batch_flush_condition_);
+  }
+
   Operator::initialize();
 }
 
@@ -185,6 +253,32 @@ void InferenceOp::start() {
       HoloInfer::raise_error(module_, "Onnxruntime with CUDA not supported on aarch64.");
     }
 
+    const auto& execution_mode = execution_mode_.get();
+    if (execution_mode != "sequential" && execution_mode != "parallel") {
+      HoloInfer::raise_error(
+          module_, "Execution mode must be sequential or parallel, got " + execution_mode);
+    }
+
+    if (max_batch_size_.get() < 1) {
+      HoloInfer::raise_error(module_, "Maximum batch size must be at least 1.");
+    }
+    if (max_batch_size_.get() > 1) {
+      bool all_onnxrt = backend_.get() == "onnxrt";
+      for (const auto& [_, backend] : backend_map_.get().get_map()) {
+        all_onnxrt = all_onnxrt && backend == "onnxrt";
+      }
+      if (!all_onnxrt || input_on_cuda_.get() || output_on_cuda_.get()) {
+        HoloInfer::raise_error(module_,
+                               "Dynamic batching requires the onnxrt backend, with input and "
+                               "output buffers on host.");
+      }
+      batcher_ = std::make_unique<HoloInfer::DynamicBatcher>(
+          in_tensor_names_.get(),
+          max_batch_size_.get(),
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::duration<double, std::milli>(max_batch_delay_ms_.get())));
+    }
+
     // Create inference specification structure
     inference_specs_ =
         std::make_shared<HoloInfer::InferenceSpecs>(backend_.get(),
@@ -199,6 +293,11 @@ void InferenceOp::start() {
                                                     enable_fp16_.get(),
                                                     input_on_cuda_.get(),
                                                     output_on_cuda_.get());
+    auto& cpu_options = inference_specs_->cpu_options_;
+    cpu_options.intra_op_num_threads = intra_op_num_threads_.get();
+    cpu_options.inter_op_num_threads = inter_op_num_threads_.get();
+    cpu_options.parallel_execution = (execution_mode == "parallel");
+    cpu_options.intra_op_thread_affinity = intra_op_thread_affinity_.get();
     HOLOSCAN_LOG_INFO("Inference Specifications created");
     // Create holoscan inference context
     holoscan_infer_context_ = std::make_unique<HoloInfer::InferContext>();
@@ -220,11 +319,20 @@ void InferenceOp::start() {
 }
 
 void InferenceOp::stop() {
+  if (batcher_ && !batcher_->empty()) {
+    HOLOSCAN_LOG_WARN("{}: {} frames not inferred at stop", module_, batcher_->size());
+  }
+  batcher_.reset();
   holoscan_infer_context_.reset();
 }
 
 void InferenceOp::compute(InputContext& op_input, OutputContext& op_output,
                           ExecutionContext& context) {
+  if (batcher_) {
+    compute_batched(op_input, op_output, context);
+    return;
+  }
+
   // get Handle to underlying nvidia::gxf::Allocator from std::shared_ptr<holoscan::Allocator>
   auto allocator =
       nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(context.context(), allocator_->gxf_cid());
@@ -276,4 +384,109 @@ void InferenceOp::compute(InputContext& op_input, OutputContext& op_output,
   } catch (...) { HoloInfer::raise_error(module_, "Tick, unknown exception"); }
 }
 
+void InferenceOp::compute_batched(InputContext& op_input, OutputContext& op_output,
+                                  ExecutionContext& context) {
+  auto allocator =
+      nvidia::gxf::Handle<nvidia::gxf::Allocator>::Create(context.context(), allocator_->gxf_cid());
+  auto cont = context.context();
+  const auto& in_tensor_names = in_tensor_names_.get();
+
+  // Infer the pending frames at once and emit their results in a single message
+  auto infer_batch = [&]() {
+    auto status = batcher_->stack(inference_specs_->data_per_tensor_);
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      status = holoscan_infer_context_->execute_inference(inference_specs_->data_per_tensor_,
+                                                          inference_specs_->output_per_model_);
+    }
+    if (status.get_code() == HoloInfer::holoinfer_code::H_SUCCESS) {
+      status = batcher_->scatter(inference_specs_->output_per_model_, frame_outputs_);
+    }
+    if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
+      status.display_message();
+      HoloInfer::raise_error(module_, "Tick, Batched inference, " + status.get_message());
+    }
+
+    // The output dimensions are the ones of a single frame
+    auto model_out_dims_map = holoscan_infer_context_->get_output_dimensions();
+    HoloInfer::DataMap batch_outputs;
+    HoloInfer::DimType batch_out_dims;
+    std::vector<std::string> batch_out_tensors;
+    const auto& stream_ids = batcher_->stream_ids();
+    for (const auto& [model, tensor_names] : inference_map_.get().get_map()) {
+      if (model_out_dims_map.find(model) == model_out_dims_map.end()) { continue; }
+      const auto& model_dims = model_out_dims_map.at(model);
+      for (size_t a = 0; a < tensor_names.size() && a < model_dims.size(); a++) {
+        for (size_t b = 0; b < stream_ids.size(); b++) {
+          auto it = frame_outputs_[b].find(tensor_names[a]);
+          if (it == frame_outputs_[b].end()) { continue; }
+          auto name = fmt::format("{}_{}", tensor_names[a], stream_ids[b]);
+          batch_outputs[name] = it->second;
+          batch_out_dims[name] = {model_dims[a]};
+          batch_out_tensors.push_back(std::move(name));
+        }
+      }
+    }
+    batcher_->clear();
+
+    auto stat = holoscan::utils::transmit_data_per_model(cont,
+                                                         HoloInfer::MultiMappings{},
+                                                         batch_outputs,
+                                                         op_output,
+                                                         batch_out_tensors,
+                                                         batch_out_dims,
+                                                         false,
+                                                         transmit_on_cuda_.get(),
+                                                         allocator.value(),
+                                                         module_,
+                                                         cuda_stream_handler_);
+    if (stat != GXF_SUCCESS) { HoloInfer::raise_error(module_, "Tick, Data Transmission"); }
+  };
+
+  try {
+    const auto& receivers = receivers_.get();
+    bool received_frame = false;
+    for (size_t stream = 0; stream < receivers.size(); ++stream) {
+      auto message = op_input.receive<holoscan::gxf::Entity>(receivers[stream]->name().c_str());
+      // Ports without a message (or with a message of other tensors) have no frame
+      if (!message || in_tensor_names.empty() ||
+          !message.value().get<holoscan::Tensor>(in_tensor_names[0].c_str(), false)) {
+        continue;
+      }
+      received_frame = true;
+      gxf_result_t stat = holoscan::utils::get_data_per_model({message.value()},
+                                                              in_tensor_names,
+                                                              frame_inputs_,
+                                                              dims_per_tensor_,
+                                                              false,
+                                                              module_,
+                                                              cont,
+                                                              cuda_stream_handler_);
+      if (stat != GXF_SUCCESS) { HoloInfer::raise_error(module_, "Tick, Data extraction"); }
+
+      // A batch holds at most one frame per stream
+      const auto stream_id = static_cast<int64_t>(stream);
+      if (batcher_->contains(stream_id) || batcher_->size() == batcher_->max_batch_size()) {
+        infer_batch();
+      }
+      auto status = batcher_->add(stream_id, frame_inputs_);
+      if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
+        status.display_message();
+        HoloInfer::raise_error(module_, "Tick, Batching, " + status.get_message());
+      }
+    }
+
+    // An execution without any frame was triggered by the flush condition: the batch is due
+    if (batcher_->ready() || (!received_frame && !batcher_->empty())) { infer_batch(); }
+
+    // Execute again when the pending batch is due, even if no other frame arrives
+    if (!batcher_->empty() && batch_flush_condition_) {
+      batch_flush_condition_->request_flush(batcher_->oldest_arrival() + batcher_->max_delay() -
+                                            std::chrono::steady_clock::now());
+    }
+  } catch (const std::runtime_error& r_) {
+    HoloInfer::raise_error(module_,
+                           "Tick, Batched inference, Message->" + std::string(r_.what()));
+  } catch (...) { HoloInfer::raise_error(module_, "Tick, unknown exception"); }
+}
+
 }  // namespace holoscan::ops
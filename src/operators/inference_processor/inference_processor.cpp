@@ -17,6 +17,7 @@
 
 #include "holoscan/operators/inference_processor/inference_processor.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -130,6 +131,11 @@ void InferenceProcessorOp::setup(OperatorSpec& spec) {
   spec.param(input_on_cuda_, "input_on_cuda", "Input buffer on CUDA", "", false);
   spec.param(output_on_cuda_, "output_on_cuda", "Output buffer on CUDA", "", false);
   spec.param(transmit_on_cuda_, "transmit_on_cuda", "Transmit message on CUDA", "", false);
+  spec.param(num_threads_,
+             "num_threads",
+             "Number of threads",
+             "Number of threads used by the CPU based processing operations.",
+             1);
   spec.param(allocator_, "allocator", "Allocator", "Output Allocator");
   spec.param(receivers_, "receivers", "Receivers", "List of receivers", {});
   spec.param(transmitter_, "transmitter", "Transmitter", "Transmitter", {&transmitter});
@@ -198,8 +204,10 @@ void InferenceProcessorOp::start() {
   } catch (...) { HoloInfer::raise_error(module_, "Start, Unknown exception"); }
 
   // Initialize holoscan processing context
-  auto status = holoscan_postprocess_context_->initialize(process_operations_.get().get_map(),
-                                                          config_path_.get());
+  auto status = holoscan_postprocess_context_->initialize(
+      process_operations_.get().get_map(),
+      config_path_.get(),
+      static_cast<size_t>(std::max(num_threads_.get(), 1)));
   if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) {
     status.display_message();
     HoloInfer::raise_error(module_, "Start, Out data setup");
@@ -0,0 +1,159 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "entity_read_ahead.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan::ops {
+
+MappedFile::MappedFile(const std::string& filename) {
+  int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw std::runtime_error(
+        fmt::format("Could not open file '{}': {}", filename, std::strerror(errno)));
+  }
+  struct stat file_stat {};
+  if (fstat(fd, &file_stat) != 0) {
+    int error = errno;
+    close(fd);
+    throw std::runtime_error(
+        fmt::format("Could not get the size of file '{}': {}", filename, std::strerror(error)));
+  }
+  size_ = static_cast<size_t>(file_stat.st_size);
+  if (size_ > 0) {
+    void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      int error = errno;
+      close(fd);
+      throw std::runtime_error(
+          fmt::format("Could not map file '{}': {}", filename, std::strerror(error)));
+    }
+    // The file is mostly read sequentially
+    madvise(data, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<const std::byte*>(data);
+  }
+  // The mapping stays valid after the file descriptor is closed
+  close(fd);
+}
+
+MappedFile::~MappedFile() {
+  if (data_) { munmap(const_cast<std::byte*>(data_), size_); }
+}
+
+gxf_result_t MemoryReadEndpoint::write_abi(const void*, size_t, size_t*) {
+  return GXF_NOT_IMPLEMENTED;
+}
+
+gxf_result_t MemoryReadEndpoint::read_abi(void* data, size_t size, size_t* bytes_read) {
+  if (data == nullptr || bytes_read == nullptr) { return GXF_ARGUMENT_NULL; }
+  if (size > size_ - offset_) { return GXF_FAILURE; }
+  std::memcpy(data, data_ + offset_, size);
+  offset_ += size;
+  *bytes_read = size;
+  return GXF_SUCCESS;
+}
+
+EntityReadAhead::EntityReadAhead(const nvidia::gxf::EntityIndex* indices, uint64_t num_frames,
+                                 const MappedFile& entity_file, size_t capacity, bool repeat)
+    : indices_(indices),
+      num_frames_(num_frames),
+      entity_file_(entity_file),
+      capacity_(capacity),
+      repeat_(repeat) {
+  thread_ = std::thread(&EntityReadAhead::run, this);
+}
+
+EntityReadAhead::~EntityReadAhead() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  thread_.join();
+}
+
+bool EntityReadAhead::pop(Item& item) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this]() { return !queue_.empty() || next_frame_index_ >= num_frames_; });
+  if (queue_.empty()) { return false; }
+  item = std::move(queue_.front());
+  queue_.pop_front();
+  cv_.notify_all();
+  return true;
+}
+
+void EntityReadAhead::seek(uint64_t frame_index) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.clear();
+    next_frame_index_ = frame_index;
+    ++seek_count_;
+  }
+  cv_.notify_all();
+}
+
+void EntityReadAhead::run() {
+  const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [this]() {
+      return stop_ || (queue_.size() < capacity_ && next_frame_index_ < num_frames_);
+    });
+    if (stop_) { return; }
+
+    const uint64_t frame_index = next_frame_index_;
+    const uint64_t seek_count = seek_count_;
+    lock.unlock();
+
+    // Read the entity without holding the lock: touching one byte of each page of the mapping
+    // makes this thread (instead of the operator) wait for the pages to be loaded from disk
+    Item item;
+    item.frame_index = frame_index;
+    const auto& index = indices_[frame_index];
+    if (index.data_offset > entity_file_.size() ||
+        index.data_size > entity_file_.size() - index.data_offset) {
+      HOLOSCAN_LOG_ERROR("Entity {} is out of the bounds of the entity file", frame_index);
+    } else {
+      item.data = entity_file_.data() + index.data_offset;
+      item.size = index.data_size;
+      const volatile std::byte* bytes = item.data;
+      for (size_t offset = 0; offset < item.size; offset += page_size) { (void)bytes[offset]; }
+      if (item.size > 0) { (void)bytes[item.size - 1]; }
+    }
+
+    lock.lock();
+    // Drop the entity if the position changed in the meantime
+    if (seek_count != seek_count_) { continue; }
+    queue_.push_back(std::move(item));
+    next_frame_index_ = frame_index + 1;
+    if (next_frame_index_ >= num_frames_ && repeat_) { next_frame_index_ = 0; }
+    cv_.notify_all();
+  }
+}
+
+}  // namespace holoscan::ops
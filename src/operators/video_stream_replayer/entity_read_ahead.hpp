@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef HOLOSCAN_OPERATORS_STREAM_PLAYBACK_ENTITY_READ_AHEAD_HPP
+#define HOLOSCAN_OPERATORS_STREAM_PLAYBACK_ENTITY_READ_AHEAD_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "gxf/serialization/endpoint.hpp"
+#include "gxf/serialization/file_stream.hpp"
+
+namespace holoscan::ops {
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ */
+class MappedFile {
+ public:
+  /**
+   * @brief Map the given file. Throws std::runtime_error if the file cannot be mapped.
+   *
+   * @param filename The path of the file.
+   */
+  explicit MappedFile(const std::string& filename);
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  const std::byte* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  const std::byte* data_ = nullptr;
+  size_t size_ = 0;
+};
+
+/**
+ * @brief Read-only nvidia::gxf::Endpoint over a memory region (e.g., an entity in a mapped file).
+ */
+class MemoryReadEndpoint : public nvidia::gxf::Endpoint {
+ public:
+  MemoryReadEndpoint(const std::byte* data, size_t size) : data_(data), size_(size) {}
+
+  gxf_result_t is_write_available_abi() override { return GXF_FAILURE; }
+  gxf_result_t is_read_available_abi() override {
+    return offset_ < size_ ? GXF_SUCCESS : GXF_FAILURE;
+  }
+  gxf_result_t write_abi(const void* data, size_t size, size_t* bytes_written) override;
+  gxf_result_t read_abi(void* data, size_t size, size_t* bytes_read) override;
+
+ private:
+  const std::byte* data_;
+  size_t size_;
+  size_t offset_ = 0;
+};
+
+/**
+ * @brief Background thread reading the entities of a recording ahead of their playback.
+ *
+ * Up to `capacity` entities of the memory-mapped entity file are read into memory (their pages
+ * are loaded from disk) and queued, in the order of the index. The position can be changed at any
+ * time with seek().
+ *
+ * The entities are only deserialized by the caller of pop(): deserializing creates GXF entities
+ * and allocates their components, which stays on the thread executing the operator.
+ */
+class EntityReadAhead {
+ public:
+  /// A serialized entity of the queue, with the position of its index in the index file
+  struct Item {
+    uint64_t frame_index = 0;
+    const std::byte* data = nullptr;  ///< Null if the entity is out of the bounds of the file
+    size_t size = 0;
+  };
+
+  EntityReadAhead(const nvidia::gxf::EntityIndex* indices, uint64_t num_frames,
+                  const MappedFile& entity_file, size_t capacity, bool repeat);
+  ~EntityReadAhead();
+
+  EntityReadAhead(const EntityReadAhead&) = delete;
+  EntityReadAhead& operator=(const EntityReadAhead&) = delete;
+
+  /**
+   * @brief Get the next entity, waiting for it to be deserialized if needed.
+   *
+   * @param item The next entity.
+   * @return false if the end of the recording is reached (only if repeat is disabled).
+   */
+  bool pop(Item& item);
+
+  /**
+   * @brief Drop the queued entities and continue reading from the given frame.
+   *
+   * @param frame_index The index of the next entity to return (must be less than num_frames).
+   */
+  void seek(uint64_t frame_index);
+
+ private:
+  void run();
+
+  const nvidia::gxf::EntityIndex* indices_;
+  uint64_t num_frames_;
+  const MappedFile& entity_file_;
+  size_t capacity_;
+  bool repeat_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Item> queue_;
+  uint64_t next_frame_index_ = 0;  ///< Index of the next entity to deserialize
+  uint64_t seek_count_ = 0;        ///< Incremented by seek() to drop the entity being read
+  bool stop_ = false;
+  std::thread thread_;
+};
+
+}  // namespace holoscan::ops
+
+#endif /* HOLOSCAN_OPERATORS_STREAM_PLAYBACK_ENTITY_READ_AHEAD_HPP */
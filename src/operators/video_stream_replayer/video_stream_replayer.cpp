@@ -17,8 +17,10 @@
 
 #include "holoscan/operators/video_stream_replayer/video_stream_replayer.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <cinttypes>
+#include <memory>
 #include <string>
 #include <thread>
 #include <utility>
@@ -34,6 +36,8 @@
 #include "holoscan/core/operator_spec.hpp"
 #include "holoscan/core/resources/gxf/std_entity_serializer.hpp"
 
+#include "entity_read_ahead.hpp"
+
 namespace holoscan::ops {
 
 void VideoStreamReplayerOp::setup(OperatorSpec& spec) {
@@ -86,6 +90,13 @@ void VideoStreamReplayerOp::setup(OperatorSpec& spec) {
              "the count "
              "is less than the number of frames in the video, it would be finished early.",
              0UL);
+  spec.param(read_ahead_,
+             "read_ahead",
+             "Read ahead",
+             "Number of entities read ahead of time by a background thread from the "
+             "memory-mapped entity file (they are deserialized in compute()). If zero value is "
+             "specified, entities are read synchronously.",
+             0UL);
 }
 
 void VideoStreamReplayerOp::initialize() {
@@ -129,28 +140,42 @@ void VideoStreamReplayerOp::initialize() {
   const std::string index_filename = path + nvidia::gxf::FileStream::kIndexFileExtension;
   const std::string entity_filename = path + nvidia::gxf::FileStream::kBinaryFileExtension;
 
-  // Open index file stream as read-only
-  index_file_stream_ = nvidia::gxf::FileStream(index_filename, "");
-  nvidia::gxf::Expected<void> result = index_file_stream_.open();
-  if (!result) {
+  // Map the index file (read-only) to access any entity index in constant time
+  try {
+    index_file_ = std::make_shared<MappedFile>(index_filename);
+  } catch (const std::exception&) {
     HOLOSCAN_LOG_WARN("Could not open index file: {}", index_filename);
-    auto code = nvidia::gxf::ToResultCode(result);
-    throw std::runtime_error(fmt::format("File open failed with code: {}", code));
+    throw;
+  }
+  if (index_file_->size() % sizeof(nvidia::gxf::EntityIndex) != 0) {
+    HOLOSCAN_LOG_WARN("Index file '{}' has a trailing partial entry which is ignored",
+                      index_filename);
   }
 
-  // Open entity file stream as read-only
-  entity_file_stream_ = nvidia::gxf::FileStream(entity_filename, "");
-  result = entity_file_stream_.open();
-  if (!result) {
-    HOLOSCAN_LOG_WARN("Could not open entity file: {}", entity_filename);
-    auto code = nvidia::gxf::ToResultCode(result);
-    throw std::runtime_error(fmt::format("File open failed with code: {}", code));
+  if (read_ahead_.get() > 0) {
+    // Map the entity file (read-only) to let the background thread read entities ahead
+    try {
+      entity_file_ = std::make_shared<MappedFile>(entity_filename);
+    } catch (const std::exception&) {
+      HOLOSCAN_LOG_WARN("Could not open entity file: {}", entity_filename);
+      throw;
+    }
+  } else {
+    // Open entity file stream as read-only
+    entity_file_stream_ = nvidia::gxf::FileStream(entity_filename, "");
+    nvidia::gxf::Expected<void> result = entity_file_stream_.open();
+    if (!result) {
+      HOLOSCAN_LOG_WARN("Could not open entity file: {}", entity_filename);
+      auto code = nvidia::gxf::ToResultCode(result);
+      throw std::runtime_error(fmt::format("File open failed with code: {}", code));
+    }
   }
 
   boolean_scheduling_term_->enable_tick();
 
   playback_index_ = 0;
   playback_count_ = 0;
+  timing_start_count_ = 0;
   index_start_timestamp_ = 0;
   index_last_timestamp_ = 0;
   index_timestamp_duration_ = 0;
@@ -161,19 +186,86 @@ void VideoStreamReplayerOp::initialize() {
 VideoStreamReplayerOp::~VideoStreamReplayerOp() {
   // for the GXF codelet, this code is in a deinitialize() method
 
+  // Stop the background reader before unmapping the files it reads from
+  entity_read_ahead_.reset();
+  entity_file_.reset();
+  index_file_.reset();
+
   // Close binary file stream
   nvidia::gxf::Expected<void> result = entity_file_stream_.close();
   if (!result) {
     auto code = nvidia::gxf::ToResultCode(result);
     HOLOSCAN_LOG_ERROR("Failed to close entity_file_stream_ with code: {}", code);
   }
+}
 
-  // Close index file stream
-  result = index_file_stream_.close();
-  if (!result) {
-    auto code = nvidia::gxf::ToResultCode(result);
-    HOLOSCAN_LOG_ERROR("Failed to close index_file_stream_ with code: {}", code);
+void VideoStreamReplayerOp::start() {
+  if (!entity_file_ || num_frames() == 0) { return; }
+
+  // Resume from the current position if the operator is restarted
+  const uint64_t frame_index = repeat_.get() ? playback_index_ % num_frames() : playback_index_;
+  entity_read_ahead_ = std::make_shared<EntityReadAhead>(indices(),
+                                                         num_frames(),
+                                                         *entity_file_,
+                                                         read_ahead_.get(),
+                                                         repeat_.get());
+  if (frame_index != 0) { entity_read_ahead_->seek(frame_index); }
+}
+
+void VideoStreamReplayerOp::stop() {
+  // Joins the background thread
+  entity_read_ahead_.reset();
+}
+
+uint64_t VideoStreamReplayerOp::num_frames() const {
+  return index_file_ ? index_file_->size() / sizeof(nvidia::gxf::EntityIndex) : 0;
+}
+
+const nvidia::gxf::EntityIndex* VideoStreamReplayerOp::indices() const {
+  // mmap() returns page-aligned memory, so the entries are suitably aligned
+  return index_file_ ? reinterpret_cast<const nvidia::gxf::EntityIndex*>(index_file_->data())
+                     : nullptr;
+}
+
+bool VideoStreamReplayerOp::seek(uint64_t frame_index) {
+  if (frame_index >= num_frames()) {
+    HOLOSCAN_LOG_ERROR("Cannot seek to frame {} (number of frames: {})", frame_index, num_frames());
+    return false;
+  }
+  pending_seek_.store(frame_index, std::memory_order_release);
+  return true;
+}
+
+bool VideoStreamReplayerOp::seek_to_timestamp(uint64_t timestamp) {
+  const nvidia::gxf::EntityIndex* begin = indices();
+  const nvidia::gxf::EntityIndex* end = begin + num_frames();
+  auto it = std::lower_bound(
+      begin, end, timestamp, [](const nvidia::gxf::EntityIndex& index, uint64_t value) {
+        return index.log_time < value;
+      });
+  if (it == end) {
+    HOLOSCAN_LOG_ERROR("Cannot seek to timestamp {} (no frame logged at or after it)", timestamp);
+    return false;
+  }
+  return seek(static_cast<uint64_t>(it - begin));
+}
+
+void VideoStreamReplayerOp::apply_seek(uint64_t frame_index) {
+  if (entity_read_ahead_) {
+    entity_read_ahead_->seek(frame_index);
+  } else {
+    entity_file_stream_.clear();
+    if (!entity_file_stream_.setReadOffset(indices()[frame_index].data_offset)) {
+      HOLOSCAN_LOG_ERROR("Could not seek entity file to frame {}", frame_index);
+    }
   }
+  playback_index_ = frame_index;
+
+  // Restart the realtime playback timing from the new position
+  timing_start_count_ = playback_count_;
+  index_last_timestamp_ = 0;
+  index_timestamp_duration_ = 0;
+  index_frame_count_ = 1;
 }
 
 void VideoStreamReplayerOp::compute(InputContext& op_input, OutputContext& op_output,
@@ -181,46 +273,66 @@ void VideoStreamReplayerOp::compute(InputContext& op_input, OutputContext& op_ou
   // avoid warning about unused variable
   (void)op_input;
 
+  const uint64_t pending_seek = pending_seek_.exchange(kNoPendingSeek, std::memory_order_acquire);
+  if (pending_seek != kNoPendingSeek) { apply_seek(pending_seek); }
+
+  const nvidia::gxf::EntityIndex* entity_indices = indices();
+  const uint64_t frame_count = num_frames();
+
+  // dynamic cast from holoscan::Resource to holoscan::StdEntitySerializer
+  auto vs_serializer =
+      std::dynamic_pointer_cast<holoscan::StdEntitySerializer>(entity_serializer_.get());
+  // get underlying GXF EntitySerializer
+  auto entity_serializer = nvidia::gxf::Handle<nvidia::gxf::EntitySerializer>::Create(
+      context.context(), vs_serializer->gxf_cid());
+
   for (size_t i = 0; i < batch_size_; i++) {
-    // Read entity index from index file
-    // Break if index not found and clear stream errors
-    nvidia::gxf::EntityIndex index;
-    nvidia::gxf::Expected<size_t> size = index_file_stream_.readTrivialType(&index);
-    if (!size) {
-      if (repeat_) {
-        // Rewind index stream
-        index_file_stream_.clear();
-        if (!index_file_stream_.setReadOffset(0)) {
-          HOLOSCAN_LOG_ERROR("Could not rewind index file");
-        }
-        size = index_file_stream_.readTrivialType(&index);
+    if (count_ > 0 && playback_count_ >= count_) {
+      HOLOSCAN_LOG_INFO("Reach end of file or playback count reaches to the limit. Stop ticking.");
+      boolean_scheduling_term_->disable_tick();
+      break;
+    }
 
+    // Get the next entity (and its index), either from the background thread or from the file
+    uint64_t frame_index = playback_index_;
+    nvidia::gxf::Expected<nvidia::gxf::Entity> entity = nvidia::gxf::Unexpected{GXF_FAILURE};
+    if (entity_read_ahead_) {
+      EntityReadAhead::Item item;
+      if (!entity_read_ahead_->pop(item)) {
+        HOLOSCAN_LOG_INFO(
+            "Reach end of file or playback count reaches to the limit. Stop ticking.");
+        boolean_scheduling_term_->disable_tick();
+        break;
+      }
+      frame_index = item.frame_index;
+      if (item.data != nullptr) {
+        // Deserialize the entity from the memory it was read into
+        MemoryReadEndpoint endpoint(item.data, item.size);
+        entity = entity_serializer.value()->deserializeEntity(context.context(), &endpoint);
+      }
+    } else {
+      if (frame_index >= frame_count && repeat_ && frame_count > 0) {
         // Rewind entity stream
         entity_file_stream_.clear();
-        if (!entity_file_stream_.setReadOffset(0)) {
+        if (!entity_file_stream_.setReadOffset(entity_indices[0].data_offset)) {
           HOLOSCAN_LOG_ERROR("Could not rewind entity file");
         }
-
-        // Initialize the frame index
-        playback_index_ = 0;
+        frame_index = 0;
       }
+      if (frame_index >= frame_count) {
+        HOLOSCAN_LOG_INFO(
+            "Reach end of file or playback count reaches to the limit. Stop ticking.");
+        boolean_scheduling_term_->disable_tick();
+        break;
+      }
+
+      // Read entity from binary file
+      entity =
+          entity_serializer.value()->deserializeEntity(context.context(), &entity_file_stream_);
     }
-    if ((!size && !repeat_) || (count_ > 0 && playback_count_ >= count_)) {
-      HOLOSCAN_LOG_INFO("Reach end of file or playback count reaches to the limit. Stop ticking.");
-      boolean_scheduling_term_->disable_tick();
-      index_file_stream_.clear();
-      break;
-    }
+    const nvidia::gxf::EntityIndex& index = entity_indices[frame_index];
+    playback_index_ = frame_index + 1;
 
-    // dynamic cast from holoscan::Resource to holoscan::StdEntitySerializer
-    auto vs_serializer =
-        std::dynamic_pointer_cast<holoscan::StdEntitySerializer>(entity_serializer_.get());
-    // get underlying GXF EntitySerializer
-    auto entity_serializer = nvidia::gxf::Handle<nvidia::gxf::EntitySerializer>::Create(
-        context.context(), vs_serializer->gxf_cid());
-    // Read entity from binary file
-    nvidia::gxf::Expected<nvidia::gxf::Entity> entity =
-        entity_serializer.value()->deserializeEntity(context.context(), &entity_file_stream_);
     if (!entity) {
       if (ignore_corrupted_entities_) {
         continue;
@@ -232,15 +344,17 @@ void VideoStreamReplayerOp::compute(InputContext& op_input, OutputContext& op_ou
     }
 
     int64_t time_to_delay = 0;
+    // Number of frames played back since the start or the last seek
+    const uint64_t timing_count = playback_count_ - timing_start_count_;
 
-    if (playback_count_ == 0) {
+    if (timing_count == 0) {
       playback_start_timestamp_ = std::chrono::system_clock::now().time_since_epoch().count();
       index_start_timestamp_ = index.log_time;
     }
     // Update last timestamp
     if (index.log_time > index_last_timestamp_) {
       index_last_timestamp_ = index.log_time;
-      index_frame_count_ = playback_count_ + 1;
+      index_frame_count_ = timing_count + 1;
       index_timestamp_duration_ = index_last_timestamp_ - index_start_timestamp_;
     }
 
@@ -251,16 +365,16 @@ void VideoStreamReplayerOp::compute(InputContext& op_input, OutputContext& op_ou
       int64_t time_delta = static_cast<int64_t>(current_timestamp - playback_start_timestamp_);
       if (frame_rate_ > 0.f) {
         time_to_delay =
-            static_cast<int64_t>(1000000000 / frame_rate_) * playback_count_ - time_delta;
+            static_cast<int64_t>(1000000000 / frame_rate_) * timing_count - time_delta;
       } else {
         // Get timestamp from entity
         uint64_t timestamp = index.log_time;
         time_to_delay = static_cast<int64_t>((timestamp - index_start_timestamp_) +
                                              index_timestamp_duration_ *
-                                                 (playback_count_ / index_frame_count_)) -
+                                                 (timing_count / index_frame_count_)) -
                         time_delta;
       }
-      if (time_to_delay < 0 && (playback_count_ % index_frame_count_ != 0)) {
+      if (time_to_delay < 0 && (timing_count % index_frame_count_ != 0)) {
         HOLOSCAN_LOG_INFO(
             fmt::format("Playing video stream is lagging behind (count: {} , delay: {} ns)",
                         playback_count_,
@@ -274,9 +388,8 @@ void VideoStreamReplayerOp::compute(InputContext& op_input, OutputContext& op_ou
     auto result = gxf::Entity(std::move(entity.value()));
     op_output.emit(result);
 
-    // Increment frame counter and index
+    // Increment frame counter
     ++playback_count_;
-    ++playback_index_;
   }
 }
 
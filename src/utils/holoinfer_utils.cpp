@@ -110,6 +110,28 @@ gxf_result_t get_data_per_model(InputContext& op_input, const std::vector<std::s
                                 std::map<std::string, std::vector<int>>& dims_per_tensor,
                                 bool cuda_buffer_out, const std::string& module,
                                 gxf_context_t& context, CudaStreamHandler& cuda_stream_handler) {
+  std::vector<holoscan::gxf::Entity> messages;
+  try {
+    messages = op_input.receive<std::vector<holoscan::gxf::Entity>>("receivers").value();
+  } catch (std::exception& _ex) {
+    return HoloInfer::report_error(module, "Data extraction, Message: " + std::string(_ex.what()));
+  }
+  return get_data_per_model(messages,
+                            in_tensors,
+                            data_per_input_tensor,
+                            dims_per_tensor,
+                            cuda_buffer_out,
+                            module,
+                            context,
+                            cuda_stream_handler);
+}
+
+gxf_result_t get_data_per_model(const std::vector<holoscan::gxf::Entity>& messages,
+                                const std::vector<std::string>& in_tensors,
+                                HoloInfer::DataMap& data_per_input_tensor,
+                                std::map<std::string, std::vector<int>>& dims_per_tensor,
+                                bool cuda_buffer_out, const std::string& module,
+                                gxf_context_t& context, CudaStreamHandler& cuda_stream_handler) {
   try {
     HoloInfer::TimePoint s_time, e_time;
     HoloInfer::timer_init(s_time);
@@ -118,7 +140,6 @@ gxf_result_t get_data_per_model(InputContext& op_input, const std::vector<std::s
 
     if (cuda_buffer_out) { to = nvidia::gxf::MemoryStorageType::kDevice; }
 
-    auto messages = op_input.receive<std::vector<holoscan::gxf::Entity>>("receivers").value();
     for (unsigned int i = 0; i < in_tensors.size(); ++i) {
       // nvidia::gxf::Handle<nvidia::gxf::Tensor> in_tensor;
       std::shared_ptr<holoscan::Tensor> in_tensor;
@@ -16,6 +16,7 @@
  */
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <complex>
 #include <cstdint>
 #include <memory>
@@ -25,15 +26,53 @@
 #include <vector>
 
 #include "./codecs.hpp"
+#include "./mock_serialization_buffer.hpp"
 #include "holoscan/core/argument_setter.hpp"
 #include "holoscan/core/codec_registry.hpp"
 #include "holoscan/core/codecs.hpp"
 #include "holoscan/core/expected.hpp"
+#include "holoscan/core/message.hpp"
 
 using std::string_literals::operator""s;
 
 namespace holoscan {
 
+namespace {
+
+// nvidia::gxf::Endpoint forwarding to a MockUcxSerializationBuffer, so that the serializers and
+// deserializers of the registry (which take a GXF endpoint) can be tested
+class MockGxfEndpoint : public nvidia::gxf::Endpoint {
+ public:
+  explicit MockGxfEndpoint(MockUcxSerializationBuffer* buffer) : buffer_(buffer) {}
+
+  gxf_result_t is_write_available_abi() override { return GXF_SUCCESS; }
+  gxf_result_t is_read_available_abi() override { return GXF_SUCCESS; }
+
+  gxf_result_t write_abi(const void* data, size_t size, size_t* bytes_written) override {
+    auto maybe_size = buffer_->write(data, size);
+    if (!maybe_size) { return GXF_FAILURE; }
+    *bytes_written = maybe_size.value();
+    return GXF_SUCCESS;
+  }
+
+  gxf_result_t read_abi(void* data, size_t size, size_t* bytes_read) override {
+    auto maybe_size = buffer_->read(data, size);
+    if (!maybe_size) { return GXF_FAILURE; }
+    *bytes_read = maybe_size.value();
+    return GXF_SUCCESS;
+  }
+
+  gxf_result_t write_ptr_abi(const void* pointer, size_t size,
+                             nvidia::gxf::MemoryStorageType type) override {
+    return buffer_->write_ptr(pointer, size, type) ? GXF_SUCCESS : GXF_FAILURE;
+  }
+
+ private:
+  MockUcxSerializationBuffer* buffer_;
+};
+
+}  // namespace
+
 TEST(CodecRegistry, TestAddCodec) {
   auto codec_registry = CodecRegistry::get_instance();
 
@@ -141,4 +180,95 @@ TEST(CodecRegistry, TestGetCodecFromTypeIndex) {
   EXPECT_EQ(typeid(d), typeid(holoscan::CodecRegistry::none_deserialize));
 }
 
+TEST(CodecRegistry, TestAddCodecFields) {
+  auto codec_registry = CodecRegistry::get_instance();
+
+  // codecs generated by HOLOSCAN_CODEC_FIELDS are registered under the stringified type name
+  codec_registry.add_codec<Detection>();
+  auto maybe_index = codec_registry.name_to_index("holoscan::Detection"s);
+  ASSERT_TRUE(maybe_index);
+  EXPECT_EQ(maybe_index.value(), std::type_index(typeid(Detection)));
+  EXPECT_TRUE(codec_registry.name_to_index("std::vector<holoscan::Detection>"s));
+  EXPECT_TRUE(codec_registry.name_to_index("std::shared_ptr<holoscan::Detection>"s));
+}
+
+TEST(CodecRegistry, TestWireCodecTable) {
+  auto codec_registry = CodecRegistry::get_instance();
+
+  // codec names are reported in sorted order
+  auto names = codec_registry.codec_names();
+  ASSERT_FALSE(names.empty());
+  EXPECT_TRUE(std::is_sorted(names.begin(), names.end()));
+
+  // no wire IDs are assigned until a table is installed
+  EXPECT_EQ(codec_registry.wire_codec_id(std::type_index(typeid(double))),
+            CodecRegistry::kInvalidWireCodecId);
+
+  // unknown names keep their slot so that IDs stay aligned with the peers
+  codec_registry.set_wire_codec_table({"double"s, "non-existent"s, "std::string"s});
+  EXPECT_EQ(codec_registry.wire_codec_id(std::type_index(typeid(double))), 0U);
+  EXPECT_EQ(codec_registry.wire_codec_id(std::type_index(typeid(std::string))), 2U);
+  EXPECT_EQ(codec_registry.wire_codec_id(std::type_index(typeid(float))),
+            CodecRegistry::kInvalidWireCodecId);
+  EXPECT_NE(codec_registry.get_codec(0U), nullptr);
+  EXPECT_EQ(codec_registry.get_codec(1U), nullptr);
+  EXPECT_NE(codec_registry.get_codec(2U), nullptr);
+  EXPECT_EQ(codec_registry.get_codec(3U), nullptr);
+
+  // codecs added after the table was installed are resolved as well
+  struct WirePair {
+    int x;
+    int y;
+  };
+  codec_registry.set_wire_codec_table({"double"s, "wire-pair"s});
+  EXPECT_EQ(codec_registry.get_codec(1U), nullptr);
+  codec_registry.add_codec<WirePair>(CodecRegistry::none_codec, "wire-pair"s);
+  EXPECT_EQ(codec_registry.wire_codec_id(std::type_index(typeid(WirePair))), 1U);
+  EXPECT_NE(codec_registry.get_codec(1U), nullptr);
+
+  // an empty table disables wire IDs
+  codec_registry.set_wire_codec_table({});
+  EXPECT_EQ(codec_registry.wire_codec_id(std::type_index(typeid(double))),
+            CodecRegistry::kInvalidWireCodecId);
+  EXPECT_EQ(codec_registry.get_codec(0U), nullptr);
+}
+
+TEST(CodecRegistry, TestZeroCopyCodecRoundTrip) {
+  using vectorT = std::vector<float, default_init_allocator<float>>;
+  auto& codec_registry = CodecRegistry::get_instance();
+  codec_registry.add_codec<vectorT, zero_copy_codec<vectorT>>("zero-copy-float-vector"s);
+
+  vectorT value(2 * kZeroCopyMinBytes / sizeof(float));
+  for (size_t i = 0; i < value.size(); i++) { value[i] = static_cast<float>(i); }
+  const Message message(value);
+  const auto* stored_value = message.get_if<vectorT>();
+  ASSERT_NE(stored_value, nullptr);
+
+  MockUcxSerializationBuffer buffer(4096, holoscan::Endpoint::MemoryStorageType::kSystem);
+  MockGxfEndpoint gxf_endpoint(&buffer);
+  auto& serializer = codec_registry.get_serializer("zero-copy-float-vector"s);
+  auto maybe_size = serializer(message, &gxf_endpoint);
+  ASSERT_TRUE(maybe_size);
+  EXPECT_EQ(maybe_size.value(), sizeof(ZeroCopyDataHeader) + value.size() * sizeof(float));
+  // the registered segment is the memory of the value stored in the message, not of a copy that
+  // would be destroyed before the data is sent
+  ASSERT_EQ(buffer.data_buffers().size(), 1U);
+  EXPECT_EQ(buffer.data_buffers()[0].buffer, static_cast<const void*>(stored_value->data()));
+
+  auto& deserializer = codec_registry.get_deserializer("zero-copy-float-vector"s);
+  auto maybe_message = deserializer(&gxf_endpoint);
+  ASSERT_TRUE(maybe_message);
+  const auto* result = maybe_message.value().get_if<vectorT>();
+  ASSERT_NE(result, nullptr);
+  ASSERT_EQ(result->size(), value.size());
+  ASSERT_EQ(buffer.data_buffers().size(), 2U);
+  EXPECT_EQ(buffer.data_buffers()[1].buffer, static_cast<const void*>(result->data()));
+
+  EXPECT_TRUE(buffer.receive_data_buffers(1));
+  EXPECT_EQ(*result, value);
+
+  // a message holding another type is rejected
+  EXPECT_FALSE(serializer(Message(1.0), &gxf_endpoint));
+}
+
 }  // namespace holoscan
@@ -352,6 +352,86 @@ TEST(Codecs, TestVectorFloat) {
   codec_vector_compare<std::vector<float>>(value);
 }
 
+TEST(Codecs, TestVectorFloatDefaultInit) {
+  std::vector<float, default_init_allocator<float>> value{1.0, 2.0, 3.0, 4.0, 5.0};
+  codec_vector_compare<std::vector<float, default_init_allocator<float>>>(value);
+}
+
+TEST(Codecs, TestZeroCopyVectorFloatInline) {
+  // payloads smaller than kZeroCopyMinBytes are copied into the serialization buffer
+  std::vector<float, default_init_allocator<float>> value{1.0, 2.0, 3.0, 4.0, 5.0};
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      4096, holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  using codecT = zero_copy_codec<std::vector<float, default_init_allocator<float>>>;
+  auto maybe_size = codecT::serialize(value, endpoint.get());
+  EXPECT_EQ(maybe_size.value(), sizeof(ZeroCopyDataHeader) + value.size() * sizeof(float));
+  EXPECT_EQ(endpoint->data_buffers().size(), 0U);
+
+  auto maybe_value = codecT::deserialize(endpoint.get());
+  EXPECT_EQ(maybe_value.value(), value);
+}
+
+TEST(Codecs, TestZeroCopyVectorFloatSegment) {
+  // payloads of at least kZeroCopyMinBytes are registered as a separate segment
+  std::vector<float, default_init_allocator<float>> value(kZeroCopyMinBytes / sizeof(float) + 3);
+  for (size_t i = 0; i < value.size(); i++) { value[i] = static_cast<float>(i) * 0.5F; }
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      4096, holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  using codecT = zero_copy_codec<std::vector<float, default_init_allocator<float>>>;
+  auto maybe_size = codecT::serialize(value, endpoint.get());
+  EXPECT_EQ(maybe_size.value(), sizeof(ZeroCopyDataHeader) + value.size() * sizeof(float));
+  // only the header is written to the serialization buffer
+  EXPECT_EQ(endpoint->size(), sizeof(ZeroCopyDataHeader));
+  ASSERT_EQ(endpoint->data_buffers().size(), 1U);
+  EXPECT_EQ(endpoint->data_buffers()[0].buffer, static_cast<void*>(value.data()));
+
+  auto maybe_value = codecT::deserialize(endpoint.get());
+  auto result = std::move(maybe_value.value());
+  ASSERT_EQ(result.size(), value.size());
+  ASSERT_EQ(endpoint->data_buffers().size(), 2U);
+  EXPECT_EQ(endpoint->data_buffers()[1].buffer, static_cast<void*>(result.data()));
+
+  // the transport fills the registered memory of the (moved) result in place
+  EXPECT_TRUE(endpoint->receive_data_buffers(1));
+  EXPECT_EQ(result, value);
+}
+
+TEST(Codecs, TestZeroCopySharedVectorUInt8) {
+  using vectorT = std::vector<uint8_t, default_init_allocator<uint8_t>>;
+  auto value = std::make_shared<vectorT>(2 * kZeroCopyMinBytes);
+  for (size_t i = 0; i < value->size(); i++) { value->at(i) = static_cast<uint8_t>(i % 251); }
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      4096, holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  using codecT = zero_copy_codec<std::shared_ptr<vectorT>>;
+  auto maybe_size = codecT::serialize(value, endpoint.get());
+  EXPECT_EQ(maybe_size.value(), sizeof(ZeroCopyDataHeader) + value->size());
+
+  auto maybe_value = codecT::deserialize(endpoint.get());
+  auto result = maybe_value.value();
+  EXPECT_TRUE(endpoint->receive_data_buffers(1));
+  EXPECT_EQ(*result, *value);
+}
+
+TEST(Codecs, TestMessageLabel) {
+  MessageLabel value;
+  value.add_new_op_timestamp(OperatorTimestampLabel("codec_tx", 1000, 1010));
+  value.add_new_op_timestamp(OperatorTimestampLabel("codec_rx", 1020, 1030));
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      4096, holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  auto maybe_size = codec<MessageLabel>::serialize(value, endpoint.get());
+  ASSERT_TRUE(maybe_size);
+  // much smaller than the in-memory operator timestamp labels
+  EXPECT_LT(maybe_size.value(), sizeof(ContiguousDataHeader) + 2 * sizeof(OperatorTimestampLabel));
+
+  auto maybe_value = codec<MessageLabel>::deserialize(endpoint.get());
+  ASSERT_TRUE(maybe_value);
+  EXPECT_EQ(maybe_value.value().to_string(), value.to_string());
+}
+
 TEST(Codecs, TestVectorComplexFloat) {
   std::vector<std::complex<float>> value{{1.0, 1.5}, {2.0, 0.0}, {0.0, 3.0}};
   codec_vector_compare<std::vector<std::complex<float>>>(value);
@@ -456,6 +536,60 @@ TEST(Codecs, TestCustomTrivialSerializer2) {
   EXPECT_EQ(result.d, value.d);
 }
 
+// Only trivially copyable value fields are copied bytewise by HOLOSCAN_CODEC_FIELDS codecs
+static_assert(detail::is_bulk_field_v<float>);
+static_assert(detail::is_bulk_field_v<std::array<float, 4>>);
+static_assert(!detail::is_bulk_field_v<std::string>);
+static_assert(!detail::is_value_field_v<const char*>);
+static_assert(!detail::is_value_field_v<float DetectionPoint::*>);
+static_assert(!detail::is_value_field_v<std::nullptr_t>);
+static_assert(!detail::is_value_field_v<std::array<int*, 2>>);
+static_assert(!detail::is_value_field_v<int* [2]>);
+
+TEST(Codecs, TestCodecFields) {
+  Detection value{"car"s, 0.75F, 3, {1.0F, 2.0F, 3.0F, 4.0F}, {{0.5F, 1.5F, "a"s}}, 12.5};
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      4096, holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  auto maybe_size = codec<Detection>::serialize(value, endpoint.get());
+  // trivially copyable fields are written without padding
+  size_t expected_size = sizeof(ContiguousDataHeader) + value.label.size() + sizeof(float) +
+                         sizeof(int16_t) + sizeof(std::array<float, 4>) + sizeof(size_t) +
+                         2 * sizeof(float) + sizeof(ContiguousDataHeader) + 1 + sizeof(double);
+  EXPECT_EQ(maybe_size.value(), expected_size);
+  EXPECT_EQ(endpoint->size(), expected_size);
+
+  auto maybe_value = codec<Detection>::deserialize(endpoint.get());
+  auto result = maybe_value.value();
+  EXPECT_EQ(result.label, value.label);
+  EXPECT_EQ(result.score, value.score);
+  EXPECT_EQ(result.class_id, value.class_id);
+  EXPECT_EQ(result.box, value.box);
+  ASSERT_EQ(result.points.size(), 1U);
+  EXPECT_EQ(result.points[0].x, value.points[0].x);
+  EXPECT_EQ(result.points[0].y, value.points[0].y);
+  EXPECT_EQ(result.points[0].name, value.points[0].name);
+  EXPECT_EQ(result.timestamp, value.timestamp);
+}
+
+TEST(Codecs, TestCodecFieldsVector) {
+  std::vector<DetectionPoint> value{{1.0F, 2.0F, "p1"s}, {3.0F, 4.0F, "point2"s}};
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      4096, holoscan::Endpoint::MemoryStorageType::kSystem);
+
+  auto maybe_size = codec<std::vector<DetectionPoint>>::serialize(value, endpoint.get());
+  EXPECT_TRUE(maybe_size);
+
+  auto maybe_value = codec<std::vector<DetectionPoint>>::deserialize(endpoint.get());
+  auto result = maybe_value.value();
+  ASSERT_EQ(result.size(), value.size());
+  for (size_t i = 0; i < value.size(); i++) {
+    EXPECT_EQ(result[i].x, value[i].x);
+    EXPECT_EQ(result[i].y, value[i].y);
+    EXPECT_EQ(result[i].name, value[i].name);
+  }
+}
+
 TEST(Codecs, TestViewSerializer) {
   ops::HolovizOp::InputSpec::View v1;
   v1.offset_x_ = 0.1;
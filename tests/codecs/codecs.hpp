@@ -14,8 +14,12 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <array>
 #include <cstdint>
+#include <string>
+#include <vector>
 
+#include "holoscan/core/codec_fields.hpp"
 #include "holoscan/core/codec_registry.hpp"
 #include "holoscan/core/codecs.hpp"
 #include "holoscan/core/errors.hpp"
@@ -44,3 +48,27 @@ struct MixedType {
 // note: don't have to explicitly define codec<MixedType> for this POD type
 
 }  // namespace holoscan
+
+namespace holoscan {
+
+// Aggregate types whose codecs are generated with HOLOSCAN_CODEC_FIELDS (see below).
+// The trivially copyable fields of Detection are not adjacent so that multiple bulk runs are used.
+struct DetectionPoint {
+  float x;
+  float y;
+  std::string name;
+};
+
+struct Detection {
+  std::string label;
+  float score;
+  int16_t class_id;
+  std::array<float, 4> box;
+  std::vector<DetectionPoint> points;
+  double timestamp;
+};
+
+}  // namespace holoscan
+
+HOLOSCAN_CODEC_FIELDS(holoscan::DetectionPoint, x, y, name)
+HOLOSCAN_CODEC_FIELDS(holoscan::Detection, label, score, class_id, box, points, timestamp)
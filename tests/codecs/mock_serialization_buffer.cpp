@@ -18,6 +18,7 @@
 #include "mock_serialization_buffer.hpp"
 
 #include <cstdint>
+#include <cstring>
 #include <vector>
 
 #include "gxf/core/expected.hpp"
@@ -74,6 +75,26 @@ expected<void, RuntimeError> MockUcxSerializationBuffer::write_ptr(const void* p
   return expected<void, RuntimeError>();
 }
 
+// Copies the segments registered on serialization into those registered on deserialization
+expected<void, RuntimeError> MockUcxSerializationBuffer::receive_data_buffers(size_t count) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (data_buffers_.size() != 2 * count) {
+    return make_unexpected<RuntimeError>(
+        RuntimeError(ErrorCode::kCodecError, "unexpected number of registered data buffers"));
+  }
+  for (size_t i = 0; i < count; ++i) {
+    const auto& src = data_buffers_[i];
+    const auto& dst = data_buffers_[count + i];
+    if (src.length != dst.length) {
+      return make_unexpected<RuntimeError>(
+          RuntimeError(ErrorCode::kCodecError, "data buffer size mismatch"));
+    }
+    std::memcpy(dst.buffer, src.buffer, src.length);
+  }
+  data_buffers_.clear();
+  return expected<void, RuntimeError>();
+}
+
 // Resizes the buffer
 expected<void, RuntimeError> MockUcxSerializationBuffer::resize(size_t size,
                                                                 MemoryStorageType storage_type) {
@@ -83,6 +83,12 @@ class MockUcxSerializationBuffer : public Endpoint {
   size_t size() const;
   // Resets buffer for sequential access
   void reset();
+  // Returns the data buffers registered by write_ptr
+  const std::vector<DataBuffer>& data_buffers() const { return data_buffers_; }
+  // Emulates the transport of the segments registered by write_ptr: the first `count` buffers
+  // (registered on serialization) are copied into the `count` buffers registered after them (on
+  // deserialization). All registered buffers are released afterwards.
+  expected<void, RuntimeError> receive_data_buffers(size_t count);
 
  private:
   std::shared_ptr<MockAllocator> allocator_;
@@ -30,6 +30,8 @@
 #include "holoscan/core/component_spec.hpp"
 #include "holoscan/core/condition.hpp"
 #include "holoscan/core/conditions/gxf/asynchronous.hpp"
+#include "holoscan/core/conditions/gxf/batch_flush.hpp"
+#include "holoscan/core/conditions/gxf/batch_message_available.hpp"
 #include "holoscan/core/conditions/gxf/boolean.hpp"
 #include "holoscan/core/conditions/gxf/count.hpp"
 #include "holoscan/core/conditions/gxf/downstream_affordable.hpp"
@@ -66,6 +68,22 @@ TEST(ConditionClasses, TestAsynchronousConditionEventState) {
   EXPECT_EQ(condition->event_state(), holoscan::AsynchronousEventState::EVENT_WAITING);
 }
 
+TEST(ConditionClasses, TestAsynchronousConditionCompareExchangeEventState) {
+  using holoscan::AsynchronousEventState;
+  Fragment F;
+  auto condition = F.make_condition<AsynchronousCondition>("async-condition");
+
+  // the state is only changed from the expected one
+  EXPECT_FALSE(condition->compare_exchange_event_state(AsynchronousEventState::EVENT_WAITING,
+                                                       AsynchronousEventState::EVENT_DONE));
+  EXPECT_EQ(condition->event_state(), AsynchronousEventState::READY);
+
+  condition->event_state(AsynchronousEventState::EVENT_WAITING);
+  EXPECT_TRUE(condition->compare_exchange_event_state(AsynchronousEventState::EVENT_WAITING,
+                                                      AsynchronousEventState::EVENT_DONE));
+  EXPECT_EQ(condition->event_state(), AsynchronousEventState::EVENT_DONE);
+}
+
 TEST(ConditionClasses, TestBooleanCondition) {
   Fragment F;
   const std::string name{"boolean-condition"};
@@ -225,6 +243,49 @@ TEST(ConditionClasses, TestMessageAvailableConditionSizeMethods) {
   EXPECT_EQ(condition->front_stage_max_size(), 5);
 }
 
+TEST(ConditionClasses, TestBatchMessageAvailableCondition) {
+  Fragment F;
+  const std::string name{"batch-message-available-condition"};
+  ArgList arglist{Arg{"max_batch_size", 8L}, Arg{"max_delay_ns", 2000000L}};
+  auto condition = F.make_condition<BatchMessageAvailableCondition>(name, arglist);
+  EXPECT_EQ(condition->name(), name);
+  EXPECT_EQ(typeid(condition), typeid(std::make_shared<BatchMessageAvailableCondition>(arglist)));
+  EXPECT_EQ(std::string(condition->gxf_typename()),
+            "holoscan::gxf::BatchMessageAvailableSchedulingTerm"s);
+  EXPECT_TRUE(condition->description().find("name: " + name) != std::string::npos);
+}
+
+TEST(ConditionClasses, TestBatchMessageAvailableConditionDefaultConstructor) {
+  Fragment F;
+  auto condition = F.make_condition<BatchMessageAvailableCondition>();
+}
+
+TEST(ConditionClasses, TestBatchMessageAvailableConditionConstructors) {
+  using namespace std::chrono_literals;
+  Fragment F;
+  auto condition = F.make_condition<BatchMessageAvailableCondition>(4L, 1000L);
+  EXPECT_EQ(condition->max_batch_size(), 4);
+  EXPECT_EQ(condition->max_delay_ns(), 1000);
+
+  condition = F.make_condition<BatchMessageAvailableCondition>(16L, 2ms);
+  EXPECT_EQ(condition->max_batch_size(), 16);
+  EXPECT_EQ(condition->max_delay_ns(), 2000000);
+}
+
+TEST(ConditionClasses, TestBatchFlushCondition) {
+  using namespace std::chrono_literals;
+  Fragment F;
+  const std::string name{"batch-flush-condition"};
+  auto condition = F.make_condition<BatchFlushCondition>(name);
+  EXPECT_EQ(condition->name(), name);
+  EXPECT_EQ(typeid(condition), typeid(std::make_shared<BatchFlushCondition>()));
+  EXPECT_EQ(std::string(condition->gxf_typename()), "holoscan::gxf::BatchFlushSchedulingTerm"s);
+  EXPECT_TRUE(condition->description().find("name: " + name) != std::string::npos);
+
+  // no GXF component yet: the request is ignored
+  condition->request_flush(1ms);
+}
+
 TEST(ConditionClasses, TestPeriodicCondition) {
   Fragment F;
   const std::string name{"periodic-condition"};
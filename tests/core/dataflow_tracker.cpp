@@ -18,8 +18,14 @@
 #include <gtest/gtest.h>
 #include <gxf/core/gxf.h>
 
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include <map>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "../config.hpp"
@@ -27,13 +33,30 @@
 #include "common/assert.hpp"
 #include "holoscan/core/dataflow_tracker.hpp"
 #include "holoscan/core/fragment.hpp"
+#include "holoscan/core/operator.hpp"
 
 namespace holoscan {
 
 class MockDataFlowTracker : public DataFlowTracker {
  public:
+  using DataFlowTracker::path_id;
   using DataFlowTracker::update_latency;
   using DataFlowTracker::update_source_messages_number;
+  using DataFlowTracker::write_to_logfile;
+};
+
+// Operator with two inputs and one output, used to build graphs with many paths
+class DiamondOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(DiamondOp)
+
+  DiamondOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.input<int>("in1");
+    spec.input<int>("in2");
+    spec.output<int>("out");
+  }
 };
 
 // Test case to check set_skip_starting_messages
@@ -253,4 +276,165 @@ TEST(DataFlowTracker, GetPathStrings) {
   }
 }
 
+TEST(DataFlowTracker, PathIdsAreInterned) {
+  Fragment F;
+  auto& tracker = (MockDataFlowTracker&)F.track(0, 0, 0);
+
+  auto path_id = tracker.path_id(std::string("tx,rx"));
+  ASSERT_NE(path_id, kInvalidPathId);
+  ASSERT_EQ(tracker.path_id(std::string("tx,rx")), path_id);
+  ASSERT_NE(tracker.path_id(std::string("tx,mx,rx")), path_id);
+
+  // Interned paths are only reported once a latency is updated
+  ASSERT_EQ(tracker.get_num_paths(), 0);
+  tracker.update_latency(path_id, 1);
+  ASSERT_EQ(tracker.get_num_paths(), 1);
+  ASSERT_EQ(tracker.get_path_strings(), std::vector<std::string>{"tx,rx"});
+  ASSERT_EQ(tracker.get_metric("tx,rx", DataFlowMetric::kNumDstMessages), 1);
+}
+
+TEST(DataFlowTracker, LatencyPercentiles) {
+  Fragment F;
+  auto& tracker = (MockDataFlowTracker&)F.track(0, 0, 0);
+
+  std::string pathname = "test";
+  for (int i = 1; i <= 1000; i++) { tracker.update_latency(pathname, i); }
+
+  ASSERT_EQ(tracker.get_metric(pathname, DataFlowMetric::kNumDstMessages), 1000);
+  ASSERT_EQ(tracker.get_metric(pathname, DataFlowMetric::kAvgE2ELatency), 500.5);
+  // Percentiles have a precision of 1%
+  ASSERT_NEAR(tracker.get_metric(pathname, DataFlowMetric::kP50E2ELatency), 500, 5);
+  ASSERT_NEAR(tracker.get_metric(pathname, DataFlowMetric::kP99E2ELatency), 990, 10);
+  ASSERT_NEAR(tracker.get_metric(pathname, DataFlowMetric::kP999E2ELatency), 999, 10);
+}
+
+TEST(DataFlowTracker, ConcurrentUpdates) {
+  Fragment F;
+  auto& tracker = (MockDataFlowTracker&)F.track(0, 0, 0);
+
+  constexpr int kNumThreads = 8;
+  constexpr int kNumUpdates = 10000;
+  auto path_id = tracker.path_id(std::string("test"));
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; i++) {
+    threads.emplace_back([&tracker, path_id, i]() {
+      for (int j = 0; j < kNumUpdates; j++) { tracker.update_latency(path_id, i + 1); }
+    });
+  }
+  for (auto& thread : threads) { thread.join(); }
+
+  ASSERT_EQ(tracker.get_metric("test", DataFlowMetric::kNumDstMessages), kNumThreads * kNumUpdates);
+  ASSERT_EQ(tracker.get_metric("test", DataFlowMetric::kMaxE2ELatency), kNumThreads);
+  ASSERT_EQ(tracker.get_metric("test", DataFlowMetric::kMinE2ELatency), 1);
+  ASSERT_DOUBLE_EQ(tracker.get_metric("test", DataFlowMetric::kAvgE2ELatency),
+                   (kNumThreads + 1) / 2.0);
+}
+
+class DataFlowTrackerBinaryLogging : public ::testing::TestWithParam<bool> {};
+
+TEST_P(DataFlowTrackerBinaryLogging, WritesRecordsAndStringTable) {
+  Fragment F;
+  auto& tracker = (MockDataFlowTracker&)F.track(0, 0, 0);
+  const bool use_mmap = GetParam();
+  const std::string filename = std::string("dataflow_tracker_binary_test") +
+                               (use_mmap ? "_mmap" : "") + ".bin";
+
+  constexpr int kNumMessages = 100;
+  tracker.enable_logging(filename, 16, DataFlowLogFormat::kBinary, use_mmap);
+  for (int i = 0; i < kNumMessages; i++) {
+    MessageLabel::TimestampedPath path{OperatorTimestampLabel("bin_tx", i, i + 1),
+                                       OperatorTimestampLabel("bin_rx", i + 2, i + 3)};
+    tracker.write_to_logfile(path);
+  }
+  tracker.end_logging();
+
+  std::ifstream file(filename, std::ios::binary);
+  ASSERT_TRUE(file.is_open());
+  std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  file.close();
+  std::remove(filename.c_str());
+
+  ASSERT_GE(data.size(), sizeof(DataFlowTraceHeader));
+  DataFlowTraceHeader header;
+  std::memcpy(&header, data.data(), sizeof(header));
+  ASSERT_EQ(std::memcmp(header.magic, kDataFlowTraceMagic, sizeof(header.magic)), 0);
+  ASSERT_EQ(header.version, kDataFlowTraceVersion);
+  ASSERT_EQ(header.record_size, sizeof(DataFlowTraceRecord));
+  ASSERT_EQ(header.num_messages, static_cast<uint64_t>(kNumMessages));
+  ASSERT_EQ(header.num_records, static_cast<uint64_t>(2 * kNumMessages));
+  ASSERT_EQ(header.num_dropped_messages, 0u);
+  ASSERT_NE(header.string_table_offset, 0u);
+  ASSERT_EQ(header.string_table_offset + header.string_table_size, data.size());
+
+  uint32_t tx_id = 0;
+  for (uint64_t i = 0; i < header.num_records; i++) {
+    DataFlowTraceRecord record;
+    std::memcpy(&record,
+                data.data() + header.records_offset + i * header.record_size,
+                sizeof(record));
+    const int64_t message = static_cast<int64_t>(i / 2);
+    ASSERT_EQ(record.message_index, i / 2 + 1);
+    ASSERT_EQ(record.operator_index, i % 2);
+    ASSERT_EQ(record.receive_timestamp, message + 2 * record.operator_index);
+    ASSERT_EQ(record.publish_timestamp, message + 2 * record.operator_index + 1);
+    if (i == 0) { tx_id = record.operator_id; }
+    if (record.operator_index == 0) { ASSERT_EQ(record.operator_id, tx_id); }
+    if (record.operator_index == 1) { ASSERT_NE(record.operator_id, tx_id); }
+  }
+
+  const std::string string_table = data.substr(header.string_table_offset);
+  ASSERT_NE(string_table.find("bin_tx"), std::string::npos);
+  ASSERT_NE(string_table.find("bin_rx"), std::string::npos);
+}
+
+INSTANTIATE_TEST_CASE_P(DataFlowTracker, DataFlowTrackerBinaryLogging, ::testing::Bool());
+
+TEST(DataFlowTracker, DroppedPathsAreReported) {
+  setenv("HOLOSCAN_FLOW_TRACKING_MAX_PATHS", "4", 1);
+  Fragment F;
+  auto& tracker = (MockDataFlowTracker&)F.track(0, 0, 0);
+  unsetenv("HOLOSCAN_FLOW_TRACKING_MAX_PATHS");
+
+  for (int i = 1; i <= 6; i++) { tracker.update_latency("test" + std::to_string(i), 5); }
+  // a dropped path is only counted once
+  tracker.update_latency("test6", 5);
+
+  ASSERT_EQ(tracker.get_num_paths(), 4);
+  ASSERT_EQ(tracker.get_num_dropped_paths(), 2U);
+}
+
+TEST(DataFlowTracker, PathTableIsSizedForTheGraph) {
+  setenv("HOLOSCAN_FLOW_TRACKING_MAX_PATHS", "4", 1);
+  Fragment F;
+  auto& tracker = (MockDataFlowTracker&)F.track(0, 0, 0);
+  unsetenv("HOLOSCAN_FLOW_TRACKING_MAX_PATHS");
+
+  // kNumDiamonds chained diamonds: 2^kNumDiamonds paths from the source to the last operator
+  constexpr int kNumDiamonds = 6;
+  auto last = F.make_operator<DiamondOp>("source");
+  std::vector<std::string> paths{"source"};
+  for (int i = 0; i < kNumDiamonds; i++) {
+    auto a = F.make_operator<DiamondOp>(fmt::format("a{}", i));
+    auto b = F.make_operator<DiamondOp>(fmt::format("b{}", i));
+    auto join = F.make_operator<DiamondOp>(fmt::format("join{}", i));
+    F.add_flow(last, a, {{"out", "in1"}});
+    F.add_flow(last, b, {{"out", "in1"}});
+    F.add_flow(a, join, {{"out", "in1"}});
+    F.add_flow(b, join, {{"out", "in2"}});
+    last = join;
+
+    std::vector<std::string> next_paths;
+    for (const auto& path : paths) {
+      next_paths.push_back(fmt::format("{},a{},join{}", path, i, i));
+      next_paths.push_back(fmt::format("{},b{},join{}", path, i, i));
+    }
+    paths = std::move(next_paths);
+  }
+
+  tracker.add_graph_paths(F.graph());
+  for (const auto& path : paths) { ASSERT_NE(tracker.path_id(path), kInvalidPathId) << path; }
+  ASSERT_EQ(tracker.get_num_dropped_paths(), 0U);
+}
+
 }  // namespace holoscan
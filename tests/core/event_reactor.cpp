@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "holoscan/core/conditions/gxf/asynchronous.hpp"
+#include "holoscan/core/resources/event_reactor.hpp"
+
+using namespace std::chrono_literals;
+
+namespace holoscan {
+
+namespace {
+
+// Wait (at most 1 s) until the condition is set to EVENT_DONE by the reactor
+bool wait_for_done(const AsynchronousCondition& condition) {
+  auto deadline = std::chrono::steady_clock::now() + 1s;
+  while (condition.event_state() != AsynchronousEventState::EVENT_DONE) {
+    if (std::chrono::steady_clock::now() > deadline) { return false; }
+    std::this_thread::sleep_for(100us);
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(EventReactor, TestPeriodicTimer) {
+  EventReactor reactor;
+  auto condition = std::make_shared<AsynchronousCondition>();
+  std::atomic<uint64_t> expirations{0};
+
+  auto id = reactor.add_timer(2ms, condition, [&](uint64_t count) { expirations += count; });
+  ASSERT_TRUE(id);
+  EXPECT_EQ(condition->event_state(), AsynchronousEventState::EVENT_WAITING);
+  EXPECT_EQ(reactor.num_registrations(), 1u);
+
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_TRUE(wait_for_done(*condition));
+    ASSERT_TRUE(reactor.arm(id.value()));
+  }
+  EXPECT_GE(expirations.load(), 5u);
+
+  EXPECT_TRUE(reactor.remove(id.value()));
+  EXPECT_FALSE(reactor.remove(id.value()));
+  EXPECT_FALSE(reactor.arm(id.value()));
+  EXPECT_EQ(reactor.num_registrations(), 0u);
+}
+
+TEST(EventReactor, TestOneShotTimer) {
+  EventReactor reactor;
+  auto condition = std::make_shared<AsynchronousCondition>();
+
+  auto id = reactor.add_timer(1ms, condition, {}, false);
+  ASSERT_TRUE(id);
+  ASSERT_TRUE(wait_for_done(*condition));
+
+  // a one-shot timer only fires again once re-armed
+  ASSERT_TRUE(reactor.arm(id.value()));
+  EXPECT_EQ(condition->event_state(), AsynchronousEventState::EVENT_WAITING);
+  ASSERT_TRUE(wait_for_done(*condition));
+}
+
+TEST(EventReactor, TestFileDescriptor) {
+  EventReactor reactor;
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+
+  auto condition = std::make_shared<AsynchronousCondition>();
+  std::atomic<int> callbacks{0};
+  auto id = reactor.add_fd(fds[0], EPOLLIN, condition, [&](uint64_t events) {
+    EXPECT_TRUE(events & EPOLLIN);
+    ++callbacks;
+  });
+  ASSERT_TRUE(id);
+
+  constexpr int kMessageCount = 100;
+  for (int i = 0; i < kMessageCount; ++i) {
+    char value = static_cast<char>(i);
+    ASSERT_EQ(write(fds[1], &value, 1), 1);
+    ASSERT_TRUE(wait_for_done(*condition));
+    // the registration is one-shot: no other callback until it is re-armed
+    std::this_thread::sleep_for(50us);
+    ASSERT_EQ(read(fds[0], &value, 1), 1);
+    EXPECT_EQ(value, static_cast<char>(i));
+    ASSERT_TRUE(reactor.arm(id.value()));
+  }
+  EXPECT_EQ(callbacks.load(), kMessageCount);
+
+  EXPECT_TRUE(reactor.remove(id.value()));
+  close(fds[0]);
+  close(fds[1]);
+
+  EXPECT_FALSE(reactor.add_fd(-1, EPOLLIN, nullptr));
+}
+
+TEST(EventReactor, TestManyRegistrations) {
+  EventReactor reactor;
+  constexpr int kRegistrationCount = 64;
+  std::vector<std::shared_ptr<AsynchronousCondition>> conditions;
+  std::vector<EventReactor::RegistrationId> ids;
+  for (int i = 0; i < kRegistrationCount; ++i) {
+    conditions.push_back(std::make_shared<AsynchronousCondition>());
+    auto id = reactor.add_timer(1ms, conditions.back());
+    ASSERT_TRUE(id);
+    ids.push_back(id.value());
+  }
+  for (auto& condition : conditions) { EXPECT_TRUE(wait_for_done(*condition)); }
+  for (auto id : ids) { EXPECT_TRUE(reactor.remove(id)); }
+}
+
+}  // namespace holoscan
@@ -19,6 +19,7 @@
 #include <yaml-cpp/yaml.h>
 
 #include <string>
+#include <vector>
 
 #include "holoscan/core/schedulers/greedy_fragment_allocation.hpp"
 
@@ -170,4 +171,30 @@ TEST(FragmentAllocation, GreedyAllocationRedundantWorker2) {
   ASSERT_EQ(schedule["fragment_3"], "app_worker_4");
 }
 
+TEST(FragmentAllocation, GreedyNumaNodeAssignment) {
+  // Two NUMA nodes with 8 CPUs each
+  std::vector<NumaNodeInfo> numa_nodes{NumaNodeInfo{0, 4, 8, 0}, NumaNodeInfo{1, 4, 8, 0}};
+
+  std::vector<SystemResourceRequirement> requirements{
+      SystemResourceRequirement{"fragment_1", 6, -1, -1, -1, 0, 0, 0, 0, 0, 0},
+      SystemResourceRequirement{"fragment_2", 4, -1, -1, -1, 0, 0, 0, 0, 0, 0},
+      SystemResourceRequirement{"fragment_3", 3, -1, -1, -1, 0, 0, 0, 0, 0, 0},
+      SystemResourceRequirement{"fragment_4", -1, -1, -1, -1, 0, 0, 0, 0, 0, 0}};
+
+  auto result = GreedyFragmentAllocationStrategy::assign_numa_nodes(requirements, numa_nodes);
+  ASSERT_TRUE(static_cast<bool>(result));
+  auto& assigned_nodes = result.value();
+  ASSERT_EQ(assigned_nodes.size(), 4);
+  // fragment_1 (6 CPUs) -> node 0 (2 left), fragment_2 (4 CPUs) -> node 1 (4 left),
+  // fragment_3 (3 CPUs) -> node 1 (1 left), fragment_4 (1 CPU) -> node 0 (1 left)
+  EXPECT_EQ(assigned_nodes["fragment_1"], 0);
+  EXPECT_EQ(assigned_nodes["fragment_2"], 1);
+  EXPECT_EQ(assigned_nodes["fragment_3"], 1);
+  EXPECT_EQ(assigned_nodes["fragment_4"], 0);
+
+  // No NUMA node
+  auto no_node_result = GreedyFragmentAllocationStrategy::assign_numa_nodes(requirements, {});
+  EXPECT_FALSE(static_cast<bool>(no_node_result));
+}
+
 }  // namespace holoscan
@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "holoscan/core/hdr_histogram.hpp"
+
+namespace holoscan {
+
+TEST(HdrHistogram, TestEmpty) {
+  HdrHistogram histogram;
+  EXPECT_EQ(histogram.total_count(), 0);
+
+  std::vector<uint64_t> counts;
+  histogram.add_to(counts);
+  EXPECT_EQ(counts.size(), HdrHistogram::bucket_array_size());
+  EXPECT_EQ(HdrHistogram::value_at_percentile(counts, 50.0), 0);
+}
+
+TEST(HdrHistogram, TestPercentiles) {
+  HdrHistogram histogram;
+  for (int64_t value = 1; value <= 100000; ++value) { histogram.record(value); }
+  EXPECT_EQ(histogram.total_count(), 100000);
+
+  std::vector<uint64_t> counts;
+  histogram.add_to(counts);
+  EXPECT_NEAR(HdrHistogram::value_at_percentile(counts, 50.0), 50000, 500);
+  EXPECT_NEAR(HdrHistogram::value_at_percentile(counts, 99.0), 99000, 990);
+  EXPECT_NEAR(HdrHistogram::value_at_percentile(counts, 99.9), 99900, 999);
+  EXPECT_NEAR(HdrHistogram::value_at_percentile(counts, 100.0), 100000, 1000);
+
+  // Small values are recorded exactly
+  HdrHistogram small;
+  for (int64_t value = 0; value < 200; ++value) { small.record(value); }
+  counts.clear();
+  small.add_to(counts);
+  EXPECT_EQ(HdrHistogram::value_at_percentile(counts, 50.0), 99);
+}
+
+TEST(HdrHistogram, TestClamping) {
+  HdrHistogram histogram;
+  histogram.record(-10);
+  histogram.record(HdrHistogram::kMaxValue * 2);
+  EXPECT_EQ(histogram.total_count(), 2);
+
+  std::vector<uint64_t> counts;
+  histogram.add_to(counts);
+  EXPECT_EQ(HdrHistogram::value_at_percentile(counts, 50.0), 0);
+  EXPECT_NEAR(HdrHistogram::value_at_percentile(counts, 100.0),
+              HdrHistogram::kMaxValue,
+              HdrHistogram::kMaxValue / 100);
+}
+
+TEST(HdrHistogram, TestMerge) {
+  HdrHistogram low;
+  HdrHistogram high;
+  std::thread low_thread([&low]() {
+    for (int64_t value = 1; value <= 1000; ++value) { low.record(value); }
+  });
+  std::thread high_thread([&high]() {
+    for (int64_t value = 1001; value <= 2000; ++value) { high.record(value); }
+  });
+  low_thread.join();
+  high_thread.join();
+
+  std::vector<uint64_t> counts;
+  low.add_to(counts);
+  high.add_to(counts);
+  EXPECT_NEAR(HdrHistogram::value_at_percentile(counts, 25.0), 500, 5);
+  EXPECT_NEAR(HdrHistogram::value_at_percentile(counts, 75.0), 1500, 15);
+}
+
+}  // namespace holoscan
@@ -17,9 +17,12 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <cstdlib>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <common/logger/spdlog_logger.hpp>
 #include <holoscan/holoscan.hpp>
@@ -391,6 +394,106 @@ TEST(Logger, TestDefaultLogLevel) {
   }
 }
 
+TEST(Logger, TestAsyncLogging) {
+  auto orig_level = log_level();
+  auto orig_pattern = Logger::pattern();
+  const char* env_orig = std::getenv("HOLOSCAN_LOG_LEVEL");
+  const char* env_format = std::getenv("HOLOSCAN_LOG_FORMAT");
+  unsetenv("HOLOSCAN_LOG_LEVEL");
+  unsetenv("HOLOSCAN_LOG_FORMAT");
+
+  set_log_level(LogLevel::INFO);
+  set_log_pattern("[%t] [%l] %v");
+
+  uint64_t dropped_count = Logger::dropped_message_count();
+  testing::internal::CaptureStderr();
+  Logger::enable_async(64, LogOverflowPolicy::kBlock);
+  EXPECT_TRUE(Logger::is_async());
+
+  std::string name = "eager";
+  // formatted by the logging thread (arithmetic arguments)
+  HOLOSCAN_LOG_INFO("deferred {} {:.1f} {}", 1, 2.5, true);
+  // formatted by the calling thread (the string may not outlive the call)
+  HOLOSCAN_LOG_INFO("{} message {}", name, 2);
+  HOLOSCAN_LOG_DEBUG("filtered message {}", 3);
+
+  constexpr int kNumThreads = 4;
+  constexpr int kNumMessages = 1000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([t]() {
+      for (int i = 0; i < kNumMessages; ++i) { HOLOSCAN_LOG_INFO("thread {} message {}", t, i); }
+    });
+  }
+  for (auto& thread : threads) { thread.join(); }
+  // written synchronously, after the queued messages
+  HOLOSCAN_LOG_ERROR("error message {}", 4);
+  Logger::disable_async();
+  EXPECT_FALSE(Logger::is_async());
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_NE(log_output.find("deferred 1 2.5 true"), std::string::npos) << log_output;
+  EXPECT_NE(log_output.find("eager message 2"), std::string::npos) << log_output;
+  EXPECT_EQ(log_output.find("filtered message"), std::string::npos) << log_output;
+  for (int t = 0; t < kNumThreads; ++t) {
+    EXPECT_NE(log_output.find(fmt::format("thread {} message {}", t, kNumMessages - 1)),
+              std::string::npos);
+  }
+  auto error_pos = log_output.find("error message 4");
+  ASSERT_NE(error_pos, std::string::npos) << log_output;
+  EXPECT_GT(error_pos, log_output.find(fmt::format("thread 0 message {}", kNumMessages - 1)));
+  // with the blocking policy, no message is dropped
+  EXPECT_EQ(Logger::dropped_message_count(), dropped_count);
+
+  set_log_level(orig_level);
+  set_log_pattern(orig_pattern);
+  if (env_orig) { setenv("HOLOSCAN_LOG_LEVEL", env_orig, 1); }
+  if (env_format) { setenv("HOLOSCAN_LOG_FORMAT", env_format, 1); }
+}
+
+TEST(Logger, TestAsyncLoggingDropPolicy) {
+  auto orig_level = log_level();
+  const char* env_orig = std::getenv("HOLOSCAN_LOG_LEVEL");
+  unsetenv("HOLOSCAN_LOG_LEVEL");
+  set_log_level(LogLevel::INFO);
+
+  uint64_t dropped_count = Logger::dropped_message_count();
+  testing::internal::CaptureStderr();
+  Logger::enable_async(4, LogOverflowPolicy::kDrop);
+  for (int i = 0; i < 10000; ++i) { HOLOSCAN_LOG_INFO("message {}", i); }
+  Logger::flush();
+  Logger::disable_async();
+  std::string log_output = testing::internal::GetCapturedStderr();
+
+  // the caller never waits for the logging thread, so messages must have been dropped
+  EXPECT_GT(Logger::dropped_message_count(), dropped_count);
+  EXPECT_NE(log_output.find("message 0"), std::string::npos) << log_output;
+  EXPECT_NE(log_output.find("dropped"), std::string::npos) << log_output;
+
+  set_log_level(orig_level);
+  if (env_orig) { setenv("HOLOSCAN_LOG_LEVEL", env_orig, 1); }
+}
+
+TEST(Logger, TestAsyncLoggingEnv) {
+  const char* env_orig = std::getenv("HOLOSCAN_LOG_ASYNC");
+
+  setenv("HOLOSCAN_LOG_ASYNC", "true", 1);
+  set_log_async(false);
+  EXPECT_TRUE(Logger::is_async());
+
+  setenv("HOLOSCAN_LOG_ASYNC", "false", 1);
+  set_log_async(true);
+  EXPECT_FALSE(Logger::is_async());
+
+  unsetenv("HOLOSCAN_LOG_ASYNC");
+  set_log_async(true, 128, LogOverflowPolicy::kBlock);
+  EXPECT_TRUE(Logger::is_async());
+  set_log_async(false);
+  EXPECT_FALSE(Logger::is_async());
+
+  if (env_orig) { setenv("HOLOSCAN_LOG_ASYNC", env_orig, 1); }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Test cases for SpdlogLogger
 ////////////////////////////////////////////////////////////////////////////////
@@ -507,6 +610,24 @@ TEST_F(RedirectLogTest, Critical) {
   EXPECT_NE(file_content.find(std::string("critical")), std::string::npos) << file_content;
 }
 
+TEST_F(RedirectLogTest, MessageOrigin) {
+  auto logger = MockSpdlogLogger::create();
+
+  logger->redirect(HOLOSCAN_LOG_LEVEL_INFO, file_);
+  logger->level(HOLOSCAN_LOG_LEVEL_INFO);
+  logger->pattern("[%Y] [%t] %v");
+  // a message logged on behalf of another thread keeps the time and thread id of the log call
+  nvidia::logger::LogMessageOrigin origin;
+  origin.time = std::chrono::system_clock::from_time_t(0) + std::chrono::hours(24 * 366);
+  origin.thread_id = 123456;
+  logger->log(__FILE__, __LINE__, "test", HOLOSCAN_LOG_LEVEL_INFO, kLogTestString, &origin);
+  std::string file_content = get_file_content();
+
+  EXPECT_NE(file_content.find(std::string(kLogTestString)), std::string::npos) << file_content;
+  EXPECT_NE(file_content.find("[1971]"), std::string::npos) << file_content;
+  EXPECT_NE(file_content.find("[123456]"), std::string::npos) << file_content;
+}
+
 TEST_F(RedirectLogTest, NullPointer) {
   auto logger = MockSpdlogLogger::create();
 
@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "holoscan/core/messagelabel.hpp"
+
+namespace holoscan {
+
+namespace {
+
+MessageLabel make_label() {
+  MessageLabel label;
+  label.add_new_op_timestamp(OperatorTimestampLabel("label_tx", 1000, 1010));
+  label.add_new_op_timestamp(OperatorTimestampLabel("label_mx", 1020, 1030));
+  label.add_new_path({OperatorTimestampLabel("label_tx2", 900, 905),
+                      OperatorTimestampLabel("label_mx", 1020, 1030)});
+  return label;
+}
+
+}  // namespace
+
+TEST(MessageLabel, TestOperatorIds) {
+  uint32_t tx_id = MessageLabel::operator_id("label_tx");
+  EXPECT_EQ(MessageLabel::operator_id("label_tx"), tx_id);
+  EXPECT_NE(MessageLabel::operator_id("label_rx"), tx_id);
+  EXPECT_EQ(MessageLabel::operator_name(tx_id), "label_tx");
+  EXPECT_EQ(MessageLabel::operator_name(MessageLabel::kInvalidOperatorId), "");
+  EXPECT_EQ(MessageLabel::find_operator_id("label_tx"), tx_id);
+  EXPECT_FALSE(MessageLabel::find_operator_id("label_never_used"));
+
+  OperatorTimestampLabel op_label("label_tx", 1, 2);
+  EXPECT_EQ(op_label.operator_ptr, nullptr);
+  EXPECT_EQ(op_label.operator_id, tx_id);
+  EXPECT_EQ(op_label.operator_name(), "label_tx");
+}
+
+TEST(MessageLabel, TestPaths) {
+  auto label = make_label();
+  ASSERT_EQ(label.num_paths(), 2);
+  EXPECT_EQ(label.get_path_name(0), "label_tx,label_mx");
+  EXPECT_EQ(label.get_path_name(1), "label_tx2,label_mx");
+  EXPECT_EQ(label.get_e2e_latency(0), 30);
+  EXPECT_EQ(label.to_string(),
+            "(label_tx,1000,1010) -> (label_mx,1020,1030) \n"
+            "(label_tx2,900,905) -> (label_mx,1020,1030) \n");
+
+  EXPECT_EQ(label.has_operator("label_mx"), (std::vector<int>{0, 1}));
+  EXPECT_EQ(label.has_operator(MessageLabel::operator_id("label_tx2")), (std::vector<int>{1}));
+  EXPECT_TRUE(label.has_operator("label_unknown").empty());
+  // Looking up an unknown operator does not assign it an ID
+  EXPECT_FALSE(MessageLabel::find_operator_id("label_unknown"));
+}
+
+TEST(MessageLabel, TestCopyOnWrite) {
+  auto label = make_label();
+  MessageLabel copy = label;
+  // The paths are shared until they are modified
+  EXPECT_EQ(&copy.get_path(0), &label.get_path(0));
+
+  copy.add_new_op_timestamp(OperatorTimestampLabel("label_rx", 1040, 1050));
+  EXPECT_NE(&copy.get_path(0), &label.get_path(0));
+  EXPECT_EQ(label.get_path(0).size(), 2);
+  EXPECT_EQ(copy.get_path(0).size(), 3);
+  EXPECT_EQ(label.get_path_name(0), "label_tx,label_mx");
+
+  copy.set_operator_pub_timestamp(0, 0, 2000);
+  EXPECT_EQ(label.get_path(0)[0].pub_timestamp, 1010);
+
+  MessageLabel merged;
+  merged.add_paths(label);
+  merged.add_new_path(copy, 1);
+  ASSERT_EQ(merged.num_paths(), 3);
+  EXPECT_EQ(&merged.get_path(1), &label.get_path(1));
+  EXPECT_EQ(&merged.get_path(2), &copy.get_path(1));
+}
+
+TEST(MessageLabel, TestSerialize) {
+  auto label = make_label();
+  std::vector<uint8_t> buffer;
+  label.serialize(buffer);
+  // Each operator is written once and the timestamps are delta-encoded
+  EXPECT_LT(buffer.size(), 4 * sizeof(OperatorTimestampLabel));
+
+  auto deserialized = MessageLabel::deserialize(buffer.data(), buffer.size());
+  ASSERT_TRUE(deserialized);
+  EXPECT_EQ(deserialized.value().to_string(), label.to_string());
+  EXPECT_EQ(deserialized.value().get_path(0)[1].operator_id,
+            MessageLabel::operator_id("label_mx"));
+
+  MessageLabel empty_label;
+  buffer.clear();
+  empty_label.serialize(buffer);
+  auto empty_deserialized = MessageLabel::deserialize(buffer.data(), buffer.size());
+  ASSERT_TRUE(empty_deserialized);
+  EXPECT_EQ(empty_deserialized.value().num_paths(), 0);
+}
+
+TEST(MessageLabel, TestDeserializeMalformed) {
+  auto label = make_label();
+  std::vector<uint8_t> buffer;
+  label.serialize(buffer);
+
+  for (size_t size = 0; size < buffer.size(); ++size) {
+    EXPECT_FALSE(MessageLabel::deserialize(buffer.data(), size)) << "size: " << size;
+  }
+  buffer[0] = 0xff;
+  EXPECT_FALSE(MessageLabel::deserialize(buffer.data(), buffer.size()));
+}
+
+}  // namespace holoscan
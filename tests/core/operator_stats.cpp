@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "holoscan/core/operator_stats.hpp"
+
+namespace holoscan {
+
+TEST(OperatorStats, EmptySnapshot) {
+  OperatorStats stats("op", {"in"}, {"out"});
+
+  auto snapshot = stats.snapshot();
+  EXPECT_EQ(snapshot.operator_name, "op");
+  EXPECT_EQ(snapshot.num_ticks, 0);
+  EXPECT_EQ(snapshot.avg_compute_time_us, 0);
+  EXPECT_EQ(snapshot.min_compute_time_us, 0);
+  ASSERT_EQ(snapshot.inputs.size(), 1);
+  EXPECT_EQ(snapshot.inputs[0].name, "in");
+  EXPECT_EQ(snapshot.inputs[0].avg_queue_size, 0);
+  ASSERT_EQ(snapshot.outputs.size(), 1);
+  EXPECT_EQ(snapshot.outputs[0].name, "out");
+  EXPECT_EQ(snapshot.outputs[0].num_messages, 0);
+}
+
+TEST(OperatorStats, RecordTicks) {
+  OperatorStats stats("op", {}, {});
+
+  // 100 ticks of 1 to 100 us, each starting 10 us after the end of the previous one
+  int64_t time_ns = 1'000'000;
+  for (int i = 1; i <= 100; i++) {
+    stats.record_tick(time_ns, time_ns + i * 1000, i != 100);
+    time_ns += i * 1000 + 10'000;
+  }
+
+  auto snapshot = stats.snapshot();
+  EXPECT_EQ(snapshot.num_ticks, 100);
+  EXPECT_EQ(snapshot.num_failed_ticks, 1);
+  EXPECT_DOUBLE_EQ(snapshot.total_compute_time_ms, 5.05);
+  EXPECT_DOUBLE_EQ(snapshot.avg_compute_time_us, 50.5);
+  EXPECT_DOUBLE_EQ(snapshot.min_compute_time_us, 1);
+  EXPECT_DOUBLE_EQ(snapshot.max_compute_time_us, 100);
+  // Percentiles have a precision of 1%
+  EXPECT_NEAR(snapshot.p50_compute_time_us, 50, 1);
+  EXPECT_NEAR(snapshot.p99_compute_time_us, 99, 1);
+  // No idle time is counted before the first tick
+  EXPECT_DOUBLE_EQ(snapshot.total_idle_time_ms, 0.99);
+}
+
+TEST(OperatorStats, RecordPorts) {
+  OperatorStats stats("op", {"in1", "in2"}, {"out"});
+  ASSERT_EQ(stats.input_index("in2"), 1);
+  ASSERT_EQ(stats.input_index("out"), -1);
+  ASSERT_EQ(stats.output_index("out"), 0);
+
+  for (size_t i = 0; i < 4; i++) {
+    stats.record_queue_size(0, i);
+    stats.record_queue_size(1, 1);
+    stats.record_emit(0);
+  }
+
+  auto snapshot = stats.snapshot();
+  ASSERT_EQ(snapshot.inputs.size(), 2);
+  EXPECT_DOUBLE_EQ(snapshot.inputs[0].avg_queue_size, 1.5);
+  EXPECT_EQ(snapshot.inputs[0].max_queue_size, 3);
+  EXPECT_DOUBLE_EQ(snapshot.inputs[1].avg_queue_size, 1);
+  EXPECT_EQ(snapshot.inputs[1].max_queue_size, 1);
+  EXPECT_EQ(snapshot.outputs[0].num_messages, 4);
+
+  auto table = OperatorStats::format({snapshot});
+  EXPECT_NE(table.find("op"), std::string::npos);
+  EXPECT_NE(table.find("input 'in1': avg queue size 1.50, max queue size 3"), std::string::npos);
+  EXPECT_NE(table.find("output 'out': 4 messages"), std::string::npos);
+  EXPECT_EQ(table.find("GIL wait"), std::string::npos);
+}
+
+TEST(OperatorStats, RecordGilWait) {
+  OperatorStats stats("op", {}, {});
+
+  stats.record_gil_wait(2'000);
+  stats.record_gil_wait(500);
+  stats.record_gil_wait(-1);  // clock adjustments are ignored
+
+  auto snapshot = stats.snapshot();
+  EXPECT_DOUBLE_EQ(snapshot.total_gil_wait_time_ms, 0.0025);
+  EXPECT_DOUBLE_EQ(snapshot.max_gil_wait_time_us, 2);
+
+  auto table = OperatorStats::format({snapshot});
+  EXPECT_NE(table.find("GIL wait: total 0.0 ms, max 2.0 us"), std::string::npos);
+}
+
+}  // namespace holoscan
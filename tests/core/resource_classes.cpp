@@ -38,6 +38,7 @@
 #include "holoscan/core/resources/gxf/manual_clock.hpp"
 #include "holoscan/core/resources/gxf/realtime_clock.hpp"
 #include "holoscan/core/resources/gxf/serialization_buffer.hpp"
+#include "holoscan/core/resources/gxf/spsc_ring_receiver.hpp"
 #include "holoscan/core/resources/gxf/std_component_serializer.hpp"
 #include "holoscan/core/resources/gxf/std_entity_serializer.hpp"
 #include "holoscan/core/resources/gxf/ucx_component_serializer.hpp"
@@ -110,6 +111,23 @@ TEST_F(ResourceClassesWithGXFContext, TestDoubleBufferReceiverDefaultConstructor
   auto resource = F.make_resource<DoubleBufferReceiver>();
 }
 
+TEST_F(ResourceClassesWithGXFContext, TestSpscRingReceiver) {
+  const std::string name{"receiver"};
+  ArgList arglist{
+      Arg{"capacity", 4UL},
+      Arg{"policy", 0UL},
+  };
+  auto resource = F.make_resource<SpscRingReceiver>(name, arglist);
+  EXPECT_EQ(resource->name(), name);
+  EXPECT_EQ(typeid(resource), typeid(std::make_shared<SpscRingReceiver>(arglist)));
+  EXPECT_EQ(std::string(resource->gxf_typename()), "holoscan::gxf::SpscRingReceiver"s);
+  EXPECT_TRUE(resource->description().find("name: " + name) != std::string::npos);
+}
+
+TEST_F(ResourceClassesWithGXFContext, TestSpscRingReceiverDefaultConstructor) {
+  auto resource = F.make_resource<SpscRingReceiver>();
+}
+
 TEST_F(ResourceClassesWithGXFContext, TestDoubleBufferTransmitter) {
   const std::string name{"transmitter"};
   ArgList arglist{
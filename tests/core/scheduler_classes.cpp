@@ -34,6 +34,7 @@
 #include "holoscan/core/schedulers/gxf/event_based_scheduler.hpp"
 #include "holoscan/core/schedulers/gxf/greedy_scheduler.hpp"
 #include "holoscan/core/schedulers/gxf/multithread_scheduler.hpp"
+#include "holoscan/core/schedulers/gxf/work_stealing_scheduler.hpp"
 #include "../utils.hpp"
 
 using namespace std::string_literals;
@@ -145,4 +146,45 @@ TEST_F(SchedulerClassesWithGXFContext, TestEventBasedSchedulerWithRealtimeClock)
   auto scheduler = F.make_scheduler<EventBasedScheduler>(name, arglist);
 }
 
+TEST(SchedulerClasses, TestWorkStealingScheduler) {
+  Fragment F;
+  const std::string name{"work-stealing-scheduler"};
+  auto scheduler = F.make_scheduler<WorkStealingScheduler>(name);
+  EXPECT_EQ(scheduler->name(), name);
+  EXPECT_EQ(typeid(scheduler), typeid(std::make_shared<WorkStealingScheduler>()));
+  EXPECT_EQ(std::string(scheduler->gxf_typename()), "holoscan::gxf::WorkStealingScheduler"s);
+
+  // The counters are only available once the scheduler is running
+  auto stats = scheduler->stats();
+  EXPECT_EQ(stats.executions, 0);
+  EXPECT_EQ(stats.steals, 0);
+}
+
+TEST_F(SchedulerClassesWithGXFContext, TestWorkStealingSchedulerWithArgs) {
+  const std::string name{"work-stealing-scheduler"};
+  ArgList arglist{
+      Arg{"name", name},
+      Arg{"worker_thread_number", 4L},
+      Arg{"stop_on_deadlock", false},
+      Arg{"check_recession_period_ms", 5.0},
+      Arg{"max_duration_ms", 10000L},
+      Arg{"stop_on_deadlock_timeout", 100LL},
+      Arg{"worker_cpu_cores", std::vector<int64_t>{0, 1, 2, 3}},
+      Arg{"operator_affinity", std::vector<std::string>{"tx:0", "rx:1"}},
+      Arg{"shared_pool", "fragments"s},
+      Arg{"pool_priority", 2L},
+      Arg{"pool_max_workers", 3L},
+      Arg{"python_workers", std::vector<int64_t>{3}},
+      Arg{"python_operators", std::vector<std::string>{"rx"}},
+  };
+  auto scheduler = F.make_scheduler<WorkStealingScheduler>(name, arglist);
+  EXPECT_TRUE(scheduler->description().find("name: " + name) != std::string::npos);
+}
+
+TEST_F(SchedulerClassesWithGXFContext, TestWorkStealingSchedulerWithManualClock) {
+  const std::string name{"work-stealing-scheduler"};
+  ArgList arglist{Arg{"clock", F.make_resource<ManualClock>()}};
+  auto scheduler = F.make_scheduler<WorkStealingScheduler>(name, arglist);
+}
+
 }  // namespace holoscan
@@ -0,0 +1,225 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "holoscan/core/services/common/shm_ring_buffer.hpp"
+
+using namespace std::chrono_literals;
+
+namespace holoscan {
+
+namespace {
+
+std::string unique_segment_name(const std::string& test_name) {
+  return "/holoscan_test_" + test_name + "_" + std::to_string(getpid());
+}
+
+void write_string(ShmRingBuffer& ring, const std::string& value) {
+  auto slot = ring.acquire_write(1000ms);
+  ASSERT_TRUE(slot);
+  ASSERT_LE(value.size(), slot->capacity);
+  std::memcpy(slot->data, value.data(), value.size());
+  ring.commit_write(slot.value(), value.size());
+}
+
+std::string lease_string(const ShmRingBuffer::ReadLease& lease) {
+  return std::string(reinterpret_cast<const char*>(lease.data()), lease.size());
+}
+
+}  // namespace
+
+TEST(ShmRingBuffer, TestCreateAndOpen) {
+  auto name = unique_segment_name("create_open");
+  auto reader = ShmRingBuffer::create(name, 4, 1000);
+  ASSERT_TRUE(reader);
+  EXPECT_EQ(reader.value()->slot_count(), 4U);
+  EXPECT_EQ(reader.value()->slot_size(), 1000U);
+
+  auto writer = ShmRingBuffer::open(name, 1000ms);
+  ASSERT_TRUE(writer);
+  EXPECT_EQ(writer.value()->slot_count(), 4U);
+  EXPECT_EQ(writer.value()->slot_size(), 1000U);
+}
+
+TEST(ShmRingBuffer, TestOpenTimeout) {
+  auto writer = ShmRingBuffer::open(unique_segment_name("missing"), 100ms);
+  EXPECT_FALSE(writer);
+}
+
+TEST(ShmRingBuffer, TestRoundTrip) {
+  auto name = unique_segment_name("round_trip");
+  auto reader = ShmRingBuffer::create(name, 2, 64).value();
+  auto writer = ShmRingBuffer::open(name, 1000ms).value();
+
+  // More messages than slots so that the slots are reused
+  for (int i = 0; i < 10; ++i) {
+    auto message = "message " + std::to_string(i);
+    write_string(*writer, message);
+    ASSERT_EQ(reader->wait_readable(1000ms), ShmRingBuffer::ReadStatus::kReady);
+    auto lease = reader->acquire_read();
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(lease_string(*lease), message);
+  }
+  EXPECT_EQ(reader->wait_readable(10ms), ShmRingBuffer::ReadStatus::kTimeout);
+}
+
+TEST(ShmRingBuffer, TestSlotAlignment) {
+  auto name = unique_segment_name("alignment");
+  auto reader = ShmRingBuffer::create(name, 3, 100).value();
+  auto writer = ShmRingBuffer::open(name, 1000ms).value();
+
+  for (int i = 0; i < 3; ++i) {
+    auto slot = writer->acquire_write(1000ms);
+    ASSERT_TRUE(slot);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(slot->data) % ShmRingBuffer::kSlotAlignment, 0U);
+    writer->discard_write(slot.value());
+  }
+}
+
+TEST(ShmRingBuffer, TestLeaseHoldsSlot) {
+  auto name = unique_segment_name("lease");
+  auto reader = ShmRingBuffer::create(name, 1, 64).value();
+  auto writer = ShmRingBuffer::open(name, 1000ms).value();
+
+  write_string(*writer, "first");
+  ASSERT_EQ(reader->wait_readable(1000ms), ShmRingBuffer::ReadStatus::kReady);
+  auto lease = reader->acquire_read();
+
+  // The only slot is still referenced by the lease
+  EXPECT_FALSE(writer->acquire_write(100ms));
+
+  lease.reset();
+  write_string(*writer, "second");
+  ASSERT_EQ(reader->wait_readable(1000ms), ShmRingBuffer::ReadStatus::kReady);
+  EXPECT_EQ(lease_string(*reader->acquire_read()), "second");
+}
+
+TEST(ShmRingBuffer, TestDiscardWrite) {
+  auto name = unique_segment_name("discard");
+  auto reader = ShmRingBuffer::create(name, 1, 64).value();
+  auto writer = ShmRingBuffer::open(name, 1000ms).value();
+
+  auto slot = writer->acquire_write(1000ms);
+  ASSERT_TRUE(slot);
+  writer->discard_write(slot.value());
+  EXPECT_EQ(reader->wait_readable(10ms), ShmRingBuffer::ReadStatus::kTimeout);
+
+  write_string(*writer, "data");
+  ASSERT_EQ(reader->wait_readable(1000ms), ShmRingBuffer::ReadStatus::kReady);
+  EXPECT_EQ(lease_string(*reader->acquire_read()), "data");
+}
+
+TEST(ShmRingBuffer, TestWriterClosed) {
+  auto name = unique_segment_name("writer_closed");
+  auto reader = ShmRingBuffer::create(name, 4, 64).value();
+  auto writer = ShmRingBuffer::open(name, 1000ms).value();
+
+  write_string(*writer, "last");
+  writer.reset();  // closes the writer
+
+  // Slots written before closing are still delivered
+  ASSERT_EQ(reader->wait_readable(1000ms), ShmRingBuffer::ReadStatus::kReady);
+  EXPECT_EQ(lease_string(*reader->acquire_read()), "last");
+  EXPECT_EQ(reader->wait_readable(1000ms), ShmRingBuffer::ReadStatus::kClosed);
+}
+
+TEST(ShmRingBuffer, TestReaderClosed) {
+  auto name = unique_segment_name("reader_closed");
+  auto reader = ShmRingBuffer::create(name, 1, 64).value();
+  auto writer = ShmRingBuffer::open(name, 1000ms).value();
+
+  write_string(*writer, "pending");
+
+  // A writer waiting for a free slot gives up when the reader is closed
+  std::thread close_thread([&reader]() {
+    std::this_thread::sleep_for(50ms);
+    reader->close_reader();
+  });
+  auto start = std::chrono::steady_clock::now();
+  auto slot = writer->acquire_write(5000ms);
+  close_thread.join();
+  EXPECT_FALSE(slot);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, 5000ms);
+}
+
+TEST(ShmRingBuffer, TestCreateExistingSegment) {
+  auto name = unique_segment_name("create_existing");
+  auto reader = ShmRingBuffer::create(name, 1, 64);
+  ASSERT_TRUE(reader);
+  // The segment of a running process is never replaced
+  EXPECT_FALSE(ShmRingBuffer::create(name, 1, 64));
+  auto writer = ShmRingBuffer::open(name, 1000ms);
+  EXPECT_TRUE(writer);
+}
+
+TEST(ShmRingBuffer, TestCreateReplacesStaleSegment) {
+  auto name = unique_segment_name("create_stale");
+  // The child process exits without destroying the ring, leaving the segment behind
+  pid_t child = fork();
+  ASSERT_GE(child, 0);
+  if (child == 0) {
+    auto ring = ShmRingBuffer::create(name, 1, 64);
+    _exit(ring ? 0 : 1);
+  }
+  int status = 0;
+  ASSERT_EQ(waitpid(child, &status, 0), child);
+  ASSERT_TRUE(WIFEXITED(status));
+  ASSERT_EQ(WEXITSTATUS(status), 0);
+
+  auto reader = ShmRingBuffer::create(name, 2, 64);
+  ASSERT_TRUE(reader);
+  EXPECT_EQ(reader.value()->slot_count(), 2U);
+}
+
+TEST(ShmRingBuffer, TestCrossThread) {
+  auto name = unique_segment_name("cross_thread");
+  auto reader = ShmRingBuffer::create(name, 4, sizeof(uint32_t)).value();
+  constexpr uint32_t kCount = 1000;
+
+  std::thread writer_thread([&name]() {
+    auto writer = ShmRingBuffer::open(name, 1000ms).value();
+    for (uint32_t i = 0; i < kCount; ++i) {
+      auto slot = writer->acquire_write(1000ms);
+      ASSERT_TRUE(slot);
+      std::memcpy(slot->data, &i, sizeof(i));
+      writer->commit_write(slot.value(), sizeof(i));
+    }
+  });
+
+  uint32_t received = 0;
+  while (reader->wait_readable(1000ms) == ShmRingBuffer::ReadStatus::kReady) {
+    auto lease = reader->acquire_read();
+    uint32_t value = 0;
+    std::memcpy(&value, lease->data(), sizeof(value));
+    EXPECT_EQ(value, received);
+    ++received;
+  }
+  writer_thread.join();
+  EXPECT_EQ(received, kCount);
+}
+
+}  // namespace holoscan
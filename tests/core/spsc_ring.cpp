@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <thread>
+
+#include "holoscan/core/spsc_ring.hpp"
+
+namespace holoscan {
+
+TEST(SpscRing, PushPop) {
+  SpscRing<int64_t> ring(3);
+  EXPECT_EQ(ring.capacity(), 3);
+  EXPECT_TRUE(ring.empty());
+
+  int64_t value = 0;
+  EXPECT_FALSE(ring.try_pop(value));
+
+  EXPECT_TRUE(ring.try_push(1));
+  EXPECT_TRUE(ring.try_push(2));
+  EXPECT_TRUE(ring.try_push(3));
+  // The capacity is not rounded up to the size of the underlying buffer
+  EXPECT_FALSE(ring.try_push(4));
+  EXPECT_EQ(ring.size(), 3);
+
+  EXPECT_TRUE(ring.peek(0, value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(ring.peek(2, value));
+  EXPECT_EQ(value, 3);
+  EXPECT_FALSE(ring.peek(3, value));
+
+  for (int64_t expected = 1; expected <= 3; ++expected) {
+    ASSERT_TRUE(ring.try_pop(value));
+    EXPECT_EQ(value, expected);
+  }
+  EXPECT_FALSE(ring.try_pop(value));
+  EXPECT_TRUE(ring.empty());
+
+  // Wrap around the end of the buffer
+  for (int64_t i = 0; i < 10; ++i) {
+    ASSERT_TRUE(ring.try_push(i));
+    ASSERT_TRUE(ring.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+}
+
+TEST(SpscRing, PopOldest) {
+  SpscRing<int64_t> ring(2);
+  int64_t value = 0;
+  EXPECT_FALSE(ring.pop_oldest(value));
+
+  EXPECT_TRUE(ring.try_push(1));
+  EXPECT_TRUE(ring.try_push(2));
+  EXPECT_FALSE(ring.try_push(3));
+
+  ASSERT_TRUE(ring.pop_oldest(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(ring.try_push(3));
+
+  ASSERT_TRUE(ring.try_pop(value));
+  EXPECT_EQ(value, 2);
+  ASSERT_TRUE(ring.try_pop(value));
+  EXPECT_EQ(value, 3);
+}
+
+TEST(SpscRing, ConcurrentTransfer) {
+  constexpr int64_t kCount = 1'000'000;
+  SpscRing<int64_t> ring(16);
+
+  std::thread producer([&ring]() {
+    for (int64_t i = 0; i < kCount; ++i) {
+      while (!ring.try_push(i)) { std::this_thread::yield(); }
+    }
+  });
+
+  int64_t expected = 0;
+  int64_t value = 0;
+  while (expected < kCount) {
+    if (ring.try_pop(value)) {
+      ASSERT_EQ(value, expected);
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(ring.empty());
+}
+
+TEST(SpscRing, ConcurrentTransferWithDrops) {
+  constexpr int64_t kCount = 1'000'000;
+  SpscRing<int64_t> ring(4);
+  int64_t num_dropped = 0;
+
+  // The producer never waits: it drops the oldest value when the ring is full
+  std::thread producer([&ring, &num_dropped]() {
+    int64_t dropped = 0;
+    for (int64_t i = 0; i < kCount; ++i) {
+      while (!ring.try_push(i)) {
+        if (ring.pop_oldest(dropped)) { ++num_dropped; }
+      }
+    }
+  });
+
+  int64_t num_received = 0;
+  int64_t last = -1;
+  int64_t value = 0;
+  while (last < kCount - 1) {
+    if (ring.try_pop(value)) {
+      // Values are received in order, and each one at most once
+      ASSERT_GT(value, last);
+      last = value;
+      ++num_received;
+    }
+  }
+  producer.join();
+  EXPECT_EQ(num_received + num_dropped, kCount);
+}
+
+}  // namespace holoscan
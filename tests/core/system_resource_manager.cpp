@@ -59,6 +59,7 @@ TEST(SystemResourceManager, TestReportCPUResourceInfo) {
   EXPECT_EQ(cpuinfo.num_cores, 0);
   EXPECT_EQ(cpuinfo.num_cpus, 0);
   EXPECT_EQ(cpuinfo.num_processors, 0);
+  EXPECT_EQ(cpuinfo.num_numa_nodes, 0);
   EXPECT_EQ(cpuinfo.memory_free, 0);
   EXPECT_EQ(cpuinfo.memory_total, 0);
   EXPECT_EQ(cpuinfo.memory_available, 0);
@@ -74,6 +75,7 @@ TEST(SystemResourceManager, TestReportCPUResourceInfo) {
   EXPECT_GT(cpuinfo.num_cores, 0);
   EXPECT_GT(cpuinfo.num_cpus, 0);
   EXPECT_GT(cpuinfo.num_processors, 0);
+  EXPECT_GT(cpuinfo.num_numa_nodes, 0);
 
   // Update memory usage info
   cpuinfo = system_resource_manager.cpu_monitor()->update(holoscan::CPUMetricFlag::MEMORY_USAGE);
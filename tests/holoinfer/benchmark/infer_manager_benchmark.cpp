@@ -0,0 +1,169 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <holoinfer.hpp>
+#include <holoinfer_utils.hpp>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace HoloInfer = holoscan::inference;
+
+namespace {
+
+constexpr int kWarmupFrames = 10;
+constexpr int kFrames = 200;
+
+struct BenchmarkResult {
+  double ms_per_frame = 0.0;
+};
+
+// Runs the two models of the multi-AI ultrasound sample with the ONNX Runtime backend on the CPU
+// and returns the mean execution time of the inference of both models per frame.
+BenchmarkResult run_onnx_cpu_inference(bool parallel_inference,
+                                       const HoloInfer::CpuInferenceOptions& cpu_options = {}) {
+  std::map<std::string, std::string> model_path_map = {
+      {"bmode_perspective", "../data/multiai_ultrasound/models/bmode_perspective.onnx"},
+      {"aortic_stenosis", "../data/multiai_ultrasound/models/aortic_stenosis.onnx"},
+  };
+  std::map<std::string, std::vector<std::string>> pre_processor_map = {
+      {"bmode_perspective", {"bmode_pre_proc"}},
+      {"aortic_stenosis", {"aortic_pre_proc"}},
+  };
+  std::map<std::string, std::vector<std::string>> inference_map = {
+      {"bmode_perspective", {"bmode_infer"}},
+      {"aortic_stenosis", {"aortic_infer"}},
+  };
+  std::map<std::string, std::string> device_map = {{"bmode_perspective", "0"},
+                                                   {"aortic_stenosis", "0"}};
+  const std::map<std::string, std::vector<int>> in_tensor_dimensions = {
+      {"bmode_pre_proc", {320, 240, 3}},
+      {"aortic_pre_proc", {300, 300, 3}},
+  };
+
+  std::map<std::string, std::string> backend_map;
+
+  auto inference_specs = std::make_shared<HoloInfer::InferenceSpecs>("onnxrt",
+                                                                     backend_map,
+                                                                     model_path_map,
+                                                                     pre_processor_map,
+                                                                     inference_map,
+                                                                     device_map,
+                                                                     false,  // is_engine_path
+                                                                     true,   // infer_on_cpu
+                                                                     parallel_inference,
+                                                                     false,   // enable_fp16
+                                                                     false,   // input_on_cuda
+                                                                     false);  // output_on_cuda
+  inference_specs->cpu_options_ = cpu_options;
+
+  auto infer_context = std::make_unique<HoloInfer::InferContext>();
+  auto status = infer_context->set_inference_params(inference_specs);
+  EXPECT_EQ(status.get_code(), HoloInfer::holoinfer_code::H_SUCCESS) << status.get_message();
+  if (status.get_code() != HoloInfer::holoinfer_code::H_SUCCESS) { return {}; }
+
+  for (const auto& [tensor_name, dims] : in_tensor_dimensions) {
+    auto db = std::make_shared<HoloInfer::DataBuffer>();
+    size_t buffer_size = std::accumulate(dims.begin(), dims.end(), 1, std::multiplies<size_t>());
+    db->host_buffer.resize(buffer_size);
+    inference_specs->data_per_tensor_.insert({tensor_name, std::move(db)});
+  }
+
+  BenchmarkResult result;
+  std::chrono::steady_clock::time_point start;
+  for (int frame = 0; frame < kWarmupFrames + kFrames; ++frame) {
+    if (frame == kWarmupFrames) { start = std::chrono::steady_clock::now(); }
+    status = infer_context->execute_inference(inference_specs->data_per_tensor_,
+                                              inference_specs->output_per_model_);
+    EXPECT_EQ(status.get_code(), HoloInfer::holoinfer_code::H_SUCCESS) << status.get_message();
+  }
+  result.ms_per_frame =
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() /
+      kFrames;
+  return result;
+}
+
+}  // namespace
+
+TEST(HoloInferBenchmark, TestOnnxCpuParallelInference) {
+  auto sequential = run_onnx_cpu_inference(false);
+  auto parallel = run_onnx_cpu_inference(true);
+
+  HOLOSCAN_LOG_INFO("{:>12} {:>14}", "inference", "ms/frame");
+  HOLOSCAN_LOG_INFO("{:>12} {:>14.3f}", "sequential", sequential.ms_per_frame);
+  HOLOSCAN_LOG_INFO("{:>12} {:>14.3f}", "parallel", parallel.ms_per_frame);
+  EXPECT_GT(sequential.ms_per_frame, 0.0);
+  EXPECT_GT(parallel.ms_per_frame, 0.0);
+}
+
+TEST(HoloInferBenchmark, TestOnnxCpuIntraOpThreads) {
+  const int num_threads = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+
+  HoloInfer::CpuInferenceOptions multi_threaded;
+  multi_threaded.intra_op_num_threads = num_threads;
+
+  auto single = run_onnx_cpu_inference(false);
+  auto multi = run_onnx_cpu_inference(false, multi_threaded);
+
+  HOLOSCAN_LOG_INFO("{:>12} {:>14} {:>14}", "threads", "ms/frame", "frames/s");
+  HOLOSCAN_LOG_INFO(
+      "{:>12} {:>14.3f} {:>14.1f}", 1, single.ms_per_frame, 1000.0 / single.ms_per_frame);
+  HOLOSCAN_LOG_INFO("{:>12} {:>14.3f} {:>14.1f}",
+                    num_threads,
+                    multi.ms_per_frame,
+                    1000.0 / multi.ms_per_frame);
+  EXPECT_GT(single.ms_per_frame, 0.0);
+  EXPECT_GT(multi.ms_per_frame, 0.0);
+}
+
+TEST(HoloInferBenchmark, TestOnnxCpuInvalidThreadAffinity) {
+  // Two intra-op threads need a single core (the calling thread is not pinned)
+  HoloInfer::CpuInferenceOptions cpu_options;
+  cpu_options.intra_op_num_threads = 2;
+  cpu_options.intra_op_thread_affinity = {0, 1};
+
+  auto inference_specs = std::make_shared<HoloInfer::InferenceSpecs>(
+      "onnxrt",
+      std::map<std::string, std::string>{},
+      std::map<std::string, std::string>{
+          {"bmode_perspective", "../data/multiai_ultrasound/models/bmode_perspective.onnx"}},
+      std::map<std::string, std::vector<std::string>>{{"bmode_perspective", {"bmode_pre_proc"}}},
+      std::map<std::string, std::vector<std::string>>{{"bmode_perspective", {"bmode_infer"}}},
+      std::map<std::string, std::string>{{"bmode_perspective", "0"}},
+      false,
+      true,
+      false,
+      false,
+      false,
+      false);
+  inference_specs->cpu_options_ = cpu_options;
+
+  auto infer_context = std::make_unique<HoloInfer::InferContext>();
+  auto status = infer_context->set_inference_params(inference_specs);
+  EXPECT_EQ(status.get_code(), HoloInfer::holoinfer_code::H_ERROR);
+}
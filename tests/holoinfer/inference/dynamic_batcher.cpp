@@ -0,0 +1,129 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <holoinfer_batcher.hpp>
+#include <holoinfer_buffer.hpp>
+
+namespace HoloInfer = holoscan::inference;
+
+namespace {
+
+std::shared_ptr<HoloInfer::DataBuffer> make_buffer(const std::vector<float>& values) {
+  auto buffer = std::make_shared<HoloInfer::DataBuffer>(HoloInfer::holoinfer_datatype::h_Float32);
+  buffer->host_buffer.resize(values.size());
+  std::copy(values.begin(), values.end(), static_cast<float*>(buffer->host_buffer.data()));
+  return buffer;
+}
+
+std::vector<float> values_of(const std::shared_ptr<HoloInfer::DataBuffer>& buffer) {
+  const auto* data = static_cast<const float*>(buffer->host_buffer.data());
+  return std::vector<float>(data, data + buffer->host_buffer.size());
+}
+
+}  // namespace
+
+TEST(DynamicBatcher, TestStackAndScatter) {
+  HoloInfer::DynamicBatcher batcher({"image", "mask"}, 3, std::chrono::milliseconds(100));
+
+  for (int64_t stream = 0; stream < 3; stream++) {
+    const float v = static_cast<float>(stream);
+    HoloInfer::DataMap frame = {{"image", make_buffer({v, v + 0.5f})}, {"mask", make_buffer({-v})}};
+    EXPECT_FALSE(batcher.ready());
+    auto status = batcher.add(stream * 10, frame);
+    ASSERT_EQ(status.get_code(), HoloInfer::holoinfer_code::H_SUCCESS) << status.get_message();
+  }
+  EXPECT_TRUE(batcher.ready());
+  EXPECT_EQ(batcher.size(), 3);
+  EXPECT_TRUE(batcher.contains(20));
+  EXPECT_FALSE(batcher.contains(1));
+  EXPECT_EQ(batcher.stream_ids(), (std::vector<int64_t>{0, 10, 20}));
+
+  HoloInfer::DataMap batched;
+  auto status = batcher.stack(batched);
+  ASSERT_EQ(status.get_code(), HoloInfer::holoinfer_code::H_SUCCESS) << status.get_message();
+  EXPECT_EQ(values_of(batched.at("image")), (std::vector<float>{0, 0.5f, 1, 1.5f, 2, 2.5f}));
+  EXPECT_EQ(values_of(batched.at("mask")), (std::vector<float>{-0.f, -1, -2}));
+
+  // Outputs of the batch: 2 elements per frame
+  HoloInfer::DataMap batched_outputs = {{"scores", make_buffer({1, 2, 3, 4, 5, 6})}};
+  std::vector<HoloInfer::DataMap> frame_outputs;
+  status = batcher.scatter(batched_outputs, frame_outputs);
+  ASSERT_EQ(status.get_code(), HoloInfer::holoinfer_code::H_SUCCESS) << status.get_message();
+  ASSERT_EQ(frame_outputs.size(), 3);
+  EXPECT_EQ(values_of(frame_outputs[0].at("scores")), (std::vector<float>{1, 2}));
+  EXPECT_EQ(values_of(frame_outputs[1].at("scores")), (std::vector<float>{3, 4}));
+  EXPECT_EQ(values_of(frame_outputs[2].at("scores")), (std::vector<float>{5, 6}));
+
+  batcher.clear();
+  EXPECT_TRUE(batcher.empty());
+  EXPECT_FALSE(batcher.ready());
+
+  // A partial batch is stacked with its own size, reusing the buffers
+  HoloInfer::DataMap frame = {{"image", make_buffer({7, 8})}, {"mask", make_buffer({9})}};
+  status = batcher.add(5, frame);
+  ASSERT_EQ(status.get_code(), HoloInfer::holoinfer_code::H_SUCCESS) << status.get_message();
+  status = batcher.stack(batched);
+  ASSERT_EQ(status.get_code(), HoloInfer::holoinfer_code::H_SUCCESS) << status.get_message();
+  EXPECT_EQ(values_of(batched.at("image")), (std::vector<float>{7, 8}));
+  EXPECT_EQ(values_of(batched.at("mask")), (std::vector<float>{9}));
+}
+
+TEST(DynamicBatcher, TestMaxDelay) {
+  const auto max_delay = std::chrono::milliseconds(5);
+  HoloInfer::DynamicBatcher batcher({"image"}, 8, max_delay);
+
+  HoloInfer::DataMap frame = {{"image", make_buffer({1, 2, 3})}};
+  ASSERT_EQ(batcher.add(0, frame).get_code(), HoloInfer::holoinfer_code::H_SUCCESS);
+  ASSERT_EQ(batcher.add(1, frame).get_code(), HoloInfer::holoinfer_code::H_SUCCESS);
+
+  const auto first = batcher.oldest_arrival();
+  EXPECT_FALSE(batcher.ready(first + max_delay / 2));
+  EXPECT_TRUE(batcher.ready(first + max_delay));
+}
+
+TEST(DynamicBatcher, TestInvalidFrames) {
+  HoloInfer::DynamicBatcher batcher({"image"}, 2, std::chrono::milliseconds(0));
+
+  HoloInfer::DataMap missing = {{"other", make_buffer({1})}};
+  EXPECT_EQ(batcher.add(0, missing).get_code(), HoloInfer::holoinfer_code::H_ERROR);
+  EXPECT_TRUE(batcher.empty());
+
+  HoloInfer::DataMap frame = {{"image", make_buffer({1, 2})}};
+  ASSERT_EQ(batcher.add(0, frame).get_code(), HoloInfer::holoinfer_code::H_SUCCESS);
+
+  // Frames of a batch must have the same size
+  HoloInfer::DataMap larger = {{"image", make_buffer({1, 2, 3})}};
+  EXPECT_EQ(batcher.add(1, larger).get_code(), HoloInfer::holoinfer_code::H_ERROR);
+  EXPECT_EQ(batcher.size(), 1);
+
+  ASSERT_EQ(batcher.add(1, frame).get_code(), HoloInfer::holoinfer_code::H_SUCCESS);
+  EXPECT_EQ(batcher.add(2, frame).get_code(), HoloInfer::holoinfer_code::H_ERROR);
+
+  // Outputs must hold one part per frame
+  HoloInfer::DataMap batched_outputs = {{"scores", make_buffer({1, 2, 3})}};
+  std::vector<HoloInfer::DataMap> frame_outputs;
+  EXPECT_EQ(batcher.scatter(batched_outputs, frame_outputs).get_code(),
+            HoloInfer::holoinfer_code::H_ERROR);
+}
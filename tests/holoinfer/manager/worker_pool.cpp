@@ -0,0 +1,158 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <manager/worker_pool.hpp>
+
+namespace HoloInfer = holoscan::inference;
+
+namespace {
+
+constexpr size_t kNumRuns = 10000;
+
+/// Task counting the number of times each task index is executed
+class CountingTask {
+ public:
+  explicit CountingTask(size_t num_tasks) : counts_(num_tasks) {}
+
+  void operator()(size_t index) { counts_.at(index).fetch_add(1, std::memory_order_relaxed); }
+
+  size_t count(size_t index) const { return counts_[index].load(std::memory_order_relaxed); }
+
+ private:
+  std::vector<std::atomic<size_t>> counts_;
+};
+
+}  // namespace
+
+TEST(WorkerPool, TestEachTaskRunsOncePerRun) {
+  for (size_t num_tasks : {1, 2, 3, 8}) {
+    HoloInfer::WorkerPool pool(num_tasks);
+    EXPECT_EQ(pool.num_tasks(), num_tasks);
+
+    CountingTask task(num_tasks);
+    for (size_t run = 1; run <= 3; ++run) {
+      pool.run(task);
+      for (size_t index = 0; index < num_tasks; ++index) {
+        EXPECT_EQ(task.count(index), run) << "num_tasks " << num_tasks << ", index " << index;
+      }
+    }
+  }
+}
+
+TEST(WorkerPool, TestRepeatedRuns) {
+  // A lost wake-up of a worker would hang run()
+  constexpr size_t kNumTasks = 4;
+  HoloInfer::WorkerPool pool(kNumTasks);
+  CountingTask task(kNumTasks);
+  for (size_t run = 0; run < kNumRuns; ++run) { pool.run(task); }
+  for (size_t index = 0; index < kNumTasks; ++index) { EXPECT_EQ(task.count(index), kNumRuns); }
+}
+
+TEST(WorkerPool, TestTaskRunsOnSameThread) {
+  constexpr size_t kNumTasks = 3;
+  HoloInfer::WorkerPool pool(kNumTasks);
+  std::vector<std::thread::id> thread_ids(kNumTasks);
+  auto record = [&thread_ids](size_t index) { thread_ids[index] = std::this_thread::get_id(); };
+  pool.run(record);
+  EXPECT_EQ(thread_ids[0], std::this_thread::get_id());
+
+  const auto first_ids = thread_ids;
+  for (size_t run = 0; run < 10; ++run) {
+    pool.run(record);
+    EXPECT_EQ(thread_ids, first_ids);
+  }
+}
+
+TEST(WorkerPool, TestExceptionIsRethrown) {
+  constexpr size_t kNumTasks = 4;
+  HoloInfer::WorkerPool pool(kNumTasks);
+
+  // Exceptions thrown by a worker and by the calling thread
+  for (size_t throwing_index : {size_t{2}, size_t{0}}) {
+    CountingTask counter(kNumTasks);
+    auto task = [&counter, throwing_index](size_t index) {
+      counter(index);
+      if (index == throwing_index) { throw std::runtime_error("task failed"); }
+    };
+    EXPECT_THROW(pool.run(task), std::runtime_error);
+    // The other tasks still ran
+    for (size_t index = 0; index < kNumTasks; ++index) { EXPECT_EQ(counter.count(index), 1); }
+
+    // The pool is still usable and the exception is not rethrown again
+    CountingTask task_after(kNumTasks);
+    EXPECT_NO_THROW(pool.run(task_after));
+    for (size_t index = 0; index < kNumTasks; ++index) { EXPECT_EQ(task_after.count(index), 1); }
+  }
+
+  // Only one exception is rethrown when every task throws
+  auto throw_all = [](size_t) { throw std::runtime_error("task failed"); };
+  EXPECT_THROW(pool.run(throw_all), std::runtime_error);
+  CountingTask task_after(kNumTasks);
+  EXPECT_NO_THROW(pool.run(task_after));
+}
+
+TEST(WorkerPool, TestDestroyIdle) {
+  for (size_t num_tasks : {1, 2, 8}) {
+    // Never run
+    { HoloInfer::WorkerPool pool(num_tasks); }
+
+    // Idle after a run
+    auto pool = std::make_unique<HoloInfer::WorkerPool>(num_tasks);
+    CountingTask task(num_tasks);
+    pool->run(task);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    pool.reset();
+    EXPECT_EQ(task.count(num_tasks - 1), 1);
+  }
+}
+
+TEST(CompletionLatch, TestWaitForAllThreads) {
+  constexpr size_t kNumThreads = 4;
+  HoloInfer::CompletionLatch latch;
+  for (size_t run = 0; run < 100; ++run) {
+    std::atomic<size_t> done{0};
+    latch.reset(kNumThreads);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < kNumThreads; ++i) {
+      threads.emplace_back([&latch, &done]() {
+        done.fetch_add(1, std::memory_order_relaxed);
+        latch.count_down();
+      });
+    }
+    latch.wait();
+    EXPECT_EQ(done.load(std::memory_order_relaxed), kNumThreads);
+    for (auto& thread : threads) { thread.join(); }
+  }
+}
+
+TEST(CompletionLatch, TestAlreadyReleased) {
+  HoloInfer::CompletionLatch latch;
+  latch.reset(1);
+  latch.count_down();
+  latch.wait();
+  latch.reset(0);
+  latch.wait();
+}
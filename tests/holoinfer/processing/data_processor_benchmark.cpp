@@ -0,0 +1,230 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <holoinfer.hpp>
+#include <process/data_processor.hpp>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace HoloInfer = holoscan::inference;
+namespace cpu_kernels = holoscan::inference::cpu_kernels;
+
+namespace {
+
+constexpr int kIterations = 50;
+
+// Scalar implementation of scale_intensity_cpu before vectorization, used as reference
+std::vector<uint8_t> reference_scale_intensity(const std::vector<float>& input) {
+  const size_t dsize = input.size();
+  float max = 0, min = 100000;
+  for (auto v : input) {
+    if (max < v) { max = v; }
+    if (min > v) { min = v; }
+  }
+  std::vector<uint32_t> histogram(256, 0);
+  for (auto v : input) { histogram[uint8_t(255 * ((v - min) / (max - min)))]++; }
+  std::vector<uint32_t> cdf_histogram(256);
+  cdf_histogram[0] = histogram[0];
+  for (int i = 1; i < 256; i++) { cdf_histogram[i] = histogram[i] + cdf_histogram[i - 1]; }
+  uint32_t cdf_histogram_min = dsize;
+  for (int i = 0; i < 256; i++) {
+    if (cdf_histogram[i] < cdf_histogram_min) { cdf_histogram_min = cdf_histogram[i]; }
+  }
+  std::vector<uint8_t> output(3 * dsize);
+  for (size_t index = 0; index < dsize; index++) {
+    auto bin = uint32_t(255 * ((input[index] - min) / (max - min)));
+    auto value = (uint32_t)(255.0 * (cdf_histogram[bin] - cdf_histogram_min) /
+                            (dsize - cdf_histogram_min));
+    for (int c = 0; c < 3; c++) { output[3 * index + c] = value; }
+  }
+  return output;
+}
+
+// Scalar implementation of compute_max_per_channel_cpu before vectorization, used as reference
+std::vector<float> reference_max_per_channel(const std::vector<float>& input, size_t rows,
+                                             size_t cols, size_t channels) {
+  std::vector<unsigned int> max_x(channels, 0), max_y(channels, 0);
+  std::vector<float> max_value(channels, -1999);
+  for (unsigned int i = 0; i < rows; i++) {
+    for (unsigned int j = 0; j < cols; j++) {
+      for (unsigned int c = 1; c < channels; c++) {
+        float v = input[i * cols * channels + j * channels + c];
+        if (max_value[c] < v) {
+          max_value[c] = v;
+          max_x[c] = i;
+          max_y[c] = j;
+        }
+      }
+    }
+  }
+  std::vector<float> output(2 * channels);
+  for (size_t c = 0; c < channels; c++) {
+    output[2 * c] = static_cast<float>(max_x[c]) / static_cast<float>(rows);
+    output[2 * c + 1] = static_cast<float>(max_y[c]) / static_cast<float>(cols);
+  }
+  return output;
+}
+
+struct Configuration {
+  cpu_kernels::Isa isa;
+  size_t num_threads;
+};
+
+std::vector<Configuration> supported_configurations() {
+  std::vector<Configuration> configurations;
+  for (auto isa : {cpu_kernels::Isa::kScalar,
+                   cpu_kernels::Isa::kNeon,
+                   cpu_kernels::Isa::kAvx2,
+                   cpu_kernels::Isa::kAvx512}) {
+    if (!cpu_kernels::isa_supported(isa)) { continue; }
+    for (size_t num_threads : {1, 4}) { configurations.push_back({isa, num_threads}); }
+  }
+  return configurations;
+}
+
+std::unique_ptr<HoloInfer::DataProcessor> make_processor(const Configuration& configuration) {
+  auto processor = std::make_unique<HoloInfer::DataProcessor>();
+  EXPECT_TRUE(processor->set_cpu_isa(configuration.isa));
+  processor->set_num_threads(configuration.num_threads);
+  return processor;
+}
+
+std::vector<uint8_t> scale_intensity(HoloInfer::DataProcessor& processor,
+                                     const std::vector<float>& input, int rows, int cols,
+                                     int iterations = 1) {
+  HoloInfer::DataMap data_map;
+  std::vector<int64_t> dims;
+  for (int i = 0; i < iterations; i++) {
+    auto status = processor.scale_intensity_cpu({1, rows, cols}, input.data(), dims, data_map,
+                                                {"out"});
+    EXPECT_EQ(status.get_code(), HoloInfer::holoinfer_code::H_SUCCESS) << status.get_message();
+  }
+  auto& buffer = data_map.at("out")->host_buffer;
+  auto data = static_cast<const uint8_t*>(buffer.data());
+  return std::vector<uint8_t>(data, data + 3 * input.size());
+}
+
+std::vector<float> max_per_channel(HoloInfer::DataProcessor& processor,
+                                   const std::vector<float>& input, int rows, int cols,
+                                   int channels, int iterations = 1) {
+  HoloInfer::DataMap data_map;
+  std::vector<int64_t> dims;
+  for (int i = 0; i < iterations; i++) {
+    auto status = processor.compute_max_per_channel_cpu(
+        {1, rows, cols, channels}, input.data(), dims, data_map, {"out"});
+    EXPECT_EQ(status.get_code(), HoloInfer::holoinfer_code::H_SUCCESS) << status.get_message();
+  }
+  auto& buffer = data_map.at("out")->host_buffer;
+  auto data = static_cast<const float*>(buffer.data());
+  return std::vector<float>(data, data + 2 * channels);
+}
+
+double ms_since(std::chrono::steady_clock::time_point start, int iterations) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+             .count() /
+         iterations;
+}
+
+}  // namespace
+
+TEST(HoloInferProcessingBenchmark, TestScaleIntensityMatchesReference) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<float> distribution(-3.0f, 11.0f);
+  for (auto [rows, cols] : std::vector<std::pair<int, int>>{{3, 7}, {37, 53}, {1080, 1920}}) {
+    std::vector<float> input(rows * cols);
+    for (auto& v : input) { v = distribution(rng); }
+    const auto expected = reference_scale_intensity(input);
+
+    for (const auto& configuration : supported_configurations()) {
+      auto processor = make_processor(configuration);
+      EXPECT_EQ(scale_intensity(*processor, input, rows, cols), expected)
+          << cpu_kernels::isa_name(configuration.isa) << ", " << configuration.num_threads
+          << " thread(s), " << rows << "x" << cols;
+    }
+  }
+}
+
+TEST(HoloInferProcessingBenchmark, TestMaxPerChannelMatchesReference) {
+  std::mt19937 rng(1234);
+  // Few distinct values so that the max of each channel appears at several locations
+  std::uniform_int_distribution<int> distribution(-5, 20);
+  for (auto [rows, cols] : std::vector<std::pair<int, int>>{{3, 7}, {37, 53}, {512, 512}}) {
+    for (int channels : {1, 2, 3, 5, 12}) {
+      std::vector<float> input(rows * cols * channels);
+      for (auto& v : input) { v = 0.5f * distribution(rng); }
+      if (channels > 2) {
+        // A channel without values above -1999 keeps the (0, 0) location
+        for (int p = 0; p < rows * cols; p++) { input[p * channels + 2] = -3000.0f; }
+      }
+      const auto expected = reference_max_per_channel(input, rows, cols, channels);
+
+      for (const auto& configuration : supported_configurations()) {
+        auto processor = make_processor(configuration);
+        EXPECT_EQ(max_per_channel(*processor, input, rows, cols, channels), expected)
+            << cpu_kernels::isa_name(configuration.isa) << ", " << configuration.num_threads
+            << " thread(s), " << rows << "x" << cols << "x" << channels;
+      }
+    }
+  }
+}
+
+TEST(HoloInferProcessingBenchmark, TestThroughput) {
+  constexpr int kRows = 1080, kCols = 1920, kChannels = 8;
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+  std::vector<float> image(kRows * kCols);
+  for (auto& v : image) { v = distribution(rng); }
+  std::vector<float> channels_image(kRows * kCols * kChannels);
+  for (auto& v : channels_image) { v = distribution(rng); }
+
+  HOLOSCAN_LOG_INFO("{:>8} {:>8} {:>24} {:>24}",
+                    "isa",
+                    "threads",
+                    "scale_intensity ms/call",
+                    "max_per_channel ms/call");
+  for (const auto& configuration : supported_configurations()) {
+    auto processor = make_processor(configuration);
+    // warm up (allocation of the output buffers)
+    scale_intensity(*processor, image, kRows, kCols);
+    max_per_channel(*processor, channels_image, kRows, kCols, kChannels);
+
+    auto start = std::chrono::steady_clock::now();
+    scale_intensity(*processor, image, kRows, kCols, kIterations);
+    const double scale_ms = ms_since(start, kIterations);
+
+    start = std::chrono::steady_clock::now();
+    max_per_channel(*processor, channels_image, kRows, kCols, kChannels, kIterations);
+    const double max_ms = ms_since(start, kIterations);
+
+    HOLOSCAN_LOG_INFO("{:>8} {:>8} {:>24.3f} {:>24.3f}",
+                      cpu_kernels::isa_name(configuration.isa),
+                      configuration.num_threads,
+                      scale_ms,
+                      max_ms);
+    EXPECT_GT(scale_ms, 0.0);
+    EXPECT_GT(max_ms, 0.0);
+  }
+}
@@ -0,0 +1,328 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <holoinfer.hpp>
+#include <manager/worker_pool.hpp>
+#include <process/cpu_kernels.hpp>
+#include <process/transforms/generate_boxes.hpp>
+
+#include "holoscan/logger/logger.hpp"
+
+namespace HoloInfer = holoscan::inference;
+namespace cpu_kernels = holoscan::inference::cpu_kernels;
+
+namespace {
+
+constexpr int kIterations = 20;
+constexpr float kThreshold = 0.5f;
+
+// Configuration of the transform, written to a temporary directory
+constexpr const char* kLabels[] = {"cat", "dog", "bird"};
+const std::map<std::string, int> kLabelCount = {{"cat", 3}, {"dog", 2}};
+const std::map<std::string, std::vector<float>> kColorMap = {{"cat", {1.0f, 0.0f, 0.0f, 1.0f}},
+                                                             {"dog", {0.0f, 1.0f, 0.0f, 0.5f}}};
+
+std::string write_config(int rows, int cols) {
+  auto directory = std::filesystem::temp_directory_path() / "holoinfer_generate_boxes_benchmark";
+  std::filesystem::create_directories(directory);
+  std::ofstream labels(directory / "labels.txt");
+  for (auto label : kLabels) { labels << label << "\n"; }
+  auto config_path = directory / fmt::format("config_{}x{}.yaml", rows, cols);
+  std::ofstream config(config_path);
+  config << "generate_boxes:\n"
+         << "  params:\n"
+         << "    label_file: labels.txt\n"
+         << "    threshold: " << kThreshold << "\n"
+         << "  display:\n"
+         << "    width: " << cols << "\n"
+         << "    height: " << rows << "\n"
+         << "  objects:\n";
+  for (const auto& [object, count] : kLabelCount) {
+    config << "    " << object << ": " << count << "\n";
+  }
+  config << "  color:\n";
+  for (const auto& [object, color] : kColorMap) {
+    config << "    " << object << ": " << color[0] << " " << color[1] << " " << color[2] << " "
+           << color[3] << "\n";
+  }
+  return config_path.string();
+}
+
+// Label of a detection: 0 is the default "object" label, 1 to 3 are the labels of kLabels, the
+// others are unknown
+struct Detections {
+  std::vector<float> scores;
+  std::vector<int64_t> labels;
+  std::vector<float> boxes;
+  std::vector<float> masks;
+};
+
+Detections make_detections(int count, int rows, int cols, bool with_masks) {
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+  std::uniform_int_distribution<int64_t> label_distribution(-1, 5);
+  Detections detections;
+  detections.scores.resize(count);
+  detections.labels.resize(count);
+  detections.boxes.resize(4 * count);
+  for (auto& v : detections.scores) { v = distribution(rng); }
+  for (auto& v : detections.labels) { v = label_distribution(rng); }
+  for (auto& v : detections.boxes) { v = distribution(rng) * cols; }
+  if (with_masks) {
+    // Masks covering a random rectangle with random values, on a background below threshold
+    detections.masks.assign(static_cast<size_t>(count) * rows * cols, 0.0f);
+    for (int i = 0; i < count; i++) {
+      std::uniform_int_distribution<int> row_distribution(0, rows - 1);
+      std::uniform_int_distribution<int> col_distribution(0, cols - 1);
+      int r0 = row_distribution(rng), r1 = row_distribution(rng);
+      int c0 = col_distribution(rng), c1 = col_distribution(rng);
+      float* mask = detections.masks.data() + static_cast<size_t>(i) * rows * cols;
+      for (int a = std::min(r0, r1); a <= std::max(r0, r1); a++) {
+        for (int b = std::min(c0, c1); b <= std::max(c0, c1); b++) {
+          mask[a * cols + b] = distribution(rng);
+        }
+      }
+    }
+  }
+  return detections;
+}
+
+// Label name of a detection as selected by GenerateBoxes before the label tables
+std::string reference_key(int64_t label) {
+  std::vector<std::string> label_strings = {"object", "cat", "dog", "bird"};
+  std::string key = "object";
+  if (label >= 0 && static_cast<size_t>(label) < label_strings.size()) {
+    if (kLabelCount.find(label_strings[label]) != kLabelCount.end()) {
+      key = label_strings[label];
+    }
+  }
+  return key;
+}
+
+// Implementation of GenerateBoxes::execute_mask before parallelization, used as reference
+std::vector<float> reference_masks(const Detections& detections, int rows, int cols) {
+  std::vector<float> buffer(static_cast<size_t>(rows) * cols * 4, 0.0f);
+  for (size_t i = 0; i < detections.scores.size(); i++) {
+    if (detections.scores[i] > kThreshold) {
+      auto key_mask = reference_key(detections.labels[i]);
+      float red = 1, blue = 1, green = 1, alpha = 1;
+      if (kColorMap.find(key_mask) != kColorMap.end()) {
+        red = kColorMap.at(key_mask)[0];
+        green = kColorMap.at(key_mask)[1];
+        blue = kColorMap.at(key_mask)[2];
+        alpha = kColorMap.at(key_mask)[3];
+      }
+      for (int a = 0; a < rows; a++) {
+        for (int b = 0; b < cols; b++) {
+          auto index = i * cols * rows + a * cols + b;
+          auto hindex = (a * cols + b) * 4;
+          if (detections.masks[index] > kThreshold) {
+            buffer[hindex] = red;
+            buffer[hindex + 1] = green;
+            buffer[hindex + 2] = blue;
+            buffer[hindex + 3] = alpha;
+          }
+        }
+      }
+    }
+  }
+  return buffer;
+}
+
+// Implementation of GenerateBoxes::execute (boxes) before the pre-built keys, used as reference
+std::map<std::string, std::vector<float>> reference_boxes(const Detections& detections, int rows,
+                                                          int cols) {
+  std::map<std::string, std::vector<float>> outputs;
+  for (const auto& [object_name, max_objects] : kLabelCount) {
+    for (int i = 0; i < max_objects; i++) {
+      outputs[fmt::format("{}{}", object_name, i)] = {0, 0, 0, 0};
+      outputs[fmt::format("{}text{}", object_name, i)] = {1.1f, 1.1f, 0.05f};
+    }
+  }
+  std::map<std::string, std::vector<std::vector<float>>> valid_boxes;
+  for (size_t i = 0; i < detections.scores.size(); i++) {
+    if (detections.scores[i] > kThreshold) {
+      const float* box = detections.boxes.data() + 4 * i;
+      valid_boxes[reference_key(detections.labels[i])].push_back(
+          {box[0] / cols, box[1] / rows, box[2] / cols, box[3] / rows});
+    }
+  }
+  for (const auto& [obj_name, obj_boxes] : valid_boxes) {
+    int size_of_item = obj_boxes.size();
+    if (kLabelCount.find(obj_name) != kLabelCount.end()) {
+      size_of_item = std::min(size_of_item, kLabelCount.at(obj_name));
+    } else {
+      size_of_item = 0;
+    }
+    for (int i = 0; i < size_of_item; i++) {
+      outputs[fmt::format("{}{}", obj_name, i)] = obj_boxes[i];
+      auto& text = outputs[fmt::format("{}text{}", obj_name, i)];
+      text[0] = obj_boxes[i][2];
+      text[1] = obj_boxes[i][1];
+    }
+  }
+  return outputs;
+}
+
+struct Configuration {
+  cpu_kernels::Isa isa;
+  size_t num_threads;
+};
+
+std::vector<Configuration> supported_configurations() {
+  std::vector<Configuration> configurations;
+  for (auto isa : {cpu_kernels::Isa::kScalar,
+                   cpu_kernels::Isa::kNeon,
+                   cpu_kernels::Isa::kAvx2,
+                   cpu_kernels::Isa::kAvx512}) {
+    if (!cpu_kernels::isa_supported(isa)) { continue; }
+    for (size_t num_threads : {1, 4}) { configurations.push_back({isa, num_threads}); }
+  }
+  return configurations;
+}
+
+/// GenerateBoxes transform with the threads and kernels of a configuration
+class Transform {
+ public:
+  Transform(const Configuration& configuration, int rows, int cols, bool with_masks)
+      : boxes_(write_config(rows, cols)), rows_(rows), cols_(cols) {
+    if (configuration.num_threads > 1) {
+      pool_ = std::make_unique<HoloInfer::WorkerPool>(configuration.num_threads);
+    }
+    boxes_.set_cpu_resources(pool_.get(), &cpu_kernels::get_kernels(configuration.isa));
+    std::vector<std::string> tensors = {"scores", "labels", with_masks ? "masks" : "boxes"};
+    auto status = boxes_.initialize(tensors);
+    EXPECT_EQ(status.get_code(), HoloInfer::holoinfer_code::H_SUCCESS) << status.get_message();
+  }
+
+  void execute(Detections& detections, int iterations = 1) {
+    const int count = detections.scores.size();
+    std::map<std::string, void*> indata = {{"scores", detections.scores.data()},
+                                           {"labels", detections.labels.data()}};
+    std::map<std::string, std::vector<int>> indim = {{"scores", {1, count}},
+                                                     {"labels", {1, count}}};
+    if (detections.masks.empty()) {
+      indata.insert({"boxes", detections.boxes.data()});
+      indim.insert({"boxes", {1, count, 4}});
+    } else {
+      indata.insert({"masks", detections.masks.data()});
+      indim.insert({"masks", {1, count, rows_, cols_}});
+    }
+    for (int i = 0; i < iterations; i++) {
+      auto status = boxes_.execute(indata, indim, data_map_, dims_);
+      EXPECT_EQ(status.get_code(), HoloInfer::holoinfer_code::H_SUCCESS) << status.get_message();
+    }
+  }
+
+  std::vector<float> output(const std::string& key) {
+    auto& buffer = data_map_.at(key)->host_buffer;
+    auto data = static_cast<const float*>(buffer.data());
+    return std::vector<float>(data, data + buffer.size());
+  }
+
+  const HoloInfer::DataMap& data_map() const { return data_map_; }
+
+ private:
+  std::unique_ptr<HoloInfer::WorkerPool> pool_;
+  HoloInfer::GenerateBoxes boxes_;
+  int rows_, cols_;
+  HoloInfer::DataMap data_map_;
+  HoloInfer::DimType dims_;
+};
+
+double ms_since(std::chrono::steady_clock::time_point start, int iterations) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+             .count() /
+         iterations;
+}
+
+}  // namespace
+
+TEST(HoloInferGenerateBoxesBenchmark, TestMasksMatchReference) {
+  for (auto [rows, cols] : std::vector<std::pair<int, int>>{{3, 7}, {37, 53}, {512, 512}}) {
+    for (int count : {1, 20}) {
+      auto detections = make_detections(count, rows, cols, true);
+      const auto expected = reference_masks(detections, rows, cols);
+
+      for (const auto& configuration : supported_configurations()) {
+        Transform transform(configuration, rows, cols, true);
+        // Twice, the second frame reusing the output buffer of the first one
+        for (int frame = 0; frame < 2; frame++) {
+          transform.execute(detections);
+          EXPECT_EQ(transform.output("holoviz_masks"), expected)
+              << cpu_kernels::isa_name(configuration.isa) << ", " << configuration.num_threads
+              << " thread(s), " << rows << "x" << cols << ", " << count << " detection(s)";
+        }
+      }
+    }
+  }
+}
+
+TEST(HoloInferGenerateBoxesBenchmark, TestBoxesMatchReference) {
+  constexpr int kRows = 1080, kCols = 1920;
+  for (int count : {1, 5, 100}) {
+    auto detections = make_detections(count, kRows, kCols, false);
+    const auto expected = reference_boxes(detections, kRows, kCols);
+
+    Transform transform({cpu_kernels::best_isa(), 1}, kRows, kCols, false);
+    for (int frame = 0; frame < 2; frame++) {
+      transform.execute(detections);
+      EXPECT_EQ(transform.data_map().size(), expected.size());
+      for (const auto& [key, values] : expected) {
+        EXPECT_EQ(transform.output(key), values) << key << ", " << count << " detection(s)";
+      }
+    }
+  }
+}
+
+TEST(HoloInferGenerateBoxesBenchmark, TestThroughput) {
+  constexpr int kRows = 512, kCols = 512, kDetections = 100;
+  auto detections = make_detections(kDetections, kRows, kCols, true);
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kIterations; i++) { reference_masks(detections, kRows, kCols); }
+  const double reference_ms = ms_since(start, kIterations);
+
+  HOLOSCAN_LOG_INFO("{:>8} {:>8} {:>24}", "isa", "threads", "masks ms/call");
+  HOLOSCAN_LOG_INFO("{:>8} {:>8} {:>24.3f}", "before", 1, reference_ms);
+  for (const auto& configuration : supported_configurations()) {
+    Transform transform(configuration, kRows, kCols, true);
+    // warm up (allocation of the output buffer)
+    transform.execute(detections);
+
+    start = std::chrono::steady_clock::now();
+    transform.execute(detections, kIterations);
+    const double masks_ms = ms_since(start, kIterations);
+
+    HOLOSCAN_LOG_INFO("{:>8} {:>8} {:>24.3f}",
+                      cpu_kernels::isa_name(configuration.isa),
+                      configuration.num_threads,
+                      masks_ms);
+    EXPECT_GT(masks_ms, 0.0);
+  }
+}
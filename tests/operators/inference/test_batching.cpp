@@ -0,0 +1,251 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <holoscan/holoscan.hpp>
+#include <holoscan/operators/inference/inference.hpp>
+
+#include "gxf/std/tensor.hpp"
+
+namespace holoscan {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// ONNX model computing y = Identity(x), with x and y float tensors of shape [N, 4] (dynamic batch
+// dimension). This data is generated in python as follows:
+//
+//  import onnx
+//  from onnx import TensorProto, helper
+//  x = helper.make_tensor_value_info("x", TensorProto.FLOAT, ["N", 4])
+//  y = helper.make_tensor_value_info("y", TensorProto.FLOAT, ["N", 4])
+//  graph = helper.make_graph([helper.make_node("Identity", ["x"], ["y"])], "identity", [x], [y])
+//  model = helper.make_model(graph, opset_imports=[helper.make_opsetid("", 13)], ir_version=8)
+//  print(", ".join(f"0x{b:02x}" for b in model.SerializeToString()))
+//
+const uint8_t kIdentityModel[] = {
+    0x08, 0x08, 0x3a, 0x48, 0x0a, 0x10, 0x0a, 0x01, 0x78, 0x12, 0x01, 0x79, 0x22, 0x08, 0x49,
+    0x64, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x12, 0x08, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69,
+    0x74, 0x79, 0x5a, 0x14, 0x0a, 0x01, 0x78, 0x12, 0x0f, 0x0a, 0x0d, 0x08, 0x01, 0x12, 0x09,
+    0x0a, 0x03, 0x12, 0x01, 0x4e, 0x0a, 0x02, 0x08, 0x04, 0x62, 0x14, 0x0a, 0x01, 0x79, 0x12,
+    0x0f, 0x0a, 0x0d, 0x08, 0x01, 0x12, 0x09, 0x0a, 0x03, 0x12, 0x01, 0x4e, 0x0a, 0x02, 0x08,
+    0x04, 0x42, 0x04, 0x0a, 0x00, 0x10, 0x0d};
+
+constexpr int32_t kFrameSize = 4;
+
+/// Times and contents of the frames sent and of the results received by a test application
+struct BatchingLog {
+  std::mutex mutex;
+  std::vector<Clock::time_point> sent;
+  std::vector<Clock::time_point> received;
+  /// Tensors of each received message, by name
+  std::vector<std::map<std::string, std::vector<float>>> results;
+};
+
+// Emits frames of one stream: a host tensor 'x' of shape [1, 4] filled with the stream index
+class FrameTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(FrameTxOp)
+
+  FrameTxOp() = default;
+  FrameTxOp(float value, std::shared_ptr<BatchingLog> log) : value_(value), log_(log) {}
+
+  void setup(OperatorSpec& spec) override { spec.output<gxf::Entity>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext& context) override {
+    auto data = std::make_shared<std::vector<float>>(kFrameSize, value_);
+    auto message = nvidia::gxf::Entity::New(context.context());
+    auto tensor = message.value().add<nvidia::gxf::Tensor>("x");
+    const nvidia::gxf::Shape shape{1, kFrameSize};
+    const auto element_type = nvidia::gxf::PrimitiveType::kFloat32;
+    const uint64_t element_size = nvidia::gxf::PrimitiveTypeSize(element_type);
+    tensor.value()->wrapMemory(shape,
+                               element_type,
+                               element_size,
+                               nvidia::gxf::ComputeTrivialStrides(shape, element_size),
+                               nvidia::gxf::MemoryStorageType::kHost,
+                               data->data(),
+                               [data](void*) mutable {
+                                 data.reset();
+                                 return nvidia::gxf::Success;
+                               });
+    {
+      std::lock_guard<std::mutex> lock(log_->mutex);
+      log_->sent.push_back(Clock::now());
+    }
+    op_output.emit(message.value(), "out");
+  }
+
+ private:
+  float value_ = 0.0F;
+  std::shared_ptr<BatchingLog> log_;
+};
+
+// Records the tensors of the messages emitted by InferenceOp
+class ResultRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(ResultRxOp)
+
+  ResultRxOp() = default;
+  explicit ResultRxOp(std::shared_ptr<BatchingLog> log) : log_(log) {}
+
+  void setup(OperatorSpec& spec) override { spec.input<gxf::Entity>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto message = op_input.receive<gxf::Entity>("in").value();
+    std::map<std::string, std::vector<float>> tensors;
+    for (const char* name : {"y_0", "y_1"}) {
+      auto tensor = message.get<Tensor>(name, false);
+      if (!tensor) { continue; }
+      const auto* data = static_cast<const float*>(tensor->data());
+      tensors[name] = std::vector<float>(data, data + tensor->size());
+    }
+    std::lock_guard<std::mutex> lock(log_->mutex);
+    log_->received.push_back(Clock::now());
+    log_->results.push_back(std::move(tensors));
+  }
+
+ private:
+  std::shared_ptr<BatchingLog> log_;
+};
+
+// Frames of num_streams streams (one frame per stream) inferred by InferenceOp with batching
+class BatchingApp : public Application {
+ public:
+  BatchingApp(std::string model_path, int num_streams, int max_batch_size,
+              double max_batch_delay_ms, std::shared_ptr<BatchingLog> log)
+      : model_path_(std::move(model_path)),
+        num_streams_(num_streams),
+        max_batch_size_(max_batch_size),
+        max_batch_delay_ms_(max_batch_delay_ms),
+        log_(log) {}
+
+  void compose() override {
+    ops::InferenceOp::DataMap model_path_map;
+    model_path_map.insert("identity", model_path_);
+    ops::InferenceOp::DataVecMap pre_processor_map;
+    pre_processor_map.insert("identity", {"x"});
+    ops::InferenceOp::DataVecMap inference_map;
+    inference_map.insert("identity", {"y"});
+
+    auto allocator = make_resource<UnboundedAllocator>("pool");
+    auto inference =
+        make_operator<ops::InferenceOp>("inference",
+                                        Arg("backend", std::string("onnxrt")),
+                                        Arg("model_path_map", model_path_map),
+                                        Arg("pre_processor_map", pre_processor_map),
+                                        Arg("inference_map", inference_map),
+                                        Arg("in_tensor_names", std::vector<std::string>{"x"}),
+                                        Arg("out_tensor_names", std::vector<std::string>{"y"}),
+                                        Arg("infer_on_cpu", true),
+                                        Arg("input_on_cuda", false),
+                                        Arg("output_on_cuda", false),
+                                        Arg("transmit_on_cuda", false),
+                                        Arg("max_batch_size", max_batch_size_),
+                                        Arg("max_batch_delay_ms", max_batch_delay_ms_),
+                                        Arg("allocator", allocator));
+    auto rx = make_operator<ResultRxOp>("rx", log_);
+    for (int stream = 0; stream < num_streams_; ++stream) {
+      auto tx = make_operator<FrameTxOp>(
+          fmt::format("tx{}", stream), static_cast<float>(stream + 1), log_);
+      tx->add_arg(make_condition<CountCondition>(1));
+      add_flow(tx, inference, {{"out", "receivers"}});
+    }
+    add_flow(inference, rx, {{"transmitter", "in"}});
+  }
+
+ private:
+  std::string model_path_;
+  int num_streams_;
+  int max_batch_size_;
+  double max_batch_delay_ms_;
+  std::shared_ptr<BatchingLog> log_;
+};
+
+class InferenceOpBatching : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    model_path_ = (std::filesystem::temp_directory_path() /
+                   fmt::format("holoscan_identity_{}.onnx", ::testing::UnitTest::GetInstance()
+                                                                 ->current_test_info()
+                                                                 ->name()))
+                      .string();
+    std::ofstream file(model_path_, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(kIdentityModel), sizeof(kIdentityModel));
+  }
+
+  void TearDown() override { std::filesystem::remove(model_path_); }
+
+  std::string model_path_;
+};
+
+}  // namespace
+
+TEST_F(InferenceOpBatching, TestPartialBatchIsFlushedOnDelay) {
+  // A single stream never fills a batch of 2 frames: the frame must be inferred once the delay
+  // expired, even though no other frame arrives
+  constexpr double kDelayMs = 200.0;
+  auto log = std::make_shared<BatchingLog>();
+  auto app = make_application<BatchingApp>(model_path_, 1, 2, kDelayMs, log);
+  app->run();
+
+  ASSERT_EQ(log->sent.size(), 1);
+  ASSERT_EQ(log->received.size(), 1);
+  const auto latency =
+      std::chrono::duration<double, std::milli>(log->received[0] - log->sent[0]).count();
+  EXPECT_GE(latency, kDelayMs);
+  EXPECT_LT(latency, kDelayMs + 5000.0);
+
+  const auto& result = log->results[0];
+  ASSERT_EQ(result.count("y_0"), 1);
+  EXPECT_EQ(result.at("y_0"), std::vector<float>(kFrameSize, 1.0F));
+  EXPECT_EQ(result.count("y_1"), 0);
+}
+
+TEST_F(InferenceOpBatching, TestFullBatchIsInferredWithoutDelay) {
+  // The frames of both streams fill the batch: it must not wait for the (long) delay
+  constexpr double kDelayMs = 60000.0;
+  auto log = std::make_shared<BatchingLog>();
+  auto app = make_application<BatchingApp>(model_path_, 2, 2, kDelayMs, log);
+  app->run();
+
+  ASSERT_EQ(log->sent.size(), 2);
+  ASSERT_EQ(log->received.size(), 1);
+  const auto latency =
+      std::chrono::duration<double, std::milli>(log->received[0] - log->sent[0]).count();
+  EXPECT_LT(latency, kDelayMs / 2);
+
+  const auto& result = log->results[0];
+  ASSERT_EQ(result.count("y_0"), 1);
+  ASSERT_EQ(result.count("y_1"), 1);
+  EXPECT_EQ(result.at("y_0"), std::vector<float>(kFrameSize, 1.0F));
+  EXPECT_EQ(result.at("y_1"), std::vector<float>(kFrameSize, 2.0F));
+}
+
+}  // namespace holoscan
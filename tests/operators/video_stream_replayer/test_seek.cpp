@@ -0,0 +1,268 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <holoscan/holoscan.hpp>
+#include <holoscan/operators/video_stream_recorder/video_stream_recorder.hpp>
+#include <holoscan/operators/video_stream_replayer/video_stream_replayer.hpp>
+
+#include "gxf/serialization/file_stream.hpp"
+#include "gxf/std/tensor.hpp"
+
+namespace holoscan {
+
+namespace {
+
+constexpr int32_t kNumFrames = 10;
+// The index of the fixture logs frame i at (i + 1) * kTimeStep
+constexpr uint64_t kTimeStep = 1000;
+const std::string kBasename = "frames";
+
+// Emits frames made of a host tensor 'frame' holding the frame number (0, 1, 2...)
+class FrameTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(FrameTxOp)
+
+  FrameTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<gxf::Entity>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext& context) override {
+    auto data = std::make_shared<int32_t>(frame_++);
+    auto message = nvidia::gxf::Entity::New(context.context());
+    auto tensor = message.value().add<nvidia::gxf::Tensor>("frame");
+    const nvidia::gxf::Shape shape{1};
+    const auto element_type = nvidia::gxf::PrimitiveType::kInt32;
+    const uint64_t element_size = nvidia::gxf::PrimitiveTypeSize(element_type);
+    tensor.value()->wrapMemory(shape,
+                               element_type,
+                               element_size,
+                               nvidia::gxf::ComputeTrivialStrides(shape, element_size),
+                               nvidia::gxf::MemoryStorageType::kHost,
+                               data.get(),
+                               [data](void*) mutable {
+                                 data.reset();
+                                 return nvidia::gxf::Success;
+                               });
+    op_output.emit(message.value(), "out");
+  }
+
+ private:
+  int32_t frame_ = 0;
+};
+
+// Records the frame numbers of the replayed frames and calls a callback for each of them
+class FrameRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(FrameRxOp)
+
+  FrameRxOp() = default;
+  FrameRxOp(std::shared_ptr<std::vector<int32_t>> frames, std::function<void(int32_t)> on_frame)
+      : frames_(std::move(frames)), on_frame_(std::move(on_frame)) {}
+
+  void setup(OperatorSpec& spec) override { spec.input<gxf::Entity>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto message = op_input.receive<gxf::Entity>("in").value();
+    auto tensor = message.get<Tensor>("frame");
+    ASSERT_TRUE(tensor);
+    const int32_t frame = *static_cast<const int32_t*>(tensor->data());
+    frames_->push_back(frame);
+    if (on_frame_) { on_frame_(frame); }
+  }
+
+ private:
+  std::shared_ptr<std::vector<int32_t>> frames_;
+  std::function<void(int32_t)> on_frame_;
+};
+
+class RecordApp : public Application {
+ public:
+  explicit RecordApp(std::string directory) : directory_(std::move(directory)) {}
+
+  void compose() override {
+    auto tx = make_operator<FrameTxOp>("tx", make_condition<CountCondition>(kNumFrames));
+    auto recorder = make_operator<ops::VideoStreamRecorderOp>(
+        "recorder", Arg("directory", directory_), Arg("basename", kBasename));
+    add_flow(tx, recorder, {{"out", "input"}});
+  }
+
+ private:
+  std::string directory_;
+};
+
+class ReplayApp : public Application {
+ public:
+  using OnFrame = std::function<void(ops::VideoStreamReplayerOp&, int32_t)>;
+
+  ReplayApp(std::string directory, size_t read_ahead, OnFrame on_frame)
+      : directory_(std::move(directory)), read_ahead_(read_ahead), on_frame_(std::move(on_frame)) {}
+
+  void compose() override {
+    replayer_ = make_operator<ops::VideoStreamReplayerOp>("replayer",
+                                                          Arg("directory", directory_),
+                                                          Arg("basename", kBasename),
+                                                          Arg("realtime", false),
+                                                          Arg("repeat", false),
+                                                          Arg("read_ahead", read_ahead_));
+    // A std::function (not a lambda) selects the FrameRxOp constructor over the forwarding one
+    std::function<void(int32_t)> on_frame = [this](int32_t frame) {
+      if (on_frame_) { on_frame_(*replayer_, frame); }
+    };
+    auto rx = make_operator<FrameRxOp>("rx", frames_, on_frame);
+    add_flow(replayer_, rx, {{"output", "in"}});
+  }
+
+  std::shared_ptr<ops::VideoStreamReplayerOp> replayer() const { return replayer_; }
+  const std::vector<int32_t>& frames() const { return *frames_; }
+
+ private:
+  std::string directory_;
+  size_t read_ahead_;
+  OnFrame on_frame_;
+  std::shared_ptr<ops::VideoStreamReplayerOp> replayer_;
+  std::shared_ptr<std::vector<int32_t>> frames_ = std::make_shared<std::vector<int32_t>>();
+};
+
+std::vector<int32_t> frame_range(int32_t first, int32_t end) {
+  std::vector<int32_t> frames;
+  for (int32_t frame = first; frame < end; ++frame) { frames.push_back(frame); }
+  return frames;
+}
+
+std::vector<int32_t> concat(std::vector<int32_t> a, const std::vector<int32_t>& b) {
+  a.insert(a.end(), b.begin(), b.end());
+  return a;
+}
+
+// The parameter is the value of the 'read_ahead' parameter of the replayer
+class VideoStreamReplayerSeek : public ::testing::TestWithParam<size_t> {
+ protected:
+  // Record a small fixture of kNumFrames frames, with known timestamps
+  static void SetUpTestSuite() {
+    directory_ = (std::filesystem::temp_directory_path() /
+                  fmt::format("holoscan_replayer_seek_{}", getpid()))
+                     .string();
+    std::filesystem::create_directories(directory_);
+    {
+      auto app = make_application<RecordApp>(directory_);
+      app->run();
+    }
+
+    const std::string index_path =
+        directory_ + "/" + kBasename + nvidia::gxf::FileStream::kIndexFileExtension;
+    std::vector<nvidia::gxf::EntityIndex> indices(kNumFrames);
+    const auto index_bytes =
+        static_cast<std::streamsize>(indices.size() * sizeof(nvidia::gxf::EntityIndex));
+    {
+      std::ifstream file(index_path, std::ios::binary);
+      file.read(reinterpret_cast<char*>(indices.data()), index_bytes);
+      ASSERT_EQ(file.gcount(), index_bytes);
+    }
+    for (size_t i = 0; i < indices.size(); ++i) { indices[i].log_time = (i + 1) * kTimeStep; }
+    std::ofstream file(index_path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(indices.data()), index_bytes);
+  }
+
+  static void TearDownTestSuite() { std::filesystem::remove_all(directory_); }
+
+  std::vector<int32_t> replay(ReplayApp::OnFrame on_frame = nullptr) {
+    auto app = make_application<ReplayApp>(directory_, GetParam(), std::move(on_frame));
+    app->run();
+    EXPECT_EQ(app->replayer()->num_frames(), static_cast<uint64_t>(kNumFrames));
+    return app->frames();
+  }
+
+  static std::string directory_;
+};
+
+std::string VideoStreamReplayerSeek::directory_;
+
+}  // namespace
+
+INSTANTIATE_TEST_CASE_P(VideoStreamReplayer, VideoStreamReplayerSeek,
+                        ::testing::Values(0UL, 4UL));
+
+TEST_P(VideoStreamReplayerSeek, TestReplayAllFrames) {
+  EXPECT_EQ(replay(), frame_range(0, kNumFrames));
+}
+
+TEST_P(VideoStreamReplayerSeek, TestSeekToFirstFrame) {
+  bool seeked = false;
+  auto frames = replay([&seeked](ops::VideoStreamReplayerOp& replayer, int32_t frame) {
+    if (frame == 3 && !seeked) {
+      seeked = true;
+      EXPECT_TRUE(replayer.seek(0));
+    }
+  });
+  EXPECT_EQ(frames, concat(frame_range(0, 4), frame_range(0, kNumFrames)));
+}
+
+TEST_P(VideoStreamReplayerSeek, TestSeekToLastFrame) {
+  auto frames = replay([](ops::VideoStreamReplayerOp& replayer, int32_t frame) {
+    if (frame == 1) { EXPECT_TRUE(replayer.seek(kNumFrames - 1)); }
+  });
+  EXPECT_EQ(frames, std::vector<int32_t>({0, 1, kNumFrames - 1}));
+}
+
+TEST_P(VideoStreamReplayerSeek, TestSeekOutOfRange) {
+  auto frames = replay([](ops::VideoStreamReplayerOp& replayer, int32_t frame) {
+    if (frame == 1) {
+      EXPECT_FALSE(replayer.seek(kNumFrames));
+      EXPECT_FALSE(replayer.seek_to_timestamp(kNumFrames * kTimeStep + 1));
+    }
+  });
+  // The playback is not affected
+  EXPECT_EQ(frames, frame_range(0, kNumFrames));
+}
+
+TEST_P(VideoStreamReplayerSeek, TestSeekDropsFramesReadAhead) {
+  // With read-ahead, the frames following frame 0 are already queued when the seek is requested:
+  // none of them may be played back
+  auto frames = replay([](ops::VideoStreamReplayerOp& replayer, int32_t frame) {
+    if (frame == 0) { EXPECT_TRUE(replayer.seek(6)); }
+  });
+  EXPECT_EQ(frames, concat({0}, frame_range(6, kNumFrames)));
+}
+
+TEST_P(VideoStreamReplayerSeek, TestSeekToTimestampBetweenFrames) {
+  // Frame 4 is the first frame logged at or after a timestamp between frames 3 and 4
+  auto frames = replay([](ops::VideoStreamReplayerOp& replayer, int32_t frame) {
+    if (frame == 0) { EXPECT_TRUE(replayer.seek_to_timestamp(4 * kTimeStep + kTimeStep / 2)); }
+  });
+  EXPECT_EQ(frames, concat({0}, frame_range(4, kNumFrames)));
+}
+
+TEST_P(VideoStreamReplayerSeek, TestSeekToTimestampOfFrame) {
+  auto frames = replay([](ops::VideoStreamReplayerOp& replayer, int32_t frame) {
+    if (frame == 0) { EXPECT_TRUE(replayer.seek_to_timestamp(8 * kTimeStep)); }
+  });
+  EXPECT_EQ(frames, concat({0}, frame_range(7, kNumFrames)));
+}
+
+}  // namespace holoscan
@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../codecs/mock_serialization_buffer.hpp"
+#include "holoscan/core/codecs.hpp"
+#include "holoscan/logger/logger.hpp"
+
+namespace holoscan {
+
+namespace {
+
+// Total number of bytes to move through the codec for each payload size
+constexpr size_t kBytesPerRun = 512UL * 1024 * 1024;
+
+// Serializes and deserializes `value` repeatedly and returns the codec throughput in bytes/s.
+// The transfer of registered (zero-copy) segments emulated by the mock buffer is not timed, as it
+// corresponds to the network transfer which is performed by the transport in both modes.
+template <typename codecT, typename vectorT>
+double measure_throughput(const vectorT& value, size_t iterations) {
+  const size_t num_bytes = value.size() * sizeof(typename vectorT::value_type);
+  auto endpoint = std::make_shared<MockUcxSerializationBuffer>(
+      num_bytes + sizeof(ZeroCopyDataHeader), Endpoint::MemoryStorageType::kSystem);
+
+  std::chrono::nanoseconds elapsed{0};
+  for (size_t i = 0; i < iterations; ++i) {
+    endpoint->reset();
+    auto start = std::chrono::steady_clock::now();
+    auto maybe_size = codecT::serialize(value, endpoint.get());
+    auto maybe_value = codecT::deserialize(endpoint.get());
+    auto result = std::move(maybe_value.value());
+    elapsed += std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(maybe_size);
+    EXPECT_EQ(result.size(), value.size());
+    if (!endpoint->data_buffers().empty()) { EXPECT_TRUE(endpoint->receive_data_buffers(1)); }
+  }
+  double seconds = std::chrono::duration<double>(elapsed).count();
+  return static_cast<double>(num_bytes * iterations) / std::max(seconds, 1e-9);
+}
+
+}  // namespace
+
+TEST(CodecThroughput, TestVectorFloatCopyVsZeroCopy) {
+  HOLOSCAN_LOG_INFO(
+      "{:>12} {:>16} {:>16} {:>8}", "bytes", "copy (MB/s)", "zero-copy (MB/s)", "ratio");
+  for (size_t num_bytes = 1024; num_bytes <= 64UL * 1024 * 1024; num_bytes *= 4) {
+    // Both codecs use the same (default-initialized) vector type
+    using vectorT = std::vector<float, default_init_allocator<float>>;
+    vectorT value(num_bytes / sizeof(float));
+    for (size_t i = 0; i < value.size(); ++i) { value[i] = static_cast<float>(i); }
+    size_t iterations = std::max<size_t>(kBytesPerRun / num_bytes, 4);
+
+    double copy_rate = measure_throughput<codec<vectorT>>(value, iterations);
+    double zero_copy_rate = measure_throughput<zero_copy_codec<vectorT>>(value, iterations);
+
+    HOLOSCAN_LOG_INFO("{:>12} {:>16.1f} {:>16.1f} {:>8.2f}",
+                      num_bytes,
+                      copy_rate / 1e6,
+                      zero_copy_rate / 1e6,
+                      zero_copy_rate / copy_rate);
+  }
+}
+
+}  // namespace holoscan
@@ -0,0 +1,155 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <holoscan/holoscan.hpp>
+
+namespace holoscan::ops {
+
+/// Emits the time at which each message is emitted (steady clock, in ns).
+class ConnectorTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(ConnectorTxOp)
+
+  ConnectorTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<int64_t>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now().time_since_epoch())
+                      .count();
+    op_output.emit(now, "out");
+  }
+};
+
+/// Receives the messages and accumulates their latency.
+class ConnectorRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(ConnectorRxOp)
+
+  ConnectorRxOp() = default;
+  ConnectorRxOp(IOSpec::ConnectorType connector_type, uint64_t capacity)
+      : connector_type_(connector_type), capacity_(capacity) {}
+
+  void setup(OperatorSpec& spec) override {
+    spec.input<int64_t>("in").connector(connector_type_, Arg("capacity", capacity_));
+  }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto sent = op_input.receive<int64_t>("in");
+    if (!sent) { return; }
+    int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now().time_since_epoch())
+                      .count();
+    total_latency_ns_ += now - sent.value();
+    ++receive_count_;
+  }
+
+  int64_t receive_count() const { return receive_count_; }
+  double avg_latency_us() const {
+    return receive_count_ ? total_latency_ns_ / 1000.0 / receive_count_ : 0.0;
+  }
+
+ private:
+  IOSpec::ConnectorType connector_type_ = IOSpec::ConnectorType::kDoubleBuffer;
+  uint64_t capacity_ = 1;
+  int64_t receive_count_ = 0;
+  int64_t total_latency_ns_ = 0;
+};
+
+}  // namespace holoscan::ops
+
+namespace {
+
+constexpr int64_t kMessageCount = 100000;
+
+class ConnectorApp : public holoscan::Application {
+ public:
+  ConnectorApp(holoscan::IOSpec::ConnectorType type, uint64_t capacity)
+      : type_(type), capacity_(capacity) {}
+
+  void compose() override {
+    using namespace holoscan;
+
+    auto tx =
+        make_operator<ops::ConnectorTxOp>("tx", make_condition<CountCondition>(kMessageCount));
+    rx_ = make_operator<ops::ConnectorRxOp>("rx", type_, capacity_);
+    add_flow(tx, rx_);
+  }
+
+  std::shared_ptr<holoscan::ops::ConnectorRxOp> rx_;
+
+ private:
+  holoscan::IOSpec::ConnectorType type_;
+  uint64_t capacity_;
+};
+
+struct ConnectorResult {
+  double messages_per_second = 0.0;
+  double avg_latency_us = 0.0;
+};
+
+ConnectorResult run_connector_app(holoscan::IOSpec::ConnectorType type, uint64_t capacity) {
+  using namespace holoscan;
+
+  auto app = make_application<ConnectorApp>(type, capacity);
+  // The operators run concurrently so that the receiver is used by two threads
+  app->scheduler(app->make_scheduler<EventBasedScheduler>(
+      "event-based-scheduler", Arg{"worker_thread_number", static_cast<int64_t>(2)}));
+
+  auto start = std::chrono::steady_clock::now();
+  app->run();
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  EXPECT_EQ(app->rx_->receive_count(), kMessageCount);
+
+  ConnectorResult result;
+  result.messages_per_second = kMessageCount / seconds;
+  result.avg_latency_us = app->rx_->avg_latency_us();
+  return result;
+}
+
+}  // namespace
+
+TEST(Connector, TestSpscRingVsDoubleBuffer) {
+  using holoscan::IOSpec;
+
+  HOLOSCAN_LOG_INFO(
+      "{:>14} {:>9} {:>14} {:>16}", "connector", "capacity", "messages/s", "avg latency (us)");
+  for (uint64_t capacity : {1UL, 16UL}) {
+    auto double_buffer = run_connector_app(IOSpec::ConnectorType::kDoubleBuffer, capacity);
+    auto spsc_ring = run_connector_app(IOSpec::ConnectorType::kSpscRing, capacity);
+
+    HOLOSCAN_LOG_INFO("{:>14} {:>9} {:>14.0f} {:>16.2f}",
+                      "double buffer",
+                      capacity,
+                      double_buffer.messages_per_second,
+                      double_buffer.avg_latency_us);
+    HOLOSCAN_LOG_INFO("{:>14} {:>9} {:>14.0f} {:>16.2f}",
+                      "spsc ring",
+                      capacity,
+                      spsc_ring.messages_per_second,
+                      spsc_ring.avg_latency_us);
+  }
+}
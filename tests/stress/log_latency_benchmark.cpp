@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <holoscan/holoscan.hpp>
+
+namespace holoscan::ops {
+
+class LogTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(LogTxOp)
+
+  LogTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<int64_t>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kMessagesPerTick; ++i) {
+      HOLOSCAN_LOG_INFO("tick {} message {} value {:.3f}", index_, i, index_ * 0.5);
+    }
+    tick_durations_.push_back(std::chrono::steady_clock::now() - start);
+    op_output.emit(index_++, "out");
+  }
+
+  static constexpr int kMessagesPerTick = 10;
+
+  const std::vector<std::chrono::nanoseconds>& tick_durations() const { return tick_durations_; }
+
+ private:
+  int64_t index_ = 0;
+  std::vector<std::chrono::nanoseconds> tick_durations_;
+};
+
+class LogRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(LogRxOp)
+
+  LogRxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<int64_t>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto value = op_input.receive<int64_t>("in").value();
+    HOLOSCAN_LOG_INFO("received {} from '{}'", value, name());
+    ++receive_count_;
+  }
+
+  int64_t receive_count() const { return receive_count_; }
+
+ private:
+  int64_t receive_count_ = 0;
+};
+
+}  // namespace holoscan::ops
+
+namespace {
+
+constexpr int64_t kTickCount = 5000;
+
+class LogApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+
+    tx_ = make_operator<ops::LogTxOp>("tx", make_condition<CountCondition>(kTickCount));
+    rx_ = make_operator<ops::LogRxOp>("rx");
+    add_flow(tx_, rx_);
+  }
+
+  std::shared_ptr<holoscan::ops::LogTxOp> tx_;
+  std::shared_ptr<holoscan::ops::LogRxOp> rx_;
+};
+
+struct TickLatency {
+  double p50_us = 0.0;
+  double p99_us = 0.0;
+  double max_us = 0.0;
+};
+
+TickLatency run_log_app(bool async) {
+  // Write the log to a file (instead of the console) to measure the logging cost, not the terminal
+  std::string log_path = "/tmp/holoscan_log_latency_benchmark.log";
+  std::fflush(stderr);
+  int stderr_fd = dup(STDERR_FILENO);
+  FILE* log_file = std::fopen(log_path.c_str(), "w");
+  dup2(fileno(log_file), STDERR_FILENO);
+
+  auto app = holoscan::make_application<LogApp>();
+  if (async) { holoscan::Logger::enable_async(8192, holoscan::LogOverflowPolicy::kBlock); }
+  app->run();
+  holoscan::Logger::disable_async();
+
+  std::fflush(stderr);
+  dup2(stderr_fd, STDERR_FILENO);
+  close(stderr_fd);
+  std::fclose(log_file);
+  std::remove(log_path.c_str());
+
+  EXPECT_EQ(app->rx_->receive_count(), kTickCount);
+  auto durations = app->tx_->tick_durations();
+  EXPECT_EQ(static_cast<int64_t>(durations.size()), kTickCount);
+  if (durations.empty()) { return {}; }
+
+  std::sort(durations.begin(), durations.end());
+  auto at_percentile = [&durations](double percentile) {
+    auto index = static_cast<size_t>(percentile / 100.0 * (durations.size() - 1));
+    return std::chrono::duration<double, std::micro>(durations[index]).count();
+  };
+  return {at_percentile(50.0), at_percentile(99.0), at_percentile(100.0)};
+}
+
+}  // namespace
+
+TEST(LogLatency, TestAsyncLogging) {
+  auto sync_latency = run_log_app(false);
+  auto async_latency = run_log_app(true);
+
+  HOLOSCAN_LOG_INFO("{} messages logged per tick", holoscan::ops::LogTxOp::kMessagesPerTick);
+  HOLOSCAN_LOG_INFO("{:>8} {:>14} {:>14} {:>14}", "logging", "p50 (us)", "p99 (us)", "max (us)");
+  for (const auto& [label, latency] :
+       {std::pair{"sync", sync_latency}, std::pair{"async", async_latency}}) {
+    HOLOSCAN_LOG_INFO(
+        "{:>8} {:>14.2f} {:>14.2f} {:>14.2f}", label, latency.p50_us, latency.p99_us, latency.max_us);
+  }
+
+  // The asynchronous backend only copies the arguments on the scheduler thread
+  EXPECT_LT(async_latency.p50_us, sync_latency.p50_us);
+}
@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+
+#include <holoscan/holoscan.hpp>
+
+#include "../system/env_wrapper.hpp"
+#include "holoscan/core/gxf/message_entity_pool.hpp"
+
+namespace {
+
+// Number of heap allocations made by the process (all threads)
+std::atomic<uint64_t> allocation_count{0};
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) { return ptr; }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace holoscan::ops {
+
+class PingEmitTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(PingEmitTxOp)
+
+  PingEmitTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<std::shared_ptr<int64_t>>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    auto value = std::make_shared<int64_t>(emit_count_);
+
+    // Only count the allocations made by emit()
+    uint64_t start_count = allocation_count.load(std::memory_order_relaxed);
+    op_output.emit(std::move(value), "out");
+    emit_allocations_ += allocation_count.load(std::memory_order_relaxed) - start_count;
+    ++emit_count_;
+  }
+
+  int64_t emit_count() const { return emit_count_; }
+  uint64_t emit_allocations() const { return emit_allocations_; }
+
+ private:
+  int64_t emit_count_ = 0;
+  uint64_t emit_allocations_ = 0;
+};
+
+class PingEmitRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(PingEmitRxOp)
+
+  PingEmitRxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<std::shared_ptr<int64_t>>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto value = op_input.receive<std::shared_ptr<int64_t>>("in");
+    if (value && *value.value() == receive_count_) { ++receive_count_; }
+  }
+
+  int64_t receive_count() const { return receive_count_; }
+
+ private:
+  int64_t receive_count_ = 0;
+};
+
+}  // namespace holoscan::ops
+
+namespace {
+
+constexpr int64_t kMessageCount = 100000;
+
+class PingEmitApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+
+    tx_ = make_operator<ops::PingEmitTxOp>("tx", make_condition<CountCondition>(kMessageCount));
+    rx_ = make_operator<ops::PingEmitRxOp>("rx");
+    add_flow(tx_, rx_);
+  }
+
+  std::shared_ptr<holoscan::ops::PingEmitTxOp> tx_;
+  std::shared_ptr<holoscan::ops::PingEmitRxOp> rx_;
+};
+
+struct PingEmitResult {
+  double allocations_per_emit = 0.0;
+  double messages_per_second = 0.0;
+};
+
+PingEmitResult run_ping_emit_app(const std::string& pool_size) {
+  EnvVarWrapper wrapper("HOLOSCAN_MESSAGE_POOL_SIZE", pool_size);
+
+  auto app = holoscan::make_application<PingEmitApp>();
+  auto start = std::chrono::steady_clock::now();
+  app->run();
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  EXPECT_EQ(app->tx_->emit_count(), kMessageCount);
+  EXPECT_EQ(app->rx_->receive_count(), kMessageCount);
+
+  PingEmitResult result;
+  result.allocations_per_emit =
+      static_cast<double>(app->tx_->emit_allocations()) / app->tx_->emit_count();
+  result.messages_per_second = kMessageCount / seconds;
+  return result;
+}
+
+}  // namespace
+
+TEST(PingEmit, TestAllocationsPerEmit) {
+  auto unpooled = run_ping_emit_app("0");
+  auto pooled =
+      run_ping_emit_app(std::to_string(holoscan::gxf::MessageEntityPool::kDefaultCapacity));
+
+  HOLOSCAN_LOG_INFO("{:>10} {:>18} {:>14}", "pool", "allocations/emit", "messages/s");
+  HOLOSCAN_LOG_INFO("{:>10} {:>18.2f} {:>14.0f}",
+                    "disabled",
+                    unpooled.allocations_per_emit,
+                    unpooled.messages_per_second);
+  HOLOSCAN_LOG_INFO("{:>10} {:>18.2f} {:>14.0f}",
+                    "enabled",
+                    pooled.allocations_per_emit,
+                    pooled.messages_per_second);
+
+  EXPECT_LT(pooled.allocations_per_emit, unpooled.allocations_per_emit);
+}
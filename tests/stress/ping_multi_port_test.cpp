@@ -17,7 +17,10 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <holoscan/holoscan.hpp>
@@ -122,6 +125,58 @@ class PingRxOp : public Operator {
   int count_ = 1;
 };
 
+// Forwards the received value (used to measure the framework overhead of a tick)
+class PingForwardOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(PingForwardOp)
+
+  PingForwardOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.input<std::shared_ptr<ValueData>>("in");
+    spec.output<std::shared_ptr<ValueData>>("out");
+  }
+
+  void compute(InputContext& op_input, OutputContext& op_output, ExecutionContext&) override {
+    op_output.emit(op_input.receive<std::shared_ptr<ValueData>>("in").value(), "out");
+  };
+};
+
+class PingSingleTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(PingSingleTxOp)
+
+  PingSingleTxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<std::shared_ptr<ValueData>>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    op_output.emit(std::make_shared<ValueData>(index_++), "out");
+  };
+
+ private:
+  int index_ = 0;
+};
+
+class PingCountRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(PingCountRxOp)
+
+  PingCountRxOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.input<std::shared_ptr<ValueData>>("in"); }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto value = op_input.receive<std::shared_ptr<ValueData>>("in").value();
+    if (value && value->data() == count_) { ++count_; }
+  };
+
+  int count() const { return count_; }
+
+ private:
+  int count_ = 0;
+};
+
 }  // namespace holoscan::ops
 
 class MyPingApp : public holoscan::Application {
@@ -146,3 +201,50 @@ TEST(PingMultiPort, TestMultipleRunPingMultiPortApp) {
     EXPECT_NO_THROW(app->run()) << fmt::format("Failed on iteration: {}", i);
   }
 }
+
+namespace {
+
+constexpr int kChainLength = 16;
+constexpr int kChainMessageCount = 20000;
+
+// tx -> forward_0 -> ... -> forward_{kChainLength - 1} -> rx
+class PingChainApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+
+    auto tx = make_operator<ops::PingSingleTxOp>(
+        "tx", make_condition<CountCondition>(kChainMessageCount));
+    std::shared_ptr<Operator> previous = tx;
+    for (int i = 0; i < kChainLength; ++i) {
+      auto forward = make_operator<ops::PingForwardOp>("forward_" + std::to_string(i));
+      add_flow(previous, forward);
+      previous = forward;
+    }
+    rx_ = make_operator<ops::PingCountRxOp>("rx");
+    add_flow(previous, rx_);
+  }
+
+  std::shared_ptr<holoscan::ops::PingCountRxOp> rx_;
+};
+
+}  // namespace
+
+TEST(PingMultiPort, TestTickOverhead) {
+  auto app = holoscan::make_application<PingChainApp>();
+
+  auto start = std::chrono::steady_clock::now();
+  app->run();
+  auto duration = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(app->rx_->count(), kChainMessageCount);
+
+  // Every operator of the chain (tx, forward operators and rx) ticks once per message. The
+  // operators do no work, so this is the framework overhead of a tick (scheduling, execution
+  // context, receive and emit), including the application setup amortized over all the ticks.
+  const double tick_count = static_cast<double>(kChainMessageCount) * (kChainLength + 2);
+  const double ns_per_tick =
+      std::chrono::duration<double, std::nano>(duration).count() / tick_count;
+  HOLOSCAN_LOG_INFO("{:>12} {:>14} {:>14}", "ticks", "ns/tick", "ticks/s");
+  HOLOSCAN_LOG_INFO("{:>12.0f} {:>14.1f} {:>14.0f}", tick_count, ns_per_tick, 1e9 / ns_per_tick);
+}
@@ -0,0 +1,187 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <any>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <holoscan/holoscan.hpp>
+
+namespace {
+
+// Number of heap allocations made by the process (all threads)
+std::atomic<uint64_t> allocation_count{0};
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) { return ptr; }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+namespace holoscan::ops {
+
+// How the receiver operators receive the values
+enum class ReceiveMode {
+  kTyped,  ///< receive<std::shared_ptr<int64_t>>()
+  kAny,    ///< receive<std::any>() followed by std::any_cast
+};
+
+struct ReceiveStats {
+  int64_t receive_count = 0;
+  uint64_t allocations = 0;
+  std::chrono::nanoseconds duration{0};
+};
+
+class ReceiveTxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(ReceiveTxOp)
+
+  ReceiveTxOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.output<std::shared_ptr<int64_t>>("out1");
+    spec.output<std::shared_ptr<int64_t>>("out2");
+  }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    op_output.emit(std::make_shared<int64_t>(index_), "out1");
+    op_output.emit(std::make_shared<int64_t>(index_), "out2");
+    ++index_;
+  }
+
+ private:
+  int64_t index_ = 0;
+};
+
+class ReceiveRxOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(ReceiveRxOp)
+
+  ReceiveRxOp() = default;
+  explicit ReceiveRxOp(ReceiveMode mode) : mode_(mode) {}
+
+  void setup(OperatorSpec& spec) override {
+    spec.input<std::shared_ptr<int64_t>>("in");
+    spec.param(receivers_, "receivers", "Input Receivers", "List of input receivers.", {});
+  }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    uint64_t start_count = allocation_count.load(std::memory_order_relaxed);
+    auto start = std::chrono::steady_clock::now();
+    std::shared_ptr<int64_t> value;
+    std::vector<std::shared_ptr<int64_t>> values;
+    if (mode_ == ReceiveMode::kTyped) {
+      value = op_input.receive<std::shared_ptr<int64_t>>("in").value();
+      values = op_input.receive<std::vector<std::shared_ptr<int64_t>>>("receivers").value();
+    } else {
+      value = std::any_cast<std::shared_ptr<int64_t>>(op_input.receive<std::any>("in").value());
+      for (auto& any_value : op_input.receive<std::vector<std::any>>("receivers").value()) {
+        values.push_back(std::any_cast<std::shared_ptr<int64_t>>(any_value));
+      }
+    }
+    stats_.duration += std::chrono::steady_clock::now() - start;
+    stats_.allocations += allocation_count.load(std::memory_order_relaxed) - start_count;
+
+    if (value && values.size() == 1 && values[0] && *value == stats_.receive_count &&
+        *values[0] == stats_.receive_count) {
+      ++stats_.receive_count;
+    }
+  }
+
+  const ReceiveStats& stats() const { return stats_; }
+
+ private:
+  ReceiveMode mode_ = ReceiveMode::kTyped;
+  Parameter<std::vector<IOSpec*>> receivers_;
+  ReceiveStats stats_;
+};
+
+}  // namespace holoscan::ops
+
+namespace {
+
+constexpr int64_t kMessageCount = 100000;
+
+class ReceiveApp : public holoscan::Application {
+ public:
+  explicit ReceiveApp(holoscan::ops::ReceiveMode mode) : mode_(mode) {}
+
+  void compose() override {
+    using namespace holoscan;
+
+    auto tx = make_operator<ops::ReceiveTxOp>("tx", make_condition<CountCondition>(kMessageCount));
+    rx_ = make_operator<ops::ReceiveRxOp>("rx", mode_);
+    add_flow(tx, rx_, {{"out1", "in"}, {"out2", "receivers"}});
+  }
+
+  std::shared_ptr<holoscan::ops::ReceiveRxOp> rx_;
+
+ private:
+  holoscan::ops::ReceiveMode mode_;
+};
+
+holoscan::ops::ReceiveStats run_receive_app(holoscan::ops::ReceiveMode mode) {
+  auto app = holoscan::make_application<ReceiveApp>(mode);
+  app->run();
+
+  auto& stats = app->rx_->stats();
+  EXPECT_EQ(stats.receive_count, kMessageCount);
+  return stats;
+}
+
+}  // namespace
+
+TEST(Receive, TestTypedReceive) {
+  using holoscan::ops::ReceiveMode;
+  auto any_stats = run_receive_app(ReceiveMode::kAny);
+  auto typed_stats = run_receive_app(ReceiveMode::kTyped);
+
+  // Each compute() call receives from the "in" port and the "receivers" parameter
+  constexpr double kReceiveCount = 2.0 * kMessageCount;
+  HOLOSCAN_LOG_INFO("{:>10} {:>20} {:>14} {:>14}", "receive", "allocations/receive", "ns/receive",
+                    "receives/s");
+  for (const auto& [label, stats] : {std::pair{"std::any", any_stats},
+                                     std::pair{"typed", typed_stats}}) {
+    double seconds = std::chrono::duration<double>(stats.duration).count();
+    HOLOSCAN_LOG_INFO("{:>10} {:>20.2f} {:>14.1f} {:>14.0f}",
+                      label,
+                      stats.allocations / kReceiveCount,
+                      seconds * 1e9 / kReceiveCount,
+                      kReceiveCount / seconds);
+  }
+
+  // The typed path copies the value out of the message instead of copying a std::any
+  EXPECT_LT(typed_stats.allocations, any_stats.allocations);
+}
@@ -169,6 +169,40 @@ TEST(DistributedApp, TestUCXBroadCastMultiReceiverApp) {
   EXPECT_TRUE(log_output.find("Rx fragment4.rx message received count: 10") != std::string::npos);
 }
 
+TEST(DistributedApp, TestShmTransportLinearPipelineApp) {
+  // All fragments run in the same process, so shared memory is used for every connection
+  EnvVarWrapper wrapper("HOLOSCAN_SHM_TRANSPORT", "true");
+
+  auto app = make_application<UCXLinearPipelineApp>();
+
+  testing::internal::CaptureStderr();
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("received count: 20") != std::string::npos)
+      << "=== LOG ===\n"
+      << log_output << "\n===========\n";
+}
+
+TEST(DistributedApp, TestShmTransportBroadCastMultiReceiverApp) {
+  EnvVarWrapper wrapper({{"HOLOSCAN_SHM_TRANSPORT", "true"}, {"HOLOSCAN_SHM_SLOT_SIZE", "1Mi"}});
+
+  auto app = make_application<UCXBroadCastMultiReceiverApp>();
+
+  // capture output so that we can check that the expected value is present
+  testing::internal::CaptureStderr();
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("RxParam fragment2.rx message received (count: 10, size: 2)") !=
+              std::string::npos)
+      << "=== LOG ===\n"
+      << log_output << "\n===========\n";
+  EXPECT_TRUE(log_output.find("Rx fragment4.rx message received count: 10") != std::string::npos);
+}
+
 TEST(DistributedApp, TestDriverTerminationWithConnectionFailure) {
   const char* env_orig = std::getenv("HOLOSCAN_MAX_CONNECTION_RETRY_COUNT");
 
@@ -17,8 +17,10 @@
 
 #include <gtest/gtest.h>
 
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "holoscan/holoscan.hpp"
 #include <holoscan/operators/bayer_demosaic/bayer_demosaic.hpp>
@@ -81,3 +83,99 @@ TEST(MultithreadedApp, TestSendingTensorToMultipleOperators) {
       << "=== LOG ===\n"
       << log_output << "\n===========\n";
 }
+
+TEST(MultithreadedApp, TestSendingTensorToMultipleOperatorsWithWorkStealing) {
+  using namespace holoscan;
+
+  EnvVarWrapper wrapper({
+      std::make_pair("HOLOSCAN_LOG_LEVEL", "DEBUG"),
+      std::make_pair("HOLOSCAN_EXECUTOR_LOG_LEVEL", "INFO"),
+  });
+
+  auto app = make_application<PingMultithreadApp>();
+
+  // capture output to check that the expected messages were logged
+  testing::internal::CaptureStderr();
+
+  // pin the transmitter to the first worker, the receivers can run on any worker
+  auto scheduler = app->make_scheduler<WorkStealingScheduler>(
+      "work-stealing-scheduler",
+      Arg{"worker_thread_number", static_cast<int64_t>(NUM_RX)},
+      Arg{"stop_on_deadlock_timeout", 100L},  // should be > check_recession_period_ms
+      Arg{"operator_affinity", std::vector<std::string>{"tx:0"}});
+  app->scheduler(scheduler);
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("null data") == std::string::npos);
+  for (int i = 1; i <= NUM_RX; ++i) {
+    EXPECT_TRUE(log_output.find(fmt::format(
+                    "Rx message value - name:rx{}, data[0]:{}, nbytes:2048", i, NUM_ITER)) !=
+                std::string::npos)
+        << "=== LOG ===\n"
+        << log_output << "\n===========\n";
+  }
+
+  // Each operator is executed at least once per message (tx: NUM_ITER, rx: NUM_RX * NUM_ITER)
+  auto stats = scheduler->stats();
+  EXPECT_GE(stats.executions, static_cast<uint64_t>((NUM_RX + 1) * NUM_ITER));
+  EXPECT_EQ(stats.executions, stats.local_pops + stats.steals);
+}
+
+TEST(MultithreadedApp, TestApplicationsSharingWorkerPool) {
+  using namespace holoscan;
+
+  EnvVarWrapper wrapper({
+      std::make_pair("HOLOSCAN_LOG_LEVEL", "DEBUG"),
+      std::make_pair("HOLOSCAN_EXECUTOR_LOG_LEVEL", "INFO"),
+  });
+
+  // Two applications (each with its own GXF context, like two fragments of a distributed
+  // application running in the same process) executed by the same workers
+  auto app1 = make_application<PingMultithreadApp>();
+  auto app2 = make_application<PingMultithreadApp>();
+  std::vector<std::shared_ptr<WorkStealingScheduler>> schedulers;
+  int64_t priority = 0;
+  for (auto& app : {app1, app2}) {
+    auto scheduler = app->make_scheduler<WorkStealingScheduler>(
+        "work-stealing-scheduler",
+        Arg{"worker_thread_number", static_cast<int64_t>(NUM_RX)},
+        Arg{"stop_on_deadlock_timeout", 100L},
+        Arg{"shared_pool", std::string("test_pool")},
+        Arg{"pool_priority", priority++},
+        Arg{"pool_max_workers", static_cast<int64_t>(NUM_RX - 1)});
+    app->scheduler(scheduler);
+    schedulers.push_back(scheduler);
+  }
+
+  // capture output to check that the expected messages were logged
+  testing::internal::CaptureStderr();
+
+  auto future1 = app1->run_async();
+  auto future2 = app2->run_async();
+  future1.get();
+  future2.get();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("null data") == std::string::npos);
+  EXPECT_TRUE(log_output.find("using shared worker pool 'test_pool'") != std::string::npos)
+      << "=== LOG ===\n"
+      << log_output << "\n===========\n";
+  for (int i = 1; i <= NUM_RX; ++i) {
+    const auto expected = fmt::format(
+        "Rx message value - name:rx{}, data[0]:{}, nbytes:2048", i, NUM_ITER);
+    // the message is logged once by each application
+    const auto first = log_output.find(expected);
+    ASSERT_TRUE(first != std::string::npos) << "=== LOG ===\n" << log_output << "\n===========\n";
+    EXPECT_TRUE(log_output.find(expected, first + 1) != std::string::npos)
+        << "=== LOG ===\n"
+        << log_output << "\n===========\n";
+  }
+
+  for (auto& scheduler : schedulers) {
+    auto stats = scheduler->stats();
+    EXPECT_GE(stats.executions, static_cast<uint64_t>((NUM_RX + 1) * NUM_ITER));
+    EXPECT_EQ(stats.executions, stats.local_pops + stats.steals);
+  }
+}
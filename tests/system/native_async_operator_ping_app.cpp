@@ -69,6 +69,20 @@ class AsyncTxRxApp : public holoscan::Application {
   }
 };
 
+class AsyncTxRxReactorApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    // a single reactor thread drives the asynchronous conditions of both operators
+    auto reactor = make_resource<EventReactor>("reactor");
+    auto tx = make_operator<ops::AsyncPingTxOp>(
+        "tx", Arg("delay", 10L), Arg("count", 5UL), Arg("reactor", reactor));
+    auto rx = make_operator<ops::AsyncPingRxOp>("rx", Arg("delay", 10L), Arg("reactor", reactor));
+
+    add_flow(tx, rx);
+  }
+};
+
 class ParameterizedAsyncPingTestFixture : public ::testing::TestWithParam<bool> {};
 
 INSTANTIATE_TEST_CASE_P(AsyncPingApps, ParameterizedAsyncPingTestFixture,
@@ -150,4 +164,28 @@ TEST_P(ParameterizedAsyncPingTestFixture, TestAsyncTxRxApp) {
       << log_output << "\n===========\n";
 }
 
+TEST_P(ParameterizedAsyncPingTestFixture, TestAsyncTxRxReactorApp) {
+  auto app = make_application<AsyncTxRxReactorApp>();
+
+  auto multithreaded = GetParam();
+  if (multithreaded) {
+    app->scheduler(app->make_scheduler<holoscan::MultiThreadScheduler>(
+        "multithread-scheduler", holoscan::Arg("stop_on_deadlock", true)));
+  }
+
+  // capture output so that we can check that the expected value is present
+  testing::internal::CaptureStderr();
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("Rx message value: 5") != std::string::npos)
+      << "=== LOG ===\n"
+      << log_output << "\n===========\n";
+
+  // the operators do not spawn their own threads
+  EXPECT_TRUE(log_output.find("Async ping tx thread entering") == std::string::npos);
+  EXPECT_TRUE(log_output.find("Async ping rx thread entering") == std::string::npos);
+}
+
 }  // namespace holoscan
@@ -18,7 +18,9 @@
 #include <gtest/gtest.h>
 #include <gxf/core/gxf.h>
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <holoscan/holoscan.hpp>
 
@@ -98,6 +100,56 @@ class ForwardTestOpTwoInputs : public Operator {
   }
 };
 
+/// @brief emits an increasing integer on each tick
+class IntTxTestOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(IntTxTestOp)
+
+  IntTxTestOp() = default;
+
+  void setup(OperatorSpec& spec) override { spec.output<int>("out"); }
+
+  void compute(InputContext&, OutputContext& op_output, ExecutionContext&) override {
+    int value = count_++;
+    op_output.emit(value, "out");
+  }
+
+ private:
+  int count_ = 0;
+};
+
+/// @brief receives the integers in batches of up to `kMaxBatchSize` messages
+class BatchRxTestOp : public Operator {
+ public:
+  HOLOSCAN_OPERATOR_FORWARD_ARGS(BatchRxTestOp)
+
+  static constexpr int64_t kMaxBatchSize = 4;
+
+  BatchRxTestOp() = default;
+
+  void setup(OperatorSpec& spec) override {
+    spec.input<int>("in")
+        .connector(IOSpec::ConnectorType::kDoubleBuffer,
+                   Arg("capacity", static_cast<uint64_t>(kMaxBatchSize)))
+        .condition(ConditionType::kBatchMessageAvailable,
+                   Arg("max_batch_size", kMaxBatchSize),
+                   Arg("max_delay_ns", static_cast<int64_t>(5'000'000)));
+  }
+
+  void compute(InputContext& op_input, OutputContext&, ExecutionContext&) override {
+    auto batch = op_input.receive_batch<int>("in").value();
+    batch_sizes_.push_back(batch.size());
+    values_.insert(values_.end(), batch.begin(), batch.end());
+  }
+
+  const std::vector<size_t>& batch_sizes() const { return batch_sizes_; }
+  const std::vector<int>& values() const { return values_; }
+
+ private:
+  std::vector<size_t> batch_sizes_;
+  std::vector<int> values_;
+};
+
 }  // namespace
 
 class NativeOpApp : public holoscan::Application {
@@ -160,6 +212,19 @@ class NativeForwardOpAppDanglingInput : public holoscan::Application {
   }
 };
 
+class NativeBatchRxApp : public holoscan::Application {
+ public:
+  void compose() override {
+    using namespace holoscan;
+    auto tx = make_operator<IntTxTestOp>("tx", make_condition<CountCondition>(10));
+    rx_ = make_operator<BatchRxTestOp>("rx");
+
+    add_flow(tx, rx_);
+  }
+
+  std::shared_ptr<BatchRxTestOp> rx_;
+};
+
 TEST(NativeOperatorPingApp, TestNativeOperatorPingApp) {
   auto app = make_application<NativeOpApp>();
 
@@ -192,6 +257,59 @@ TEST(NativeOperatorPingApp, TestNativeOperatorForwardApp) {
   EXPECT_TRUE(log_output.find("value2: 100") != std::string::npos);
 }
 
+TEST(NativeOperatorPingApp, TestNativeOperatorForwardAppStats) {
+  auto app = make_application<NativeForwardOpApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+  app->enable_operator_stats();
+
+  // capture output so that we can check that the statistics are printed
+  testing::internal::CaptureStderr();
+
+  app->run();
+
+  std::string log_output = testing::internal::GetCapturedStderr();
+  EXPECT_TRUE(log_output.find("Operator statistics") != std::string::npos);
+
+  auto stats = app->operator_stats();
+  ASSERT_EQ(stats.size(), 3);
+  for (const auto& op_stats : stats) {
+    EXPECT_EQ(op_stats.num_ticks, 10) << op_stats.operator_name;
+    EXPECT_EQ(op_stats.num_failed_ticks, 0) << op_stats.operator_name;
+    EXPECT_LE(op_stats.min_compute_time_us, op_stats.max_compute_time_us);
+    if (op_stats.operator_name == "mx") {
+      ASSERT_EQ(op_stats.inputs.size(), 1);
+      EXPECT_EQ(op_stats.inputs[0].name, "data");
+      EXPECT_GE(op_stats.inputs[0].max_queue_size, 1);
+      ASSERT_EQ(op_stats.outputs.size(), 1);
+      EXPECT_EQ(op_stats.outputs[0].num_messages, 10);
+    } else if (op_stats.operator_name == "tx") {
+      ASSERT_EQ(op_stats.outputs.size(), 2);
+      for (const auto& port : op_stats.outputs) { EXPECT_EQ(port.num_messages, 10); }
+    }
+  }
+}
+
+TEST(NativeOperatorPingApp, TestNativeBatchReceiveApp) {
+  auto app = make_application<NativeBatchRxApp>();
+
+  const std::string config_file = test_config.get_test_data_file("minimal.yaml");
+  app->config(config_file);
+
+  app->run();
+
+  // All the messages are received in order, in batches of at most kMaxBatchSize messages (the
+  // last partial batch is flushed by the delay)
+  const auto& values = app->rx_->values();
+  ASSERT_EQ(values.size(), 10);
+  for (int i = 0; i < 10; ++i) { EXPECT_EQ(values[i], i); }
+  for (auto batch_size : app->rx_->batch_sizes()) {
+    EXPECT_GE(batch_size, 1);
+    EXPECT_LE(batch_size, static_cast<size_t>(BatchRxTestOp::kMaxBatchSize));
+  }
+}
+
 TEST(NativeOperatorPingApp, TestNativeForwardOpAppDanglingOutput) {
   auto app = make_application<NativeForwardOpAppDanglingOutput>();
 